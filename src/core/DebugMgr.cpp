@@ -41,6 +41,8 @@
 
 #include "ctype.h"				// isspace, isdigit, isxdigit
 
+#include <algorithm>			// lower_bound, max, min
+
 using namespace std;
 
 #define PRINTF	if (!LogHLDebugger ()) ; else LogAppendMsg
@@ -74,6 +76,13 @@ static const char*	PrvSkipWhite			(const char* p);
 static Bool			PrvParseDecimal			(const char **ps, int *i);
 static Bool			PrvParseUnsigned		(const char **ps, uint32 *u);
 
+static void			PrvDeleteCondition		(BreakpointCondition* cond);
+static Bool			PrvWatchpointBefore		(const EmWatchpointType& wp, emuptr addr);
+static void			PrvClearWatchpoints		(void);
+static void			PrvUpdateWatchSummary	(void);
+static void			PrvSnapshotWatchpoint	(EmWatchpointType& wp);
+static uint32		PrvWatchedValue			(const EmWatchpointType& wp);
+
 
 // ---------------------------------------------------------------------------
 #pragma mark ===== Constants
@@ -94,6 +103,7 @@ static Bool			PrvParseUnsigned		(const char **ps, uint32 *u);
 // ----- Saved variables -----------------------------------------------------
 
 DebugGlobalsType		gDebuggerGlobals;
+static EmWatchpointList	gWatchpoints;
 
 
 // ----- UnSaved variables ---------------------------------------------------
@@ -113,6 +123,12 @@ emuptr	gExceptionAddress;
 int		gExceptionSize;
 Bool	gExceptionForRead;
 
+static uint32	gWatchMaxBytes;		// Longest range in gWatchpoints
+static int32	gWatchNextID = 1;
+static int32	gStepSpyID;			// Watchpoint standing in for the step spy, or 0
+static int32	gDataBreakID;		// Watchpoint for watchAddr/watchBytes, or 0
+static Bool		gInDataBreak;		// Set while we read watched memory ourselves
+
 
 // If we're listening for a debugger connection, the first three sockets
 // contain references to those listening entities.	As soon as a connection
@@ -316,12 +332,19 @@ void Debug::Initialize (void)
 {
 	memset (&gDebuggerGlobals, 0, sizeof (gDebuggerGlobals));
 
+	::PrvClearWatchpoints ();
+
 	EmAssert (gSession);
 	gSession->AddInstructionBreakHandlers (
 				InstallInstructionBreaks,
 				RemoveInstructionBreaks,
 				HandleInstructionBreak);
 
+	gSession->AddDataBreakHandlers (
+				InstallDataBreaks,
+				RemoveDataBreaks,
+				HandleDataBreak);
+
 	// Install functions that will cause the CPU loop to exit if we're
 	// connected to an external debugger.
 
@@ -418,7 +441,7 @@ void Debug::Reset (void)
 
 void Debug::Save (SessionFile& f)
 {
-	const int32	kCurrentVersion = 1;
+	const int32	kCurrentVersion = 2;
 
 	Chunk			chunk;
 	EmStreamChunk	s (chunk);
@@ -475,6 +498,25 @@ void Debug::Save (SessionFile& f)
 	s << gDebuggerGlobals.watchAddr;
 	s << gDebuggerGlobals.watchBytes;
 
+	// Version 2: data watchpoints.  The ones standing in for the step spy
+	// and watchAddr are rebuilt from the fields above.
+
+	s << (int32) (gWatchpoints.size () - (gStepSpyID ? 1 : 0) - (gDataBreakID ? 1 : 0));
+
+	EmWatchpointList::iterator	iter = gWatchpoints.begin ();
+	while (iter != gWatchpoints.end ())
+	{
+		if (iter->id != gStepSpyID && iter->id != gDataBreakID)
+		{
+			s << iter->addr;
+			s << iter->bytes;
+			s << iter->flags;
+			s << (iter->condition ? iter->condition->source : "");
+		}
+
+		++iter;
+	}
+
 	f.WriteDebugInfo (chunk);
 }
 
@@ -501,6 +543,11 @@ void Debug::Load (SessionFile& f)
 		Debug::DeleteBreakpointCondition (ii);
 	}
 
+	// Meta-memory is about to be replaced, too, so just forget the
+	// watchpoints rather than unmarking them.
+
+	::PrvClearWatchpoints ();
+
 	// Load the new state.
 
 	Chunk	chunk;
@@ -564,6 +611,35 @@ void Debug::Load (SessionFile& f)
 			s >> gDebuggerGlobals.watchAddr;
 			s >> gDebuggerGlobals.watchBytes;
 		}
+
+		if (version >= 2)
+		{
+			int32	count;
+			s >> count;
+
+			for (int32 ii = 0; ii < count; ++ii)
+			{
+				emuptr	addr;
+				uint32	bytes;
+				uint32	flags;
+				string	source;
+
+				s >> addr;
+				s >> bytes;
+				s >> flags;
+				s >> source;
+
+				BreakpointCondition*	bc = NULL;
+				if (source.size () > 0)
+				{
+					bc = NewBreakpointCondition (source.c_str ());
+				}
+
+				Debug::AddWatchpoint (addr, bytes, flags, bc);
+			}
+		}
+
+		Debug::UpdateDataBreaks ();
 	}
 	else
 	{
@@ -592,6 +668,8 @@ void Debug::Dispose (void)
 	{
 		Debug::DeleteBreakpointCondition (ii);
 	}
+
+	::PrvClearWatchpoints ();
 }
 
 
@@ -1537,15 +1615,12 @@ void Debug::SetBreakpoint (int index, emuptr addr, BreakpointCondition* c)
 {
 	Debug::ClearBreakpoint (index);
 
-	EmAssert (gSession);
-	gSession->RemoveInstructionBreaks ();
-
 	gDebuggerGlobals.bp[index].enabled		= true;
 	gDebuggerGlobals.bp[index].installed	= false;
 	gDebuggerGlobals.bp[index].addr			= (MemPtr)(uintptr_t) addr;
 	gDebuggerGlobals.bpCondition[index]		= c;
 
-	gSession->InstallInstructionBreaks ();
+	MetaMemory::MarkInstructionBreak (addr);
 }
 
 
@@ -1563,15 +1638,15 @@ void Debug::SetBreakpoint (int index, emuptr addr, BreakpointCondition* c)
 
 void Debug::ClearBreakpoint (int index)
 {
-	EmAssert (gSession);
-	gSession->RemoveInstructionBreaks ();
+	if (gDebuggerGlobals.bp[index].enabled)
+	{
+		MetaMemory::UnmarkInstructionBreak ((emuptr)(uintptr_t) gDebuggerGlobals.bp[index].addr);
+	}
 
 	gDebuggerGlobals.bp[index].enabled = false;
 	gDebuggerGlobals.bp[index].addr = NULL;
 
 	Debug::DeleteBreakpointCondition (index);
-
-	gSession->InstallInstructionBreaks ();
 }
 
 /***********************************************************************
@@ -1590,16 +1665,8 @@ void Debug::DeleteBreakpointCondition (int index)
 {
 	BreakpointCondition*&	cond = gDebuggerGlobals.bpCondition[index];
 
-	if (cond)
-	{
-		if (cond->source)
-		{
-			free (cond->source);
-		}
-
-		delete cond;
-		cond = NULL;
-	}
+	::PrvDeleteCondition (cond);
+	cond = NULL;
 }
 
 
@@ -1631,6 +1698,291 @@ Bool Debug::BreakpointInstalled (void)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	Debug::AddWatchpoint
+ *
+ * DESCRIPTION: Start watching the given range of memory for the kinds
+ *				of access in "flags".  Takes ownership of the condition,
+ *				which may be NULL.
+ *
+ * PARAMETERS:	addr, bytes - the range to watch.
+ *
+ *				flags - kWatchRead, kWatchWrite, and/or kWatchChange.
+ *
+ *				c - condition that must also hold for the break to be
+ *					reported, or NULL.
+ *
+ * RETURNED:	An ID to pass to RemoveWatchpoint, or 0 if the range
+ *				or flags are invalid.
+ *
+ ***********************************************************************/
+
+int32 Debug::AddWatchpoint (emuptr addr, uint32 bytes, uint32 flags,
+							BreakpointCondition* c)
+{
+	flags &= kWatchRead | kWatchWrite | kWatchChange;
+
+	if (bytes == 0 || flags == 0 || addr + bytes < addr)
+	{
+		::PrvDeleteCondition (c);
+		return 0;
+	}
+
+	EmWatchpointType	wp;
+
+	wp.id			= gWatchNextID++;
+	wp.addr			= addr;
+	wp.bytes		= bytes;
+	wp.flags		= flags;
+	wp.condition	= c;
+
+	EmWatchpointList::iterator	iter = lower_bound (gWatchpoints.begin (),
+		gWatchpoints.end (), addr, ::PrvWatchpointBefore);
+
+	iter = gWatchpoints.insert (iter, wp);
+
+	::PrvSnapshotWatchpoint (*iter);
+	::PrvUpdateWatchSummary ();
+
+	MetaMemory::MarkDataBreak (addr, addr + bytes);
+
+	return wp.id;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Debug::RemoveWatchpoint
+ *
+ * DESCRIPTION: Stop watching the range set up by AddWatchpoint.
+ *
+ * PARAMETERS:	id - the value returned by AddWatchpoint.
+ *
+ * RETURNED:	TRUE if there was such a watchpoint.
+ *
+ ***********************************************************************/
+
+Bool Debug::RemoveWatchpoint (int32 id)
+{
+	EmWatchpointList::iterator	iter = gWatchpoints.begin ();
+	while (iter != gWatchpoints.end () && iter->id != id)
+	{
+		++iter;
+	}
+
+	if (iter == gWatchpoints.end ())
+		return false;
+
+	emuptr	begin	= iter->addr;
+	emuptr	end		= iter->addr + iter->bytes;
+
+	::PrvDeleteCondition (iter->condition);
+	gWatchpoints.erase (iter);
+	::PrvUpdateWatchSummary ();
+
+	MetaMemory::UnmarkDataBreak (begin, end);
+
+	// Other watchpoints may share some of those bytes; mark them again.
+
+	iter = gWatchpoints.begin ();
+	while (iter != gWatchpoints.end () && iter->addr < end)
+	{
+		if (iter->addr + iter->bytes > begin)
+		{
+			MetaMemory::MarkDataBreak (iter->addr, iter->addr + iter->bytes);
+		}
+
+		++iter;
+	}
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Debug::RemoveAllWatchpoints
+ *
+ * DESCRIPTION: Remove all watchpoints, including the ones standing in
+ *				for the step spy and the data breakpoint.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void Debug::RemoveAllWatchpoints (void)
+{
+	Debug::RemoveDataBreaks ();
+
+	::PrvClearWatchpoints ();
+
+	gDebuggerGlobals.stepSpy		= false;
+	gDebuggerGlobals.watchEnabled	= false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Debug::UpdateDataBreaks
+ *
+ * DESCRIPTION: Bring the watchpoints for the step spy and the data
+ *				breakpoint up to date with gDebuggerGlobals.  Call
+ *				after changing stepSpy, ssAddr, ssValue, watchEnabled,
+ *				watchAddr, or watchBytes.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void Debug::UpdateDataBreaks (void)
+{
+	if (gStepSpyID)
+	{
+		Debug::RemoveWatchpoint (gStepSpyID);
+		gStepSpyID = 0;
+	}
+
+	if (gDataBreakID)
+	{
+		Debug::RemoveWatchpoint (gDataBreakID);
+		gDataBreakID = 0;
+	}
+
+	if (gDebuggerGlobals.stepSpy)
+	{
+		gStepSpyID = Debug::AddWatchpoint (gDebuggerGlobals.ssAddr,
+			sizeof (uint32), kWatchChange, NULL);
+
+		// The step spy compares against the value the debugger gave us,
+		// not against what's in memory now.
+
+		EmWatchpointList::iterator	iter = gWatchpoints.begin ();
+		while (iter != gWatchpoints.end ())
+		{
+			if (iter->id == gStepSpyID)
+			{
+				::PrvSnapshotWatchpoint (*iter);
+				break;
+			}
+
+			++iter;
+		}
+	}
+
+	if (gDebuggerGlobals.watchEnabled)
+	{
+		gDataBreakID = Debug::AddWatchpoint (gDebuggerGlobals.watchAddr,
+			gDebuggerGlobals.watchBytes, kWatchWrite, NULL);
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Debug::HandleDataBreak
+ *
+ * DESCRIPTION: Called (through EmSession::HandleDataBreak) by the RAM
+ *				bank handlers when an access touches bytes marked with
+ *				MetaMemory::MarkDataBreak.  Finds the watchpoints the
+ *				access overlaps and checks each of them.
+ *
+ * PARAMETERS:	address, size - the range accessed.
+ *
+ *				forRead - TRUE if this was a read.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void Debug::HandleDataBreak (emuptr address, int size, Bool forRead)
+{
+	// Ignore our own accesses while checking a watchpoint, and reads
+	// the emulator makes on its own behalf.
+
+	if (gInDataBreak || (forRead && CEnableFullAccess::AccessOK ()))
+		return;
+
+	gInDataBreak = true;
+
+	// The list is sorted by starting address, and no range is longer
+	// than gWatchMaxBytes, so only the entries starting in
+	// (address - gWatchMaxBytes, address + size) can overlap the access.
+
+	EmWatchpointList::iterator	iter = lower_bound (gWatchpoints.begin (),
+		gWatchpoints.end (), address + size, ::PrvWatchpointBefore);
+
+	while (iter != gWatchpoints.begin ())
+	{
+		--iter;
+
+		if (iter->addr + gWatchMaxBytes <= address)
+			break;
+
+		if (iter->addr + iter->bytes > address)
+		{
+			Debug::CheckWatchpoint (*iter, address, size, forRead);
+		}
+	}
+
+	gInDataBreak = false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Debug::InstallDataBreaks
+ *
+ * DESCRIPTION: Mark all watched ranges in meta-memory.  Called after
+ *				a reset or load wipes meta-memory out.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void Debug::InstallDataBreaks (void)
+{
+	EmWatchpointList::iterator	iter = gWatchpoints.begin ();
+	while (iter != gWatchpoints.end ())
+	{
+		::PrvSnapshotWatchpoint (*iter);
+		MetaMemory::MarkDataBreak (iter->addr, iter->addr + iter->bytes);
+
+		++iter;
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Debug::RemoveDataBreaks
+ *
+ * DESCRIPTION: Unmark all watched ranges in meta-memory.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void Debug::RemoveDataBreaks (void)
+{
+	EmWatchpointList::iterator	iter = gWatchpoints.begin ();
+	while (iter != gWatchpoints.end ())
+	{
+		MetaMemory::UnmarkDataBreak (iter->addr, iter->addr + iter->bytes);
+
+		++iter;
+	}
+}
+
+
 #pragma mark -
 
 /***********************************************************************
@@ -1688,49 +2040,174 @@ Bool Debug::MustBreakOnTrapSystemCall (uint16 trapWord, uint16 refNum)
 
 /***********************************************************************
  *
- * FUNCTION:	Debug::DoCheckStepSpy
+ * FUNCTION:	Debug::CheckWatchpoint
  *
- * DESCRIPTION: .
+ * DESCRIPTION: See if an access that overlaps the given watchpoint
+ *				should be reported, and report it if so.
  *
- * PARAMETERS:	.
+ * PARAMETERS:	wp - the watchpoint.
  *
- * RETURNED:	.
+ *				address, size - the range accessed.
+ *
+ *				forRead - TRUE if this was a read.
+ *
+ * RETURNED:	Nothing.
  *
  ***********************************************************************/
 
-void Debug::DoCheckStepSpy (emuptr writeAddress, int writeBytes)
+void Debug::CheckWatchpoint (EmWatchpointType& wp, emuptr address,
+							 int size, Bool forRead)
 {
-	CEnableFullAccess	munge;
+	uint32	wanted = forRead ? kWatchRead : (kWatchWrite | kWatchChange);
+
+	if ((wp.flags & wanted) == 0)
+		return;
+
+	// For change watchpoints, compare the bytes just written with the
+	// ones last seen.  Keep the saved copy current even if the condition
+	// doesn't hold, so that the next report shows the right old value.
+
+	Bool	changed		= false;
+	uint32	oldValue	= 0;
+
+	if (!forRead && (wp.flags & kWatchChange) != 0)
+	{
+		CEnableFullAccess	munge;
+
+		emuptr	begin	= max (address, wp.addr);
+		emuptr	end		= min ((emuptr) (address + size), wp.addr + wp.bytes);
+
+		oldValue = ::PrvWatchedValue (wp);
+
+		for (emuptr a = begin; a < end; ++a)
+		{
+			uint8	value = EmMemGet8 (a);
+			uint8&	saved = wp.value[a - wp.addr];
+
+			if (value != saved)
+			{
+				saved = value;
+				changed = true;
+			}
+		}
 
-	uint32	newValue = EmMemGet32 (gDebuggerGlobals.ssAddr);
-	if (newValue != gDebuggerGlobals.ssValue)
+		if (!changed && (wp.flags & kWatchWrite) == 0)
+			return;
+	}
+
+	if (wp.condition && !wp.condition->Evaluate ())
+		return;
+
+	if (changed && wp.bytes <= sizeof (uint32))
 	{
-		gSession->ScheduleDeferredError (new EmDeferredErrStepSpy (writeAddress, writeBytes,
-			gDebuggerGlobals.ssAddr, gDebuggerGlobals.ssValue, newValue));
+		gSession->ScheduleDeferredError (new EmDeferredErrStepSpy (address, size,
+			wp.addr, oldValue, ::PrvWatchedValue (wp)));
+	}
+	else
+	{
+		gSession->ScheduleDeferredError (new EmDeferredErrWatchpoint (address, size,
+			forRead, wp.addr, wp.bytes));
 	}
 }
 
 
-/***********************************************************************
- *
- * FUNCTION:	Debug::DoCheckWatchpoint
- *
- * DESCRIPTION: .
- *
- * PARAMETERS:	.
- *
- * RETURNED:	.
- *
- ***********************************************************************/
+////// watchpoint support
+
+void PrvDeleteCondition (BreakpointCondition* cond)
+{
+	if (cond)
+	{
+		if (cond->source)
+		{
+			free (cond->source);
+		}
+
+		delete cond;
+	}
+}
+
+Bool PrvWatchpointBefore (const EmWatchpointType& wp, emuptr addr)
+{
+	return wp.addr < addr;
+}
+
+void PrvClearWatchpoints (void)
+{
+	EmWatchpointList::iterator	iter = gWatchpoints.begin ();
+	while (iter != gWatchpoints.end ())
+	{
+		::PrvDeleteCondition (iter->condition);
+		++iter;
+	}
+
+	gWatchpoints.clear ();
+
+	gStepSpyID		= 0;
+	gDataBreakID	= 0;
+
+	::PrvUpdateWatchSummary ();
+}
 
-void Debug::DoCheckWatchpoint (emuptr writeAddress, int writeBytes)
+void PrvUpdateWatchSummary (void)
 {
-	if (writeAddress < gDebuggerGlobals.watchAddr + gDebuggerGlobals.watchBytes &&
-		writeAddress + writeBytes > gDebuggerGlobals.watchAddr)
+	gWatchMaxBytes = 0;
+
+	EmWatchpointList::iterator	iter = gWatchpoints.begin ();
+	while (iter != gWatchpoints.end ())
 	{
-		gSession->ScheduleDeferredError (new EmDeferredErrWatchpoint (writeAddress, writeBytes,
-			gDebuggerGlobals.watchAddr, gDebuggerGlobals.watchBytes));
+		gWatchMaxBytes = max (gWatchMaxBytes, iter->bytes);
+		++iter;
 	}
+
+	gDebuggerGlobals.watchCount = gWatchpoints.size ();
+}
+
+/* Record the current contents of a change watchpoint's range.  The step
+   spy's watchpoint takes the value the external debugger gave us instead. */
+
+void PrvSnapshotWatchpoint (EmWatchpointType& wp)
+{
+	if ((wp.flags & kWatchChange) == 0)
+		return;
+
+	wp.value.resize (wp.bytes);
+
+	if (wp.id == gStepSpyID)
+	{
+		for (uint32 ii = 0; ii < wp.bytes; ++ii)
+		{
+			wp.value[ii] = (uint8) (gDebuggerGlobals.ssValue >> (8 * (wp.bytes - 1 - ii)));
+		}
+
+		return;
+	}
+
+	CEnableFullAccess	munge;
+
+	Bool	wasInDataBreak = gInDataBreak;
+	gInDataBreak = true;
+
+	for (uint32 ii = 0; ii < wp.bytes; ++ii)
+	{
+		wp.value[ii] = EmMemGet8 (wp.addr + ii);
+	}
+
+	gInDataBreak = wasInDataBreak;
+}
+
+/* Return the saved contents of a change watchpoint of up to four bytes
+   as a big-endian value. */
+
+uint32 PrvWatchedValue (const EmWatchpointType& wp)
+{
+	uint32	result = 0;
+
+	for (size_t ii = 0; ii < wp.value.size () && ii < sizeof (uint32); ++ii)
+	{
+		result = (result << 8) | wp.value[ii];
+	}
+
+	return result;
 }
 
 
@@ -18,6 +18,8 @@
 #include "EmMemory.h"			// CEnableFullAccess
 #include "EmTypes.h"			// ErrCode
 
+#include <vector>				// vector
+
 // Types
 
 #pragma mark Types
@@ -84,6 +86,34 @@ struct EmBreakpointType
 	Boolean					installed;			// for alignment
 };
 
+// Data watchpoints.  Any number of them can be set, each watching a range
+// of RAM for reads, writes, or writes that change its contents, optionally
+// qualified by a BreakpointCondition.  The watched bytes are marked with
+// MetaMemory::MarkDataBreak, so only accesses to the 64K pages holding a
+// watchpoint leave the fast memory path.  The bank handlers pass accesses
+// to marked bytes to EmSession::HandleDataBreak, which ends up in
+// Debug::HandleDataBreak.  The step spy and the single data breakpoint
+// from the Breakpoints dialog are implemented as watchpoints, too.
+
+enum
+{
+	kWatchRead				= 0x01,				// break on reads
+	kWatchWrite				= 0x02,				// break on writes
+	kWatchChange			= 0x04				// break on writes that change the value
+};
+
+struct EmWatchpointType
+{
+	int32					id;					// handle returned by Debug::AddWatchpoint
+	emuptr					addr;				// first byte watched
+	uint32					bytes;				// number of bytes watched
+	uint32					flags;				// kWatchRead, kWatchWrite, kWatchChange
+	BreakpointCondition*	condition;			// condition, or NULL if none
+	std::vector<uint8>		value;				// contents last seen (kWatchChange)
+};
+
+typedef std::vector<EmWatchpointType>	EmWatchpointList;	// sorted by addr
+
 struct DebugGlobalsType
 {
 	// Mode settings
@@ -124,6 +154,11 @@ struct DebugGlobalsType
 	bool					watchEnabled;
 	emuptr			 		watchAddr;			// address to watch, or 0 if none
 	UInt32					watchBytes; 		// number of bytes to watch
+
+	// Number of data watchpoints (including the two above), so that the
+	// bank handlers can skip looking at meta-memory when there are none.
+
+	UInt32					watchCount;
 };
 
 // class Debug
@@ -160,7 +195,6 @@ class Debug
 		static Bool 			HandleSystemCall		(const SystemCallContext& context);
 		static ErrCode			EnterDebugger			(ExceptionNumber, SLP*);
 		static ErrCode			ExitDebugger			(void);
-		static void 			CheckStepSpy			(emuptr writeAddress, int writeBytes);
 
 		static void 			HandleInstructionBreak	(void);
 		static void 			InstallInstructionBreaks(void);
@@ -174,12 +208,22 @@ class Debug
 
 		static Bool				BreakpointInstalled		(void);
 
+		static int32			AddWatchpoint			(emuptr addr, uint32 bytes, uint32 flags,
+														 BreakpointCondition* c);
+		static Bool				RemoveWatchpoint		(int32 id);
+		static void				RemoveAllWatchpoints	(void);
+		static void				UpdateDataBreaks		(void);
+
+		static void				HandleDataBreak			(emuptr address, int size, Bool forRead);
+		static void				InstallDataBreaks		(void);
+		static void				RemoveDataBreaks		(void);
+
 	private:
 		static void 			ConditionalBreak		(void);
 		static Bool 			MustBreakOnTrapSystemCall	(uint16 trapWord, uint16 refNum);
 
-		static void 			DoCheckStepSpy			(emuptr writeAddress, int writeBytes);
-		static void 			DoCheckWatchpoint		(emuptr writeAddress, int writeBytes);
+		static void				CheckWatchpoint			(EmWatchpointType& wp, emuptr address,
+														 int size, Bool forRead);
 
 		static void 			EventCallback			(CSocket* s, int event);
 		static void 			CreateListeningSockets	(void);
@@ -187,23 +231,5 @@ class Debug
 };
 
 
-// This function is called from the memory setter functions. Make it inline so
-// that the common case where stepSpy == FALSE executes quickly.  Yes, this
-// _does_ make a difference.
-
-inline void Debug::CheckStepSpy (emuptr writeAddress, int writeBytes)
-{
-	if (gDebuggerGlobals.stepSpy)
-	{
-		Debug::DoCheckStepSpy (writeAddress, writeBytes);
-	}
-
-	if (gDebuggerGlobals.watchEnabled)
-	{
-		Debug::DoCheckWatchpoint (writeAddress, writeBytes);
-	}
-}
-
-
 #endif /* _DEBUGMGR_H_ */
 
@@ -90,6 +90,11 @@ kCommand[] =
 	{ kCommandTimerAccurate,	&EmApplication::DoTimerMode,	0						},
 	{ kCommandTimerLegacy,		&EmApplication::DoTimerMode,	0						},
 
+	{ kCommandCPUInterpreter,	&EmApplication::DoCPUEngine,	0						},
+	{ kCommandCPUBlocks,		&EmApplication::DoCPUEngine,	0						},
+
+	{ kCommandIdleFastForward,	&EmApplication::DoIdleFastForward,	0					},
+
 	{ kCommandSpeedQuarter,		&EmApplication::DoSetSpeed,		kStr_CmdSetSpeed		},
 	{ kCommandSpeedHalf,		&EmApplication::DoSetSpeed,		kStr_CmdSetSpeed		},
 	{ kCommandSpeed1x,			&EmApplication::DoSetSpeed,		kStr_CmdSetSpeed		},
@@ -1093,6 +1098,41 @@ void EmApplication::DoTimerMode (EmCommandID cmd)
 }
 
 
+// ---------------------------------------------------------------------------
+//		EmApplication::DoCPUEngine
+// ---------------------------------------------------------------------------
+// Switch between the interpreter and the predecoded block engine.  The CPU
+// thread picks up the change the next time it enters its loop.
+
+void EmApplication::DoCPUEngine (EmCommandID cmd)
+{
+	long engine = (cmd == kCommandCPUBlocks) ? kCPUEngineBlocks : kCPUEngineInterpreter;
+
+	Preference<long> p (kPrefKeyCPUEngine);
+	p = engine;
+
+	if (gSession)
+		gSession->fCPUEngine.store ((int) engine, std::memory_order_relaxed);
+}
+
+
+// ---------------------------------------------------------------------------
+//		EmApplication::DoIdleFastForward
+// ---------------------------------------------------------------------------
+// Toggle skipping over idle time while Gremlins, event replay, or
+// minimization are running.
+
+void EmApplication::DoIdleFastForward (EmCommandID)
+{
+	Preference<bool> p (kPrefKeyIdleFastForward);
+	bool fastForward = !*p;
+	p = fastForward;
+
+	if (gSession)
+		gSession->fIdleFastForward.store (fastForward, std::memory_order_relaxed);
+}
+
+
 // ---------------------------------------------------------------------------
 //		EmApplication::DoSpeedManual
 // ---------------------------------------------------------------------------
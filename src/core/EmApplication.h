@@ -197,6 +197,8 @@ class EmApplication : public EmActionHandler
 		void					DoBreakpoints		(EmCommandID);
 		void					DoSetSpeed			(EmCommandID);
 		void					DoTimerMode			(EmCommandID);
+		void					DoCPUEngine			(EmCommandID);
+		void					DoIdleFastForward	(EmCommandID);
 		void					DoSpeedManual		(EmCommandID);
 		void					DoReplay			(EmCommandID);
 		void					DoMinimize			(EmCommandID);
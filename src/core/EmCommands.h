@@ -78,6 +78,11 @@ enum EmCommandID
 	kCommandTimerAccurate,
 	kCommandTimerLegacy,
 
+	kCommandCPUInterpreter,
+	kCommandCPUBlocks,
+
+	kCommandIdleFastForward,
+
 	kCommandSpeedQuarter,
 	kCommandSpeedHalf,
 	kCommandSpeed1x,
@@ -51,6 +51,7 @@
 #include "EmROMReader.h"		// EmROMReader
 #include "EmStreamFile.h"		// EmStreamFile
 #include "Miscellaneous.h"		// StMemory
+#include "Profiling.h"			// EmWaitStates
 
 #include "PalmPack.h"
 #define NON_PORTABLE
@@ -1206,6 +1207,51 @@ long EmDevice::HardwareSubID (void) const
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:    EmDevice::GetWaitStates
+ *
+ * DESCRIPTION: Returns the number of wait states the device's memory
+ *				and peripherals add to each bus access.  Used by the
+ *				profiler to count cycles.
+ *
+ * PARAMETERS:  waitStates - receives the values.
+ *
+ * RETURNED:    Nothing.
+ *
+ ***********************************************************************/
+
+void EmDevice::GetWaitStates (EmWaitStates& waitStates) const
+{
+	// The MC68328 devices ran their ROM and RAM slower than the
+	// later ones.  (The Palm VII values are unconfirmed.)
+
+	if (fDeviceID == kDevicePalmVII)
+	{
+		waitStates.fROM			= 1;
+		waitStates.fSRAM		= 2;
+		waitStates.fDRAM		= 2;
+	}
+	else if (this->Supports68328 ())
+	{
+		waitStates.fROM			= 2;
+		waitStates.fSRAM		= 4;
+		waitStates.fDRAM		= 4;
+	}
+	else
+	{
+		waitStates.fROM			= 1;
+		waitStates.fSRAM		= 1;
+		waitStates.fDRAM		= 1;
+	}
+
+	waitStates.fRegisters	= 0;
+	waitStates.fSED1375		= 4;
+	waitStates.fPLD			= 0;	// !!! What's this value?
+	waitStates.fDummyBank	= 99;	// hopefully won't be used!
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:    EmDevice::GetMenuString
@@ -23,6 +23,7 @@ class EmFileRef;
 class EmRegs;
 class EmSession;
 struct DeviceInfo;
+struct EmWaitStates;
 
 class EmROMReader;
 
@@ -66,6 +67,8 @@ class EmDevice
 		long					HardwareID			(void) const;
 		long					HardwareSubID		(void) const;
 
+		void					GetWaitStates		(EmWaitStates&) const;
+
 		std::string GetMenuString		(void) const;
 		std::string GetIDString			(void) const;
 		std::vector<std::string>			GetIDStrings		(void) const;
@@ -6,11 +6,33 @@
 	The correction ratio (emu_mixed / real_mixed) is applied to the
 	throttle clock so that "1x Realtime" matches the real device.
 	The timer stays on raw MC68000 cycles (unchanged).
+
+	A single ratio is only right for workloads that look like Mixed CPI.
+	Real hardware reaches ROM, RAM and the on-chip registers at different
+	speeds (see docs/benchmark-analysis-m500.md), so for devices with
+	benchmark data the throttle uses a per-region bus timing model
+	instead:
+
+		real cycles = Flash cycles * (real NOP ROM / emu NOP ROM)
+					  + RAM cycles * (real NOP RAM / emu NOP RAM)
+					  + sum over regions of accesses * per-access cost
+
+	where Flash cycles and RAM cycles are the emulated cycles run with the
+	PC in Flash and in RAM.  The NOP tests make no data accesses, so they
+	give the cost of code fetched from each.  Each per-access cost is
+	what's left of a single-access test (RAM Rd W, RAM Wr W, ROM Rd W,
+	HW Reg Rd) after taking out the Flash code cost; it can be negative.
+	Those tests all run from Flash, so data accesses made by code in RAM
+	are charged the same, untested, costs.  Accesses are counted per
+	call into EmMemGet/Put, not per bus cycle: the long tests cost about
+	the same per access as the word tests.
 \* ===================================================================== */
 
 #ifndef EmDeviceBenchmark_h
 #define EmDeviceBenchmark_h
 
+#include "EmMemory.h"		// kEmMemRegionCount
+
 #include <cstring>
 
 struct EmBenchmarkData
@@ -45,6 +67,102 @@ static const EmDeviceBenchmarkEntry kDeviceBenchmarks[] =
 static const int kDeviceBenchmarkCount =
 	sizeof(kDeviceBenchmarks) / sizeof(kDeviceBenchmarks[0]);
 
+// BenchPRC runs 1000000 x 8 operations per test (LCD Wr runs 250000 x 8)
+// and reports 100 Hz ticks.
+
+static const int64_t kBenchmarkOps			= 8000000;
+static const int64_t kBenchmarkTickRate		= 100;
+
+// Bus timing costs are kept in 1/4096ths of a real cycle.
+
+static const int kBusTimingShift = 12;
+
+struct EmBusTiming
+{
+	int32    sysClk;                          // 0 = no benchmark data
+	int64_t  coreCost;                        // per emulated cycle, PC in Flash
+	int64_t  ramCoreCost;                     // per emulated cycle, PC in RAM
+	int64_t  getCost[kEmMemRegionCount];      // per EmMemGet
+	int64_t  putCost[kEmMemRegionCount];      // per EmMemPut
+};
+
+// Per-access cost left over from a single-access test once the
+// emulated cycles have been scaled by nopReal / nopEmu.
+
+inline int64_t EmDeviceBenchmark_AccessCost (
+	int real, int emu, int nopReal, int nopEmu, int32 systemClockFreq)
+{
+	return ((int64_t) real * nopEmu - (int64_t) emu * nopReal)
+		* systemClockFreq * (1 << kBusTimingShift)
+		/ ((int64_t) nopEmu * kBenchmarkTickRate * kBenchmarkOps);
+}
+
+inline void EmDeviceBenchmark_GetBusTiming (
+	const char* deviceID, int32 systemClockFreq, EmBusTiming& timing)
+{
+	memset (&timing, 0, sizeof (timing));
+
+	for (int i = 0; i < kDeviceBenchmarkCount; ++i)
+	{
+		if (strcmp (kDeviceBenchmarks[i].deviceID, deviceID) == 0)
+		{
+			const EmBenchmarkData& real = kDeviceBenchmarks[i].realHardware;
+			const EmBenchmarkData& emu  = kDeviceBenchmarks[i].emulatorBase;
+
+			if (real.nopRom <= 0 || emu.nopRom <= 0 || systemClockFreq <= 0)
+				break;
+
+			timing.sysClk   = systemClockFreq;
+			timing.coreCost = ((int64_t) real.nopRom << kBusTimingShift) / emu.nopRom;
+
+			if (real.nopRam > 0 && emu.nopRam > 0)
+				timing.ramCoreCost = ((int64_t) real.nopRam << kBusTimingShift) / emu.nopRam;
+			else
+				timing.ramCoreCost = timing.coreCost;
+
+			timing.getCost[kEmMemRegionRAM] = EmDeviceBenchmark_AccessCost (
+				real.ramRdW, emu.ramRdW, real.nopRom, emu.nopRom, systemClockFreq);
+			timing.putCost[kEmMemRegionRAM] = EmDeviceBenchmark_AccessCost (
+				real.ramWrW, emu.ramWrW, real.nopRom, emu.nopRom, systemClockFreq);
+			timing.getCost[kEmMemRegionROM] = EmDeviceBenchmark_AccessCost (
+				real.romRdW, emu.romRdW, real.nopRom, emu.nopRom, systemClockFreq);
+
+			// The registers are on-chip; there's no write test, so charge
+			// writes the same as reads.
+
+			timing.getCost[kEmMemRegionRegs] = EmDeviceBenchmark_AccessCost (
+				real.hwRegRd, emu.hwRegRd, real.nopRom, emu.nopRom, systemClockFreq);
+			timing.putCost[kEmMemRegionRegs] = timing.getCost[kEmMemRegionRegs];
+			break;
+		}
+	}
+}
+
+// Real-hardware microseconds taken by "cycles" emulated cycles, "ramCycles"
+// of them with the PC in RAM, that made the given numbers of accesses to
+// each region.
+
+inline int64_t EmDeviceBenchmark_GetElapsedUs (const EmBusTiming& timing,
+	uint32 cycles, uint32 ramCycles, const uint32* gets, const uint32* puts)
+{
+	if (ramCycles > cycles)
+		ramCycles = cycles;
+
+	int64_t	total = (int64_t) (cycles - ramCycles) * timing.coreCost
+				  + (int64_t) ramCycles * timing.ramCoreCost;
+
+	for (int region = 0; region < kEmMemRegionCount; ++region)
+	{
+		total += (int64_t) gets[region] * timing.getCost[region];
+		total += (int64_t) puts[region] * timing.putCost[region];
+	}
+
+	if (total < 0)
+		return 0;
+
+	return (total >> kBusTimingShift) * 1000000LL / timing.sysClk;
+}
+
 inline int32 EmDeviceBenchmark_GetEffectiveClockFreq (
 	const char* deviceID, int32 systemClockFreq)
 {
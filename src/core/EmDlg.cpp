@@ -14,7 +14,7 @@
 #include "EmCommon.h"
 #include "EmDlg.h"
 
-#include "DebugMgr.h"			// gDebuggerGlobals
+#include "DebugMgr.h"			// gDebuggerGlobals, Debug::UpdateDataBreaks
 #include "EmApplication.h"		// gApplication, BindPoser
 #include "EmBankDRAM.h"			// EmBankDRAM::ValidAddress
 #include "EmBankROM.h"			// EmBankROM::ValidAddress
@@ -3993,6 +3993,8 @@ EmDlgFnResult EmDlg::PrvEditBreakpoints (EmDlgContext& context)
 						gDebuggerGlobals.watchBytes = EmDlg::GetItemValue (dlg, kDlgItemBrkNumberOfBytes);
 					}
 
+					Debug::UpdateDataBreaks ();
+
 					// Fall thru...
 				}
 
@@ -5168,6 +5170,7 @@ EmDlgFnResult EmDlg::PrvGremlinControl (EmDlgContext& context)
 					if (stopper.Stopped())
 					{
 						Hordes::Stop ();
+						Hordes::ExportStates ();
 					}
 					break;
 				}
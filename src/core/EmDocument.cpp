@@ -16,11 +16,11 @@
 
 #include "EmApplication.h"		// SetDocument
 #include "EmCommands.h"			// EmCommandID, kCommandSessionClose, etc.
+#include "EmHordeCoordinator.h"	// EmHordeCoordinator::Start, Idle
 #include "EmPatchState.h"		// EmPatchState::EvtGetEventCalled
 #include "EmRPC.h"				// RPC::Idle
 #include "EmSession.h"			// EmStopMethod
 #include "EmWindow.h"			// EmWindow, gWindow
-#include "EmWindowQt.h"			// gHostWindow, getLCDImage
 #include "ErrorHandling.h"		// Errors::ReportIfError
 #include "Hordes.h"				// Hordes::PostLoad, Suspend, Step, Resume, Stop
 #include "Platform.h"			// Platform::GetBoundDevice
@@ -105,6 +105,32 @@ class EmActionNewHorde : public EmAction
 };
 
 
+class EmActionNewHordeWorkers : public EmAction
+{
+	public:
+								EmActionNewHordeWorkers (const HordeInfo& info, int32 numWorkers) :
+									EmAction (kStr_CmdGremlinNew),
+									fInfo (info),
+									fNumWorkers (numWorkers)
+								{
+								}
+
+		virtual					~EmActionNewHordeWorkers (void)
+								{
+								}
+
+		virtual void			Do (void)
+								{
+									EmSessionStopper	stopper (gSession, kStopOnSysCall);
+									EmHordeCoordinator::Start (fInfo, fNumWorkers);
+								}
+
+	private:
+		HordeInfo				fInfo;
+		int32					fNumWorkers;
+};
+
+
 class EmActionDialog : public EmAction
 {
 	public:
@@ -491,10 +517,24 @@ void EmDocument::HandleIdle (void)
 		HordeInfo	info;
 		if (Startup::NewHorde (&info))
 		{
-			this->ScheduleNewHorde (info);
+			// With -horde_workers, shard the Horde across worker
+			// processes instead of running it here.
+
+			if (Startup::HordeWorkers () > 1 && info.fStartNumber != info.fStopNumber)
+			{
+				this->PostAction (new EmActionNewHordeWorkers (info, Startup::HordeWorkers ()));
+			}
+			else
+			{
+				this->ScheduleNewHorde (info);
+			}
 		}
 	}
 
+	// Wrap up a sharded Horde once its workers are done.
+
+	EmHordeCoordinator::Idle ();
+
 	// Pop off deferred actions and handle them.
 
 	this->DoAll ();
@@ -927,6 +967,7 @@ void EmDocument::DoGremlinStop (EmCommandID)
 {
 	EmSessionStopper	stopper (fSession, kStopNow);
 	Hordes::Stop ();
+	Hordes::ExportStates ();
 }
 
 
@@ -1186,15 +1227,8 @@ Bool EmDocument::HostCanSaveBound (void)
 // ---------------------------------------------------------------------------
 //		� EmDocument::HostSaveScreen
 // ---------------------------------------------------------------------------
-
-void EmDocument::HostSaveScreen (const EmFileRef& destRef)
-{
-	if (gHostWindow)
-	{
-		QString path = QString::fromStdString (destRef.GetFullPath ());
-		gHostWindow->getLCDImage ().save (path, "PNG");
-	}
-}
+// Defined by the host window implementation (EmWindowQt.cpp or
+// EmWindowHeadless.cpp), which knows how to get at the LCD image.
 
 
 #pragma mark -
@@ -15,6 +15,7 @@
 #include "EmEventPlayback.h"
 
 #include "CGremlinsStubs.h"		// StubAppEnqueueKey, StubAppEnqueuePt
+#include "EmCPU68K.h"			// gCPU68K->ReportIdleSkipped
 #include "EmEventOutput.h"		// GetEventInfo
 #include "EmMemory.h"			// EmMem_strlen, EmMem_strcpy
 #include "EmMinimize.h"			// EmMinimize::IsOn
@@ -700,6 +701,9 @@ Bool EmEventPlayback::ReplayGetEvent (void)
 
 		EmEventPlayback::ReplayEvents (false);
 
+		if (gCPU68K && !EmMinimize::IsOn ())
+			gCPU68K->ReportIdleSkipped ();
+
 		// If minimization is running, tell it that we appear to have
 		// run the gamut.
 
@@ -0,0 +1,264 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Gremlin Hordes sharded across worker processes.  See
+	EmHordeCoordinator.h for an overview.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmHordeCoordinator.h"
+
+#include "EmApplication.h"		// gApplication, ScheduleQuit
+#include "EmDirRef.h"			// EmDirRef
+#include "EmFileRef.h"			// EmFileRef
+#include "Hordes.h"				// Hordes::NewCoordinated, gErrorHappened
+#include "Logging.h"			// LogAppendMsg
+#include "Startup.h"			// Startup::GetHordeWorkerArgs
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFileInfo>
+#include <QProcess>
+#include <QStringList>
+
+#include <algorithm>			// min, max
+#include <vector>				// vector
+
+using namespace std;
+
+
+struct EmHordeWorker
+{
+	QProcess*	fProcess;
+	int32		fFirst;
+	int32		fLast;
+	EmDirRef	fSaveDir;
+};
+
+typedef vector<EmHordeWorker>	EmHordeWorkerList;
+
+static EmHordeWorkerList	gWorkers;
+static Bool					gIsOn;
+
+
+static QString				PrvWorkerProgram		(void);
+static Bool					PrvFindProgressFile		(const EmDirRef& saveDir,
+													 EmFileRef& result);
+
+
+// ---------------------------------------------------------------------------
+//		� EmHordeCoordinator::Start
+// ---------------------------------------------------------------------------
+// Save the root state and start one worker process for each shard of the
+// Horde's Gremlin range.  There are never more workers than Gremlins.
+
+void EmHordeCoordinator::Start (const HordeInfo& info, int32 numWorkers)
+{
+	EmAssert (!gIsOn);
+
+	Hordes::NewCoordinated (info);
+
+	int32	first	= min (info.fStartNumber, info.fStopNumber);
+	int32	last	= max (info.fStartNumber, info.fStopNumber);
+	int32	count	= last - first + 1;
+
+	if (numWorkers > count)
+		numWorkers = count;
+
+	EmFileRef	rootRef		= Hordes::SuggestFileRef (kHordeRootFile);
+	EmDirRef	hordeDir	= Hordes::GetGremlinDirectory ();
+	QString		program		= ::PrvWorkerProgram ();
+
+	StringList	extraArgs;
+	Startup::GetHordeWorkerArgs (extraArgs);
+
+	for (int32 ii = 0; ii < numWorkers; ++ii)
+	{
+		EmHordeWorker	worker;
+
+		worker.fFirst	= first + (count * ii) / numWorkers;
+		worker.fLast	= first + (count * (ii + 1)) / numWorkers - 1;
+
+		char	dirName[20];
+		sprintf (dirName, "Worker_%02ld", (long) ii);
+
+		worker.fSaveDir	= EmDirRef (hordeDir, dirName);
+
+		QStringList	args;
+
+		args << "-psf"				<< QString::fromStdString (rootRef.GetFullPath ())
+			 << "-horde_first"		<< QString::number (worker.fFirst)
+			 << "-horde_last"		<< QString::number (worker.fLast)
+			 << "-horde_save_dir"	<< QString::fromStdString (worker.fSaveDir.GetFullPath ())
+			 << "-horde_quit_when_done";
+
+		StringList::iterator	iter = extraArgs.begin ();
+		while (iter != extraArgs.end ())
+		{
+			args << QString::fromStdString (*iter);
+			++iter;
+		}
+
+		worker.fProcess = new QProcess;
+		worker.fProcess->setProcessChannelMode (QProcess::ForwardedChannels);
+		worker.fProcess->start (program, args);
+
+		LogAppendMsg ("Started Horde worker %ld for Gremlins #%ld to #%ld",
+			(long) ii, (long) worker.fFirst, (long) worker.fLast);
+
+		gWorkers.push_back (worker);
+	}
+
+	LogDump ();
+
+	gIsOn = true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmHordeCoordinator::IsOn
+// ---------------------------------------------------------------------------
+
+Bool EmHordeCoordinator::IsOn (void)
+{
+	return gIsOn;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmHordeCoordinator::Idle
+// ---------------------------------------------------------------------------
+// Wrap up once the last worker has exited.
+
+void EmHordeCoordinator::Idle (void)
+{
+	if (!gIsOn)
+		return;
+
+	EmHordeWorkerList::iterator	iter = gWorkers.begin ();
+	while (iter != gWorkers.end ())
+	{
+		if (iter->fProcess->state () != QProcess::NotRunning)
+			return;
+
+		++iter;
+	}
+
+	EmHordeCoordinator::Finish ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmHordeCoordinator::Finish
+// ---------------------------------------------------------------------------
+// Collect the workers' search progress files and exit statuses, and have
+// Hordes log the merged summary.  A worker's exit status is the same
+// 0/1/2 (none/warning/error) that this process exits with, so they're
+// folded into gWarningHappened and gErrorHappened.
+
+void EmHordeCoordinator::Finish (void)
+{
+	gIsOn = false;
+
+	EmFileRefList	progressFiles;
+	Bool			warningHappened	= false;
+	Bool			errorHappened	= false;
+
+	EmHordeWorkerList::iterator	iter = gWorkers.begin ();
+	while (iter != gWorkers.end ())
+	{
+		QProcess*	process = iter->fProcess;
+
+		if (process->error () == QProcess::FailedToStart ||
+			process->exitStatus () != QProcess::NormalExit)
+		{
+			LogAppendMsg ("=== ERROR: Horde worker for Gremlins #%ld to #%ld did not finish",
+				(long) iter->fFirst, (long) iter->fLast);
+
+			errorHappened = true;
+		}
+		else if (process->exitCode () == 2)
+		{
+			errorHappened = true;
+		}
+		else if (process->exitCode () == 1)
+		{
+			warningHappened = true;
+		}
+
+		EmFileRef	progressFile;
+
+		if (::PrvFindProgressFile (iter->fSaveDir, progressFile))
+		{
+			progressFiles.push_back (progressFile);
+		}
+
+		delete process;
+
+		++iter;
+	}
+
+	gWorkers.clear ();
+
+	Hordes::EndCoordinated (progressFiles);
+
+	gWarningHappened	= warningHappened;
+	gErrorHappened		= errorHappened;
+
+	if (Hordes::QuitWhenDone ())
+	{
+		EmAssert (gApplication);
+		gApplication->ScheduleQuit ();
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvWorkerProgram
+// ---------------------------------------------------------------------------
+// Workers have no use for a window, so run pose64-headless if it was
+// installed next to us.  Otherwise, run another copy of this executable.
+
+QString PrvWorkerProgram (void)
+{
+	QDir	appDir (QCoreApplication::applicationDirPath ());
+
+#if PLATFORM_WINDOWS
+	QString	headless = appDir.filePath ("pose64-headless.exe");
+#else
+	QString	headless = appDir.filePath ("pose64-headless");
+#endif
+
+	if (QFileInfo (headless).isExecutable ())
+		return headless;
+
+	return QCoreApplication::applicationFilePath ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvFindProgressFile
+// ---------------------------------------------------------------------------
+// A worker's Horde files are in a timestamped Gremlins directory under
+// the -horde_save_dir it was given.
+
+Bool PrvFindProgressFile (const EmDirRef& saveDir, EmFileRef& result)
+{
+	EmDirRefList	children;
+	saveDir.GetChildren (NULL, &children);
+
+	EmDirRefList::iterator	iter = children.begin ();
+	while (iter != children.end ())
+	{
+		EmFileRef	progressFile (*iter, Hordes::SuggestFileName (kHordeProgressFile));
+
+		if (progressFile.Exists ())
+		{
+			result = progressFile;
+			return true;
+		}
+
+		++iter;
+	}
+
+	return false;
+}
@@ -0,0 +1,38 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Gremlin Hordes sharded across worker processes.
+
+	Started by -horde_workers N.  Instead of running the Horde's
+	Gremlins itself, this process saves the root state, splits the
+	Gremlin range into N contiguous shards, and starts one pose64
+	worker per shard on the root state.  Each worker runs its shard as
+	an ordinary Horde with its own -horde_save_dir (Worker_NN under
+	the coordinator's Gremlins directory), so its log, .pev, and .psf
+	files don't collide with anyone else's.
+
+	When every worker has exited, the error stats each one left in its
+	search progress file are merged and logged as one summary, just as
+	if the whole range had been run here.
+\* ===================================================================== */
+
+#ifndef EmHordeCoordinator_h
+#define EmHordeCoordinator_h
+
+#include "EmStructs.h"			// HordeInfo
+
+class EmHordeCoordinator
+{
+	public:
+		static void				Start					(const HordeInfo& info,
+														 int32 numWorkers);
+		static Bool				IsOn					(void);
+
+		// Called from EmDocument::HandleIdle.
+
+		static void				Idle					(void);
+
+	private:
+		static void				Finish					(void);
+};
+
+#endif	// EmHordeCoordinator_h
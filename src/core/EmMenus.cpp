@@ -252,6 +252,11 @@ EmPrvMenuItem	kPrvMenuItems[] =
 	{ kCommandTimerAccurate,	kStr_MenuTimerAccurate },
 	{ kCommandTimerLegacy,		kStr_MenuTimerLegacy },
 
+	{ kCommandCPUInterpreter,	kStr_MenuCPUInterpreter },
+	{ kCommandCPUBlocks,		kStr_MenuCPUBlocks },
+
+	{ kCommandIdleFastForward,	kStr_MenuIdleFastForward },
+
 	{ kCommandSpeedQuarter,		kStr_MenuSpeedQuarter },
 	{ kCommandSpeedHalf,		kStr_MenuSpeedHalf },
 	{ kCommandSpeed1x,			kStr_MenuSpeed1x },
@@ -608,6 +613,11 @@ void PrvInitializeMenus (Bool alternateLayout)
 	::PrvAddMenuItem (subMenuSpeed, kCommandTimerAccurate);
 	::PrvAddMenuItem (subMenuSpeed, kCommandTimerLegacy);
 	::PrvAddMenuItem (subMenuSpeed, __________);
+	::PrvAddMenuItem (subMenuSpeed, kCommandCPUInterpreter);
+	::PrvAddMenuItem (subMenuSpeed, kCommandCPUBlocks);
+	::PrvAddMenuItem (subMenuSpeed, __________);
+	::PrvAddMenuItem (subMenuSpeed, kCommandIdleFastForward);
+	::PrvAddMenuItem (subMenuSpeed, __________);
 	::PrvAddMenuItem (subMenuSpeed, kCommandSpeedQuarter);
 	::PrvAddMenuItem (subMenuSpeed, kCommandSpeedHalf);
 	::PrvAddMenuItem (subMenuSpeed, kCommandSpeed1x);
@@ -959,6 +969,11 @@ Bool PrvGetItemStatus (const EmMenuItem& item)
 		case kCommandTimerAccurate:		return true;
 		case kCommandTimerLegacy:		return true;
 
+		case kCommandCPUInterpreter:	return true;
+		case kCommandCPUBlocks:			return true;
+
+		case kCommandIdleFastForward:	return true;
+
 		case kCommandSpeedQuarter:		return true;
 		case kCommandSpeedHalf:			return true;
 		case kCommandSpeed1x:			return true;
@@ -1024,6 +1039,22 @@ Bool PrvGetItemChecked (const EmMenuItem& item)
 		if (id == kCommandTimerLegacy)		return accuracy == 0;
 	}
 
+	// CPU engine radio buttons
+	if (id == kCommandCPUInterpreter || id == kCommandCPUBlocks)
+	{
+		Preference<long> prefEngine (kPrefKeyCPUEngine);
+		long engine = *prefEngine;
+
+		if (id == kCommandCPUInterpreter)	return engine != kCPUEngineBlocks;
+		if (id == kCommandCPUBlocks)		return engine == kCPUEngineBlocks;
+	}
+
+	if (id == kCommandIdleFastForward)
+	{
+		Preference<bool> prefFastForward (kPrefKeyIdleFastForward);
+		return *prefFastForward;
+	}
+
 	if (id < kCommandSpeedQuarter || id > kCommandSpeedMax)
 		return false;
 
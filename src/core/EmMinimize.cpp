@@ -15,6 +15,7 @@
 #include "EmMinimize.h"
 
 #include "EmApplication.h"		// gApplication->ScheduleQuit
+#include "EmCPU68K.h"			// gCPU68K->ReportIdleSkipped
 #include "EmDlg.h"				// MinimizeProgressOpen, DoCommonDialog
 #include "EmEventPlayback.h"	// EnableEvents, DisableEvents
 #include "EmPalmOS.h"			// EmPalmOS::GenerateStackCrawl
@@ -304,6 +305,7 @@ long						EmMinimize::fgDiscardedNumberOfEvents;
 long						EmMinimize::fgPassNumber;
 Bool						EmMinimize::fgPassEndedInError;
 StringList					EmMinimize::fgLastStackCrawl;
+EmSessionSnapshot			EmMinimize::fgInitialState;
 
 
 static inline Bool PrvIsPenUp (const PointType& pt)
@@ -365,6 +367,11 @@ void EmMinimize::Dispose (void)
 {
 	EmMinimize::TurnOn (false);
 	fgState.fLevels.clear ();
+	fgInitialState.Clear ();
+
+	// Drop the pages the last restored snapshot left for sharing.
+
+	EmSessionSnapshot::DisposeBase ();
 }
 
 
@@ -412,6 +419,7 @@ void EmMinimize::Start (void)
 	// Initialize the minimization routines.
 
 	fgState.fLevels.clear ();
+	fgInitialState.Clear ();
 	fgStartTime					= Platform::GetMilliseconds ();
 	fgDiscardedNumberOfEvents	= 0;
 	fgPassNumber				= 1;
@@ -682,6 +690,9 @@ void EmMinimize::MinimizationComplete (void)
 {
 	PRINTF ("EmMinimize::MinimizationComplete: DONE.");
 
+	if (gCPU68K)
+		gCPU68K->ReportIdleSkipped ();
+
 	// Stop the presses.
 
 	EmMinimize::TurnOn (false);
@@ -1235,7 +1246,19 @@ void EmMinimize::RealLoadInitialState (void)
 	try
 	{
 		EmAssert (gSession);
-		gSession->Load (gSession->GetFile ());
+
+		// Load the file the first time through, and keep a copy of the
+		// state in memory.  Each pass after that restores the copy.
+
+		if (fgInitialState.IsEmpty ())
+		{
+			gSession->Load (gSession->GetFile ());
+			gSession->Save (fgInitialState);
+		}
+		else
+		{
+			gSession->Load (fgInitialState);
+		}
 
 		PRINTF ("EmMinimize::RealLoadInitialState: Reloaded initial state.");
 	}
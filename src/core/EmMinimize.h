@@ -14,6 +14,7 @@
 #ifndef EmMinimize_h
 #define EmMinimize_h
 
+#include "EmSessionSnapshot.h"	// EmSessionSnapshot
 #include "EmStructs.h"			// GremlinEvent
 
 #include "omnithread.h"			// omni_mutex
@@ -128,6 +129,7 @@ class EmMinimize
 		static long				fgPassNumber;
 		static Bool				fgPassEndedInError;
 		static StringList		fgLastStackCrawl;
+		static EmSessionSnapshot	fgInitialState;
 };
 
 #endif // EmMinimize_h
@@ -19,6 +19,7 @@
 #include "EmMemory.h"			// CEnableFullAccess, EmMem_strcpy, EmMem_memcmp
 #include "EmPalmHeap.h"			// EmPalmHeap
 #include "EmPatchState.h"		// EmPatchState::OSMajorVersion
+#include "EmSymbolIndex.h"		// EmSymbolIndex::Find
 #include "Miscellaneous.h"		// FindFunctionName
 #include "Platform.h"			// Platform::GetString
 #include "Strings.r.h"			// kStr_INetLibTrapBase
@@ -1128,7 +1129,7 @@ emuptr GetSysFunctionAddress (uint16 trapWord, uint32 extra, Bool digDeep)
 		throw EmUnimplementedFunctionException ();
 	}
 
-	if (digDeep)
+	if (digDeep && ::IsSubDispatchTrap (trapWord))
 	{
 		emuptr result2 = EmMemNULL;
 
@@ -1162,6 +1163,129 @@ emuptr GetSysFunctionAddress (uint16 trapWord, uint32 extra, Bool digDeep)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	FunctionAddressChanged
+ *
+ * DESCRIPTION:	Determines whether a system function still resolves
+ *				to the addresses GetFunctionAddress returned for it
+ *				earlier.  This rereads the trap table slot or the
+ *				library dispatch table entry, which is much cheaper
+ *				than resolving the function from scratch (for a
+ *				library, that means looking up its name).  It catches
+ *				trap table and library table changes made without
+ *				going through the Palm OS calls we patch.
+ *
+ * PARAMETERS:	trapWord, extra - as for GetFunctionAddress.
+ *
+ *				destPC1, destPC2 - the addresses GetFunctionAddress
+ *					returned, without and with digDeep.
+ *
+ * RETURNED:	True if either address is now different, or if the
+ *				function can no longer be found.
+ *
+ ***********************************************************************/
+
+Bool FunctionAddressChanged (uint16 trapWord, uint32 extra, emuptr destPC1, emuptr destPC2)
+{
+	trapWord = ::SysTrapIndex (trapWord) | sysTrapBase;
+
+	if (::IsSystemTrap (trapWord))
+	{
+		try
+		{
+			if (::GetSysFunctionAddress (trapWord, extra, false) != destPC1)
+				return true;
+
+			if (::IsSubDispatchTrap (trapWord) &&
+				::GetSysFunctionAddress (trapWord, extra, true) != destPC2)
+				return true;
+		}
+		catch (EmUnimplementedFunctionException&)
+		{
+			return true;
+		}
+
+		return false;
+	}
+
+	// Walk the library table as GetLibFunctionAddress does, skipping the
+	// checks on the library name and the dispatch number.  Those only
+	// need to pass once: they depend on the same table entries.
+
+	UInt16	refNum = (UInt16) extra;
+
+	if (refNum == sysInvalidRefNum || refNum == 0)
+		return true;
+
+	CEnableFullAccess	munge;	// Remove blocks on memory access.
+
+	uint32	sysLibTableP		= EmLowMem_GetGlobal (sysLibTableP);
+	UInt16	sysLibTableEntries	= EmLowMem_GetGlobal (sysLibTableEntries);
+
+	if (sysLibTableP == EmMemNULL)
+		return true;
+
+	if (refNum >= sysLibTableEntries)
+		return refNum != kMagicRefNum || destPC1 != 1;
+
+	emuptr	dispatchTblP;
+
+	if (EmPatchState::OSMajorVersion () > 1)
+	{
+		dispatchTblP	= EmMemGet32 (sysLibTableP + refNum * 16 /* m68k sizeof(SysLibTblEntryType) */);
+	}
+	else
+	{
+		dispatchTblP	= EmMemGet32 (sysLibTableP + refNum * 8 /* m68k sizeof(SysLibTblEntryTypeV10) */);
+	}
+
+	int16	offset = EmMemGet16 (dispatchTblP + LibTrapIndex (trapWord) * 2);
+	emuptr	result = dispatchTblP + offset;
+
+	if (result != destPC1)
+		return true;
+
+	if (EmMemGet16 (result) == kOpcode_JMPREL)
+	{
+		result += 2;
+		result += (int16) EmMemGet16 (result);
+	}
+
+	return result != destPC2;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	IsSubDispatchTrap
+ *
+ * DESCRIPTION:	Returns whether the given system function dispatches
+ *				on D2 to one of several functions.  For these, the
+ *				address GetSysFunctionAddress returns when digging
+ *				deep depends on the "extra" parameter.
+ *
+ * PARAMETERS:	trapWord - the dispatch number used to invoke the
+ *					function.
+ *
+ * RETURNED:	True if so.
+ *
+ ***********************************************************************/
+
+Bool IsSubDispatchTrap (uint16 trapWord)
+{
+	trapWord = ::SysTrapIndex (trapWord) | sysTrapBase;
+
+	return
+		trapWord == sysTrapIntlDispatch		||
+		trapWord == sysTrapOmDispatch		||
+		trapWord == sysTrapTsmDispatch		||
+		trapWord == sysTrapFlpDispatch 		||
+		trapWord == sysTrapSerialDispatch	||
+		trapWord == sysTrapFlpEmDispatch;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	GetStdDispatchAddress
@@ -1563,7 +1687,29 @@ void FindFunctionName (emuptr addr, char* nameP,
 			emuptr* startAddrP, emuptr* endAddrP,
 			long nameCapacity)
 {
-	// Get the start address only if requested.
+	// Most functions are in heap chunks, which EmSymbolIndex will have
+	// scanned for us already.
+
+	const EmSymbol*	symbol = EmSymbolIndex::Find (addr);
+
+	if (symbol)
+	{
+		if (startAddrP)
+			*startAddrP = symbol->fStart;
+
+		if (endAddrP)
+			*endAddrP = symbol->fEnd;
+
+		if (nameP && nameCapacity > 0)
+		{
+			strncpy (nameP, symbol->fName.c_str (), nameCapacity - 1);
+			nameP[nameCapacity - 1] = '\0';
+		}
+
+		return;
+	}
+
+	// Otherwise, scan for it.  Get the start address only if requested.
 
 	if (startAddrP)
 		*startAddrP = ::FindFunctionStart (addr);
@@ -129,9 +129,11 @@ int		GetProscribedReason		(const SystemCallContext& context);
 emuptr	GetFunctionAddress		(uint16 trapWord, uint32 extra = sysInvalidRefNum, Bool digDeep = false);
 emuptr	GetLibFunctionAddress	(uint16 trapWord, UInt16 refNum, Bool digDeep);
 emuptr	GetSysFunctionAddress	(uint16 trapWord, uint32 extra, Bool digDeep);
+Bool	FunctionAddressChanged	(uint16 trapWord, uint32 extra, emuptr destPC1, emuptr destPC2);
 emuptr	GetStdDispatchAddress	(emuptr entryPt, uint32 regD2);
 emuptr	GetFlpEmDispatchAddress	(emuptr entryPt, uint32 regD2);
 emuptr	GetIntlDispatchAddress	(emuptr entryPt, uint32 regD2);
+Bool	IsSubDispatchTrap		(uint16 trapWord);
 
 
 class EmUnimplementedFunctionException
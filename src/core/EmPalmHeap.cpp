@@ -21,16 +21,34 @@
 #include "ROMStubs.h"			// MemNumHeaps, MemHeapID, MemHeapPtr
 #include "SessionFile.h"		// SessionFile
 
+#include <algorithm>			// upper_bound
 #include <stdio.h>				// sprintf
 
 using namespace std;
 
+
+// Comparison functions for binary searches of the (address-sorted) heap
+// and chunk lists.
+
+static bool PrvHeapStartsAfter (emuptr p, const EmPalmHeap& heap)
+{
+	return p < heap.Start ();
+}
+
+static bool PrvChunkStartsAfter (emuptr p, const EmPalmChunk& chunk)
+{
+	return p < chunk.Start ();
+}
+
 // ===========================================================================
 //		� EmPalmHeap
 // ===========================================================================
 
 EmPalmHeapList	EmPalmHeap::fgHeapList;
 
+uint32			EmPalmHeap::fgFullResyncCount;
+uint32			EmPalmHeap::fgPartialResyncCount;
+
 
 /***********************************************************************
  *
@@ -49,6 +67,8 @@ EmPalmHeapList	EmPalmHeap::fgHeapList;
 
 void EmPalmHeap::Initialize (void)
 {
+	fgFullResyncCount = 0;
+	fgPartialResyncCount = 0;
 }
 
 
@@ -246,18 +266,21 @@ const EmPalmHeap* EmPalmHeap::GetHeapByPtr (emuptr p)
 
 const EmPalmHeap* EmPalmHeap::GetHeapByPtr (MemPtr p)
 {
-	// !!! Could do a binary search here, if needed.
+	// The heap list is sorted by address (see AddHeap).  Find the
+	// last heap starting at or before "p".
 
-	EmPalmHeapList::iterator	iter = fgHeapList.begin ();
+	EmPalmHeapList::iterator	iter = upper_bound (fgHeapList.begin (),
+									fgHeapList.end (), (emuptr)(uintptr_t) p,
+									PrvHeapStartsAfter);
 
-	while (iter != fgHeapList.end ())
+	if (iter != fgHeapList.begin ())
 	{
+		--iter;
+
 		if (iter->Contains ((emuptr)(uintptr_t) p))
 		{
 			return &*iter;
 		}
-
-		++iter;
 	}
 
 	return NULL;
@@ -386,6 +409,13 @@ void EmPalmHeap::MemHeapInit (UInt16 heapID, Int16, Boolean)
  * DESCRIPTION:	All of these functions alter the heap in some way.
  *				Resync our notion of the state of the heap with reality.
  *
+ *				Compacting, freeing by owner, and scrambling can move
+ *				any chunk in the heap, so they rewalk the whole heap.
+ *				Allocating, freeing, and resizing a chunk normally
+ *				only touch that chunk and its neighbors, so those just
+ *				rewalk the affected range.  They fall back to a full
+ *				resync if it looks like other chunks were moved.
+ *
  * PARAMETERS:	Parameters to the Memory Manager functions that altered
  *				the heap.
  *
@@ -420,31 +450,40 @@ void EmPalmHeap::MemHeapScramble (UInt16 heapID, EmPalmChunkList* delta)
 
 void EmPalmHeap::MemChunkNew (UInt16 heapID, MemPtr p, UInt16 attr, EmPalmChunkList* delta)
 {
-	UNUSED_PARAM (p);
-	UNUSED_PARAM (attr);
-
 	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByID (heapID));
 
 	if (heap)
-		heap->ResyncAll (delta);
+	{
+		// Unless the chunk is non-movable or pre-locked, we
+		// got back a handle.
+
+		if (attr & (memNewChunkFlagNonMovable | memNewChunkFlagPreLock))
+			heap->ResyncNewChunk (p, false, delta);
+		else
+			heap->ResyncNewChunk (DerefHandle ((MemHandle) p), true, delta);
+	}
 }
 
-void EmPalmHeap::MemChunkFree (EmPalmHeap* heap, EmPalmChunkList* delta)
+void EmPalmHeap::MemChunkFree (EmPalmHeap* heap, MemPtr p, EmPalmChunkList* delta)
 {
 //	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByPtr (p));
 
 	if (heap)
-		heap->ResyncAll (delta);
+	{
+		if (p)
+			heap->ResyncFreedChunk (((emuptr)(uintptr_t) p) - heap->fChunkHdrSize, delta);
+		else
+			heap->ResyncAll (delta);
+	}
 }
 
 void EmPalmHeap::MemPtrNew (MemPtr p, EmPalmChunkList* delta)
 {
-	UNUSED_PARAM (p);
 //	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByPtr (p));
 	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByID (0));
 
 	if (heap)
-		heap->ResyncAll (delta);
+		heap->ResyncNewChunk (p, false, delta);
 }
 
 void EmPalmHeap::MemPtrResize (MemPtr p, EmPalmChunkList* delta)
@@ -452,17 +491,16 @@ void EmPalmHeap::MemPtrResize (MemPtr p, EmPalmChunkList* delta)
 	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByPtr (p));
 
 	if (heap)
-		heap->ResyncAll (delta);
+		heap->ResyncResizedChunk (p, delta);
 }
 
 void EmPalmHeap::MemHandleNew (MemHandle h, EmPalmChunkList* delta)
 {
-	UNUSED_PARAM (h);
 //	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByHdl (h));
 	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByID (0));
 
 	if (heap)
-		heap->ResyncAll (delta);
+		heap->ResyncNewChunk (DerefHandle (h), true, delta);
 }
 
 void EmPalmHeap::MemHandleResize (MemHandle h, EmPalmChunkList* delta)
@@ -470,15 +508,45 @@ void EmPalmHeap::MemHandleResize (MemHandle h, EmPalmChunkList* delta)
 	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByHdl (h));
 
 	if (heap)
-		heap->ResyncAll (delta);
+		heap->ResyncResizedChunk (DerefHandle (h), delta);
 }
 
-void EmPalmHeap::MemHandleFree (EmPalmHeap* heap, EmPalmChunkList* delta)
+void EmPalmHeap::MemHandleFree (EmPalmHeap* heap, MemHandle h, emuptr chunkHdr, EmPalmChunkList* delta)
 {
 //	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByHdl (h));
 
 	if (heap)
-		heap->ResyncAll (delta);
+	{
+		// The master pointer has already been released.  The headpatch
+		// passes along the chunk it referred to; make sure that's the
+		// chunk that referred back to the handle.
+
+		emuptr				hp = (emuptr)(uintptr_t) memHandleUnProtect (h);
+		const EmPalmChunk*	chunk = chunkHdr ? heap->GetChunkContaining (chunkHdr) : NULL;
+
+		if (!chunk || chunk->HeaderStart () != chunkHdr || chunk->Free () ||
+			!chunk->HOffset () || chunk->HeaderStart () - chunk->HOffset () * 2 != hp)
+		{
+			chunkHdr = EmMemNULL;
+
+			ITERATE_CHUNKS (*heap, iter, end)
+			{
+				if (!iter->Free () && iter->HOffset () &&
+					iter->HeaderStart () - iter->HOffset () * 2 == hp)
+				{
+					chunkHdr = iter->HeaderStart ();
+					break;
+				}
+
+				++iter;
+			}
+		}
+
+		if (chunkHdr)
+			heap->ResyncFreedChunk (chunkHdr, delta);
+		else
+			heap->ResyncAll (delta);
+	}
 }
 
 void EmPalmHeap::MemLocalIDToLockedPtr (MemPtr p, EmPalmChunkList* delta)
@@ -549,6 +617,32 @@ void EmPalmHeap::ValidateAllHeaps (void)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmHeap::GetFullResyncCount	[ STATIC ]
+ * FUNCTION:	EmPalmHeap::GetPartialResyncCount	[ STATIC ]
+ *
+ * DESCRIPTION:	Return the number of times a heap was completely
+ *				rewalked, or only had a range of chunks rewalked, since
+ *				the session was created.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	The counter.
+ *
+ ***********************************************************************/
+
+uint32 EmPalmHeap::GetFullResyncCount (void)
+{
+	return fgFullResyncCount;
+}
+
+uint32 EmPalmHeap::GetPartialResyncCount (void)
+{
+	return fgPartialResyncCount;
+}
+
+
 #pragma mark -
 
 
@@ -906,7 +1000,7 @@ EmPalmChunkList::const_iterator EmPalmHeap::GetChunkListEnd (void) const
  *
  * FUNCTION:	EmPalmHeap::GetChunkReferencedBy
  *
- * DESCRIPTION:	Iterate over our list of chunks, finding the one
+ * DESCRIPTION:	Search our list of chunks, finding the one
  *				referenced by the given handle.
  *
  * PARAMETERS:	h - test handle
@@ -918,21 +1012,9 @@ EmPalmChunkList::const_iterator EmPalmHeap::GetChunkListEnd (void) const
 
 const EmPalmChunk* EmPalmHeap::GetChunkReferencedBy (MemHandle h) const
 {
-	// !!! Could do a binary search here, if needed.
-
 	emuptr	p = (emuptr)(uintptr_t) EmPalmHeap::DerefHandle (h);
 
-	ITERATE_CHUNKS (*this, iter, end)
-	{
-		if (iter->Contains (p))
-		{
-			return &*iter;
-		}
-
-		++iter;
-	}
-
-	return NULL;
+	return this->GetChunkContaining (p);
 }
 
 
@@ -940,10 +1022,14 @@ const EmPalmChunk* EmPalmHeap::GetChunkReferencedBy (MemHandle h) const
  *
  * FUNCTION:	EmPalmHeap::GetChunkContaining
  *
- * DESCRIPTION:	Iterate over our list of chunks, finding the one
+ * DESCRIPTION:	Search our list of chunks, finding the one
  *				containing the given pointer.  The range includes the
  *				chunk header and trailer.
  *
+ *				The chunk list is built by walking the heap, so it's
+ *				always sorted by address, and chunks don't overlap.
+ *				That lets us do a binary search.
+ *
  * PARAMETERS:	p - probe address
  *
  * RETURNED:	Pointer to chunk object containing the probe address.
@@ -953,16 +1039,19 @@ const EmPalmChunk* EmPalmHeap::GetChunkReferencedBy (MemHandle h) const
 
 const EmPalmChunk* EmPalmHeap::GetChunkContaining (emuptr p) const
 {
-	// !!! Could do a binary search here, if needed.
+	// Find the last chunk starting at or before "p".
+
+	EmPalmChunkList::const_iterator	iter = upper_bound (fChunkList.begin (),
+										fChunkList.end (), p, PrvChunkStartsAfter);
 
-	ITERATE_CHUNKS (*this, iter, end)
+	if (iter != fChunkList.begin ())
 	{
+		--iter;
+
 		if (iter->Contains (p))
 		{
 			return &*iter;
 		}
-
-		++iter;
 	}
 
 	return NULL;
@@ -973,7 +1062,7 @@ const EmPalmChunk* EmPalmHeap::GetChunkContaining (emuptr p) const
  *
  * FUNCTION:	EmPalmHeap::GetChunkBodyContaining
  *
- * DESCRIPTION:	Iterate over our list of chunks, finding the one
+ * DESCRIPTION:	Search our list of chunks, finding the one
  *				containing the given pointer.  The range does not
  *				include the chunk header or trailer.
  *
@@ -986,19 +1075,56 @@ const EmPalmChunk* EmPalmHeap::GetChunkContaining (emuptr p) const
 
 const EmPalmChunk* EmPalmHeap::GetChunkBodyContaining (emuptr p) const
 {
-	// !!! Could do a binary search here, if needed.
+	const EmPalmChunk*	chunk = this->GetChunkContaining (p);
 
-	ITERATE_CHUNKS (*this, iter, end)
+	if (chunk && chunk->BodyContains (p))
 	{
-		if (iter->BodyContains (p))
+		return chunk;
+	}
+
+	return NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmHeap::GetChunksContaining
+ *
+ * DESCRIPTION:	Bulk version of GetChunkContaining, for tools that need
+ *				to map many addresses to the chunks that own them.
+ *				If the addresses are sorted, consecutive addresses in
+ *				the same chunk are resolved without another search.
+ *
+ * PARAMETERS:	addrs - probe addresses
+ *
+ *				chunks - receives one entry per probe address: the
+ *					chunk containing it, or NULL.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmPalmHeap::GetChunksContaining (const vector<emuptr>& addrs,
+									  vector<const EmPalmChunk*>& chunks) const
+{
+	chunks.clear ();
+	chunks.reserve (addrs.size ());
+
+	const EmPalmChunk*	chunk = NULL;
+
+	vector<emuptr>::const_iterator	iter = addrs.begin ();
+
+	while (iter != addrs.end ())
+	{
+		if (!chunk || !chunk->Contains (*iter))
 		{
-			return &*iter;
+			chunk = this->GetChunkContaining (*iter);
 		}
 
+		chunks.push_back (chunk);
+
 		++iter;
 	}
-
-	return NULL;
 }
 
 
@@ -1292,6 +1418,8 @@ void EmPalmHeap::GetHeapHeaderInfo (emuptr heapHdr)
 
 void EmPalmHeap::ResyncAll (EmPalmChunkList* delta)
 {
+	++fgFullResyncCount;
+
 	this->ResyncMPTList ();
 	this->ResyncChunkList (delta);
 }
@@ -1433,23 +1561,20 @@ void EmPalmHeap::ResyncPtr (MemPtr p, EmPalmChunkList* delta)
 	if (!this->Tracked ())
 		return;
 
-	EmPalmChunkList::iterator	iter = fChunkList.begin ();
-
 	emuptr	chunkStart = ((emuptr)(uintptr_t) p) - fChunkHdrSize;
-	
-	while (iter != fChunkList.end ())
+
+	const EmPalmChunk*	chunk = this->GetChunkContaining (chunkStart);
+
+	if (chunk && chunk->HeaderStart () == chunkStart)
 	{
-		if (iter->HeaderStart () == chunkStart)
-		{
-			*iter = EmPalmChunk (*this, chunkStart);
-			
-			if (delta)
-				delta->push_back (*iter);
+		EmPalmChunk&	entry = fChunkList[chunk - &fChunkList[0]];
 
-			return;
-		}
+		entry = EmPalmChunk (*this, chunkStart);
 
-		++iter;
+		if (delta)
+			delta->push_back (entry);
+
+		return;
 	}
 
 	EmAssert (false);
@@ -1495,6 +1620,377 @@ void EmPalmHeap::ResyncHdl (MemHandle h, EmPalmChunkList* delta)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmHeap::ResyncNewChunk
+ *
+ * DESCRIPTION:	Resynchronize after a chunk has been allocated.  If the
+ *				new chunk was carved out of a free chunk big enough to
+ *				hold it, then the Memory Manager didn't need to compact
+ *				the heap, and only the chunks around the new one need
+ *				to be rewalked.  Otherwise, the whole heap is rewalked.
+ *
+ *				Does nothing if the heap is not "tracked".
+ *
+ * PARAMETERS:	p - pointer to the body of the new chunk.  NULL if the
+ *					allocation failed.
+ *
+ *				newHandle - true if the chunk is relocatable, in which
+ *					case a new master pointer table may have been
+ *					allocated, too.
+ *
+ *				delta - optional collection to receive the list of
+ *					chunks that are different between the current and
+ *					previous states of the heap.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmPalmHeap::ResyncNewChunk (MemPtr p, Bool newHandle, EmPalmChunkList* delta)
+{
+	if (!this->Tracked ())
+		return;
+
+	emuptr	chunkHdr = ((emuptr)(uintptr_t) p) - fChunkHdrSize;
+
+	if (p && this->DataContains (chunkHdr))
+	{
+		// Allocating a handle can require a new master pointer table,
+		// which is another new chunk somewhere else in the heap.
+
+		Bool	sameMPTs = true;
+
+		if (newHandle)
+		{
+			size_t	oldNumMPTs = fMPTList.size ();
+
+			this->ResyncMPTList ();
+
+			sameMPTs = fMPTList.size () == oldNumMPTs;
+		}
+
+		const EmPalmChunk*	oldChunk = this->GetChunkContaining (chunkHdr);
+
+		if (sameMPTs && oldChunk && oldChunk->Free ())
+		{
+			EmPalmChunk	newChunk (*this, chunkHdr);
+
+			if (newChunk.End () <= oldChunk->End () &&
+				this->ResyncRange (chunkHdr, newChunk.End (), delta))
+			{
+				return;
+			}
+		}
+	}
+
+	this->ResyncAll (delta);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmHeap::ResyncFreedChunk
+ *
+ * DESCRIPTION:	Resynchronize after a chunk has been freed.  Freeing a
+ *				chunk never moves other chunks, but the freed chunk
+ *				may have been merged with the free chunks on either
+ *				side of it.
+ *
+ *				Does nothing if the heap is not "tracked".
+ *
+ * PARAMETERS:	chunkHdr - pointer to the header of the chunk that
+ *					was freed.
+ *
+ *				delta - optional collection to receive the list of
+ *					chunks that are different between the current and
+ *					previous states of the heap.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmPalmHeap::ResyncFreedChunk (emuptr chunkHdr, EmPalmChunkList* delta)
+{
+	if (!this->Tracked ())
+		return;
+
+	const EmPalmChunk*	oldChunk = this->GetChunkContaining (chunkHdr);
+
+	if (oldChunk && oldChunk->HeaderStart () == chunkHdr &&
+		this->ResyncRange (chunkHdr, oldChunk->End (), delta))
+	{
+		return;
+	}
+
+	this->ResyncAll (delta);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmHeap::ResyncResizedChunk
+ *
+ * DESCRIPTION:	Resynchronize after a chunk has been resized.  If the
+ *				chunk is still where it was and either shrank or grew
+ *				only into free space, then no other chunks were moved
+ *				and only the chunks around it need to be rewalked.
+ *				Otherwise, the whole heap is rewalked.
+ *
+ *				Does nothing if the heap is not "tracked".
+ *
+ * PARAMETERS:	p - pointer to the body of the resized chunk.
+ *
+ *				delta - optional collection to receive the list of
+ *					chunks that are different between the current and
+ *					previous states of the heap.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmPalmHeap::ResyncResizedChunk (MemPtr p, EmPalmChunkList* delta)
+{
+	if (!this->Tracked ())
+		return;
+
+	emuptr				chunkHdr = ((emuptr)(uintptr_t) p) - fChunkHdrSize;
+	const EmPalmChunk*	oldChunk = p ? this->GetChunkContaining (chunkHdr) : NULL;
+
+	// Make sure it's the same chunk, and not some other chunk that
+	// was moved into the same location.
+
+	if (oldChunk && oldChunk->HeaderStart () == chunkHdr && !oldChunk->Free ())
+	{
+		EmPalmChunk	newChunk (*this, chunkHdr);
+		Bool		inPlace = newChunk.HOffset () == oldChunk->HOffset ();
+
+		// If it grew, all the chunks it grew over must have been free.
+
+		emuptr		oldEnd = oldChunk->End ();
+		emuptr		probe = oldEnd;
+
+		while (inPlace && probe < newChunk.End ())
+		{
+			const EmPalmChunk*	nextChunk = this->GetChunkContaining (probe);
+
+			if (!nextChunk || !nextChunk->Free ())
+				inPlace = false;
+			else
+				probe = nextChunk->End ();
+		}
+
+		if (inPlace &&
+			this->ResyncRange (chunkHdr, max (oldEnd, newChunk.End ()), delta))
+		{
+			return;
+		}
+	}
+
+	this->ResyncAll (delta);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmHeap::ResyncRange
+ *
+ * DESCRIPTION:	Resynchronize our notion of the chunks in the given
+ *				range of the heap, which must not have moved any chunks
+ *				outside of it.  The walk starts at the chunk before
+ *				"start" (in case a free chunk there was merged with or
+ *				split from the one at "start"), and continues until it
+ *				finds a chunk at or after "end" that matches what we
+ *				had before.
+ *
+ *				Free chunks outside of the range are also reread, as
+ *				they're linked together in version 3 and later heaps.
+ *
+ * PARAMETERS:	start, end - the range of the heap that changed.
+ *
+ *				delta - optional collection to receive the list of
+ *					chunks that are different between the current and
+ *					previous states of the heap.
+ *
+ * RETURNED:	True if the chunk list was updated.  False if our
+ *				notion of the heap doesn't match what's there, in
+ *				which case the caller needs to resync the whole heap.
+ *
+ ***********************************************************************/
+
+Bool EmPalmHeap::ResyncRange (emuptr start, emuptr end, EmPalmChunkList* delta)
+{
+	const EmPalmChunk*	startChunk = this->GetChunkContaining (start);
+
+	if (!startChunk)
+		return false;
+
+	size_t	first = startChunk - &fChunkList[0];
+
+	if (first > 0)
+		--first;
+
+	// Walk the heap from the first affected chunk until we get back in
+	// step with our old chunk list.  "last" tracks the first old chunk
+	// that's not before the chunk being examined.
+
+	EmPalmChunkList	newChunks;
+	size_t			last = first;
+	emuptr			chunkHdr = fChunkList[first].HeaderStart ();
+
+	while (1)
+	{
+		while (last < fChunkList.size () && fChunkList[last].HeaderStart () < chunkHdr)
+		{
+			++last;
+		}
+
+		// Get information about the current chunk.
+
+		EmPalmChunk		chunk (*this, chunkHdr);
+
+		// If the size is zero, we've reached the sentinel at the end.
+
+		if (chunk.Size () == 0)
+		{
+			last = fChunkList.size ();
+			break;
+		}
+
+		// If we're past the changed range and this chunk hasn't
+		// changed, then the rest of the heap hasn't changed, either.
+
+		if (chunkHdr >= end && last < fChunkList.size () &&
+			fChunkList[last].HeaderStart () == chunkHdr &&
+			fChunkList[last].CompareForDelta (chunk))
+		{
+			break;
+		}
+
+		// See if this chunk looks valid.  An exception is thrown if not.
+
+		chunk.Validate (*this);
+
+		newChunks.push_back (chunk);
+
+		chunkHdr += chunk.Size ();
+	}
+
+	// Check the free chunks outside of the range before changing
+	// anything, so that the caller can still fall back to a full
+	// resync.
+
+	EmPalmChunkList	freeChunks;
+
+	if (!this->ResyncFreeChunks (first, last, freeChunks))
+		return false;
+
+	// Replace the old chunks with the new ones.
+
+	EmPalmChunkList	oldChunks (fChunkList.begin () + first, fChunkList.begin () + last);
+
+	fChunkList.erase (fChunkList.begin () + first, fChunkList.begin () + last);
+	fChunkList.insert (fChunkList.begin () + first, newChunks.begin (), newChunks.end ());
+
+	if (delta)
+		this->GenerateDeltas (oldChunks, newChunks, *delta);
+
+	// Update the free chunks whose links changed.  Both lists are
+	// sorted by address.
+
+	EmPalmChunkList::iterator		iter = fChunkList.begin ();
+	EmPalmChunkList::const_iterator	freeIter = freeChunks.begin ();
+
+	while (freeIter != freeChunks.end ())
+	{
+		while (iter->HeaderStart () < freeIter->HeaderStart ())
+		{
+			++iter;
+		}
+
+		*iter = *freeIter;
+
+		if (delta)
+			delta->push_back (*freeIter);
+
+		++freeIter;
+	}
+
+	++fgPartialResyncCount;
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmHeap::ResyncFreeChunks
+ *
+ * DESCRIPTION:	Reread the headers of the free chunks on either side of
+ *				a range of the chunk list.  In heaps with a free list,
+ *				the handle offset of a free chunk points to the next
+ *				free chunk, so allocating or freeing a chunk changes
+ *				the header of a free chunk outside of the range.  The
+ *				Memory Manager keeps the free list in address order,
+ *				so that can only be the nearest free chunk before or
+ *				after the range.
+ *
+ * PARAMETERS:	skipBegin, skipEnd - range of chunks in the chunk list
+ *					that are being reread anyway.
+ *
+ *				changed - collection to receive the free chunks that
+ *					are different, in address order.
+ *
+ * RETURNED:	False if a chunk we think is free isn't, or has changed
+ *				size.
+ *
+ ***********************************************************************/
+
+Bool EmPalmHeap::ResyncFreeChunks (size_t skipBegin, size_t skipEnd, EmPalmChunkList& changed)
+{
+	if (fVersion < kVersion3)
+		return true;
+
+	size_t	neighbors[2];
+	int		numNeighbors = 0;
+
+	size_t	ii = skipBegin;
+	while (ii > 0)
+	{
+		--ii;
+
+		if (fChunkList[ii].Free ())
+		{
+			neighbors[numNeighbors++] = ii;
+			break;
+		}
+	}
+
+	for (ii = skipEnd; ii < fChunkList.size (); ++ii)
+	{
+		if (fChunkList[ii].Free ())
+		{
+			neighbors[numNeighbors++] = ii;
+			break;
+		}
+	}
+
+	for (int jj = 0; jj < numNeighbors; ++jj)
+	{
+		const EmPalmChunk&	oldChunk = fChunkList[neighbors[jj]];
+		EmPalmChunk			chunk (*this, oldChunk.HeaderStart ());
+
+		if (!chunk.Free () || chunk.Size () != oldChunk.Size ())
+			return false;
+
+		if (!oldChunk.CompareForDelta (chunk))
+			changed.push_back (chunk);
+	}
+
+	return true;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	EmPalmHeap::GenerateDeltas
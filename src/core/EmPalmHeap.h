@@ -80,6 +80,7 @@ class EmPalmHeap
 														 UInt16 attributes,
 														 EmPalmChunkList* = NULL);
 		static void				MemChunkFree			(EmPalmHeap* heap,
+														 MemPtr,
 														 EmPalmChunkList* = NULL);
 
 		static void				MemPtrNew				(MemPtr,
@@ -92,6 +93,8 @@ class EmPalmHeap
 		static void				MemHandleResize			(MemHandle,
 														 EmPalmChunkList* = NULL);
 		static void				MemHandleFree			(EmPalmHeap* heap,
+														 MemHandle,
+														 emuptr chunkHdr,
 														 EmPalmChunkList* = NULL);
 
 		static void				MemLocalIDToLockedPtr	(MemPtr,
@@ -114,6 +117,9 @@ class EmPalmHeap
 		static MemPtr			DerefHandle				(MemHandle h);
 		static MemHandle		RecoverHandle			(MemPtr p);
 
+		static uint32			GetFullResyncCount		(void);
+		static uint32			GetPartialResyncCount	(void);
+
 	private:
 		static void				AddHeap					(UInt16 heapID);
 		static int32			GetHeapVersion			(emuptr	heapHdr);
@@ -122,6 +128,9 @@ class EmPalmHeap
 	
 		static EmPalmHeapList	fgHeapList;
 
+		static uint32			fgFullResyncCount;
+		static uint32			fgPartialResyncCount;
+
 
 // ===== Object member functions =====
 
@@ -141,6 +150,8 @@ class EmPalmHeap
 		const EmPalmChunk*		GetChunkReferencedBy	(MemHandle) const;
 		const EmPalmChunk*		GetChunkContaining		(emuptr) const;
 		const EmPalmChunk*		GetChunkBodyContaining	(emuptr) const;
+		void					GetChunksContaining		(const std::vector<emuptr>&,
+														 std::vector<const EmPalmChunk*>&) const;
 
 		EmPalmMPTList::const_iterator
 								GetMPTListBegin			(void) const;
@@ -199,6 +210,20 @@ class EmPalmHeap
 		void					ResyncHdl				(MemHandle,
 														 EmPalmChunkList* delta);
 
+		void					ResyncNewChunk			(MemPtr,
+														 Bool newHandle,
+														 EmPalmChunkList* delta);
+		void					ResyncFreedChunk		(emuptr chunkHdr,
+														 EmPalmChunkList* delta);
+		void					ResyncResizedChunk		(MemPtr,
+														 EmPalmChunkList* delta);
+		Bool					ResyncRange				(emuptr start,
+														 emuptr end,
+														 EmPalmChunkList* delta);
+		Bool					ResyncFreeChunks		(size_t skipBegin,
+														 size_t skipEnd,
+														 EmPalmChunkList& changed);
+
 		void					GenerateDeltas			(const EmPalmChunkList& oldList,
 														 const EmPalmChunkList& newList,
 														 EmPalmChunkList& delta);
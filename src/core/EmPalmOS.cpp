@@ -30,6 +30,8 @@
 #include "EmPatchMgr.h"			// EmPatchMgr
 #include "EmPatchState.h"		// EmPatchState
 #include "EmSession.h"			// gSession->Reset
+#include "EmSymbolIndex.h"		// EmSymbolIndex::Reset
+#include "EmSysCallTrace.h"		// EmSysCallTrace::RecordCall
 #include "ErrorHandling.h"		// Errors::ReportInvalidPC
 #include "Logging.h"			// LogSystemCalls
 #include "MetaMemory.h"			// MetaMemory::InRAMOSComponent
@@ -154,6 +156,7 @@ void EmPalmOS::Reset (void)
 	Platform_NetLib::Reset ();
 	EmPalmHeap::Reset ();
 	EmLowMem::Reset ();
+	EmSymbolIndex::Reset ();
 
 	// If the appropriate modifier key is down, install a temporary breakpoint
 	// at the start of the Big ROM.
@@ -243,6 +246,7 @@ void EmPalmOS::Load (SessionFile& f)
 	Platform_NetLib::Load (f);
 	EmPalmHeap::Load (f);
 	EmLowMem::Load (f);
+	EmSymbolIndex::Load ();
 
 	Chunk	chunk;
 	if (f.ReadStackInfo (chunk))
@@ -293,6 +297,7 @@ void EmPalmOS::Load (SessionFile& f)
 
 void EmPalmOS::Dispose (void)
 {
+	EmSymbolIndex::Reset ();
 	EmLowMem::Dispose ();
 	EmPalmHeap::Dispose ();
 	Platform_NetLib::Dispose ();
@@ -1548,8 +1553,10 @@ Bool EmPalmOS::HandleSystemCall (Bool fromTrap)
 	// ======================================================================
 
 	SystemCallContext	context;
-	Bool				gotFunction = GetSystemCallContext (
-								gCPU->GetPC () - pcAdjust, context);
+	HeadpatchProc		hp;
+	TailpatchProc		tp;
+	Bool				gotFunction = EmPatchMgr::GetSystemCallContext (
+								gCPU->GetPC () - pcAdjust, context, hp, tp);
 
 
 	// ======================================================================
@@ -1585,17 +1592,7 @@ Bool EmPalmOS::HandleSystemCall (Bool fromTrap)
 
 	if (!gSession->IsNested () && LogSystemCalls ())
 	{
-		char	name [sysPktMaxNameLen];
-
-		strcpy (name, ::GetTrapName (context, true));
-
-		EmStackFrameList	stackCrawl;
-		EmPalmOS::GenerateStackCrawl (stackCrawl);
-
-		string	dots ("|-|-|-|-|-|-|-|-|-|-|-|-|-|-|-|-|-|-|-|-");
-		dots.resize (stackCrawl.size ());
-
-		LogAppendMsg ("--- System Call 0x%04X: %s%s.", (long) context.fTrapWord, dots.c_str (), name);
+		EmSysCallTrace::RecordCall (context);
 	}
 
 
@@ -1649,7 +1646,33 @@ Bool EmPalmOS::HandleSystemCall (Bool fromTrap)
 	// If this trap is patched, let the patch handler handle the patch.
 	// ======================================================================
 
-	CallROMType result = EmPatchMgr::HandleSystemCall (context);
+	CallROMType result = EmPatchMgr::HandleSystemCall (context, hp, tp);
+
+
+	// ======================================================================
+	//	If the head patch couldn't complete the function yet (say, it's
+	//	waiting on a host socket), back the PC up so that the call is made
+	//	again, and park the CPU until the next interrupt.  The call is
+	//	retried once per interrupt (the system tick, usually) rather than
+	//	spinning, and the emulated clock keeps going in the meantime.
+	// ======================================================================
+
+	if (result == kRetryCall)
+	{
+#if HAS_PROFILING
+		if (gProfilingEnabled)
+		{
+			ProfileFnExit (context.fNextPC, context.fTrapWord);
+		}
+
+		gProfilingCounted = oldProfilingCounted;
+#endif
+
+		gCPU->SetPC (context.fPC);
+		gCPU68K->Park ();
+
+		return true;
+	}
 
 
 	// ======================================================================
@@ -16,6 +16,19 @@
 
 #include "Platform.h"			// Platform::AllocateMemory
 
+#include <algorithm>			// min
+
+// The SSE2 and AVX2 scanline converters are built with GCC/Clang target
+// attributes and chosen at runtime, so they don't need any special
+// compiler flags.  Elsewhere, only the scalar converters are used.
+
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+	#define HAS_SIMD_CONVERTERS	1
+	#include <immintrin.h>
+#else
+	#define HAS_SIMD_CONVERTERS	0
+#endif
+
 using namespace std;
 
 /*
@@ -42,6 +55,13 @@ using namespace std;
 	some of Poser's facilities.  It can flip all of the scanlines in order
 	to help interoperate with Windows BMPs; it can create an outline region
 	that can be used to create a host window's border; etc.
+
+	Every pair of formats in FOR_EACH_FORMAT has a scalar scanline
+	converter.  Converting to a smaller indexed depth maps each color to
+	the nearest one in the destination color table.  On x86 hosts, the
+	direct-to-direct and indexed-to-32-bit conversions use SSE2 or AVX2
+	converters instead, depending on what the CPU supports.  The scalar
+	converters define what the SIMD ones must produce.
 */
 
 
@@ -54,6 +74,8 @@ static uint32*	gConvert2To8;	// Used to convert an 8-bit byte consisting of 4 2-
 static uint16*	gConvert4To8;	// Used to convert an 8-bit byte consisting of 2 4-bit pixels
 								// to a 16-bit value containing 4 8-bit pixels.
 
+static int		gSIMDLevel = -1;	// kPixMapSIMDNone, etc., or -1 if not determined yet.
+
 struct ScanlineParms
 {
 	uint8*			fDestScanline;
@@ -62,6 +84,13 @@ struct ScanlineParms
 	const RGBList*	fSrcColors;
 	EmCoord			fLeft;
 	EmCoord			fRight;
+
+	// Prepared by CopyRect for the converters that need them.
+
+	int				fSrcDepth;
+	const uint8*	fIndexMap;		// Src index -> dest index, when reducing the depth
+	const uint32*	fSrcPixels;		// Src colors as 32-bit dest pixels
+	const uint8*	fShuffle;		// Src byte for each dest byte of 4 pixels, or 0x80
 };
 
 
@@ -75,6 +104,15 @@ typedef void (*ScanlineConverter) (const ScanlineParms&);
 static void				PrvMakeMask		(void* dstPtr, void* srcPtr, long rowBytes, long width, long height);
 static void				PrvAddToRegion	(EmRegion& region, int top, int left, int right);
 static EmPixMapDepth	PrvGetDepth		(EmPixMapFormat);
+static void				PrvGetChannelOffsets	(EmPixMapFormat, int offsets[4]);
+static void				PrvMakeShuffle	(EmPixMapFormat src, EmPixMapFormat dest, uint8 shuffle[16]);
+static void				PrvMakeSrcPixels	(const RGBList&, EmPixMapFormat dest, uint32 pixels[256]);
+static void				PrvMakeIndexMap	(const RGBList& src, int srcDepth, const RGBList* dest, int destDepth, uint8 map[256]);
+static uint8			PrvFindNearestColor	(const RGBList&, int numColors, uint8 r, uint8 g, uint8 b);
+static uint8			PrvGetPackedPixel	(const uint8* scanline, EmCoord xx, int depth);
+static void				PrvConvertIndexToIndex	(const ScanlineParms&, int destDepth);
+static int				PrvGetSIMDLevel	(void);
+static ScanlineConverter	PrvGetSIMDConverter	(EmPixMapFormat src, EmPixMapFormat dest);
 
 #define DECLARE_CONVERTER(src_format, dest_format)				\
 	static void PrvConvert##src_format##To##dest_format (const ScanlineParms&);
@@ -295,7 +333,7 @@ FOR_EACH_FORMAT_PAIR (DECLARE_CONVERTER)
 	EmAssert (srcColors);										\
 															\
 	EmCoord xx = 0;											\
-	while (1)												\
+	while (xx < right)										\
 	{														\
 		uint8	bits = *srcPtr++;							\
 		CONVERT_PACKED_BYTE_##src_format(dest_format)		\
@@ -347,6 +385,56 @@ FOR_EACH_FORMAT_PAIR (DECLARE_CONVERTER)
 	}
 
 
+#define STD_DIRECT_TO_INDEX_CONVERT(src_format, dest_depth)	\
+	EmCoord			right		= parms.fRight;				\
+	uint8*			destPtr		= parms.fDestScanline;		\
+	const uint8*	srcPtr		= parms.fSrcScanline;		\
+	const RGBList*	destColors	= parms.fDestColors;		\
+															\
+	EmAssert (destColors);									\
+															\
+	const int		kFirstShift	= 8 - dest_depth;			\
+	int				shift		= kFirstShift;				\
+	uint8			aByte		= 0;						\
+															\
+	/* Runs of the same color are common, so remember */	\
+	/* the last one looked up. */							\
+															\
+	uint32			lastColor	= 0xFFFFFFFF;				\
+	uint8			lastIndex	= 0;						\
+															\
+	for (EmCoord xx = 0; xx < right; ++xx)					\
+	{														\
+		uint8	r, g, b, a;									\
+		GET_##src_format(srcPtr, r, g, b, a)				\
+		(void) a;	/* Indexed formats have no alpha. */	\
+															\
+		uint32	color = (r << 16) | (g << 8) | b;			\
+															\
+		if (color != lastColor)								\
+		{													\
+			lastColor = color;								\
+			lastIndex = ::PrvFindNearestColor (*destColors,	\
+				1 << dest_depth, r, g, b);					\
+		}													\
+															\
+		aByte |= lastIndex << shift;						\
+															\
+		shift -= dest_depth;								\
+		if (shift < 0)										\
+		{													\
+			*destPtr++	= aByte;							\
+			shift		= kFirstShift;						\
+			aByte		= 0;								\
+		}													\
+	}														\
+															\
+	if (shift != kFirstShift)								\
+	{														\
+		*destPtr++ = aByte;									\
+	}
+
+
 /***********************************************************************
  *
  * FUNCTION:	EmPixMap constructor
@@ -1226,6 +1314,49 @@ EmPixMap::ConvertToFormat	(EmPixMapFormat destFormat)
 }
 
 
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPixMap::GetSIMDLevel
+ *
+ * DESCRIPTION:	Return which SIMD scanline converters CopyRect uses.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	The SIMD level.
+ *
+ ***********************************************************************/
+
+EmPixMapSIMDLevel
+EmPixMap::GetSIMDLevel	(void)
+{
+	return (EmPixMapSIMDLevel) ::PrvGetSIMDLevel ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPixMap::SetSIMDLevel
+ *
+ * DESCRIPTION:	Limit CopyRect to the SIMD scanline converters up to
+ *				the given level; kPixMapSIMDNone selects the scalar
+ *				ones.  The level is never raised beyond what the host
+ *				CPU supports.  Used to compare the converters against
+ *				each other.
+ *
+ * PARAMETERS:	level - the highest SIMD level to use.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+EmPixMap::SetSIMDLevel	(EmPixMapSIMDLevel level)
+{
+	gSIMDLevel = -1;
+	gSIMDLevel = min ((int) level, ::PrvGetSIMDLevel ());
+}
+
 /***********************************************************************
  *
  * FUNCTION:	CopyRect
@@ -1236,9 +1367,9 @@ EmPixMap::ConvertToFormat	(EmPixMapFormat destFormat)
  *
  *				RESTRICTIONS: Currently, no translation of pixels can
  *					occur.  Additionally, the only scaling allowed
- *					is scaling up by a factor of two.  Finally, no
- *					depth conversions will take place if the process
- *					requires an inverse table lookup.
+ *					is scaling up by a factor of two.  Conversions
+ *					that require an inverse table lookup use the
+ *					nearest color in dest's color table.
  *
  * PARAMETERS:	dest - pixmap to receive the pixels.
  *
@@ -1289,6 +1420,39 @@ EmPixMap::CopyRect	(EmPixMap& dest, const EmPixMap& src,
 	parms.fLeft				= srcRect.fLeft;
 	parms.fRight			= srcRect.fRight;
 
+	parms.fSrcDepth			= src.GetDepth ();
+	parms.fIndexMap			= NULL;
+	parms.fSrcPixels		= NULL;
+	parms.fShuffle			= NULL;
+
+	// Prepare the tables that some converters need: a map from source
+	// to destination indexes when reducing the depth of an indexed
+	// pixmap, the source colors as destination pixels when converting
+	// from an indexed pixmap to a 32-bit one, and the byte
+	// arrangement when converting between direct formats.
+
+	uint8	indexMap[256];
+	uint32	srcPixels[256];
+	uint8	shuffle[16];
+
+	if (parms.fSrcColors && dest.GetDepth () < parms.fSrcDepth)
+	{
+		::PrvMakeIndexMap (*parms.fSrcColors, parms.fSrcDepth,
+			parms.fDestColors, dest.GetDepth (), indexMap);
+		parms.fIndexMap = indexMap;
+	}
+
+	if (parms.fSrcColors && dest.GetDepth () == 32)
+	{
+		::PrvMakeSrcPixels (*parms.fSrcColors, dest.GetFormat (), srcPixels);
+		parms.fSrcPixels = srcPixels;
+	}
+
+	if (!parms.fSrcColors && !parms.fDestColors)
+	{
+		::PrvMakeShuffle (src.GetFormat (), dest.GetFormat (), shuffle);
+		parms.fShuffle = shuffle;
+	}
 
 	// Determine what scanline converter to use.
 
@@ -1308,6 +1472,13 @@ EmPixMap::CopyRect	(EmPixMap& dest, const EmPixMap& src,
 
 	EmAssert (conv);
 
+	ScanlineConverter	simdConv = ::PrvGetSIMDConverter (src.GetFormat (), dest.GetFormat ());
+
+	if (simdConv)
+	{
+		conv = simdConv;
+	}
+
 	// Create any tables we (might) need.
 
 	::Get1To8Table ();
@@ -1910,14 +2081,22 @@ void PrvConvert1To1 (const ScanlineParms& parms)
 	STD_NO_CONVERT(1)
 }
 
-void PrvConvert1To2 (const ScanlineParms& /*parms*/)
+void PrvConvert1To2 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	// Note, this conversion assumes that the first two entries of
+	// the destination color table contains the same colors as the
+	// first two entries in the source color table.
+
+	::PrvConvertIndexToIndex (parms, 2);
 }
 
-void PrvConvert1To4 (const ScanlineParms& /*parms*/)
+void PrvConvert1To4 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	// Note, this conversion assumes that the first two entries of
+	// the destination color table contains the same colors as the
+	// first two entries in the source color table.
+
+	::PrvConvertIndexToIndex (parms, 4);
 }
 
 void PrvConvert1To8 (const ScanlineParms& parms)
@@ -1994,9 +2173,9 @@ void PrvConvert1To32BGRA (const ScanlineParms& parms)
 
 #pragma mark -
 
-void PrvConvert2To1 (const ScanlineParms& /*parms*/)
+void PrvConvert2To1 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	::PrvConvertIndexToIndex (parms, 1);
 }
 
 void PrvConvert2To2 (const ScanlineParms& parms)
@@ -2004,9 +2183,13 @@ void PrvConvert2To2 (const ScanlineParms& parms)
 	STD_NO_CONVERT(2)
 }
 
-void PrvConvert2To4 (const ScanlineParms& /*parms*/)
+void PrvConvert2To4 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	// Note, this conversion assumes that the first four entries of
+	// the destination color table contains the same colors as the
+	// first four entries in the source color table.
+
+	::PrvConvertIndexToIndex (parms, 4);
 }
 
 void PrvConvert2To8 (const ScanlineParms& parms)
@@ -2073,14 +2256,14 @@ void PrvConvert2To32BGRA (const ScanlineParms& parms)
 
 #pragma mark -
 
-void PrvConvert4To1 (const ScanlineParms& /*parms*/)
+void PrvConvert4To1 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	::PrvConvertIndexToIndex (parms, 1);
 }
 
-void PrvConvert4To2 (const ScanlineParms& /*parms*/)
+void PrvConvert4To2 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	::PrvConvertIndexToIndex (parms, 2);
 }
 
 void PrvConvert4To4 (const ScanlineParms& parms)
@@ -2187,22 +2370,23 @@ void PrvConvert8To1 (const ScanlineParms& parms)
 		}
 	}
 
-	// Write out any partially filled out byte.
+	// Write out any partially filled out byte.  (As in
+	// STD_DIRECT_TO_1_CONVERT, bitMask is never 0 here.)
 
-	if (bitMask != 0)
+	if (bitMask != 0x80)
 	{
 		*destPtr++ = aByte;
 	}
 }
 
-void PrvConvert8To2 (const ScanlineParms& /*parms*/)
+void PrvConvert8To2 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	::PrvConvertIndexToIndex (parms, 2);
 }
 
-void PrvConvert8To4 (const ScanlineParms& /*parms*/)
+void PrvConvert8To4 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	::PrvConvertIndexToIndex (parms, 4);
 }
 
 void PrvConvert8To8 (const ScanlineParms& parms)
@@ -2247,19 +2431,19 @@ void PrvConvert24RGBTo1 (const ScanlineParms& parms)
 	STD_DIRECT_TO_1_CONVERT(24RGB)
 }
 
-void PrvConvert24RGBTo2 (const ScanlineParms& /*parms*/)
+void PrvConvert24RGBTo2 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(24RGB, 2)
 }
 
-void PrvConvert24RGBTo4 (const ScanlineParms& /*parms*/)
+void PrvConvert24RGBTo4 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(24RGB, 4)
 }
 
-void PrvConvert24RGBTo8 (const ScanlineParms& /*parms*/)
+void PrvConvert24RGBTo8 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(24RGB, 8)
 }
 
 void PrvConvert24RGBTo24RGB (const ScanlineParms& parms)
@@ -2299,19 +2483,19 @@ void PrvConvert24BGRTo1 (const ScanlineParms& parms)
 	STD_DIRECT_TO_1_CONVERT(24BGR)
 }
 
-void PrvConvert24BGRTo2 (const ScanlineParms& /*parms*/)
+void PrvConvert24BGRTo2 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(24BGR, 2)
 }
 
-void PrvConvert24BGRTo4 (const ScanlineParms& /*parms*/)
+void PrvConvert24BGRTo4 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(24BGR, 4)
 }
 
-void PrvConvert24BGRTo8 (const ScanlineParms& /*parms*/)
+void PrvConvert24BGRTo8 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(24BGR, 8)
 }
 
 void PrvConvert24BGRTo24RGB (const ScanlineParms& parms)
@@ -2351,19 +2535,19 @@ void PrvConvert32ARGBTo1 (const ScanlineParms& parms)
 	STD_DIRECT_TO_1_CONVERT(32ARGB)
 }
 
-void PrvConvert32ARGBTo2 (const ScanlineParms& /*parms*/)
+void PrvConvert32ARGBTo2 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(32ARGB, 2)
 }
 
-void PrvConvert32ARGBTo4 (const ScanlineParms& /*parms*/)
+void PrvConvert32ARGBTo4 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(32ARGB, 4)
 }
 
-void PrvConvert32ARGBTo8 (const ScanlineParms& /*parms*/)
+void PrvConvert32ARGBTo8 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(32ARGB, 8)
 }
 
 void PrvConvert32ARGBTo24RGB (const ScanlineParms& parms)
@@ -2403,19 +2587,19 @@ void PrvConvert32ABGRTo1 (const ScanlineParms& parms)
 	STD_DIRECT_TO_1_CONVERT(32ABGR)
 }
 
-void PrvConvert32ABGRTo2 (const ScanlineParms& /*parms*/)
+void PrvConvert32ABGRTo2 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(32ABGR, 2)
 }
 
-void PrvConvert32ABGRTo4 (const ScanlineParms& /*parms*/)
+void PrvConvert32ABGRTo4 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(32ABGR, 4)
 }
 
-void PrvConvert32ABGRTo8 (const ScanlineParms& /*parms*/)
+void PrvConvert32ABGRTo8 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(32ABGR, 8)
 }
 
 void PrvConvert32ABGRTo24RGB (const ScanlineParms& parms)
@@ -2455,19 +2639,19 @@ void PrvConvert32RGBATo1 (const ScanlineParms& parms)
 	STD_DIRECT_TO_1_CONVERT(32RGBA)
 }
 
-void PrvConvert32RGBATo2 (const ScanlineParms& /*parms*/)
+void PrvConvert32RGBATo2 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(32RGBA, 2)
 }
 
-void PrvConvert32RGBATo4 (const ScanlineParms& /*parms*/)
+void PrvConvert32RGBATo4 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(32RGBA, 4)
 }
 
-void PrvConvert32RGBATo8 (const ScanlineParms& /*parms*/)
+void PrvConvert32RGBATo8 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(32RGBA, 8)
 }
 
 void PrvConvert32RGBATo24RGB (const ScanlineParms& parms)
@@ -2507,19 +2691,19 @@ void PrvConvert32BGRATo1 (const ScanlineParms& parms)
 	STD_DIRECT_TO_1_CONVERT(32BGRA)
 }
 
-void PrvConvert32BGRATo2 (const ScanlineParms& /*parms*/)
+void PrvConvert32BGRATo2 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(32BGRA, 2)
 }
 
-void PrvConvert32BGRATo4 (const ScanlineParms& /*parms*/)
+void PrvConvert32BGRATo4 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(32BGRA, 4)
 }
 
-void PrvConvert32BGRATo8 (const ScanlineParms& /*parms*/)
+void PrvConvert32BGRATo8 (const ScanlineParms& parms)
 {
-	EmAssert (false);
+	STD_DIRECT_TO_INDEX_CONVERT(32BGRA, 8)
 }
 
 void PrvConvert32BGRATo24RGB (const ScanlineParms& parms)
@@ -2551,3 +2735,674 @@ void PrvConvert32BGRATo32BGRA (const ScanlineParms& parms)
 {
 	STD_NO_CONVERT(32)
 }
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvGetChannelOffsets
+ *
+ * DESCRIPTION:	Return where each color component is stored within a
+ *				pixel of the given direct format.
+ *
+ * PARAMETERS:	f - the pixel format.
+ *
+ *				offsets - receives the byte offsets of the red, green,
+ *					blue, and alpha components, in that order.  An
+ *					offset is -1 if the pixel has no such component.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvGetChannelOffsets (EmPixMapFormat f, int offsets[4])
+{
+	static const int8 kOffsetArray[][4] =
+	{
+		{ 0, 1, 2, -1 },	// kPixMapFormat24RGB
+		{ 2, 1, 0, -1 },	// kPixMapFormat24BGR
+		{ 1, 2, 3,  0 },	// kPixMapFormat32ARGB
+		{ 3, 2, 1,  0 },	// kPixMapFormat32ABGR
+		{ 0, 1, 2,  3 },	// kPixMapFormat32RGBA
+		{ 2, 1, 0,  3 }		// kPixMapFormat32BGRA
+	};
+
+	COMPILE_TIME_ASSERT (countof (kOffsetArray) == kPixMapFormatLast - kPixMapFormat24RGB);
+
+	for (int ii = 0; ii < 4; ++ii)
+	{
+		offsets[ii] = f >= kPixMapFormat24RGB ? kOffsetArray[f - kPixMapFormat24RGB][ii] : -1;
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvMakeShuffle
+ *
+ * DESCRIPTION:	Work out how to rearrange the bytes of four pixels in
+ *				one direct format into four pixels of another.  This
+ *				is the control vector for a byte shuffle instruction.
+ *
+ * PARAMETERS:	src - the source pixel format.
+ *
+ *				dest - the destination pixel format.
+ *
+ *				shuffle - receives, for each of the destination bytes,
+ *					the offset of the source byte it comes from, or 0x80
+ *					if it should be zero (alpha from a 24-bit pixel).
+ *					Unused bytes at the end are also 0x80.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvMakeShuffle (EmPixMapFormat src, EmPixMapFormat dest, uint8 shuffle[16])
+{
+	int		srcOffsets[4];
+	int		destOffsets[4];
+
+	::PrvGetChannelOffsets (src, srcOffsets);
+	::PrvGetChannelOffsets (dest, destOffsets);
+
+	int		srcBytes	= ::PrvGetDepth (src) / 8;
+	int		destBytes	= ::PrvGetDepth (dest) / 8;
+
+	memset (shuffle, 0x80, 16);
+
+	for (int pixel = 0; pixel < 4; ++pixel)
+	{
+		for (int channel = 0; channel < 4; ++channel)
+		{
+			if (destOffsets[channel] < 0)
+				continue;
+
+			shuffle[pixel * destBytes + destOffsets[channel]] =
+				srcOffsets[channel] < 0 ? 0x80 : pixel * srcBytes + srcOffsets[channel];
+		}
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvMakeSrcPixels
+ *
+ * DESCRIPTION:	Convert a color table into an array of 32-bit pixels,
+ *				as they would appear in memory in the given format.
+ *				Alpha is zero, as in the scalar converters.
+ *
+ * PARAMETERS:	colors - the color table.
+ *
+ *				dest - the 32-bit pixel format.
+ *
+ *				pixels - receives the pixels.  Entries past the end of
+ *					the color table are zero.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvMakeSrcPixels (const RGBList& colors, EmPixMapFormat dest, uint32 pixels[256])
+{
+	int		offsets[4];
+	::PrvGetChannelOffsets (dest, offsets);
+
+	size_t	numColors = min (colors.size (), (size_t) 256);
+
+	memset (pixels, 0, 256 * sizeof (uint32));
+
+	for (size_t ii = 0; ii < numColors; ++ii)
+	{
+		uint8	bytes[4] = { 0, 0, 0, 0 };
+
+		bytes[offsets[0]] = colors[ii].fRed;
+		bytes[offsets[1]] = colors[ii].fGreen;
+		bytes[offsets[2]] = colors[ii].fBlue;
+
+		memcpy (&pixels[ii], bytes, sizeof (uint32));
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvMakeIndexMap
+ *
+ * DESCRIPTION:	Work out which destination index to use for each
+ *				source index when converting an indexed pixmap to a
+ *				smaller indexed depth.  1-bpp destinations are assumed
+ *				to be white/black, and get the same threshold that
+ *				PrvConvert8To1 uses.  Anything else gets the nearest
+ *				color in the destination color table.
+ *
+ * PARAMETERS:	src - the source color table.
+ *
+ *				srcDepth - the source depth.
+ *
+ *				dest - the destination color table.
+ *
+ *				destDepth - the destination depth.
+ *
+ *				map - receives the destination indexes.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvMakeIndexMap (const RGBList& src, int srcDepth,
+					  const RGBList* dest, int destDepth, uint8 map[256])
+{
+	memset (map, 0, 256);
+
+	int		numColors = min ((int) src.size (), 1 << srcDepth);
+
+	for (int ii = 0; ii < numColors; ++ii)
+	{
+		const RGBType&	rgb = src[ii];
+
+		if (destDepth == 1)
+		{
+			map[ii] = rgb.fRed < 0xC0 || rgb.fGreen < 0xC0 || rgb.fBlue < 0xC0;
+		}
+		else
+		{
+			EmAssert (dest);
+
+			map[ii] = ::PrvFindNearestColor (*dest, 1 << destDepth,
+				rgb.fRed, rgb.fGreen, rgb.fBlue);
+		}
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvFindNearestColor
+ *
+ * DESCRIPTION:	Find the color table entry closest to the given color.
+ *
+ * PARAMETERS:	colors - the color table.
+ *
+ *				numColors - the number of entries the pixel depth can
+ *					address.  Entries past that are ignored.
+ *
+ *				r, g, b - the color.
+ *
+ * RETURNED:	The index of the closest entry.
+ *
+ ***********************************************************************/
+
+uint8 PrvFindNearestColor (const RGBList& colors, int numColors,
+						   uint8 r, uint8 g, uint8 b)
+{
+	int		count		= min ((int) colors.size (), numColors);
+	uint8	result		= 0;
+	int32	bestDist	= 0x7FFFFFFF;
+
+	for (int ii = 0; ii < count; ++ii)
+	{
+		int32	dr		= (int32) colors[ii].fRed - r;
+		int32	dg		= (int32) colors[ii].fGreen - g;
+		int32	db		= (int32) colors[ii].fBlue - b;
+		int32	dist	= dr * dr + dg * dg + db * db;
+
+		if (dist < bestDist)
+		{
+			bestDist	= dist;
+			result		= ii;
+
+			if (dist == 0)
+				break;
+		}
+	}
+
+	return result;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvGetPackedPixel
+ *
+ * DESCRIPTION:	Return a pixel from a 1-, 2-, 4-, or 8-bpp scanline.
+ *
+ * PARAMETERS:	scanline - the scanline.
+ *
+ *				xx - the pixel's horizontal position.
+ *
+ *				depth - the scanline's depth.
+ *
+ * RETURNED:	The pixel's index.
+ *
+ ***********************************************************************/
+
+uint8 PrvGetPackedPixel (const uint8* scanline, EmCoord xx, int depth)
+{
+	int		perByte	= 8 / depth;
+	int		shift	= 8 - depth * (xx % perByte + 1);
+
+	return (scanline[xx / perByte] >> shift) & ((1 << depth) - 1);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvConvertIndexToIndex
+ *
+ * DESCRIPTION:	Scanline converter for going between indexed depths.
+ *				When reducing the depth, indexes are mapped through
+ *				fIndexMap.  Otherwise, they're left as they are.
+ *
+ * PARAMETERS:	parms - the scanline parameters.
+ *
+ *				destDepth - the destination depth.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvConvertIndexToIndex (const ScanlineParms& parms, int destDepth)
+{
+	EmCoord			right		= parms.fRight;
+	uint8*			destPtr		= parms.fDestScanline;
+	const uint8*	srcPtr		= parms.fSrcScanline;
+	const uint8*	indexMap	= parms.fIndexMap;
+	int				srcDepth	= parms.fSrcDepth;
+
+	EmAssert (indexMap || destDepth > srcDepth);
+
+	const int		kFirstShift	= 8 - destDepth;
+	int				shift		= kFirstShift;
+	uint8			aByte		= 0;
+
+	for (EmCoord xx = 0; xx < right; ++xx)
+	{
+		uint8	index = ::PrvGetPackedPixel (srcPtr, xx, srcDepth);
+
+		if (indexMap)
+		{
+			index = indexMap[index];
+		}
+
+		aByte |= index << shift;
+
+		shift -= destDepth;
+		if (shift < 0)
+		{
+			*destPtr++	= aByte;
+			shift		= kFirstShift;
+			aByte		= 0;
+		}
+	}
+
+	if (shift != kFirstShift)
+	{
+		*destPtr++ = aByte;
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvGetSIMDLevel
+ *
+ * DESCRIPTION:	Determine which of the SIMD scanline converters the
+ *				host CPU can run.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	kPixMapSIMDNone, kPixMapSIMDSSE2, or kPixMapSIMDAVX2.
+ *				EmPixMap::SetSIMDLevel may have lowered it.
+ *
+ ***********************************************************************/
+
+int PrvGetSIMDLevel (void)
+{
+	if (gSIMDLevel < 0)
+	{
+		int		level = kPixMapSIMDNone;
+
+#if HAS_SIMD_CONVERTERS
+		__builtin_cpu_init ();
+
+		if (__builtin_cpu_supports ("avx2"))
+			level = kPixMapSIMDAVX2;
+		else if (__builtin_cpu_supports ("sse2"))
+			level = kPixMapSIMDSSE2;
+#endif
+
+		gSIMDLevel = level;
+	}
+
+	return gSIMDLevel;
+}
+
+
+#pragma mark -
+
+#if HAS_SIMD_CONVERTERS
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvConvertMToNSSE2, PrvConvertMToNAVX2
+ *
+ * DESCRIPTION:	SIMD scanline converters.  Each handles a whole family
+ *				of format pairs, using the tables CopyRect prepared in
+ *				ScanlineParms.  Pixels left over at the end of the
+ *				scanline are converted one at a time, the same way.
+ *				Loads and stores never go past the pixels being
+ *				converted, so scanlines needn't be padded.
+ *
+ * PARAMETERS:	parms - the scanline parameters.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+// Convert one pixel with a shuffle made by PrvMakeShuffle.
+
+#define SHUFFLE_PIXEL(destPtr, srcPtr, shuffle, destBytes)				\
+	for (int jj = 0; jj < destBytes; ++jj)								\
+	{																	\
+		destPtr[jj] = shuffle[jj] & 0x80 ? 0 : srcPtr[shuffle[jj]];		\
+	}
+
+__attribute__ ((target ("sse2")))
+static void PrvConvert32To32SSE2 (const ScanlineParms& parms)
+{
+	// SSE2 has no byte shuffle, but every 32-bit format is a byte
+	// rotation or reversal of the others, so each destination byte
+	// can be shifted into place within its 32-bit lane and masked.
+	// Shifting by 32 or more gives zero, which lets each byte be
+	// shifted both ways without a branch.
+
+	EmCoord			right	= parms.fRight;
+	uint8*			destPtr	= parms.fDestScanline;
+	const uint8*	srcPtr	= parms.fSrcScanline;
+	const uint8*	shuffle	= parms.fShuffle;
+
+	__m128i			masks[4];
+	__m128i			leftCounts[4];
+	__m128i			rightCounts[4];
+
+	for (int jj = 0; jj < 4; ++jj)
+	{
+		int		delta = (jj - shuffle[jj]) * 8;
+
+		masks[jj]		= _mm_set1_epi32 ((int) (0xFFU << (jj * 8)));
+		leftCounts[jj]	= _mm_cvtsi32_si128 (delta >= 0 ? delta : 32);
+		rightCounts[jj]	= _mm_cvtsi32_si128 (delta >= 0 ? 32 : -delta);
+	}
+
+	EmCoord	xx = 0;
+
+	for (; xx + 4 <= right; xx += 4)
+	{
+		__m128i	src		= _mm_loadu_si128 ((const __m128i*) srcPtr);
+		__m128i	dest;
+
+		#define MOVE_BYTE(jj)												\
+			_mm_and_si128 (_mm_or_si128 (									\
+				_mm_sll_epi32 (src, leftCounts[jj]),						\
+				_mm_srl_epi32 (src, rightCounts[jj])), masks[jj])
+
+		dest = _mm_or_si128 (
+			_mm_or_si128 (MOVE_BYTE (0), MOVE_BYTE (1)),
+			_mm_or_si128 (MOVE_BYTE (2), MOVE_BYTE (3)));
+
+		#undef MOVE_BYTE
+
+		_mm_storeu_si128 ((__m128i*) destPtr, dest);
+
+		srcPtr += 16;
+		destPtr += 16;
+	}
+
+	for (; xx < right; ++xx)
+	{
+		SHUFFLE_PIXEL (destPtr, srcPtr, shuffle, 4)
+
+		srcPtr += 4;
+		destPtr += 4;
+	}
+}
+
+__attribute__ ((target ("avx2")))
+static void PrvConvert32To32AVX2 (const ScanlineParms& parms)
+{
+	EmCoord			right	= parms.fRight;
+	uint8*			destPtr	= parms.fDestScanline;
+	const uint8*	srcPtr	= parms.fSrcScanline;
+	const uint8*	shuffle	= parms.fShuffle;
+
+	__m256i			control	= _mm256_broadcastsi128_si256 (
+								_mm_loadu_si128 ((const __m128i*) shuffle));
+
+	EmCoord	xx = 0;
+
+	for (; xx + 8 <= right; xx += 8)
+	{
+		__m256i	src = _mm256_loadu_si256 ((const __m256i*) srcPtr);
+
+		_mm256_storeu_si256 ((__m256i*) destPtr, _mm256_shuffle_epi8 (src, control));
+
+		srcPtr += 32;
+		destPtr += 32;
+	}
+
+	for (; xx < right; ++xx)
+	{
+		SHUFFLE_PIXEL (destPtr, srcPtr, shuffle, 4)
+
+		srcPtr += 4;
+		destPtr += 4;
+	}
+}
+
+__attribute__ ((target ("avx2")))
+static void PrvConvert24To32AVX2 (const ScanlineParms& parms)
+{
+	// Each 128-bit lane gets four 24-bit pixels (12 bytes), read with
+	// a 16-byte load.  Stop while there are still enough source bytes
+	// left over that the last load stays within the scanline.
+
+	EmCoord			right	= parms.fRight;
+	uint8*			destPtr	= parms.fDestScanline;
+	const uint8*	srcPtr	= parms.fSrcScanline;
+	const uint8*	shuffle	= parms.fShuffle;
+
+	__m256i			control	= _mm256_broadcastsi128_si256 (
+								_mm_loadu_si128 ((const __m128i*) shuffle));
+
+	EmCoord	xx = 0;
+
+	for (; xx + 10 <= right; xx += 8)
+	{
+		__m128i	lo	= _mm_loadu_si128 ((const __m128i*) srcPtr);
+		__m128i	hi	= _mm_loadu_si128 ((const __m128i*) (srcPtr + 12));
+		__m256i	src	= _mm256_inserti128_si256 (_mm256_castsi128_si256 (lo), hi, 1);
+
+		_mm256_storeu_si256 ((__m256i*) destPtr, _mm256_shuffle_epi8 (src, control));
+
+		srcPtr += 24;
+		destPtr += 32;
+	}
+
+	for (; xx < right; ++xx)
+	{
+		SHUFFLE_PIXEL (destPtr, srcPtr, shuffle, 4)
+
+		srcPtr += 3;
+		destPtr += 4;
+	}
+}
+
+__attribute__ ((target ("avx2")))
+static void PrvConvertTo24AVX2 (const ScanlineParms& parms)
+{
+	// Handles both 32-bit and 24-bit sources.  Each 128-bit lane
+	// produces four 24-bit pixels (12 bytes), written with a 16-byte
+	// store that the next store partly overwrites.  Stop while there
+	// are still enough pixels left over that the last store stays
+	// within the scanline.
+
+	EmCoord			right		= parms.fRight;
+	uint8*			destPtr		= parms.fDestScanline;
+	const uint8*	srcPtr		= parms.fSrcScanline;
+	const uint8*	shuffle		= parms.fShuffle;
+	int				srcBytes	= parms.fSrcDepth / 8;
+
+	__m256i			control		= _mm256_broadcastsi128_si256 (
+									_mm_loadu_si128 ((const __m128i*) shuffle));
+
+	EmCoord	xx = 0;
+
+	for (; xx + 10 <= right; xx += 8)
+	{
+		__m128i	lo	= _mm_loadu_si128 ((const __m128i*) srcPtr);
+		__m128i	hi	= _mm_loadu_si128 ((const __m128i*) (srcPtr + 4 * srcBytes));
+		__m256i	src	= _mm256_inserti128_si256 (_mm256_castsi128_si256 (lo), hi, 1);
+		__m256i	dest = _mm256_shuffle_epi8 (src, control);
+
+		_mm_storeu_si128 ((__m128i*) destPtr, _mm256_castsi256_si128 (dest));
+		_mm_storeu_si128 ((__m128i*) (destPtr + 12), _mm256_extracti128_si256 (dest, 1));
+
+		srcPtr += 8 * srcBytes;
+		destPtr += 24;
+	}
+
+	for (; xx < right; ++xx)
+	{
+		SHUFFLE_PIXEL (destPtr, srcPtr, shuffle, 3)
+
+		srcPtr += srcBytes;
+		destPtr += 3;
+	}
+}
+
+__attribute__ ((target ("avx2")))
+static void PrvConvertIndexTo32AVX2 (const ScanlineParms& parms)
+{
+	// Unpack eight indexes at a time into 32-bit lanes, and look them
+	// up in the source colors (already in the destination format)
+	// with a gather.
+
+	EmCoord			right		= parms.fRight;
+	uint8*			destPtr		= parms.fDestScanline;
+	const uint8*	srcPtr		= parms.fSrcScanline;
+	const uint32*	srcPixels	= parms.fSrcPixels;
+	int				srcDepth	= parms.fSrcDepth;
+
+	EmAssert (srcPixels);
+
+	// Eight pixels take srcDepth bytes.  Read them as a big-endian
+	// value, and shift each pixel down to the bottom of its lane.
+
+	int				topShift	= srcDepth * 8;
+
+	__m256i			shifts		= _mm256_setr_epi32 (
+									topShift - srcDepth * 1, topShift - srcDepth * 2,
+									topShift - srcDepth * 3, topShift - srcDepth * 4,
+									topShift - srcDepth * 5, topShift - srcDepth * 6,
+									topShift - srcDepth * 7, topShift - srcDepth * 8);
+	__m256i			mask		= _mm256_set1_epi32 ((1 << srcDepth) - 1);
+
+	EmCoord	xx = 0;
+
+	for (; xx + 8 <= right; xx += 8)
+	{
+		__m256i	indexes;
+
+		if (srcDepth == 8)
+		{
+			indexes = _mm256_cvtepu8_epi32 (_mm_loadl_epi64 ((const __m128i*) srcPtr));
+		}
+		else
+		{
+			uint32	bits = 0;
+
+			for (int ii = 0; ii < srcDepth; ++ii)
+			{
+				bits = (bits << 8) | srcPtr[ii];
+			}
+
+			indexes = _mm256_and_si256 (
+				_mm256_srlv_epi32 (_mm256_set1_epi32 (bits), shifts), mask);
+		}
+
+		__m256i	pixels = _mm256_i32gather_epi32 ((const int*) srcPixels, indexes, 4);
+
+		_mm256_storeu_si256 ((__m256i*) destPtr, pixels);
+
+		srcPtr += srcDepth;
+		destPtr += 32;
+	}
+
+	for (; xx < right; ++xx)
+	{
+		uint8	index = ::PrvGetPackedPixel (parms.fSrcScanline, xx, srcDepth);
+
+		memcpy (destPtr, &srcPixels[index], sizeof (uint32));
+		destPtr += 4;
+	}
+}
+
+#endif	// HAS_SIMD_CONVERTERS
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvGetSIMDConverter
+ *
+ * DESCRIPTION:	Return the fastest SIMD scanline converter that the
+ *				host CPU can run for the given formats, if there is
+ *				one.  Identical formats are left to STD_NO_CONVERT.
+ *
+ * PARAMETERS:	src - the source pixel format.
+ *
+ *				dest - the destination pixel format.
+ *
+ * RETURNED:	The converter, or NULL if the scalar one should be
+ *				used.
+ *
+ ***********************************************************************/
+
+ScanlineConverter PrvGetSIMDConverter (EmPixMapFormat src, EmPixMapFormat dest)
+{
+#if HAS_SIMD_CONVERTERS
+	int		level		= ::PrvGetSIMDLevel ();
+	int		srcDepth	= ::PrvGetDepth (src);
+	int		destDepth	= ::PrvGetDepth (dest);
+
+	if (src == dest || srcDepth == 16 || destDepth == 16)
+	{
+		return NULL;
+	}
+
+	if (level >= kPixMapSIMDAVX2)
+	{
+		if (destDepth == 32 && srcDepth <= 8)
+			return &::PrvConvertIndexTo32AVX2;
+
+		if (destDepth == 32 && srcDepth == 32)
+			return &::PrvConvert32To32AVX2;
+
+		if (destDepth == 32 && srcDepth == 24)
+			return &::PrvConvert24To32AVX2;
+
+		if (destDepth == 24 && srcDepth >= 24)
+			return &::PrvConvertTo24AVX2;
+	}
+
+	if (level >= kPixMapSIMDSSE2)
+	{
+		if (destDepth == 32 && srcDepth == 32)
+			return &::PrvConvert32To32SSE2;
+	}
+#else
+	UNUSED_PARAM (src);
+	UNUSED_PARAM (dest);
+#endif
+
+	return NULL;
+}
@@ -44,6 +44,13 @@ enum EmPixMapFormat
 	kPixMapFormatLast
 };
 
+enum EmPixMapSIMDLevel
+{
+	kPixMapSIMDNone,
+	kPixMapSIMDSSE2,
+	kPixMapSIMDAVX2
+};
+
 
 class EmPixMap
 {
@@ -82,6 +89,9 @@ class EmPixMap
 		static void				CopyRect		(EmPixMap& dest, const EmPixMap& src,
 												 const EmRect& destRect, const EmRect& srcRect);
 
+		static EmPixMapSIMDLevel	GetSIMDLevel	(void);
+		static void				SetSIMDLevel	(EmPixMapSIMDLevel);
+
 	private:
 		EmPixMapRowBytes		DetermineRowBytes	(void) const;
 		void					InvalidateBuffer	(void);
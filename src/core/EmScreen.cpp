@@ -16,16 +16,83 @@
 
 #include "EmHAL.h"				// EmHAL:: GetLCDBeginEnd
 #include "EmMemory.h"			// CEnableFullAccess
+#include "Logging.h"			// LogAppendMsg
 #include "MetaMemory.h"			// MetaMemory::MarkScreen
+#include "PreferenceMgr.h"		// Preference, kPrefKeyLCDRefreshRate
+
+#include <atomic>				// atomic
 
 using namespace std;
 
-static emuptr	gScreenDirtyLow;
-static emuptr	gScreenDirtyHigh;
+// Screen writes are recorded in gScreenDirtyBits, one bit for each
+// kDirtyChunkSize bytes from gScreenBegin to gScreenEnd.  This lets
+// GetBits fetch just the scanlines that changed, rather than everything
+// from the lowest to the highest address touched (a blinking cursor at
+// the top of the screen and a clock at the bottom would otherwise cause
+// the whole screen to be refreshed).  gScreenAllDirty overrides the
+// bitmap when the whole screen needs to be redrawn.
+
+static ByteList	gScreenDirtyBits;
+static Bool		gScreenAllDirty;
 
 static emuptr	gScreenBegin;
 static emuptr	gScreenEnd;
 
+// How many scanlines GetBits fetched.  These are written on the CPU thread
+// and may be read on any other.
+
+static atomic<int32>	gLastDirtyLineCount;
+static atomic<uint32>	gTotalUpdates;
+static atomic<uint32>	gTotalDirtyLines;
+
+// The frame pipeline.  gCaptureInfo accumulates every scanline that
+// GetBits fetches on the CPU thread, so its image is always complete.
+// gLineSerials records the number of the frame in which each scanline
+// last changed.
+//
+// Frames are handed to the UI thread through three preallocated slots:
+// the CPU thread owns gBackFrame, the UI thread owns gFrontFrame, and
+// gMiddleFrame is the one in transit.  Publishing swaps the back slot
+// with the middle one and flags it as fresh; GetFrame swaps the front
+// slot with the middle one if it's fresh.  Neither side ever waits for
+// the other, and neither touches a slot the other owns.  A slot being
+// refilled only needs the scanlines that changed since it was last
+// filled, and the UI only needs to paint the ones that changed since
+// the frame it painted last.
+
+struct EmScreenFrame
+{
+	EmPixMap		fImage;
+	Bool			fLCDOn;
+	int32			fLeftMargin;
+	uint32			fSerial;		// 0 if never filled
+	vector<uint32>	fLineSerials;
+};
+
+enum { kNumFrames = 3, kFrameFresh = 0x80 };
+
+static EmScreenUpdateInfo	gCaptureInfo;
+static vector<uint32>		gLineSerials;
+static uint32				gFrameSerial;
+static uint32				gPublishedSerial;
+static uint32				gFrameStart;
+static int32				gRefreshRate;
+
+static EmScreenFrame		gFrames[kNumFrames];
+static int					gBackFrame;
+static atomic<int>			gMiddleFrame;
+static int					gFrontFrame;
+static uint32				gPaintedSerial;
+static atomic<bool>			gCapturing;
+
+static EmScreenFrameProc	gFrameProc;
+static void*				gFrameRefCon;
+
+static void		PrvResizeDirtyBits	(void);
+static void		PrvResetFrames		(void);
+static Bool		PrvCaptureFrame		(void);
+static void		PrvFillFrame		(EmScreenFrame&);
+
 
 /***********************************************************************
  *
@@ -44,11 +111,21 @@ static emuptr	gScreenEnd;
 
 void EmScreen::Initialize (void)
 {
-	gScreenDirtyLow		= EmMemEOM;
-	gScreenDirtyHigh 	= EmMemNULL;
+	gScreenAllDirty		= false;
 
 	gScreenBegin		= EmMemNULL;
 	gScreenEnd			= EmMemNULL;
+
+	gLastDirtyLineCount.store (0, memory_order_relaxed);
+	gTotalUpdates.store (0, memory_order_relaxed);
+	gTotalDirtyLines.store (0, memory_order_relaxed);
+
+	Preference<long>	prefRefreshRate (kPrefKeyLCDRefreshRate);
+
+	gRefreshRate		= *prefRefreshRate > 0 ? *prefRefreshRate : 60;
+
+	::PrvResizeDirtyBits ();
+	::PrvResetFrames ();
 }
 
 
@@ -71,11 +148,12 @@ void EmScreen::Initialize (void)
 
 void EmScreen::Reset (void)
 {
-	gScreenDirtyLow		= EmMemNULL;
-	gScreenDirtyHigh	= EmMemEOM;
+	gScreenAllDirty		= true;
 
 	gScreenBegin		= EmMemNULL;
 	gScreenEnd			= EmMemNULL;
+
+	::PrvResizeDirtyBits ();
 }
 
 
@@ -112,10 +190,11 @@ void EmScreen::Save (SessionFile&)
 
 void EmScreen::Load (SessionFile&)
 {
-	gScreenDirtyLow		= EmMemNULL;
-	gScreenDirtyHigh	= EmMemEOM;
+	gScreenAllDirty		= true;
 
 	EmHAL::GetLCDBeginEnd (gScreenBegin, gScreenEnd);
+
+	::PrvResizeDirtyBits ();
 }
 
 
@@ -135,6 +214,12 @@ void EmScreen::Load (SessionFile&)
 
 void EmScreen::Dispose (void)
 {
+	EmScreen::ReportDirtyLines ();
+
+	ByteList	empty;
+	gScreenDirtyBits.swap (empty);
+
+	::PrvResetFrames ();
 }
 
 
@@ -152,33 +237,27 @@ void EmScreen::Dispose (void)
 
 void EmScreen::MarkDirty (emuptr address, uint32 size)
 {
-	/*	
-		SUBTLE BUG NOTE:  Both of these tests need to be performed.
-		Originally, I had this as an if (...) ... else if (...) ... After
-		all, how could a given address be above the high- water mark if it
-		was below the low-water mark?  "Obviously", it couldn't, so I didn't
-		see the need to test against the high-water mark if we were below
-		the low-water mark.
-
-		Well, duh, that assumption was false.  After the LCD buffer is
-		copied to the screen, we set the low-water mark to the end of the
-		buffer and the high-water mark to the beginning of the buffer.  If
-		the screen is modified in such a way that each pixel affected
-		appears lower in memory than any previous pixel (as happens when we
-		scroll a document down), then we always entered the low-water mark
-		of the code below; we never entered the high-water mark of the code.
-		Thus, the high-water mark stayed set to the beginning of the
-		buffer, giving us a NULL update range.
-	*/
-
-	if (address < gScreenDirtyLow)
+	// Writes outside of the screen are of no interest.  (GetBits
+	// would clip them away anyway.)
+
+	uint32	offset = address - gScreenBegin;
+
+	if (offset >= gScreenEnd - gScreenBegin || size == 0)
+	{
+		return;
+	}
+
+	uint32	first	= offset >> EmScreenUpdateInfo::kDirtyChunkShift;
+	uint32	last	= (offset + size - 1) >> EmScreenUpdateInfo::kDirtyChunkShift;
+
+	if (last >= gScreenDirtyBits.size () * 8)
 	{
-		gScreenDirtyLow = address;
+		last = gScreenDirtyBits.size () * 8 - 1;
 	}
 
-	if (address + size > gScreenDirtyHigh)
+	for (uint32 chunk = first; chunk <= last; ++chunk)
 	{
-		gScreenDirtyHigh = address + size;
+		gScreenDirtyBits[chunk >> 3] |= 1 << (chunk & 7);
 	}
 }
 
@@ -197,8 +276,7 @@ void EmScreen::MarkDirty (emuptr address, uint32 size)
 
 void EmScreen::InvalidateAll (void)
 {
-	gScreenDirtyLow		= EmMemNULL;
-	gScreenDirtyHigh	= EmMemEOM;
+	gScreenAllDirty		= true;
 
 	emuptr newScreenBegin;
 	emuptr newScreenEnd;
@@ -212,6 +290,8 @@ void EmScreen::InvalidateAll (void)
 		gScreenEnd		= newScreenEnd;
 
 		MetaMemory::MarkScreen (gScreenBegin, gScreenEnd);
+
+		::PrvResizeDirtyBits ();
 	}
 }
 
@@ -247,18 +327,73 @@ Bool EmScreen::GetBits (EmScreenUpdateInfo& info)
 	emuptr screenEnd;
 	EmHAL::GetLCDBeginEnd (screenBegin, screenEnd);
 
+	// If the LCD has moved since we started tracking it (so that the
+	// bitmap no longer covers it), everything is dirty.
+
+	if (screenBegin != gScreenBegin || screenEnd != gScreenEnd)
+	{
+		gScreenAllDirty = true;
+	}
+
 	// Get the range of bytes affected, clipping to the range of the
-	// screen.  From this information, we can determine the first and
-	// last affected scanlines.
+	// screen.  From this information, and the bitmap of dirty chunks,
+	// GetLCDScanlines can determine which scanlines to fetch.  Clear
+	// the bitmap as we go so that it can be munged again by
+	// EmScreen::MarkDirty.
+
+	info.fDirtyBase		= screenBegin;
+	info.fScreenLow		= screenEnd;
+	info.fScreenHigh	= screenBegin;
+
+	if (gScreenAllDirty)
+	{
+		gScreenAllDirty = false;
+
+		info.fDirtyBits.clear ();
+		info.fScreenLow		= screenBegin;
+		info.fScreenHigh	= screenEnd;
+
+		fill (gScreenDirtyBits.begin (), gScreenDirtyBits.end (), 0);
+	}
+	else
+	{
+		size_t	numBytes = gScreenDirtyBits.size ();
+
+		info.fDirtyBits.resize (numBytes);
 
-	info.fScreenLow		= max (gScreenDirtyLow, screenBegin);
-	info.fScreenHigh	= min (gScreenDirtyHigh, screenEnd);
+		size_t	firstByte	= numBytes;
+		size_t	lastByte	= 0;
 
-	// Reset gScreenDirtyLow/High with sentinel values so that they can
-	// be munged again by EmScreen::MarkDirty.
+		for (size_t ii = 0; ii < numBytes; ++ii)
+		{
+			uint8	bits = gScreenDirtyBits[ii];
 
-	gScreenDirtyLow		= EmMemEOM;
-	gScreenDirtyHigh	= EmMemNULL;
+			info.fDirtyBits[ii] = bits;
+
+			if (bits)
+			{
+				gScreenDirtyBits[ii] = 0;
+
+				if (firstByte == numBytes)
+					firstByte = ii;
+
+				lastByte = ii;
+			}
+		}
+
+		if (firstByte < numBytes)
+		{
+			const int	kShift = EmScreenUpdateInfo::kDirtyChunkShift;
+
+			info.fScreenLow		= screenBegin + ((firstByte * 8) << kShift);
+			info.fScreenHigh	= screenBegin + (((lastByte + 1) * 8) << kShift);
+
+			info.fScreenLow		= max (info.fScreenLow, screenBegin);
+			info.fScreenHigh	= min (info.fScreenHigh, screenEnd);
+		}
+	}
+
+	info.fDirtyLineCount = 0;
 
 	// If no lines need to be updated, we can return now.
 
@@ -276,7 +411,605 @@ Bool EmScreen::GetBits (EmScreenUpdateInfo& info)
 		CEnableFullAccess	munge;	// Remove blocks on memory access.
 
 		EmHAL::GetLCDScanlines (info);
+
+		gLastDirtyLineCount.store (info.fDirtyLineCount, memory_order_relaxed);
+		gTotalUpdates.fetch_add (1, memory_order_relaxed);
+		gTotalDirtyLines.fetch_add (info.fDirtyLineCount, memory_order_relaxed);
 	}
 
 	return true;
 }
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreen::CycleSlowly
+ *
+ * DESCRIPTION: Publish a new frame if a vertical refresh period
+ *				(1/LCDRefreshRate seconds of emulated time) has passed
+ *				since the last one.  Called on the CPU thread.
+ *
+ * PARAMETERS:	cycleCount - the CPU's current cycle count.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmScreen::CycleSlowly (uint32 cycleCount)
+{
+	int32	clockFreq = EmHAL::GetSystemClockFrequency ();
+
+	if (clockFreq <= 0)
+	{
+		return;
+	}
+
+	if (cycleCount - gFrameStart < (uint32) (clockFreq / gRefreshRate))
+	{
+		return;
+	}
+
+	gFrameStart = cycleCount;
+
+	if (::PrvCaptureFrame () && gFrameProc)
+	{
+		gFrameProc (gFrameRefCon);
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreen::UpdateFrame
+ *
+ * DESCRIPTION: Publish a new frame now.  Used by the UI thread while
+ *				the CPU thread isn't running, and so isn't publishing
+ *				frames itself.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmScreen::UpdateFrame (void)
+{
+	::PrvCaptureFrame ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreen::SetFrameNotification
+ *
+ * DESCRIPTION: Set the function CycleSlowly calls when it publishes a
+ *				new frame.
+ *
+ * PARAMETERS:	proc - the function to call, or NULL.
+ *
+ *				refCon - passed to proc.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmScreen::SetFrameNotification (EmScreenFrameProc proc, void* refCon)
+{
+	gFrameProc		= proc;
+	gFrameRefCon	= refCon;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreen::GetFrame
+ *
+ * DESCRIPTION: Pick up the newest published frame.  info.fImage is
+ *				set to refer to the frame's pixels (which are not
+ *				copied), and the scanlines that changed since the
+ *				previous call are marked dirty.  Called on the UI
+ *				thread.
+ *
+ * PARAMETERS:	info - receives the frame.
+ *
+ *				wholeLCD - true if every scanline should be marked
+ *					dirty.
+ *
+ * RETURNED:	True if any scanlines are marked dirty.
+ *
+ ***********************************************************************/
+
+Bool EmScreen::GetFrame (EmScreenUpdateInfo& info, Bool wholeLCD)
+{
+	if (gMiddleFrame.load () & kFrameFresh)
+	{
+		gFrontFrame = gMiddleFrame.exchange (gFrontFrame) & ~kFrameFresh;
+	}
+
+	EmScreenFrame&	frame = gFrames[gFrontFrame];
+
+	info.fLCDOn			= frame.fLCDOn;
+	info.fLeftMargin	= frame.fLeftMargin;
+
+	info.fImage.SetSize (frame.fImage.GetSize ());
+	info.fImage.SetFormat (frame.fImage.GetFormat ());
+	info.fImage.SetRowBytes (frame.fImage.GetRowBytes ());
+	info.fImage.SetColorTable (frame.fImage.GetColorTable ());
+
+	if (frame.fSerial != 0)
+	{
+		info.fImage.SetBits (frame.fImage.GetBits ());
+	}
+
+	info.SetChangedLines (frame.fLineSerials, wholeLCD ? 0 : gPaintedSerial);
+
+	gPaintedSerial = frame.fSerial;
+
+	return info.fDirtyLineCount > 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreen::GetLastDirtyLineCount
+ *
+ * DESCRIPTION: Return the number of scanlines fetched by the most
+ *				recent call to GetBits.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	The line count.
+ *
+ ***********************************************************************/
+
+int32 EmScreen::GetLastDirtyLineCount (void)
+{
+	return gLastDirtyLineCount.load (memory_order_relaxed);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreen::GetDirtyLineTotals
+ *
+ * DESCRIPTION: Return the number of screen updates that fetched any
+ *				scanlines since the session was created, and the total
+ *				number of scanlines fetched.
+ *
+ * PARAMETERS:	updates - receives the update count.
+ *
+ *				lines - receives the scanline count.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmScreen::GetDirtyLineTotals (uint32& updates, uint32& lines)
+{
+	updates	= gTotalUpdates.load (memory_order_relaxed);
+	lines	= gTotalDirtyLines.load (memory_order_relaxed);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreen::ReportDirtyLines
+ *
+ * DESCRIPTION: Write the scanline statistics to the standard log, so
+ *				that the saving from fetching only dirty scanlines
+ *				can be seen.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmScreen::ReportDirtyLines (void)
+{
+	uint32	updates, lines;
+	EmScreen::GetDirtyLineTotals (updates, lines);
+
+	if (updates == 0)
+		return;
+
+	LogAppendMsg ("LCD: %lu screen updates fetched %lu scanlines (%.1f per update, %ld in the last one)",
+		(unsigned long) updates, (unsigned long) lines,
+		(double) lines / updates, (long) EmScreen::GetLastDirtyLineCount ());
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreenUpdateInfo::SetDirtyLines
+ *
+ * DESCRIPTION: Determine the range of scanlines to fetch from
+ *				fScreenLow and fScreenHigh, and which scanlines in that
+ *				range were touched according to fDirtyBits.
+ *
+ * PARAMETERS:	baseAddr - address of the first scanline.
+ *
+ *				rowBytes - bytes per scanline.
+ *
+ *				height - number of scanlines in the LCD.
+ *
+ * RETURNED:	Nothing.  fFirstLine, fLastLine, and fDirtyLineCount
+ *				are updated.
+ *
+ ***********************************************************************/
+
+void EmScreenUpdateInfo::SetDirtyLines (emuptr baseAddr, int32 rowBytes, int32 height)
+{
+	fFirstLine		= (fScreenLow - baseAddr) / rowBytes;
+	fLastLine		= (fScreenHigh - baseAddr - 1) / rowBytes + 1;
+
+	if (fLastLine > height)
+	{
+		fLastLine = height;
+	}
+
+	fDirtyLines.assign (max (fLastLine - fFirstLine, (int32) 0), 0);
+	fDirtyLineCount	= 0;
+
+	size_t	numChunks = fDirtyBits.size () * 8;
+
+	for (int32 line = fFirstLine; line < fLastLine; ++line)
+	{
+		// Look for any dirty chunk overlapping this line.  Anything
+		// the bitmap doesn't cover is treated as dirty.
+
+		uint32	lineBegin	= baseAddr + line * rowBytes - fDirtyBase;
+		uint32	lineEnd		= lineBegin + rowBytes - 1;
+		size_t	first		= lineBegin >> kDirtyChunkShift;
+		size_t	last		= lineEnd >> kDirtyChunkShift;
+		Bool	dirty		= numChunks == 0 || baseAddr + line * rowBytes < fDirtyBase || last >= numChunks;
+
+		for (size_t chunk = first; !dirty && chunk <= last; ++chunk)
+		{
+			dirty = (fDirtyBits[chunk >> 3] & (1 << (chunk & 7))) != 0;
+		}
+
+		if (dirty)
+		{
+			fDirtyLines[line - fFirstLine] = 1;
+			++fDirtyLineCount;
+		}
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreenUpdateInfo::FetchDirtyLines
+ *
+ * DESCRIPTION: Copy the scanlines marked by SetDirtyLines from
+ *				emulated memory into fImage, one run of adjacent
+ *				lines at a time.  fImage's size, format, and rowBytes
+ *				must already be set.
+ *
+ * PARAMETERS:	baseAddr - address of the first scanline.
+ *
+ *				rowBytes - bytes per scanline.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmScreenUpdateInfo::FetchDirtyLines (emuptr baseAddr, int32 rowBytes)
+{
+	uint8*	bits = (uint8*) fImage.GetBits ();
+	int32	line = fFirstLine;
+
+	while (line < fLastLine)
+	{
+		if (!this->IsLineDirty (line))
+		{
+			++line;
+			continue;
+		}
+
+		int32	runStart = line;
+
+		while (line < fLastLine && this->IsLineDirty (line))
+		{
+			++line;
+		}
+
+		EmMem_memcpy (
+			(void*) (bits + runStart * rowBytes),
+			baseAddr + runStart * rowBytes,
+			(line - runStart) * rowBytes);
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreenUpdateInfo::SetChangedLines
+ *
+ * DESCRIPTION: Set fFirstLine, fLastLine, and the dirty scanlines
+ *				from a frame's per-scanline serial numbers.
+ *
+ * PARAMETERS:	lineSerials - the number of the frame in which each
+ *					scanline last changed.
+ *
+ *				sinceSerial - scanlines that changed in any later
+ *					frame are marked dirty.
+ *
+ * RETURNED:	Nothing.  fFirstLine, fLastLine, and fDirtyLineCount
+ *				are updated.
+ *
+ ***********************************************************************/
+
+void EmScreenUpdateInfo::SetChangedLines (const vector<uint32>& lineSerials,
+										  uint32 sinceSerial)
+{
+	int32	height = (int32) lineSerials.size ();
+
+	fFirstLine		= 0;
+	fLastLine		= 0;
+	fDirtyLineCount	= 0;
+
+	for (int32 line = 0; line < height; ++line)
+	{
+		if (lineSerials[line] > sinceSerial)
+		{
+			if (fDirtyLineCount == 0)
+				fFirstLine = line;
+
+			fLastLine = line + 1;
+			++fDirtyLineCount;
+		}
+	}
+
+	fDirtyLines.assign (fLastLine - fFirstLine, 0);
+
+	for (int32 line = fFirstLine; line < fLastLine; ++line)
+	{
+		if (lineSerials[line] > sinceSerial)
+		{
+			fDirtyLines[line - fFirstLine] = 1;
+		}
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreenUpdateInfo::IsLineDirty
+ *
+ * DESCRIPTION: Return whether the given scanline was fetched.
+ *
+ * PARAMETERS:	line - the scanline number.
+ *
+ * RETURNED:	True if the line is between fFirstLine and fLastLine
+ *				and was touched since the previous update.
+ *
+ ***********************************************************************/
+
+Bool EmScreenUpdateInfo::IsLineDirty (int32 line) const
+{
+	if (line < fFirstLine || line >= fLastLine)
+	{
+		return false;
+	}
+
+	return fDirtyLines[line - fFirstLine] != 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvResizeDirtyBits
+ *
+ * DESCRIPTION: Make gScreenDirtyBits big enough to cover the range
+ *				from gScreenBegin to gScreenEnd, and clear it.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvResizeDirtyBits (void)
+{
+	const int	kShift		= EmScreenUpdateInfo::kDirtyChunkShift;
+	uint32		numChunks	= ((gScreenEnd - gScreenBegin) + (1 << kShift) - 1) >> kShift;
+
+	gScreenDirtyBits.assign ((numChunks + 7) / 8, 0);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvResetFrames
+ *
+ * DESCRIPTION: Release the frame pipeline's buffers and return it to
+ *				its initial state, with no frame published.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvResetFrames (void)
+{
+	gCaptureInfo.fImage.SetSize (EmPoint (0, 0));
+	gCaptureInfo.fLCDOn			= false;
+	gCaptureInfo.fLeftMargin	= 0;
+
+	gLineSerials.clear ();
+	gFrameSerial		= 0;
+	gPublishedSerial	= 0;
+	gFrameStart			= 0;
+
+	for (int ii = 0; ii < kNumFrames; ++ii)
+	{
+		gFrames[ii].fImage.SetSize (EmPoint (0, 0));
+		gFrames[ii].fLCDOn		= false;
+		gFrames[ii].fLeftMargin	= 0;
+		gFrames[ii].fSerial		= 0;
+		gFrames[ii].fLineSerials.clear ();
+	}
+
+	gBackFrame			= 0;
+	gMiddleFrame		= 1;
+	gFrontFrame			= 2;
+	gPaintedSerial		= 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvCaptureFrame
+ *
+ * DESCRIPTION: Fetch the scanlines that changed since the last frame,
+ *				fill the back frame slot, and publish it.  If another
+ *				thread is already doing this, return without waiting.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	True if a new frame was published.
+ *
+ ***********************************************************************/
+
+Bool PrvCaptureFrame (void)
+{
+	if (gCapturing.exchange (true))
+	{
+		return false;
+	}
+
+	EmScreenUpdateInfo&	info = gCaptureInfo;
+
+	// GetBits doesn't fetch anything while the LCD is off, so whatever
+	// was drawn in the meantime needs to be fetched now.
+
+	if (!info.fLCDOn)
+	{
+		EmScreen::InvalidateAll ();
+	}
+
+	Bool				oldLCDOn		= info.fLCDOn;
+	int32				oldLeftMargin	= info.fLeftMargin;
+	EmPoint				oldSize			= info.fImage.GetSize ();
+	EmPixMapFormat		oldFormat		= info.fImage.GetFormat ();
+	EmPixMapRowBytes	oldRowBytes		= info.fImage.GetRowBytes ();
+
+	Bool	fetched = EmScreen::GetBits (info) && info.fLCDOn;
+	Bool	changed = fetched && info.fDirtyLineCount > 0;
+
+	if (changed)
+	{
+		++gFrameSerial;
+
+		if (info.fImage.GetSize () != oldSize ||
+			info.fImage.GetFormat () != oldFormat ||
+			info.fImage.GetRowBytes () != oldRowBytes)
+		{
+			// The LCD was reconfigured, so none of the lines that
+			// GetBits didn't fetch are any good.
+
+			EmScreen::InvalidateAll ();
+			EmScreen::GetBits (info);
+
+			gLineSerials.assign (info.fImage.GetSize ().fY, gFrameSerial);
+		}
+		else
+		{
+			for (int32 line = info.fFirstLine; line < info.fLastLine; ++line)
+			{
+				if (info.IsLineDirty (line))
+				{
+					gLineSerials[line] = gFrameSerial;
+				}
+			}
+		}
+	}
+	else if (info.fLCDOn != oldLCDOn || info.fLeftMargin != oldLeftMargin)
+	{
+		++gFrameSerial;
+	}
+
+	Bool	published = gFrameSerial != gPublishedSerial;
+
+	if (published)
+	{
+		::PrvFillFrame (gFrames[gBackFrame]);
+
+		gPublishedSerial = gFrameSerial;
+
+		gBackFrame = gMiddleFrame.exchange (gBackFrame | kFrameFresh) & ~kFrameFresh;
+	}
+
+	gCapturing = false;
+
+	return published;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvFillFrame
+ *
+ * DESCRIPTION: Bring a frame slot up to date with gCaptureInfo.  Only
+ *				the scanlines that changed since the slot was last
+ *				filled are copied, and the slot's buffers are only
+ *				reallocated if the LCD was reconfigured.
+ *
+ * PARAMETERS:	frame - the slot to fill.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvFillFrame (EmScreenFrame& frame)
+{
+	const EmPixMap&	src = gCaptureInfo.fImage;
+	EmPixMap&		dest = frame.fImage;
+
+	if (dest.GetSize () != src.GetSize () ||
+		dest.GetFormat () != src.GetFormat () ||
+		dest.GetRowBytes () != src.GetRowBytes ())
+	{
+		dest.SetSize (src.GetSize ());
+		dest.SetFormat (src.GetFormat ());
+		dest.SetRowBytes (src.GetRowBytes ());
+
+		frame.fSerial = 0;
+	}
+
+	const uint8*	srcBits		= (const uint8*) src.GetBits ();
+	uint8*			destBits	= (uint8*) dest.GetBits ();
+	int32			rowBytes	= src.GetRowBytes ();
+	int32			height		= (int32) gLineSerials.size ();
+	int32			line		= 0;
+
+	while (line < height)
+	{
+		if (gLineSerials[line] <= frame.fSerial)
+		{
+			++line;
+			continue;
+		}
+
+		int32	runStart = line;
+
+		while (line < height && gLineSerials[line] > frame.fSerial)
+		{
+			++line;
+		}
+
+		memcpy (destBits + runStart * rowBytes,
+				srcBits + runStart * rowBytes,
+				(line - runStart) * rowBytes);
+	}
+
+	dest.SetColorTable (src.GetColorTable ());
+
+	frame.fLineSerials	= gLineSerials;
+	frame.fLCDOn		= gCaptureInfo.fLCDOn;
+	frame.fLeftMargin	= gCaptureInfo.fLeftMargin;
+	frame.fSerial		= gFrameSerial;
+}
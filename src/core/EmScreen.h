@@ -16,6 +16,8 @@
 
 #include "EmPixMap.h"			// EmPixMap
 
+#include <vector>				// vector
+
 class SessionFile;
 
 class EmScreenUpdateInfo
@@ -33,13 +35,46 @@ class EmScreenUpdateInfo
 									// this contains that amount.
 		Bool		fLCDOn;			// True if LCD is on at all
 
+		// Only the scanlines between fFirstLine and fLastLine for
+		// which IsLineDirty returns true are guaranteed to be filled
+		// in.  fDirtyLineCount is the number of such lines.
+
+		Bool		IsLineDirty		(int32 line) const;
+		int32		fDirtyLineCount;
+
 		// Input parameters.  Set by Screen::GetBits and
 		// passed to EmHAL::GetLCDScanlines.
 
 		emuptr		fScreenLow;		// First dirty byte
 		emuptr		fScreenHigh;	// Last dirty byte
+
+		emuptr		fDirtyBase;		// Address of the first byte of fDirtyBits
+		ByteList	fDirtyBits;		// One bit per kDirtyChunkSize bytes.  If
+									// empty, everything from fScreenLow to
+									// fScreenHigh is dirty.
+
+		enum { kDirtyChunkShift = 4, kDirtyChunkSize = 1 << kDirtyChunkShift };
+
+		// Called from the GetLCDScanlines implementations.  SetDirtyLines
+		// works out fFirstLine, fLastLine, and which lines in between
+		// have changed.  FetchDirtyLines then copies just those lines
+		// from emulated memory into fImage.
+
+		void		SetDirtyLines	(emuptr baseAddr, int32 rowBytes, int32 height);
+		void		FetchDirtyLines	(emuptr baseAddr, int32 rowBytes);
+
+		// Called from EmScreen::GetFrame.  Marks as dirty the lines
+		// whose serial number is after the given one.
+
+		void		SetChangedLines	(const std::vector<uint32>& lineSerials,
+									 uint32 sinceSerial);
+
+	private:
+		ByteList	fDirtyLines;	// Indexed by line - fFirstLine
 };
 
+typedef void (*EmScreenFrameProc) (void* refCon);
+
 class EmScreen
 {
 	public:
@@ -53,6 +88,34 @@ class EmScreen
 		static void 			InvalidateAll		(void);
 
 		static Bool 			GetBits 			(EmScreenUpdateInfo&);
+
+		// Frame pipeline.  CycleSlowly (called on the CPU thread)
+		// captures the dirty scanlines into a complete frame once per
+		// emulated vertical refresh and publishes it.  UpdateFrame does
+		// the same thing right away, for when the CPU isn't running.
+		// GetFrame (called on the UI thread) picks up the newest
+		// published frame without copying it; info.fImage refers to
+		// the frame's pixels until the next call to GetFrame.
+
+		static void				CycleSlowly			(uint32 cycleCount);
+		static void				UpdateFrame			(void);
+		static Bool				GetFrame			(EmScreenUpdateInfo&, Bool wholeLCD);
+
+		// The given function is called on the CPU thread each time
+		// CycleSlowly publishes a frame that differs from the last
+		// one, so that the UI can repaint right away.  Set it while
+		// no session is running; pass NULL to remove it.
+
+		static void				SetFrameNotification	(EmScreenFrameProc, void* refCon);
+
+		// Statistics on how many scanlines GetBits fetched: the count
+		// for the most recent update, and running totals since the
+		// session started.  ReportDirtyLines logs them; it's called
+		// when a Gremlin finishes and when the session is disposed.
+
+		static int32			GetLastDirtyLineCount	(void);
+		static void				GetDirtyLineTotals		(uint32& updates, uint32& lines);
+		static void				ReportDirtyLines		(void);
 };
 
 #endif	// EmScreen_h
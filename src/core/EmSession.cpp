@@ -24,6 +24,7 @@
 #include "EmHAL.h"				// EmHAL::ButtonEvent (ReleaseBootKeys)
 #include "EmMemory.h"			// Memory::ResetBankHandlers
 #include "EmMinimize.h"			// EmMinimize::RealLoadInitialState
+#include "EmSessionSnapshot.h"	// EmSessionSnapshot
 #include "EmStreamFile.h"		// EmStreamFile
 #include "ErrorHandling.h"		// Errors::Throw
 #include "Hordes.h"				// Hordes::AutoSaveState, etc.
@@ -147,6 +148,12 @@ EmSession::EmSession (void) :
 
 	fEmulationSpeed.store ((int) speed, std::memory_order_relaxed);
 
+	Preference<long> prefEngine (kPrefKeyCPUEngine);
+	fCPUEngine.store ((int) *prefEngine, std::memory_order_relaxed);
+
+	Preference<bool> prefFastForward (kPrefKeyIdleFastForward);
+	fIdleFastForward.store (*prefFastForward, std::memory_order_relaxed);
+
 	EmAssert (gSession == NULL);
 	gSession = this;
 }
@@ -642,6 +649,14 @@ void EmSession::Load (SessionFile& f)
 	else
 	{
 		fNeedPostLoad = true;
+
+		// The instruction breaks came back with meta-memory, but their
+		// reference counts didn't.  Have their owners re-establish them.
+		// Likewise for the data breaks, which may have been marked before
+		// meta-memory was read in.
+
+		this->InstallInstructionBreaks ();
+		this->InstallDataBreaks ();
 	}
 }
 
@@ -680,6 +695,40 @@ void EmSession::Load (const EmFileRef& ref)
 }
 
 
+// ---------------------------------------------------------------------------
+//		� EmSession::Save
+// ---------------------------------------------------------------------------
+
+void EmSession::Save (EmSessionSnapshot& snapshot)
+{
+	snapshot.Clear ();
+
+	EmStreamChunk	stream (snapshot.GetState ());
+	ChunkFile		chunkFile (stream);
+	SessionFile		sessionFile (chunkFile, snapshot);
+
+	this->Save (sessionFile);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSession::Load
+// ---------------------------------------------------------------------------
+
+void EmSession::Load (EmSessionSnapshot& snapshot)
+{
+	EmStreamChunk	stream (snapshot.GetState ());
+	ChunkFile		chunkFile (stream);
+	SessionFile		sessionFile (chunkFile, snapshot);
+
+	this->Load (sessionFile);
+
+	// Saves from here on share the restored pages.
+
+	snapshot.MakeBase ();
+}
+
+
 #pragma mark -
 
 // ---------------------------------------------------------------------------
@@ -158,6 +158,22 @@ enum EmStopMethod
 };
 
 
+// ---------------------------------------------------------------------------
+#pragma mark EmCPUEngine
+// ---------------------------------------------------------------------------
+
+/*
+**	Selects how EmCPU68K::Execute runs 68K code.  Also the value stored
+**	in kPrefKeyCPUEngine.
+*/
+
+enum EmCPUEngine
+{
+	kCPUEngineInterpreter,	// Fetch, decode, and dispatch every instruction.
+	kCPUEngineBlocks		// Run predecoded basic blocks (EmBlockCache68K).
+};
+
+
 // ---------------------------------------------------------------------------
 #pragma mark EmKeyEvent
 // ---------------------------------------------------------------------------
@@ -272,6 +288,7 @@ typedef std::vector<DataBreakFuncs>	DataBreakFuncList;
 
 class EmCPU;
 class EmDeferredErr;
+class EmSessionSnapshot;
 class SessionFile;
 struct Configuration;
 
@@ -327,6 +344,13 @@ class EmSession
 													 Bool updateFileRef);
 		void 					Load				(const EmFileRef&);
 
+		// Same, for an in-memory snapshot.  Restoring a snapshot is much
+		// faster than reloading a file.  Use EmSessionSnapshot::Export to
+		// turn a snapshot into a session file.
+
+		void 					Save				(EmSessionSnapshot&);
+		void 					Load				(EmSessionSnapshot&);
+
 		// Called by external thread to create and destroy the thread.  CreateThread
 		// is called after the EmSession is created.  If "suspended" is true, the
 		// client should also call ResumeThread.  If "suspended" is false, the
@@ -683,6 +707,8 @@ class EmSession
 	public:
 		std::atomic<int>			fEmulationSpeed{1};		// 0=max, 1=1x, 2=2x, 4=4x, 8=8x
 		std::atomic<int32>			fEffectiveClockFreq{0};	// 0 = lazy-init on first throttle call
+		std::atomic<int>			fCPUEngine{kCPUEngineInterpreter};	// EmCPUEngine
+		std::atomic<bool>			fIdleFastForward{false};	// Skip idle time under Gremlins/replay
 
 	private:
 		InstructionBreakFuncList	fInstructionBreakFuncs;
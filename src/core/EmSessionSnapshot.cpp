@@ -0,0 +1,289 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	In-memory session snapshots.  See EmSessionSnapshot.h for an
+	overview.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmSessionSnapshot.h"
+
+#include "EmStreamFile.h"		// EmStreamFile
+#include "SessionFile.h"		// SessionFile
+
+#include <algorithm>			// min
+
+using namespace std;
+
+
+// The last image saved or restored for each tag.  New images share any
+// pages that haven't changed since then.
+
+static EmSessionSnapshot::ImageMap	gLastImages;
+
+
+// ---------------------------------------------------------------------------
+//		� EmSessionSnapshot::EmSessionSnapshot
+// ---------------------------------------------------------------------------
+
+EmSessionSnapshot::EmSessionSnapshot (void) :
+	fState (),
+	fImages ()
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSessionSnapshot::~EmSessionSnapshot
+// ---------------------------------------------------------------------------
+
+EmSessionSnapshot::~EmSessionSnapshot (void)
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSessionSnapshot::IsEmpty
+// ---------------------------------------------------------------------------
+
+Bool EmSessionSnapshot::IsEmpty (void) const
+{
+	return fState.GetLength () == 0 && fImages.empty ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSessionSnapshot::Clear
+// ---------------------------------------------------------------------------
+
+void EmSessionSnapshot::Clear (void)
+{
+	fState.SetLength (0);
+	fImages.clear ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSessionSnapshot::IsSameAs
+// ---------------------------------------------------------------------------
+// Return whether the two snapshots hold the same state.  Pages are never
+// modified and unchanged pages are shared, so images only need their
+// page pointers compared.  A false result doesn't guarantee that the
+// contents differ.
+
+Bool EmSessionSnapshot::IsSameAs (const EmSessionSnapshot& other) const
+{
+	if (fState.GetLength () != other.fState.GetLength ())
+		return false;
+
+	if (memcmp (fState.GetPointer (), other.fState.GetPointer (), fState.GetLength ()) != 0)
+		return false;
+
+	if (fImages.size () != other.fImages.size ())
+		return false;
+
+	ImageMap::const_iterator	iter1 = fImages.begin ();
+	ImageMap::const_iterator	iter2 = other.fImages.begin ();
+
+	while (iter1 != fImages.end ())
+	{
+		const Image&	image1 = iter1->second;
+		const Image&	image2 = iter2->second;
+
+		if (iter1->first != iter2->first ||
+			image1.fSize != image2.fSize ||
+			image1.fCompression != image2.fCompression)
+		{
+			return false;
+		}
+
+		for (size_t ii = 0; ii < image1.fPages.size (); ++ii)
+		{
+			if (image1.fPages[ii].get () != image2.fPages[ii].get ())
+				return false;
+		}
+
+		++iter1;
+		++iter2;
+	}
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSessionSnapshot::Export
+// ---------------------------------------------------------------------------
+// Write the snapshot out as a regular (compressed) session file.
+
+void EmSessionSnapshot::Export (const EmFileRef& ref) const
+{
+	EmStreamFile	stream (ref, kCreateOrEraseForUpdate,
+						kFileCreatorEmulator, kFileTypeSession);
+	ChunkFile		chunkFile (stream);
+	SessionFile		sessionFile (chunkFile);
+
+	sessionFile.WriteSnapshot (*this);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSessionSnapshot::MakeBase
+// ---------------------------------------------------------------------------
+
+void EmSessionSnapshot::MakeBase (void) const
+{
+	ImageMap::const_iterator	iter = fImages.begin ();
+	while (iter != fImages.end ())
+	{
+		gLastImages[iter->first] = iter->second;
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSessionSnapshot::DisposeBase
+// ---------------------------------------------------------------------------
+
+void EmSessionSnapshot::DisposeBase (void)
+{
+	gLastImages.clear ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSessionSnapshot::GetState
+// ---------------------------------------------------------------------------
+
+Chunk& EmSessionSnapshot::GetState (void)
+{
+	return fState;
+}
+
+
+const Chunk& EmSessionSnapshot::GetState (void) const
+{
+	return fState;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSessionSnapshot::WriteImage
+// ---------------------------------------------------------------------------
+// Record an image under the given tag.  "compression" is the compression
+// SessionFile would have used for it in a file; it's only used by Export.
+
+void EmSessionSnapshot::WriteImage (ChunkFile::Tag tag, uint32 size,
+									const void* image, int compression)
+{
+	Image	result;
+
+	result.fSize		= size;
+	result.fCompression	= compression;
+	result.fPages.reserve ((size + kPageSize - 1) / kPageSize);
+
+	const Image*				base = NULL;
+	ImageMap::const_iterator	iter = gLastImages.find (tag);
+
+	if (iter != gLastImages.end () && iter->second.fSize == size)
+	{
+		base = &iter->second;
+	}
+
+	const uint8*	src		= (const uint8*) image;
+	uint32			index	= 0;
+
+	for (uint32 offset = 0; offset < size; offset += kPageSize, ++index)
+	{
+		uint32	len = min (size - offset, (uint32) kPageSize);
+
+		if (base && memcmp (base->fPages[index]->fData, src + offset, len) == 0)
+		{
+			result.fPages.push_back (base->fPages[index]);
+		}
+		else
+		{
+			Page*	page = new Page;
+			memcpy (page->fData, src + offset, len);
+
+			result.fPages.push_back (PageRef (page));
+		}
+	}
+
+	fImages[tag]		= result;
+	gLastImages[tag]	= result;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSessionSnapshot::GetImageSize
+// ---------------------------------------------------------------------------
+
+int32 EmSessionSnapshot::GetImageSize (ChunkFile::Tag tag) const
+{
+	ImageMap::const_iterator	iter = fImages.find (tag);
+
+	if (iter == fImages.end ())
+		return ChunkFile::kChunkNotFound;
+
+	return iter->second.fSize;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSessionSnapshot::GetImageCompression
+// ---------------------------------------------------------------------------
+
+int EmSessionSnapshot::GetImageCompression (ChunkFile::Tag tag) const
+{
+	ImageMap::const_iterator	iter = fImages.find (tag);
+
+	EmAssert (iter != fImages.end ());
+
+	return iter->second.fCompression;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSessionSnapshot::ReadImage
+// ---------------------------------------------------------------------------
+// Copy the image stored under the given tag into the given buffer, which
+// must be at least GetImageSize bytes long.
+
+Bool EmSessionSnapshot::ReadImage (ChunkFile::Tag tag, void* image) const
+{
+	ImageMap::const_iterator	iter = fImages.find (tag);
+
+	if (iter == fImages.end ())
+		return false;
+
+	const Image&	source	= iter->second;
+	uint8*			dest	= (uint8*) image;
+	uint32			index	= 0;
+
+	for (uint32 offset = 0; offset < source.fSize; offset += kPageSize, ++index)
+	{
+		uint32	len = min (source.fSize - offset, (uint32) kPageSize);
+
+		memcpy (dest + offset, source.fPages[index]->fData, len);
+	}
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSessionSnapshot::GetImageTags
+// ---------------------------------------------------------------------------
+
+void EmSessionSnapshot::GetImageTags (vector<ChunkFile::Tag>& tags) const
+{
+	tags.clear ();
+
+	ImageMap::const_iterator	iter = fImages.begin ();
+	while (iter != fImages.end ())
+	{
+		tags.push_back (iter->first);
+		++iter;
+	}
+}
@@ -0,0 +1,95 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	In-memory session snapshots.
+
+	An EmSessionSnapshot holds the same information a .psf file would,
+	without the compression and file I/O.  EmSession::Save and
+	EmSession::Load accept one in place of a file, which lets Gremlin
+	Hordes and EmMinimize return to a previous state quickly.
+
+	The small chunks are kept in ChunkFile format in a single Chunk.
+	The large images (RAM, meta-RAM, meta-ROM, frame buffers, Gremlin
+	history) are kept as lists of fixed-size, reference-counted pages.
+	Pages are never modified after they're created.  When an image is
+	saved, each page that's identical to the same page of the last
+	image saved or restored under that tag is shared rather than
+	copied.  A Gremlin's suspended state therefore only costs the
+	memory for the pages that Gremlin changed since the root state.
+
+	Use Export to write a snapshot out as an ordinary session file.
+\* ===================================================================== */
+
+#ifndef EmSessionSnapshot_h
+#define EmSessionSnapshot_h
+
+#include "ChunkFile.h"			// Chunk, ChunkFile::Tag
+#include "EmRefCounted.h"		// EmRefCounted, EmRefCounter
+
+#include <map>					// map
+#include <vector>				// vector
+
+class EmFileRef;
+
+
+class EmSessionSnapshot
+{
+	public:
+								EmSessionSnapshot		(void);
+								~EmSessionSnapshot		(void);
+
+		Bool					IsEmpty					(void) const;
+		void					Clear					(void);
+
+		Bool					IsSameAs				(const EmSessionSnapshot&) const;
+
+		void					Export					(const EmFileRef&) const;
+
+		// Make this snapshot's images the ones that later snapshots
+		// share unchanged pages with.  EmSession::Load calls this after
+		// restoring a snapshot.  DisposeBase releases them.
+
+		void					MakeBase				(void) const;
+		static void				DisposeBase				(void);
+
+		// Used by SessionFile.
+
+		Chunk&					GetState				(void);
+		const Chunk&			GetState				(void) const;
+
+		void					WriteImage				(ChunkFile::Tag tag,
+														 uint32 size,
+														 const void* image,
+														 int compression);
+
+		int32					GetImageSize			(ChunkFile::Tag tag) const;
+		int						GetImageCompression		(ChunkFile::Tag tag) const;
+		Bool					ReadImage				(ChunkFile::Tag tag, void* image) const;
+
+		void					GetImageTags			(std::vector<ChunkFile::Tag>&) const;
+
+	public:
+		enum { kPageSize = 4096 };
+
+		struct Page : public EmRefCounted
+		{
+			uint8				fData[kPageSize];
+		};
+
+		typedef EmRefCounter<Page>		PageRef;
+		typedef std::vector<PageRef>	PageList;
+
+		struct Image
+		{
+			uint32				fSize;
+			int					fCompression;
+			PageList			fPages;
+		};
+
+		typedef std::map<ChunkFile::Tag, Image>	ImageMap;
+
+	private:
+		Chunk					fState;
+		ImageMap				fImages;
+};
+
+#endif	// EmSessionSnapshot_h
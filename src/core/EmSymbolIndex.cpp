@@ -0,0 +1,296 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Address to function name index.  See EmSymbolIndex.h for an
+	overview.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmSymbolIndex.h"
+
+#include "EmBankROM.h"			// EmBankROM, EmBankFlash
+#include "EmFileRef.h"			// EmFileRef
+#include "EmMapFile.h"			// EmMapFile::Read
+#include "EmMemory.h"			// EmMemGetBank
+#include "EmPalmFunction.h"		// EndOfFunctionSequence, GetMacsbugInfo
+#include "EmPalmHeap.h"			// EmPalmHeap, EmPalmChunk
+#include "EmSession.h"			// gSession
+
+#include <map>					// map
+
+using namespace std;
+
+
+// The symbols in one heap chunk.  Keyed by the chunk's body start.
+
+struct EmChunkSymbols
+{
+	emuptr				fEnd;
+	EmSymbolList		fSymbols;
+};
+
+typedef map<emuptr, EmChunkSymbols>	EmChunkSymbolsMap;
+typedef map<emuptr, string>			EmAddressNameMap;
+
+static EmChunkSymbolsMap	gROMChunks;
+static EmChunkSymbolsMap	gRAMChunks;
+static uint32				gRAMResyncCount;
+
+static EmAddressNameMap		gMapFileNames;
+static Bool					gMapFileRead;
+
+// Set while scanning a chunk.  Reading memory can lead to checks that
+// want to know what function we're in, which must not rescan.
+
+static Bool					gIndexing;
+
+
+static Bool					PrvInROM				(emuptr addr);
+static void					PrvReadMapFile			(void);
+static bool					PrvSymbolStartsAfter	(emuptr addr,
+													 const EmSymbol& symbol);
+static EmChunkSymbols&		PrvIndexChunk			(EmChunkSymbolsMap&,
+													 const EmPalmChunk&);
+static const EmSymbol*		PrvFindSymbol			(const EmSymbolList&,
+													 emuptr addr);
+
+
+// ---------------------------------------------------------------------------
+//		� EmSymbolIndex::Reset
+// ---------------------------------------------------------------------------
+// Forget everything, including the map file.  The next session may be
+// running a different ROM.
+
+void EmSymbolIndex::Reset (void)
+{
+	gROMChunks.clear ();
+	gRAMChunks.clear ();
+
+	gMapFileNames.clear ();
+	gMapFileRead = false;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSymbolIndex::Load
+// ---------------------------------------------------------------------------
+// A session file (or snapshot) was loaded over the running session.  The
+// ROM hasn't changed, but RAM has.
+
+void EmSymbolIndex::Load (void)
+{
+	gRAMChunks.clear ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSymbolIndex::Find
+// ---------------------------------------------------------------------------
+// Return the function containing the given address, or NULL if it isn't
+// in a heap chunk or isn't in a function we can recognize.  The result
+// is only good until the next call.
+
+const EmSymbol* EmSymbolIndex::Find (emuptr addr)
+{
+	if (gIndexing)
+		return NULL;
+
+	const EmPalmHeap*	heap = EmPalmHeap::GetHeapByPtr (addr);
+	if (!heap)
+		return NULL;
+
+	const EmPalmChunk*	chunk = heap->GetChunkContaining (addr);
+	if (!chunk || !chunk->BodyContains (addr))
+		return NULL;
+
+	if (!gMapFileRead)
+	{
+		::PrvReadMapFile ();
+	}
+
+	Bool	inROM = ::PrvInROM (chunk->BodyStart ());
+
+	if (!inROM && gRAMResyncCount != EmPalmHeap::GetFullResyncCount ())
+	{
+		gRAMChunks.clear ();
+		gRAMResyncCount = EmPalmHeap::GetFullResyncCount ();
+	}
+
+	EmChunkSymbolsMap&			chunks	= inROM ? gROMChunks : gRAMChunks;
+	EmChunkSymbolsMap::iterator	iter	= chunks.find (chunk->BodyStart ());
+
+	if (iter == chunks.end () || iter->second.fEnd != chunk->BodyEnd ())
+	{
+		return ::PrvFindSymbol (::PrvIndexChunk (chunks, *chunk).fSymbols, addr);
+	}
+
+	const EmSymbol*	symbol = ::PrvFindSymbol (iter->second.fSymbols, addr);
+
+	// Code in RAM can be overwritten in place.  If the function we found
+	// doesn't end the way it did when we scanned it, scan it again.
+
+	if (symbol && !inROM && !::EndOfFunctionSequence (symbol->fEnd - 2))
+	{
+		symbol = ::PrvFindSymbol (
+			::PrvIndexChunk (chunks, *chunk).fSymbols, addr);
+	}
+
+	return symbol;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvInROM
+// ---------------------------------------------------------------------------
+
+Bool PrvInROM (emuptr addr)
+{
+	EmMemGetFunc	func = EmMemGetBank (addr).lget;
+
+	return (func == &EmBankROM::GetLong) || (func == &EmBankFlash::GetLong);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvReadMapFile
+// ---------------------------------------------------------------------------
+
+void PrvReadMapFile (void)
+{
+	gMapFileRead = true;
+
+	if (!gSession)
+		return;
+
+	EmFileRef	romFile = gSession->GetConfiguration ().fROMFile;
+
+	if (!romFile.IsSpecified ())
+		return;
+
+	EmFileRef		mapFile (romFile.GetParent (), romFile.GetName () + ".map");
+	StringStringMap	entries;
+
+	if (!mapFile.Exists () || !EmMapFile::Read (mapFile, entries))
+		return;
+
+	StringStringMap::iterator	iter = entries.begin ();
+	while (iter != entries.end ())
+	{
+		emuptr	addr = (emuptr) strtoul (iter->first.c_str (), NULL, 16);
+
+		if (addr != EmMemNULL && !iter->second.empty ())
+		{
+			gMapFileNames[addr] = iter->second;
+		}
+
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvIndexChunk
+// ---------------------------------------------------------------------------
+// Walk the chunk from the start, the same way FindFunctionEnd does: look
+// for an end-of-function sequence, take the Macsbug name after it, and
+// start the next function after the name and any constant data.  Then
+// apply any names from the map file.
+
+EmChunkSymbols& PrvIndexChunk (EmChunkSymbolsMap& chunks, const EmPalmChunk& chunk)
+{
+	EmChunkSymbols&	result = chunks[chunk.BodyStart ()];
+
+	result.fEnd = chunk.BodyEnd ();
+	result.fSymbols.clear ();
+
+	emuptr	start	= chunk.BodyStart ();
+	emuptr	addr	= start;
+	char	name[256];
+
+	gIndexing = true;
+
+	try
+	{
+		while (addr < result.fEnd)
+		{
+			if (!EmMemCheckAddress (addr, 2))
+				break;
+
+			if (::EndOfFunctionSequence (addr))
+			{
+				EmSymbol	symbol;
+				emuptr		next;
+
+				symbol.fStart	= start;
+				symbol.fEnd		= addr + 2;
+
+				::GetMacsbugInfo (symbol.fEnd, name, sizeof (name), &next);
+				symbol.fName = name;
+
+				result.fSymbols.push_back (symbol);
+
+				start	= next;
+				addr	= next;
+				continue;
+			}
+
+			addr += 2;
+		}
+	}
+	catch (...)
+	{
+		gIndexing = false;
+		throw;
+	}
+
+	gIndexing = false;
+
+	EmAddressNameMap::iterator	iter = gMapFileNames.lower_bound (chunk.BodyStart ());
+	while (iter != gMapFileNames.end () && iter->first < result.fEnd)
+	{
+		EmSymbol*	symbol = const_cast<EmSymbol*> (
+			::PrvFindSymbol (result.fSymbols, iter->first));
+
+		if (symbol)
+		{
+			symbol->fName = iter->second;
+		}
+
+		++iter;
+	}
+
+	return result;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvFindSymbol
+// ---------------------------------------------------------------------------
+// The symbols are sorted and don't overlap, so find the last one starting
+// at or before the address and see if it runs past it.
+
+const EmSymbol* PrvFindSymbol (const EmSymbolList& symbols, emuptr addr)
+{
+	EmSymbolList::const_iterator	iter = upper_bound (symbols.begin (),
+										symbols.end (), addr, PrvSymbolStartsAfter);
+
+	if (iter == symbols.begin ())
+		return NULL;
+
+	--iter;
+
+	if (addr >= iter->fEnd)
+		return NULL;
+
+	return &*iter;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvSymbolStartsAfter
+// ---------------------------------------------------------------------------
+// Comparison function for binary searches of a chunk's symbols.
+
+bool PrvSymbolStartsAfter (emuptr addr, const EmSymbol& symbol)
+{
+	return addr < symbol.fStart;
+}
@@ -0,0 +1,50 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Address to function name index.
+
+	FindFunctionName used to find a function by scanning emulated
+	memory backward and forward from the address for end-of-function
+	sequences, then decoding the Macsbug name after the function.
+	EmSymbolIndex does that scan once for each heap chunk that's asked
+	about, recording every function in the chunk in a sorted list, so
+	later lookups are a binary search.
+
+	Chunks in ROM are scanned at most once per ROM (until the next
+	reset).  Chunks in RAM are scanned again if they're resized, if a
+	heap is resynced from scratch (MemHeapCompact and friends), or if
+	the end-of-function sequence a symbol ends with is no longer
+	there.  Session loads forget the RAM chunks.
+
+	If the ROM file has a sibling "<ROM name>.map" file, it's read with
+	EmMapFile.  Each line is "<hex address> = <name>" and renames the
+	function containing that address, which gives full names for ROMs
+	built with only 8- or 16-character Macsbug names.
+\* ===================================================================== */
+
+#ifndef EmSymbolIndex_h
+#define EmSymbolIndex_h
+
+#include <string>				// string
+#include <vector>				// vector
+
+
+struct EmSymbol
+{
+	emuptr					fStart;			// First instruction
+	emuptr					fEnd;			// Just after the RTS (or whatever)
+	std::string				fName;			// Empty if the function has none
+};
+
+typedef std::vector<EmSymbol>	EmSymbolList;
+
+
+class EmSymbolIndex
+{
+	public:
+		static void				Reset					(void);
+		static void				Load					(void);
+
+		static const EmSymbol*	Find					(emuptr addr);
+};
+
+#endif	// EmSymbolIndex_h
@@ -0,0 +1,209 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Binary system call trace.  See EmSysCallTrace.h for an overview.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmSysCallTrace.h"
+
+#include "EmCPU68K.h"			// gCPU68K
+#include "EmPalmFunction.h"		// GetTrapName
+#include "EmSession.h"			// gSession, EmSessionStopper
+#include "Hordes.h"				// Hordes::IsOn, Hordes::EventCounter
+#include "Logging.h"			// LogGetStdLog, LogInsertion
+#include "Miscellaneous.h"		// SystemCallContext
+#include "Platform.h"			// Platform::GetMilliseconds
+#include "UAE.h"				// m68k_areg, m68k_dreg
+
+#include <atomic>				// std::atomic
+
+
+static EmSysCallTraceRecord	gRecords[EmSysCallTrace::kNumRecords];
+
+// Total records ever written, and the number of the oldest record not
+// yet discarded by Clear.  The slot for record N is N % kNumRecords.
+
+static std::atomic<uint32>	gNumWritten{0};
+static uint32				gNumCleared;
+
+
+// ---------------------------------------------------------------------------
+//		� EmSysCallTrace::RecordCall
+// ---------------------------------------------------------------------------
+// Called on the CPU thread when a system function is about to be called.
+
+void EmSysCallTrace::RecordCall (const SystemCallContext& context)
+{
+	EmSysCallTrace::Record (context, kCall, 0);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSysCallTrace::RecordReturn
+// ---------------------------------------------------------------------------
+// Called on the CPU thread when a tailpatched system function returns.
+
+void EmSysCallTrace::RecordReturn (const SystemCallContext& context)
+{
+	EmSysCallTrace::Record (context, kReturn, m68k_dreg (regs, 0));
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSysCallTrace::Clear
+// ---------------------------------------------------------------------------
+// Forget the records made so far.  LogStream calls this, with its mutex
+// held, when the standard log is cleared.
+
+void EmSysCallTrace::Clear (void)
+{
+	gNumCleared = gNumWritten.load (std::memory_order_acquire);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSysCallTrace::GetInsertions
+// ---------------------------------------------------------------------------
+// Format the records in the ring as lines to be merged into the standard
+// log.  LogStream::DumpToFile calls this before it takes its mutex.
+//
+// Function names are found by reading the trap and library tables in
+// emulated memory, so the CPU thread is stopped while that's done (unless
+// this *is* the CPU thread).  If it can't be stopped, or there's no
+// session, just the numbers are logged.
+
+void EmSysCallTrace::GetInsertions (LogInsertionList& insertions)
+{
+	if (gSession && !gSession->InCPUThread ())
+	{
+		EmSessionStopper	stopper (gSession, kStopNow);
+
+		EmSysCallTrace::Format (insertions, stopper.Stopped ());
+	}
+	else
+	{
+		EmSysCallTrace::Format (insertions, gSession != NULL);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSysCallTrace::Format
+// ---------------------------------------------------------------------------
+// Does the work for GetInsertions.  Records that were overwritten before
+// we got to them, or while we were copying them, are counted but
+// otherwise lost.
+
+void EmSysCallTrace::Format (LogInsertionList& insertions, Bool withNames)
+{
+	uint32	end		= gNumWritten.load (std::memory_order_acquire);
+	uint32	begin	= gNumCleared;
+	uint32	lost	= 0;
+
+	if (end - begin > kNumRecords)
+	{
+		lost = end - begin - kNumRecords;
+		begin = end - kNumRecords;
+	}
+
+	insertions.reserve (end - begin + 1);
+
+	char	buffer[400];
+
+	while (begin != end)
+	{
+		// Copy the record, then make sure the CPU thread didn't start
+		// writing a newer one into the same slot while we did.
+
+		EmSysCallTraceRecord	record = gRecords[begin % kNumRecords];
+
+		uint32	written = gNumWritten.load (std::memory_order_acquire);
+
+		if (written - begin >= kNumRecords)
+		{
+			++lost;
+			++begin;
+			continue;
+		}
+
+		if (lost)
+		{
+			LogInsertion	insertion;
+
+			snprintf (buffer, sizeof (buffer),
+				"--- System call trace: %lu older calls were overwritten.",
+				(unsigned long) lost);
+
+			insertion.fPosition		= record.fLogPosition;
+			insertion.fTime			= record.fTime;
+			insertion.fEventCounter	= record.fEventCounter;
+			insertion.fText			= buffer;
+
+			insertions.push_back (insertion);
+
+			lost = 0;
+		}
+
+		const char*	name = "";
+
+		if (withNames)
+		{
+			name = ::GetTrapName (record.fTrapWord, record.fExtra, true);
+		}
+
+		if (record.fKind == kCall)
+		{
+			snprintf (buffer, sizeof (buffer),
+				"--- System Call 0x%04X: %s (PC = 0x%08lX, A7 = 0x%08lX, extra = 0x%08lX, cycle %lu).",
+				(int) record.fTrapWord, name,
+				(unsigned long) record.fPC, (unsigned long) record.fA7,
+				(unsigned long) record.fExtra, (unsigned long) record.fCycle);
+		}
+		else
+		{
+			snprintf (buffer, sizeof (buffer),
+				"--- System Call 0x%04X returned: %s (D0 = 0x%08lX, A7 = 0x%08lX, cycle %lu).",
+				(int) record.fTrapWord, name,
+				(unsigned long) record.fD0, (unsigned long) record.fA7,
+				(unsigned long) record.fCycle);
+		}
+
+		LogInsertion	insertion;
+
+		insertion.fPosition		= record.fLogPosition;
+		insertion.fTime			= record.fTime;
+		insertion.fEventCounter	= record.fEventCounter;
+		insertion.fText			= buffer;
+
+		insertions.push_back (insertion);
+
+		++begin;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmSysCallTrace::Record
+// ---------------------------------------------------------------------------
+
+void EmSysCallTrace::Record (const SystemCallContext& context, uint16 kind, uint32 d0)
+{
+	EmAssert (gCPU68K);
+
+	uint32					index	= gNumWritten.load (std::memory_order_relaxed);
+	EmSysCallTraceRecord&	record	= gRecords[index % kNumRecords];
+	LogStream*				log		= LogGetStdLog ();
+
+	record.fLogPosition	= log ? log->GetLinePosition () : 0;
+	record.fCycle		= gCPU68K->GetCycleCount ();
+	record.fTime		= Platform::GetMilliseconds ();
+	record.fEventCounter	= Hordes::IsOn () ? Hordes::EventCounter () : -1;
+	record.fPC			= context.fPC;
+	record.fA7			= m68k_areg (regs, 7);
+	record.fExtra		= context.fExtra;
+	record.fD0			= d0;
+	record.fTrapWord	= context.fTrapWord;
+	record.fKind		= kind;
+
+	gNumWritten.store (index + 1, std::memory_order_release);
+}
@@ -0,0 +1,70 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Binary system call trace.
+
+	With LogSystemCalls on, EmPalmOS::HandleSystemCall used to look up
+	the function name, crawl the stack, and format a line of text for
+	every trap the emulated CPU made.  Now it just appends a small
+	fixed-size record to a ring buffer, and EmPatchMgr appends another
+	when a tailpatched call returns.  Each record notes the standard
+	log's line position (LogStream::GetLinePosition) at the time.
+
+	Names and text are only produced when the standard log is dumped
+	to its file.  The records still in the ring (up to the most recent
+	kNumRecords calls) are then formatted and merged into the log's
+	text at the positions they noted, so they come out in order with
+	the log's other lines.  The log's own text is not changed, and the
+	records stay in the ring until LogClear, so the next dump includes
+	them again.
+
+	The ring is written only by the CPU thread.  The write index is
+	published with release semantics after each record is filled in,
+	so no lock is taken on the recording path.  GetInsertions stops the
+	CPU thread while it looks up names, and drops any record that was
+	overwritten while it was being copied.
+\* ===================================================================== */
+
+#ifndef EmSysCallTrace_h
+#define EmSysCallTrace_h
+
+#include "Logging.h"			// LogInsertionList
+
+struct SystemCallContext;
+
+
+struct EmSysCallTraceRecord
+{
+	uint64		fLogPosition;	// LogStream::GetLinePosition of the standard log
+	uint32		fCycle;			// EmCPU68K cycle count
+	uint32		fTime;			// Platform::GetMilliseconds, for the log timestamp
+	int32		fEventCounter;	// Hordes::EventCounter, or -1
+	emuptr		fPC;			// Address of the TRAP or JSR
+	emuptr		fA7;			// A7 at the call or return
+	uint32		fExtra;			// Library refNum or sub-dispatch selector
+	uint32		fD0;			// Result (returns only)
+	uint16		fTrapWord;
+	uint16		fKind;			// kCall or kReturn
+};
+
+
+class EmSysCallTrace
+{
+	public:
+		enum { kNumRecords = 65536 };
+		enum { kCall, kReturn };
+
+		static void				RecordCall				(const SystemCallContext&);
+		static void				RecordReturn			(const SystemCallContext&);
+
+		static void				Clear					(void);
+		static void				GetInsertions			(LogInsertionList&);
+
+	private:
+		static void				Record					(const SystemCallContext&,
+														 uint16 kind,
+														 uint32 d0);
+		static void				Format					(LogInsertionList&,
+														 Bool withNames);
+};
+
+#endif	// EmSysCallTrace_h
@@ -568,17 +568,17 @@ void EmWindow::PaintScreen (Bool drawCase, Bool wholeLCD)
 		fOldBacklightOn	= backlightOn;
 		fOldLEDState	= ledState;
 
-		// If we're going to be drawing the whole LCD, then invalidate
-		// the entire screen.
+		// Get the newest complete LCD frame.  The CPU thread publishes
+		// one each emulated vertical refresh while it's running; when
+		// it isn't, publish one ourselves.  If we're going to be
+		// drawing the whole LCD, then mark all of its lines dirty.
 
-		if (wholeLCD || drawLCD)
+		if (gSession->GetSessionState () != kRunning)
 		{
-			EmScreen::InvalidateAll ();
+			EmScreen::UpdateFrame ();
 		}
 
-		// Get the current LCD state.
-
-		bufferDirty = EmScreen::GetBits (info);
+		bufferDirty = EmScreen::GetFrame (info, wholeLCD || drawLCD);
 
 		// (debug logging removed)
 
@@ -1732,8 +1732,9 @@ void Errors::ReportErrStepSpy (emuptr writeAddress,
 //		� Errors::ReportErrWatchpoint
 // ---------------------------------------------------------------------------
 
-void Errors::ReportErrWatchpoint (emuptr writeAddress,
-								  int writeBytes,
+void Errors::ReportErrWatchpoint (emuptr accessAddress,
+								  int accessBytes,
+								  Bool forRead,
 								  emuptr watchAddress,
 								  uint32 watchBytes)
 {
@@ -1743,17 +1744,17 @@ void Errors::ReportErrWatchpoint (emuptr writeAddress,
 
 	// Set the %op message variable.
 
-	string	operation (Platform::GetString (kStr_WroteTo));
+	string	operation (Platform::GetString (forRead ? kStr_ReadFrom : kStr_WroteTo));
 	Errors::SetParameter ("%op", operation);
 
 	// Set the %mem message variable.
 
-	string	asString1 (::PrvAsHex8 (writeAddress));
+	string	asString1 (::PrvAsHex8 (accessAddress));
 	Errors::SetParameter ("%mem", asString1.c_str ());
 
 	// Set the %write_bytes message variable.
 
-	string	asString2 (::PrvAsDecimal (writeBytes));
+	string	asString2 (::PrvAsDecimal (accessBytes));
 	Errors::SetParameter ("%write_bytes", asString2.c_str ());
 
 	// Set the %watch_start message variable.
@@ -3367,13 +3368,15 @@ void EmDeferredErrStepSpy::Do (void)
 //		� EmDeferredErrWatchpoint
 // ---------------------------------------------------------------------------
 
-EmDeferredErrWatchpoint::EmDeferredErrWatchpoint (emuptr writeAddress,
-												 int writeBytes,
+EmDeferredErrWatchpoint::EmDeferredErrWatchpoint (emuptr accessAddress,
+												 int accessBytes,
+												 Bool forRead,
 												 emuptr watchAddress,
 												 uint32 watchBytes) :
 	EmDeferredErr (),
-	fWriteAddress (writeAddress),
-	fWriteBytes (writeBytes),
+	fAccessAddress (accessAddress),
+	fAccessBytes (accessBytes),
+	fForRead (forRead),
 	fWatchAddress (watchAddress),
 	fWatchBytes (watchBytes)
 {
@@ -3385,5 +3388,5 @@ EmDeferredErrWatchpoint::~EmDeferredErrWatchpoint (void)
 
 void EmDeferredErrWatchpoint::Do (void)
 {
-	Errors::ReportErrWatchpoint (fWriteAddress, fWriteBytes, fWatchAddress, fWatchBytes);
+	Errors::ReportErrWatchpoint (fAccessAddress, fAccessBytes, fForRead, fWatchAddress, fWatchBytes);
 }
@@ -142,7 +142,7 @@ class Errors
 		static void				ReportErrBitmapAccess		(emuptr bitmapAddress, emuptr address, long size, Bool forRead);
 		static void				ReportErrProscribedFunction	(const SystemCallContext&);
 		static void				ReportErrStepSpy			(emuptr writeAddress, int writeBytes, emuptr ssAddress, uint32 ssValue, uint32 newValue);
-		static void				ReportErrWatchpoint			(emuptr writeAddress, int writeBytes, emuptr watchAddress, uint32 watchBytes);
+		static void				ReportErrWatchpoint			(emuptr accessAddress, int accessBytes, Bool forRead, emuptr watchAddress, uint32 watchBytes);
 
 			// Palm OS-detected errors
 
@@ -496,8 +496,9 @@ class EmDeferredErrStepSpy : public EmDeferredErr
 class EmDeferredErrWatchpoint : public EmDeferredErr
 {
 	public:
-								EmDeferredErrWatchpoint			(emuptr writeAddress,
-																 int writeBytes,
+								EmDeferredErrWatchpoint			(emuptr accessAddress,
+																 int accessBytes,
+																 Bool forRead,
 																 emuptr watchAddress,
 																 uint32 watchBytes);
 		virtual					~EmDeferredErrWatchpoint		(void);
@@ -505,8 +506,9 @@ class EmDeferredErrWatchpoint : public EmDeferredErr
 		virtual void			Do								(void);
 
 	protected:
-		emuptr					fWriteAddress;
-		int						fWriteBytes;
+		emuptr					fAccessAddress;
+		int						fAccessBytes;
+		Bool					fForRead;
 		emuptr					fWatchAddress;
 		uint32					fWatchBytes;
 };
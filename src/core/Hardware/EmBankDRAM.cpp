@@ -18,8 +18,9 @@
 #include "EmCommon.h"
 #include "EmBankDRAM.h"
 
-#include "DebugMgr.h"			// Debug::CheckStepSpy
+#include "DebugMgr.h"			// gDebuggerGlobals.watchCount
 #include "EmBankSRAM.h"			// gRAMBank_Size, gRAM_Memory, gMemoryAccess
+#include "EmBlockCache68K.h"	// EmBlockCache68K::Invalidate
 #include "EmCPU.h"				// GetSP
 #include "EmCPU68K.h"			// gCPU68K
 #include "EmHAL.h"				// EmHAL
@@ -189,6 +190,22 @@ static inline void PrvScreenCheck (uint8* metaAddress, emuptr address, size_t si
 	}
 }
 
+static inline void PrvCodeCheck (uint8* metaAddress, size_t size)
+{
+	if (MetaMemory::IsCodeBlock (metaAddress, size))
+	{
+		EmBlockCache68K::Invalidate (metaAddress, size);
+	}
+}
+
+static inline void PrvDataBreakCheck (uint8* metaAddress, emuptr address, size_t size, Bool forRead)
+{
+	if (gDebuggerGlobals.watchCount != 0 && MetaMemory::IsDataBreak (metaAddress, size))
+	{
+		gSession->HandleDataBreak (address, size, forRead);
+	}
+}
+
 
 #pragma mark -
 
@@ -325,7 +342,12 @@ void EmBankDRAM::SetBankHandlers (void)
 
 	Memory::InitializeBanks (	gAddressBank,
 								EmMemBankIndex (kMemoryStart),
-								numBanks);
+								numBanks,
+								kEmMemRegionRAM);
+
+	Memory::InitializePages (	EmMemBankIndex (kMemoryStart),
+								numBanks,
+								kEmMemPagePlainGet | kEmMemPagePlainSet | kEmMemPageAppChecks);
 }
 
 
@@ -374,6 +396,8 @@ uint32 EmBankDRAM::GetLong (emuptr address)
 	CYCLE_GETLONG (WAITSTATES_DRAM);
 #endif
 
+	::PrvDataBreakCheck (metaAddress, address, sizeof (uint32), true);
+
 	return EmMemDoGet32 (gRAM_Memory + address);
 }
 
@@ -412,6 +436,8 @@ uint32 EmBankDRAM::GetWord (emuptr address)
 	CYCLE_GETWORD (WAITSTATES_DRAM);
 #endif
 
+	::PrvDataBreakCheck (metaAddress, address, sizeof (uint16), true);
+
 	return EmMemDoGet16 (gRAM_Memory + address);
 }
 
@@ -445,6 +471,8 @@ uint32 EmBankDRAM::GetByte (emuptr address)
 	CYCLE_GETBYTE (WAITSTATES_DRAM);
 #endif
 
+	::PrvDataBreakCheck (metaAddress, address, sizeof (uint8), true);
+
 	return EmMemDoGet8 (gRAM_Memory + address);
 }
 
@@ -485,6 +513,7 @@ void EmBankDRAM::SetLong (emuptr address, uint32 value)
 	}
 
 	::PrvScreenCheck (metaAddress, address, sizeof (uint32));
+	::PrvCodeCheck (metaAddress, sizeof (uint32));
 
 #if (HAS_PROFILING)
 	CYCLE_PUTLONG (WAITSTATES_DRAM);
@@ -498,10 +527,9 @@ void EmBankDRAM::SetLong (emuptr address, uint32 value)
 	MetaMemory::MarkLongInitialized (address);
 #endif
 
-	// See if any interesting memory locations have changed.  If so,
-	// CheckStepSpy will report it.
+	// See if any watched memory locations have been written to.
 
-	Debug::CheckStepSpy (address, sizeof (uint32));
+	::PrvDataBreakCheck (metaAddress, address, sizeof (uint32), false);
 }
 
 
@@ -539,6 +567,7 @@ void EmBankDRAM::SetWord (emuptr address, uint32 value)
 	}
 
 	::PrvScreenCheck (metaAddress, address, sizeof (uint16));
+	::PrvCodeCheck (metaAddress, sizeof (uint16));
 
 #if (HAS_PROFILING)
 	CYCLE_PUTWORD (WAITSTATES_DRAM);
@@ -552,10 +581,9 @@ void EmBankDRAM::SetWord (emuptr address, uint32 value)
 	MetaMemory::MarkWordInitialized (address);
 #endif
 
-	// See if any interesting memory locations have changed.  If so,
-	// CheckStepSpy will report it.
+	// See if any watched memory locations have been written to.
 
-	Debug::CheckStepSpy (address, sizeof (uint16));
+	::PrvDataBreakCheck (metaAddress, address, sizeof (uint16), false);
 }
 
 
@@ -588,6 +616,7 @@ void EmBankDRAM::SetByte (emuptr address, uint32 value)
 	}
 
 	::PrvScreenCheck (metaAddress, address, sizeof (uint8));
+	::PrvCodeCheck (metaAddress, sizeof (uint8));
 
 #if (HAS_PROFILING)
 	CYCLE_PUTBYTE (WAITSTATES_DRAM);
@@ -601,10 +630,9 @@ void EmBankDRAM::SetByte (emuptr address, uint32 value)
 	MetaMemory::MarkByteInitialized (address);
 #endif
 
-	// See if any interesting memory locations have changed.  If so,
-	// CheckStepSpy will report it.
+	// See if any watched memory locations have been written to.
 
-	Debug::CheckStepSpy (address, sizeof (uint8));
+	::PrvDataBreakCheck (metaAddress, address, sizeof (uint8), false);
 }
 
 
@@ -15,6 +15,7 @@
 #include "EmBankROM.h"
 
 #include "Byteswapping.h"		// ByteswapWords
+#include "EmBlockCache68K.h"	// EmBlockCache68K::Invalidate
 #include "EmCPU68K.h"			// gCPU68K
 #include "EmErrCodes.h"			// kError_UnsupportedROM
 #include "EmHAL.h"				// EmHAL
@@ -22,6 +23,7 @@
 #include "EmPalmStructs.h"		// EmProxyCardHeaderType
 #include "EmSession.h"			// GetDevice, ScheduleDeferredError
 #include "ErrorHandling.h"		// Errors::Throw
+#include "MetaMemory.h"			// MetaMemory::IsCodeBlock
 #include "Miscellaneous.h"		// StWordSwapper, NextPowerOf2
 #include "Profiling.h"			// WAITSTATES_ROM
 #include "SessionFile.h"		// WriteROMFileReference
@@ -76,6 +78,21 @@ static uint8*	gROM_Memory;
 static uint8*	gROM_MetaMemory;
 
 
+// ROM normally doesn't change, but it can be written to by Flash
+// programming or when protection is turned off.  Make sure any
+// predecoded blocks of the old code are dropped.
+
+static inline void PrvCodeCheck (emuptr address, size_t size)
+{
+	uint8*	metaAddress = &gROM_MetaMemory[address];
+
+	if (MetaMemory::IsCodeBlock (metaAddress, size))
+	{
+		EmBlockCache68K::Invalidate (metaAddress, size);
+	}
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	EmBankROM::Initialize
@@ -233,7 +250,14 @@ void EmBankROM::SetBankHandlers (void)
 	uint32	last_bank	= EmMemBankIndex (EmBankROM::GetMemoryStart () + gManagedROMSize - 1);
 
 	Memory::InitializeBanks (	gROMAddressBank, first_bank,
-								last_bank - first_bank + 1);
+								last_bank - first_bank + 1,
+								kEmMemRegionROM);
+
+	// Writes always go through SetLong & co. so that they're reported.
+
+	Memory::InitializePages (	first_bank,
+								last_bank - first_bank + 1,
+								kEmMemPagePlainGet);
 }
 
 
@@ -432,6 +456,8 @@ void EmBankROM::SetLong (emuptr address, uint32 value)
 
 	address &= gROMBank_Mask;
 
+	::PrvCodeCheck (address, sizeof (uint32));
+
 	EmMemDoPut32 (gROM_Memory + address, value);
 }
 
@@ -481,6 +507,8 @@ void EmBankROM::SetWord (emuptr address, uint32 value)
 
 	address &= gROMBank_Mask;
 
+	::PrvCodeCheck (address, sizeof (uint16));
+
 	EmMemDoPut16 (gROM_Memory + address, value);
 }
 
@@ -523,6 +551,8 @@ void EmBankROM::SetByte (emuptr address, uint32 value)
 
 	address &= gROMBank_Mask;
 
+	::PrvCodeCheck (address, sizeof (uint8));
+
 	EmMemDoPut8 (gROM_Memory + address, value);
 }
 
@@ -1089,7 +1119,8 @@ void EmBankFlash::SetBankHandlers (void)
 	uint32	last_bank	= EmMemBankIndex (EmBankROM::GetMemoryStart () + gManagedROMSize - 1);
 
 	Memory::InitializeBanks (	gFlashAddressBank, first_bank,
-								last_bank - first_bank + 1);
+								last_bank - first_bank + 1,
+								kEmMemRegionROM);
 }
 
 
@@ -1370,6 +1401,7 @@ void EmBankFlash::SetWord (emuptr address, uint32 value)
 			// ??? What happens on other operations?
 
 			address &= gROMBank_Mask;
+			::PrvCodeCheck (address, sizeof (uint16));
 			EmMemDoPut16 (gROM_Memory + address, value);
 
 			gState = kAMDState_ProgramDone;
@@ -14,7 +14,6 @@
 #include "EmCommon.h"
 #include "EmBankRegs.h"
 
-#include "DebugMgr.h"			// Debug::CheckStepSpy
 #include "EmCPU.h"				// GetPC
 #include "EmCPU68K.h"			// gCPU68K
 #include "EmMemory.h"			// gMemAccessFlags, EmMemory::IsPCInRAM
@@ -435,11 +434,6 @@ void EmBankRegs::SetLong (emuptr address, uint32 value)
 	{
 		bank->SetLong (address, value);
 
-		// See if any interesting memory locations have changed.  If so,
-		// CheckStepSpy will report it.
-
-		Debug::CheckStepSpy (address, sizeof (uint32));
-
 		return;
 	}
 
@@ -485,11 +479,6 @@ void EmBankRegs::SetWord (emuptr address, uint32 value)
 	{
 		bank->SetWord (address, value);
 
-		// See if any interesting memory locations have changed.  If so,
-		// CheckStepSpy will report it.
-
-		Debug::CheckStepSpy (address, sizeof (uint16));
-
 		return;
 	}
 
@@ -528,11 +517,6 @@ void EmBankRegs::SetByte (emuptr address, uint32 value)
 	{
 		bank->SetByte (address, value);
 
-		// See if any interesting memory locations have changed.  If so,
-		// CheckStepSpy will report it.
-
-		Debug::CheckStepSpy (address, sizeof (uint8));
-
 		return;
 	}
 
@@ -15,7 +15,8 @@
 #include "EmBankSRAM.h"
 
 #include "Byteswapping.h"		// ByteswapWords
-#include "DebugMgr.h"			// Debug::CheckStepSpy
+#include "DebugMgr.h"			// gDebuggerGlobals.watchCount
+#include "EmBlockCache68K.h"	// EmBlockCache68K::Invalidate
 #include "EmCPU68K.h"			// gCPU68K
 #include "EmMemory.h"			// gRAMBank_Size, gRAM_Memory, gMemoryAccess
 #include "EmScreen.h"			// EmScreen::MarkDirty
@@ -105,6 +106,22 @@ static inline void PrvScreenCheck (uint8* metaAddress, emuptr address, size_t si
 	}
 }
 
+static inline void PrvCodeCheck (uint8* metaAddress, size_t size)
+{
+	if (MetaMemory::IsCodeBlock (metaAddress, size))
+	{
+		EmBlockCache68K::Invalidate (metaAddress, size);
+	}
+}
+
+static inline void PrvDataBreakCheck (uint8* metaAddress, emuptr address, size_t size, Bool forRead)
+{
+	if (gDebuggerGlobals.watchCount != 0 && MetaMemory::IsDataBreak (metaAddress, size))
+	{
+		gSession->HandleDataBreak (address, size, forRead);
+	}
+}
+
 
 /***********************************************************************
  *
@@ -284,7 +301,13 @@ void EmBankSRAM::SetBankHandlers (void)
 
 	long	numBanks = EmMemBankIndex (gMemoryStart + gRAMBank_Size - 1) -
 									EmMemBankIndex (gMemoryStart) + 1;
-	Memory::InitializeBanks (gAddressBank, EmMemBankIndex (gMemoryStart), numBanks);
+	Memory::InitializeBanks (gAddressBank, EmMemBankIndex (gMemoryStart), numBanks,
+		kEmMemRegionRAM);
+
+	// Writes by applications are checked if SRAM is write-protected.
+
+	Memory::InitializePages (EmMemBankIndex (gMemoryStart), numBanks,
+		kEmMemPagePlainGet | kEmMemPagePlainSet | kEmMemPageAppChecks);
 }
 
 
@@ -325,9 +348,12 @@ uint32 EmBankSRAM::GetLong (emuptr address)
 	CYCLE_GETLONG (WAITSTATES_SRAM);
 #endif
 
-	address &= gRAMBank_Mask;
+	emuptr phyAddress = address;
+	phyAddress &= gRAMBank_Mask;
 
-	return EmMemDoGet32 (gRAM_Memory + address);
+	::PrvDataBreakCheck (InlineGetMetaAddress (phyAddress), address, sizeof (uint32), true);
+
+	return EmMemDoGet32 (gRAM_Memory + phyAddress);
 }
 
 
@@ -366,9 +392,12 @@ uint32 EmBankSRAM::GetWord (emuptr address)
 	CYCLE_GETWORD (WAITSTATES_SRAM);
 #endif
 
-	address &= gRAMBank_Mask;
+	emuptr phyAddress = address;
+	phyAddress &= gRAMBank_Mask;
+
+	::PrvDataBreakCheck (InlineGetMetaAddress (phyAddress), address, sizeof (uint16), true);
 
-	return EmMemDoGet16 (gRAM_Memory + address);
+	return EmMemDoGet16 (gRAM_Memory + phyAddress);
 }
 
 
@@ -400,9 +429,12 @@ uint32 EmBankSRAM::GetByte (emuptr address)
 	CYCLE_GETBYTE (WAITSTATES_SRAM);
 #endif
 
-	address &= gRAMBank_Mask;
+	emuptr phyAddress = address;
+	phyAddress &= gRAMBank_Mask;
+
+	::PrvDataBreakCheck (InlineGetMetaAddress (phyAddress), address, sizeof (uint8), true);
 
-	return EmMemDoGet8 (gRAM_Memory + address);
+	return EmMemDoGet8 (gRAM_Memory + phyAddress);
 }
 
 
@@ -451,13 +483,13 @@ void EmBankSRAM::SetLong (emuptr address, uint32 value)
 	register uint8*	metaAddress = InlineGetMetaAddress (phyAddress);
 //	META_CHECK (metaAddress, address, SetLong, uint32, false);
 	::PrvScreenCheck (metaAddress, address, sizeof (uint32));
+	::PrvCodeCheck (metaAddress, sizeof (uint32));
 
 	EmMemDoPut32 (gRAM_Memory + phyAddress, value);
 
-	// See if any interesting memory locations have changed.  If so,
-	// CheckStepSpy will report it.
+	// See if any watched memory locations have been written to.
 
-	Debug::CheckStepSpy (address, sizeof (uint32));
+	::PrvDataBreakCheck (metaAddress, address, sizeof (uint32), false);
 }
 
 
@@ -504,13 +536,13 @@ void EmBankSRAM::SetWord (emuptr address, uint32 value)
 	register uint8*	metaAddress = InlineGetMetaAddress (phyAddress);
 //	META_CHECK (metaAddress, address, SetLong, uint16, false);
 	::PrvScreenCheck (metaAddress, address, sizeof (uint16));
+	::PrvCodeCheck (metaAddress, sizeof (uint16));
 
 	EmMemDoPut16 (gRAM_Memory + phyAddress, value);
 
-	// See if any interesting memory locations have changed.  If so,
-	// CheckStepSpy will report it.
+	// See if any watched memory locations have been written to.
 
-	Debug::CheckStepSpy (address, sizeof (uint16));
+	::PrvDataBreakCheck (metaAddress, address, sizeof (uint16), false);
 }
 
 
@@ -550,13 +582,13 @@ void EmBankSRAM::SetByte (emuptr address, uint32 value)
 	register uint8*	metaAddress = InlineGetMetaAddress (phyAddress);
 //	META_CHECK (metaAddress, address, SetLong, uint8, false);
 	::PrvScreenCheck (metaAddress, address, sizeof (uint8));
+	::PrvCodeCheck (metaAddress, sizeof (uint8));
 
 	EmMemDoPut8 (gRAM_Memory + phyAddress, value);
 
-	// See if any interesting memory locations have changed.  If so,
-	// CheckStepSpy will report it.
+	// See if any watched memory locations have been written to.
 
-	Debug::CheckStepSpy (address, sizeof (uint8));
+	::PrvDataBreakCheck (metaAddress, address, sizeof (uint8), false);
 }
 
 
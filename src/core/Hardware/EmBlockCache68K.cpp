@@ -0,0 +1,489 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Predecoded basic-block cache for the 68K core.
+
+	See EmBlockCache68K.h for an overview.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmBlockCache68K.h"
+
+#include "EmBankDRAM.h"			// EmBankDRAM::GetLong
+#include "EmBankROM.h"			// EmBankROM::GetLong, EmBankFlash::GetLong
+#include "EmBankSRAM.h"			// EmBankSRAM::GetLong
+#include "EmMemory.h"			// EmMemGetBank, EmMemGetMetaAddress, Memory::RestrictPages
+#include "MetaMemory.h"			// MetaMemory::MarkCodeBlock
+#include "Platform.h"			// Platform::AllocateMemory
+#include "UAE.h"				// table68k, op_illg
+
+#include <map>					// multimap
+#include <unordered_map>		// unordered_map
+#include <vector>				// vector
+
+using namespace std;
+
+// Longest run of instructions recorded into one block.  Blocks end
+// earlier at any change of flow, so this only matters for long runs
+// of straight-line code.  Since the block's cycles are handed to the
+// HAL in one lump, it also bounds how late an interrupt can be noticed.
+
+const int	kMaxBlockInsns	= 32;
+
+// Stop creating blocks once this many are live; the next block
+// started after that flushes the cache and begins again.
+
+const size_t	kMaxBlocks		= 32768;
+
+typedef unordered_map<emuptr, EmBlock68K*>	EmBlockPCMap;
+typedef multimap<uint8*, EmBlock68K*>		EmBlockMetaMap;
+typedef vector<EmBlock68K*>					EmBlockList;
+
+EmBlock68K*				EmBlockCache68K::fgTable[kTableSize];
+
+static uint8			gEndsBlock[65536];	// Non-zero for opcodes that end a block.
+
+static EmBlockPCMap		gBlocksByPC;
+static EmBlockMetaMap	gBlocksByMeta;
+static uint32			gLargestBlock;		// Largest fSize seen; bounds range searches.
+
+static EmBlockList		gDeadBlocks;
+static int				gExecuteDepth;
+
+static Bool				gRecording;
+static Bool				gRecordAborted;
+static emuptr			gRecordPC;
+static uint8*			gRecordMeta;
+static uint32			gRecordSize;
+static int				gRecordCount;
+static EmBlockInsn68K	gRecordInsns[kMaxBlockInsns];
+
+
+// ---------------------------------------------------------------------------
+//		� PrvIsCodeBank
+// ---------------------------------------------------------------------------
+// Only ROM and RAM are cached.  Code running out of memory-mapped
+// hardware (or anything else) is always interpreted.
+
+static Bool PrvIsCodeBank (emuptr address)
+{
+	const EmAddressBank&	bank = EmMemGetBank (address);
+
+	if (bank.xlatemetaaddr == NULL)
+		return false;
+
+	return	bank.lget == EmBankSRAM::GetLong ||
+			bank.lget == EmBankDRAM::GetLong ||
+			bank.lget == EmBankROM::GetLong ||
+			bank.lget == EmBankFlash::GetLong;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvRemarkRange
+// ---------------------------------------------------------------------------
+// Clear the kCodeBlock bits in [begin, end), then set them again for any
+// part of that range still covered by a live block or by the block being
+// recorded.  Blocks can overlap when a branch lands in the middle of an
+// existing block.
+
+static void PrvRemarkRange (uint8* begin, uint8* end)
+{
+	MetaMemory::UnmarkCodeBlock (begin, end);
+
+	EmBlockMetaMap::iterator	iter = gBlocksByMeta.lower_bound (begin - gLargestBlock);
+
+	while (iter != gBlocksByMeta.end () && iter->first < end)
+	{
+		EmBlock68K*	block		= iter->second;
+		uint8*		blockEnd	= block->fMetaStart + block->fSize;
+
+		if (blockEnd > begin)
+		{
+			MetaMemory::MarkCodeBlock (max (block->fMetaStart, begin), min (blockEnd, end));
+		}
+
+		++iter;
+	}
+
+	if (gRecording && !gRecordAborted)
+	{
+		uint8*	recordEnd = gRecordMeta + gRecordSize;
+
+		if (gRecordMeta < end && recordEnd > begin)
+		{
+			MetaMemory::MarkCodeBlock (max (gRecordMeta, begin), min (recordEnd, end));
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmBlockCache68K::InitializeOpcodeTable
+// ---------------------------------------------------------------------------
+// Note which opcodes end a basic block: anything that can change the flow
+// of control or the supervisor/interrupt state, and anything the 68000
+// can't execute.  Other instructions can still leave a block early by
+// taking an exception; EmCPU68K::ExecuteBlocks checks for that after each
+// instruction.
+
+void EmBlockCache68K::InitializeOpcodeTable (void)
+{
+	for (long opcode = 0; opcode < 65536; ++opcode)
+	{
+		const struct instr&	insn	= table68k[opcode];
+		Bool				ends	= insn.clev > 0 || cpufunctbl[opcode] == op_illg;
+
+		switch (insn.mnemo)
+		{
+			case i_ILLG:
+			case i_ORSR:	case i_ANDSR:	case i_EORSR:	case i_MV2SR:
+			case i_TRAP:	case i_TRAPV:	case i_CHK:		case i_CHK2:
+			case i_RESET:	case i_STOP:
+			case i_RTE:		case i_RTD:		case i_RTS:		case i_RTR:
+			case i_JSR:		case i_JMP:		case i_BSR:		case i_Bcc:
+			case i_DBcc:
+				ends = true;
+				break;
+
+			default:
+				break;
+		}
+
+		gEndsBlock[opcode] = ends ? 1 : 0;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmBlockCache68K::Flush
+// ---------------------------------------------------------------------------
+
+void EmBlockCache68K::Flush (void)
+{
+	EmBlockMetaMap::iterator	iter = gBlocksByMeta.begin ();
+
+	while (iter != gBlocksByMeta.end ())
+	{
+		EmBlock68K*	block = iter->second;
+
+		MetaMemory::UnmarkCodeBlock (block->fMetaStart, block->fMetaStart + block->fSize);
+
+		block->fValid = false;
+		gDeadBlocks.push_back (block);
+
+		++iter;
+	}
+
+	if (gRecording)
+	{
+		MetaMemory::UnmarkCodeBlock (gRecordMeta, gRecordMeta + gRecordSize);
+		gRecordAborted = true;
+	}
+
+	gBlocksByMeta.clear ();
+	gBlocksByPC.clear ();
+	gLargestBlock = 0;
+
+	memset (fgTable, 0, sizeof (fgTable));
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmBlockCache68K::Dispose
+// ---------------------------------------------------------------------------
+
+void EmBlockCache68K::Dispose (void)
+{
+	EmAssert (gExecuteDepth == 0);
+
+	EmBlockMetaMap::iterator	iter = gBlocksByMeta.begin ();
+
+	while (iter != gBlocksByMeta.end ())
+	{
+		Platform::DisposeMemory (iter->second);
+		++iter;
+	}
+
+	EmBlockList::iterator	dead = gDeadBlocks.begin ();
+
+	while (dead != gDeadBlocks.end ())
+	{
+		Platform::DisposeMemory (*dead);
+		++dead;
+	}
+
+	gBlocksByMeta.clear ();
+	gBlocksByPC.clear ();
+	gDeadBlocks.clear ();
+	gLargestBlock	= 0;
+	gRecording		= false;
+
+	memset (fgTable, 0, sizeof (fgTable));
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmBlockCache68K::Invalidate
+// ---------------------------------------------------------------------------
+// Called when [metaAddress, metaAddress + size) is written and at least one
+// of those bytes is tagged as code.  Drop every block covering any of those
+// bytes.  If no block covers them (the bits may be left over from a saved
+// session's meta-memory image), the stale bits are simply cleared.
+
+void EmBlockCache68K::Invalidate (uint8* metaAddress, uint32 size)
+{
+	uint8*	begin		= metaAddress;
+	uint8*	end			= metaAddress + size;
+	uint8*	clearBegin	= begin;
+	uint8*	clearEnd	= end;
+
+	if (gRecording && !gRecordAborted &&
+		gRecordMeta < end && gRecordMeta + gRecordSize > begin)
+	{
+		clearBegin		= min (clearBegin, gRecordMeta);
+		clearEnd		= max (clearEnd, gRecordMeta + gRecordSize);
+		gRecordAborted	= true;
+	}
+
+	EmBlockMetaMap::iterator	iter = gBlocksByMeta.lower_bound (begin - gLargestBlock);
+
+	while (iter != gBlocksByMeta.end () && iter->first < end)
+	{
+		EmBlock68K*	block		= iter->second;
+		uint8*		blockEnd	= block->fMetaStart + block->fSize;
+
+		if (blockEnd > begin)
+		{
+			clearBegin	= min (clearBegin, block->fMetaStart);
+			clearEnd	= max (clearEnd, blockEnd);
+
+			gBlocksByMeta.erase (iter++);
+			EmBlockCache68K::Remove (block);
+		}
+		else
+		{
+			++iter;
+		}
+	}
+
+	PrvRemarkRange (clearBegin, clearEnd);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmBlockCache68K::EnterExecute
+// ---------------------------------------------------------------------------
+
+void EmBlockCache68K::EnterExecute (void)
+{
+	if (gExecuteDepth++ > 0)
+		return;
+
+	// Nothing can be executing out of an invalidated block now.
+
+	EmBlockList::iterator	iter = gDeadBlocks.begin ();
+
+	while (iter != gDeadBlocks.end ())
+	{
+		Platform::DisposeMemory (*iter);
+		++iter;
+	}
+
+	gDeadBlocks.clear ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmBlockCache68K::ExitExecute
+// ---------------------------------------------------------------------------
+
+void EmBlockCache68K::ExitExecute (void)
+{
+	EmAssert (gExecuteDepth > 0);
+
+	if (--gExecuteDepth > 0)
+		return;
+
+	// If we're leaving in the middle of a recording (an exception was
+	// thrown out of the CPU loop), throw the recording away.
+
+	if (gRecording)
+	{
+		gRecordAborted = true;
+		EmBlockCache68K::EndBlock ();
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmBlockCache68K::BeginBlock
+// ---------------------------------------------------------------------------
+// Start recording a block at "pc".  Returns false if the code there can't
+// be cached, in which case the caller should just interpret it.  Only one
+// block is recorded at a time; nested CPU loops started while a block is
+// being recorded simply interpret.
+
+Bool EmBlockCache68K::BeginBlock (emuptr pc)
+{
+	if (gRecording || (pc & 1) != 0 || !::PrvIsCodeBank (pc))
+		return false;
+
+	if (gBlocksByPC.size () >= kMaxBlocks)
+	{
+		EmBlockCache68K::Flush ();
+	}
+
+	gRecording		= true;
+	gRecordAborted	= false;
+	gRecordPC		= pc;
+	gRecordMeta		= EmMemGetMetaAddress (pc);
+	gRecordSize		= 0;
+	gRecordCount	= 0;
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmBlockCache68K::AddInstruction
+// ---------------------------------------------------------------------------
+// Called after the interpreter has executed the instruction at "offset".
+// "nextOffset" is where the PC now points, and "sequential" is true if the
+// instruction completed without redirecting the PC (that is, it didn't
+// take an exception).
+
+Bool EmBlockCache68K::AddInstruction (EmBlockOpFunc68K* handler, uint16 opcode,
+									  uint32 offset, uint32 nextOffset,
+									  Bool sequential)
+{
+	if (!gRecording || gRecordAborted)
+		return false;
+
+	EmAssert (offset == gRecordSize);
+
+	Bool	ends = gEndsBlock[opcode] != 0;
+
+	// An ordinary instruction that took an exception tells us nothing
+	// about where the next instruction is.  Leave it out of the block.
+
+	if (!ends && (!sequential || nextOffset <= offset))
+		return false;
+
+	EmBlockInsn68K&	insn = gRecordInsns[gRecordCount++];
+
+	insn.fHandler	= handler;
+	insn.fOpcode	= opcode;
+	insn.fNext		= ends ? 0 : (uint16) nextOffset;
+
+	// Only the opcode words are really cached (UAE reads extension words
+	// itself), but tagging the whole span is simpler and costs little.
+
+	uint32	newSize = ends ? offset + 2 : nextOffset;
+
+	MetaMemory::MarkCodeBlock (gRecordMeta + gRecordSize, gRecordMeta + newSize);
+	Memory::RestrictPages (gRecordPC + gRecordSize, gRecordPC + newSize, kEmMemPagePlainSet);
+	gRecordSize = newSize;
+
+	if (ends || gRecordCount >= kMaxBlockInsns)
+		return false;
+
+	// Make sure the next instruction is in the same run of memory, and
+	// stop short of any instruction break so that breaks are only ever
+	// found at the start of a block.
+
+	emuptr	nextPC = gRecordPC + nextOffset;
+
+	if (!::PrvIsCodeBank (nextPC))
+		return false;
+
+	uint8*	nextMeta = EmMemGetMetaAddress (nextPC);
+
+	if (nextMeta != gRecordMeta + nextOffset || MetaMemory::IsCPUBreak (nextMeta))
+		return false;
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmBlockCache68K::EndBlock
+// ---------------------------------------------------------------------------
+
+void EmBlockCache68K::EndBlock (void)
+{
+	if (!gRecording)
+		return;
+
+	// Keep the block only if it's complete and not already known.  (A
+	// nested CPU loop may have created it while we were recording.)
+
+	Bool	keep = !gRecordAborted && gRecordCount > 0 &&
+				   gBlocksByPC.find (gRecordPC) == gBlocksByPC.end ();
+
+	gRecording = false;
+
+	if (!keep)
+	{
+		if (!gRecordAborted)
+		{
+			::PrvRemarkRange (gRecordMeta, gRecordMeta + gRecordSize);
+		}
+
+		return;
+	}
+
+	size_t		size	= sizeof (EmBlock68K) + (gRecordCount - 1) * sizeof (EmBlockInsn68K);
+	EmBlock68K*	block	= (EmBlock68K*) Platform::AllocateMemory (size);
+
+	block->fStart		= gRecordPC;
+	block->fMetaStart	= gRecordMeta;
+	block->fSize		= gRecordSize;
+	block->fValid		= true;
+	block->fCount		= gRecordCount;
+
+	memcpy (block->fInsns, gRecordInsns, gRecordCount * sizeof (EmBlockInsn68K));
+
+	gBlocksByPC[block->fStart] = block;
+	gBlocksByMeta.insert (EmBlockMetaMap::value_type (block->fMetaStart, block));
+	gLargestBlock = max (gLargestBlock, block->fSize);
+
+	fgTable[(block->fStart >> 1) & kTableMask] = block;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmBlockCache68K::FindSlow
+// ---------------------------------------------------------------------------
+
+EmBlock68K* EmBlockCache68K::FindSlow (emuptr pc)
+{
+	EmBlockPCMap::iterator	iter = gBlocksByPC.find (pc);
+
+	if (iter == gBlocksByPC.end ())
+		return NULL;
+
+	fgTable[(pc >> 1) & kTableMask] = iter->second;
+
+	return iter->second;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmBlockCache68K::Remove
+// ---------------------------------------------------------------------------
+// Unlink a block (already removed from gBlocksByMeta) from the PC lookups.
+// The block itself may be the one executing, so it's only marked invalid
+// here and freed by the next outermost EnterExecute.
+
+void EmBlockCache68K::Remove (EmBlock68K* block)
+{
+	EmBlock68K*&	slot = fgTable[(block->fStart >> 1) & kTableMask];
+
+	if (slot == block)
+		slot = NULL;
+
+	gBlocksByPC.erase (block->fStart);
+
+	block->fValid = false;
+	gDeadBlocks.push_back (block);
+}
@@ -0,0 +1,120 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Predecoded basic-block cache for the 68K core.
+
+	Code in ROM and RAM is decoded into straight-line blocks the first
+	time it runs.  Each block records, per instruction, the UAE handler,
+	the opcode, and the offset of the following instruction, so that
+	EmCPU68K::ExecuteBlocks can dispatch without re-fetching and
+	re-decoding opcodes or checking for breakpoints on every instruction.
+	UAE handlers fetch their own extension words, so those are not
+	copied into the block.
+
+	The bytes covered by a block are tagged with MetaMemory's kCodeBlock
+	bit.  The ROM, SRAM, and DRAM "set" paths test that bit and call
+	Invalidate when code is overwritten.  Blocks are indexed by their
+	meta-memory address so that writes through any alias of the same
+	physical memory find them.
+\* ===================================================================== */
+
+#ifndef EmBlockCache68K_h
+#define EmBlockCache68K_h
+
+// Same signature as UAE's cpuop_func; declared here so that clients
+// (MetaMemory.h in particular) don't need to pull in all of UAE.
+
+typedef unsigned long	EmBlockOpFunc68K (uint32);
+
+struct EmBlockInsn68K
+{
+	EmBlockOpFunc68K*	fHandler;
+	uint16				fOpcode;
+	uint16				fNext;		// Offset of the next instruction from the block start.
+};
+
+struct EmBlock68K
+{
+	emuptr				fStart;		// Emulated address of the first instruction.
+	uint8*				fMetaStart;	// Meta-memory address of the first byte.
+	uint32				fSize;		// Number of code bytes covered.
+	Bool				fValid;		// Cleared when invalidated; storage is freed later.
+	int					fCount;		// Number of entries in fInsns.
+	EmBlockInsn68K		fInsns[1];	// (variable length)
+};
+
+
+class EmBlockCache68K
+{
+	public:
+		// Called from EmCPU68K::InitializeUAETables while UAE's
+		// table68k is still available.
+
+		static void				InitializeOpcodeTable	(void);
+
+		// Drop all blocks.  Flush also clears the kCodeBlock bits in
+		// meta-memory and so must only be called while that memory is
+		// valid; Dispose frees the blocks without touching it.
+
+		static void				Flush					(void);
+		static void				Dispose					(void);
+
+		// Called by the memory banks when a write touches bytes tagged
+		// with kCodeBlock.
+
+		static void				Invalidate				(uint8* metaAddress, uint32 size);
+
+		// Bracket each run of EmCPU68K::ExecuteBlocks.  Invalidated
+		// blocks may still be executing, so they are only freed when the
+		// outermost run starts.
+
+		static void				EnterExecute			(void);
+		static void				ExitExecute				(void);
+
+		// Return the block starting at "pc", or NULL.
+
+		static EmBlock68K*		Find					(emuptr pc);	// Inlined, defined below
+
+		// Record a new block while the interpreter executes it.
+		// AddInstruction is called after each instruction; it returns
+		// false when the block is complete or cannot be extended.
+
+		static Bool				BeginBlock				(emuptr pc);
+		static Bool				AddInstruction			(EmBlockOpFunc68K* handler,
+														 uint16 opcode,
+														 uint32 offset,
+														 uint32 nextOffset,
+														 Bool sequential);
+		static void				EndBlock				(void);
+
+	private:
+		static EmBlock68K*		FindSlow				(emuptr pc);
+		static void				Remove					(EmBlock68K*);
+
+		enum { kTableSize = 4096, kTableMask = kTableSize - 1 };
+
+		static EmBlock68K*		fgTable[kTableSize];
+};
+
+
+// Stack object used by EmCPU68K::ExecuteBlocks to bracket a run,
+// even if an exception is thrown out of the CPU loop.
+
+class StBlockCacheExecute
+{
+	public:
+								StBlockCacheExecute		(void) { EmBlockCache68K::EnterExecute (); }
+								~StBlockCacheExecute	(void) { EmBlockCache68K::ExitExecute (); }
+};
+
+
+inline EmBlock68K* EmBlockCache68K::Find (emuptr pc)
+{
+	EmBlock68K*	block = fgTable[(pc >> 1) & kTableMask];
+
+	if (block && block->fStart == pc)
+		return block;
+
+	return FindSlow (pc);
+}
+
+#endif	/* EmBlockCache68K_h */
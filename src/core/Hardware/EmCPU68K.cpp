@@ -17,14 +17,17 @@
 #include "Byteswapping.h"		// Canonical
 #include "DebugMgr.h"			// gExceptionAddress, gExceptionSize, gExceptionForRead
 #include "EmBankROM.h"			// EmBankROM::GetMemoryStart
+#include "EmBlockCache68K.h"	// EmBlockCache68K
 #include "EmEventPlayback.h"	// EmEventPlayback::ReplayingEvents
 #include "EmHAL.h"				// EmHAL::GetInterruptLevel
 #include "EmMemory.h"			// CEnableFullAccess
 #include "EmMinimize.h"			// IsOn
+#include "EmScreen.h"			// EmScreen::CycleSlowly
 #include "EmSession.h"			// HandleInstructionBreak
 #include "Logging.h"			// LogAppendMsg
 #include "MetaMemory.h"			// IsCPUBreak
 #include "Platform.h"			// GetMilliseconds
+#include "PreferenceMgr.h"		// Preference, kPrefKeyTimerAccuracy
 #include "SessionFile.h"		// WriteDBallRegs, etc.
 #include "StringData.h"			// kExceptionNames
 #include "EmDeviceBenchmark.h"	// EmDeviceBenchmark_GetEffectiveClockFreq
@@ -123,15 +126,19 @@ EmCPU68K*	gCPU68K;
 // code can be more efficient if "counter" can be cached in a register
 // instead of being a static or global variable.
 
-#define CYCLE(sleeping, cycles)													\
+#define CYCLE(sleeping)															\
 {																				\
 	EmAssert (session);															\
 																				\
 	/* Always advance timers, even during nested execution.  Without this, */	\
 	/* a STOP instruction during a nested call can never be cleared because */	\
 	/* no timer interrupt fires.  (Matches DOSBox's approach of always */		\
-	/* firing PIC events at all nesting depths.) */								\
-	EmHAL::Cycle (sleeping, cycles);											\
+	/* firing PIC events at all nesting depths.)  The timers are only */		\
+	/* brought up to date when their next event is due; see SyncHardware. */	\
+	if (fEvents.IsDue (fCycleCount))											\
+	{																			\
+		this->ServiceHardware ();												\
+	}																			\
 																				\
 	if (!session->IsNested ())													\
 	{																			\
@@ -152,6 +159,8 @@ EmCPU68K::EmCPU68K (EmSession* session) :
 	EmCPU (session),
 	fLastTraceAddress (EmMemNULL),
 	fCycleCount (0),
+	fHALCycleCount (0),
+	fEvents (),
 //	fExceptionHandlers (),
 	fHookJSR (),
 	fHookJSR_Ind (),
@@ -197,6 +206,11 @@ void EmCPU68K::Reset (Bool hardwareReset)
 {
 	fLastTraceAddress		= EmMemNULL;
 	fCycleCount				= 0;
+	fHALCycleCount			= 0;
+	fRAMCycleCount			= 0;
+	fRAMCycleMark			= 0;
+
+	fEvents.Reset (fCycleCount);
 
 #if REGISTER_HISTORY
 	fRegHistoryIndex		= 0;
@@ -275,6 +289,11 @@ void EmCPU68K::Load (SessionFile& f)
 
 	Canonical (tempRegs);
 	this->SetRegisters (tempRegs);
+
+	// The hardware state was just replaced; have it post new deadlines.
+
+	fHALCycleCount = fCycleCount;
+	fEvents.Reset (fCycleCount);
 }
 
 
@@ -348,6 +367,23 @@ void EmCPU68K::Execute (void)
 	uint32	deadManStart = Platform::GetMilliseconds ();
 #endif
 
+#if !REGISTER_HISTORY
+	// -----------------------------------------------------------------------
+	// Use the predecoded block engine if it's been selected.  Profiling
+	// (which needs to see every instruction) always uses this loop.
+	// -----------------------------------------------------------------------
+
+	if (session->fCPUEngine.load (std::memory_order_relaxed) == kCPUEngineBlocks
+#if HAS_PROFILING
+		&& !gProfilingEnabled
+#endif
+		)
+	{
+		this->ExecuteBlocks ();
+		return;
+	}
+#endif
+
 	// -----------------------------------------------------------------------
 	// Check for the stopped flag before entering the "execute an opcode"
 	// section.  It could be that we last exited the loop while still in stop
@@ -521,7 +557,7 @@ void EmCPU68K::Execute (void)
 
 		// Perform periodic tasks.
 
-		CYCLE (false, cycles);
+		CYCLE (false);
 
 StoppedLoop:
 
@@ -601,6 +637,141 @@ StoppedLoop:
 #endif
 
 
+// ---------------------------------------------------------------------------
+//		� EmCPU68K::ExecuteBlocks
+// ---------------------------------------------------------------------------
+// Alternate CPU loop that runs predecoded basic blocks (see
+// EmBlockCache68K.h).  The first time code at a given address is reached,
+// it's executed one instruction at a time while its handlers are recorded.
+// After that, the block's instructions are dispatched straight from the
+// recorded handlers.  Breakpoints are checked only at the start of a
+// block; the cache makes sure that's the only place they can be.
+//
+// A block is left early if an instruction sets any special flags, if the
+// PC doesn't land on the next recorded instruction (an exception was
+// taken), or if the block was invalidated while running.
+//
+// As in Execute, the hardware is serviced only when its next scheduled
+// event is due.  An event that raises an interrupt sets the special flags,
+// which ends the block.
+
+void EmCPU68K::ExecuteBlocks (void)
+{
+	EmSession*		session		= fSession;
+	int				counter		= 0;
+
+	StBlockCacheExecute	executing;
+
+	if ((regs.spcflags & SPCFLAG_STOP) != 0)
+		goto StoppedLoop;
+
+	while (1)
+	{
+		if (MetaMemory::IsCPUBreak (regs.pc_meta_oldp + (regs.pc_p - regs.pc_oldp)))
+		{
+			EmAssert (session);
+			session->HandleInstructionBreak ();
+		}
+
+		{
+			emuptr		pc			= m68k_getpc ();
+			uint8*		base		= regs.pc_p;
+			EmBlock68K*	block		= EmBlockCache68K::Find (pc);
+			int			executed	= 0;
+
+			if (block)
+			{
+				const EmBlockInsn68K*	insn	= block->fInsns;
+				const EmBlockInsn68K*	last	= insn + block->fCount - 1;
+
+				while (1)
+				{
+					fCycleCount += insn->fHandler (insn->fOpcode) * 2;
+
+					++executed;
+
+					if (fEvents.IsDue (fCycleCount))
+					{
+						this->ServiceHardware ();
+					}
+
+					if (insn == last || regs.spcflags ||
+						regs.pc_p != base + insn->fNext || !block->fValid)
+					{
+						break;
+					}
+
+					++insn;
+				}
+			}
+			else
+			{
+				// Not seen before: interpret it, recording as we go.
+
+				Bool	recording = EmBlockCache68K::BeginBlock (pc);
+
+				while (1)
+				{
+					uint8*		insnStart	= regs.pc_p;
+					EmOpcode68K	opcode		= do_get_mem_word (insnStart);
+					cpuop_func*	handler		= cpufunctbl[opcode];
+
+					fCycleCount += handler (opcode) * 2;
+
+					++executed;
+
+					if (fEvents.IsDue (fCycleCount))
+					{
+						this->ServiceHardware ();
+					}
+
+					// An instruction that redirects the PC through m68k_setpc
+					// (a jump, or an exception) leaves pc_p == pc_oldp.
+
+					if (!recording ||
+						!EmBlockCache68K::AddInstruction (handler, opcode,
+							insnStart - base, regs.pc_p - base,
+							regs.pc_p != regs.pc_oldp) ||
+						regs.spcflags)
+					{
+						break;
+					}
+				}
+
+				if (recording)
+				{
+					EmBlockCache68K::EndBlock ();
+				}
+			}
+
+			// Perform the expensive periodic tasks (as in the CYCLE
+			// macro, but once for the whole block).
+
+			if (!session->IsNested ())
+			{
+				counter += executed;
+
+				if (counter > 0x7FFF)
+				{
+					counter &= 0x7FFF;
+					this->CycleSlowly (false);
+				}
+			}
+		}
+
+StoppedLoop:
+
+		if (regs.spcflags)
+		{
+			if (this->ExecuteSpecial ())
+			{
+				break;
+			}
+		}
+	}
+}
+
+
 // ---------------------------------------------------------------------------
 //		� EmCPU68K::ExecuteSpecial
 // ---------------------------------------------------------------------------
@@ -627,8 +798,7 @@ Bool EmCPU68K::ExecuteSpecial (void)
 			// instructions past the STOP opcode.
 			while (regs.spcflags & SPCFLAG_STOP)
 			{
-				fCycleCount += 16;
-				EmHAL::Cycle (true, 16);
+				this->CycleSleeping (16);
 
 				if (regs.spcflags & (SPCFLAG_INT | SPCFLAG_DOINT))
 				{
@@ -881,6 +1051,11 @@ Bool EmCPU68K::ExecuteStoppedLoop (void)
 		}
 	}
 
+	// Account for the instructions executed before the STOP, so that
+	// GetCyclesUntilNextInterrupt starts from an up-to-date timer.
+
+	this->SyncHardware ();
+
 	int	counter = 0;
 
 #if HAS_DEAD_MANS_SWITCH
@@ -904,7 +1079,28 @@ Bool EmCPU68K::ExecuteStoppedLoop (void)
 		// Calculate how many cycles until the next timer interrupt fires.
 		int32 cyclesToNext = EmHAL::GetCyclesUntilNextInterrupt ();
 
-		if (cyclesToNext > 0 && cyclesToNext < 0x7FFFFFFF)
+		if (cyclesToNext > 0 && cyclesToNext < 0x7FFFFFFF && this->CanSkipIdleTime ())
+		{
+			// Nothing can wake the OS before the next timer interrupt or
+			// hardware event, so jump straight there without sleeping.
+			// Credit the skipped cycles to the throttle so that
+			// CycleSlowly doesn't try to pay them back in wall-clock time.
+
+			int32 untilEvent = (int32) (fEvents.GetNextDeadline () - fCycleCount);
+			if (untilEvent < cyclesToNext)
+				cyclesToNext = untilEvent;
+			if (cyclesToNext < 16)
+				cyclesToNext = 16;
+
+			this->CycleSleeping (cyclesToNext);
+
+			fIdleSkippedCycles	+= cyclesToNext;
+			fThrottleBaseCycles	+= cyclesToNext;
+
+			if (gPCInRAM)
+				fRAMCycleMark	+= cyclesToNext;
+		}
+		else if (cyclesToNext > 0 && cyclesToNext < 0x7FFFFFFF)
 		{
 			// Accurate timer is active and knows when the next interrupt fires.
 			// Advance by that amount (clamped) and sleep for the wall-clock equivalent.
@@ -914,8 +1110,7 @@ Bool EmCPU68K::ExecuteStoppedLoop (void)
 			if (cyclesToNext > 65536)
 				cyclesToNext = 65536;
 
-			fCycleCount += cyclesToNext;
-			EmHAL::Cycle (true, cyclesToNext);
+			this->CycleSleeping (cyclesToNext);
 
 			// Throttle: sleep for the corresponding wall-clock time.
 			// Use the RAW system clock here, not the benchmark-corrected
@@ -947,8 +1142,7 @@ Bool EmCPU68K::ExecuteStoppedLoop (void)
 			// counter already past compare).  Fall back to small fixed steps
 			// so the legacy Cycle() path can fire interrupts normally.
 
-			fCycleCount += 16;
-			EmHAL::Cycle (true, 16);
+			this->CycleSleeping (16);
 		}
 
 		// Perform expensive periodic tasks (button polling, UART,
@@ -998,6 +1192,35 @@ Bool EmCPU68K::ExecuteStoppedLoop (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		� EmCPU68K::CanSkipIdleTime
+// ---------------------------------------------------------------------------
+// Return whether ExecuteStoppedLoop may fast-forward to the next timer
+// deadline.  That's only done when the user asked for it, when an
+// automated run (Gremlins, event replay, minimization) is driving the
+// session, and when nothing other than a timer could wake the OS: no
+// interrupt is pending and no button, key, or pen input is queued.
+
+Bool EmCPU68K::CanSkipIdleTime (void)
+{
+	if (!fSession->fIdleFastForward.load (std::memory_order_relaxed))
+		return false;
+
+	if (!Hordes::IsOn () && !EmEventPlayback::ReplayingEvents () && !EmMinimize::IsOn ())
+		return false;
+
+	if (regs.spcflags & (SPCFLAG_INT | SPCFLAG_DOINT))
+		return false;
+
+	if (fSession->HasButtonActivity () ||
+		fSession->HasKeyEvent () ||
+		fSession->HasPenEvent ())
+		return false;
+
+	return true;
+}
+
+
 // ---------------------------------------------------------------------------
 //		� EmCPU68K::CycleSlowly
 // ---------------------------------------------------------------------------
@@ -1010,6 +1233,10 @@ void EmCPU68K::CycleSlowly (Bool sleeping)
 
 	Platform::CycleSlowly ();
 
+	// Publish an LCD frame if a vertical refresh period has passed.
+
+	EmScreen::CycleSlowly (fCycleCount);
+
 	// Speed throttle
 	int speed = fSession->fEmulationSpeed.load (std::memory_order_relaxed);
 
@@ -1024,6 +1251,9 @@ void EmCPU68K::CycleSlowly (Bool sleeping)
 			fThrottleBaseCycles = fCycleCount;
 			fThrottleBaseTimeUs = nowUs;
 			fThrottlePrevSpeed = speed;
+			fThrottleBaseRAMCycles = this->GetRAMCycleCount ();
+			memcpy (fThrottleBaseGets, gEmMemRegionGets, sizeof (fThrottleBaseGets));
+			memcpy (fThrottleBasePuts, gEmMemRegionPuts, sizeof (fThrottleBasePuts));
 		}
 		else
 		{
@@ -1043,9 +1273,39 @@ void EmCPU68K::CycleSlowly (Bool sleeping)
 				else
 					clockFreq = sysClk;
 			}
+			if (!fBusTimingChecked && clockFreq > 0)
+			{
+				// Per-region bus timing, if the device has benchmark data.
+				// Otherwise fBusTiming.sysClk stays 0 and we use clockFreq.
+				string deviceID = fSession->GetDevice ().GetIDString ();
+				EmDeviceBenchmark_GetBusTiming (deviceID.c_str (),
+					EmHAL::GetSystemClockFrequency (), fBusTiming);
+				fBusTimingChecked = true;
+			}
 			if (clockFreq > 0)
 			{
-				int64_t emulatedUs = (int64_t) elapsed * 1000000LL / clockFreq;
+				int64_t emulatedUs;
+
+				if (fBusTiming.sysClk > 0)
+				{
+					uint32	ramCycles = this->GetRAMCycleCount () - fThrottleBaseRAMCycles;
+					uint32	gets[kEmMemRegionCount];
+					uint32	puts[kEmMemRegionCount];
+
+					for (int region = 0; region < kEmMemRegionCount; ++region)
+					{
+						gets[region] = gEmMemRegionGets[region] - fThrottleBaseGets[region];
+						puts[region] = gEmMemRegionPuts[region] - fThrottleBasePuts[region];
+					}
+
+					emulatedUs = EmDeviceBenchmark_GetElapsedUs (fBusTiming,
+						elapsed, ramCycles, gets, puts);
+				}
+				else
+				{
+					emulatedUs = (int64_t) elapsed * 1000000LL / clockFreq;
+				}
+
 				int64_t targetWallUs = emulatedUs * 100 / speed;
 				int64_t actualWallUs = nowUs - fThrottleBaseTimeUs;
 				int64_t sleepUs = targetWallUs - actualWallUs;
@@ -1068,6 +1328,9 @@ void EmCPU68K::CycleSlowly (Bool sleeping)
 					// More than 100ms behind — reset to prevent catch-up burst
 					fThrottleBaseCycles = fCycleCount;
 					fThrottleBaseTimeUs = nowUs;
+					fThrottleBaseRAMCycles = this->GetRAMCycleCount ();
+					memcpy (fThrottleBaseGets, gEmMemRegionGets, sizeof (fThrottleBaseGets));
+					memcpy (fThrottleBasePuts, gEmMemRegionPuts, sizeof (fThrottleBasePuts));
 				}
 			}
 		}
@@ -1235,6 +1498,24 @@ Bool EmCPU68K::Stopped (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		� EmCPU68K::Park
+// ---------------------------------------------------------------------------
+// Halt the CPU until the next interrupt, just as the STOP instruction does.
+// The PC should already point at whatever is to be run again on wake-up.
+// If interrupts are masked off, nothing could wake the CPU, so it's left
+// running.
+
+void EmCPU68K::Park (void)
+{
+	if (regs.intmask >= 7)
+		return;
+
+	regs.stopped = 1;
+	regs.spcflags |= SPCFLAG_STOP;
+}
+
+
 // ---------------------------------------------------------------------------
 //		� EmCPU68K::CheckForBreak
 // ---------------------------------------------------------------------------
@@ -1377,12 +1658,12 @@ void EmCPU68K::ProcessException (ExceptionNumber exception)
 		emuptr frame = m68k_areg (regs, 7);
 
 		// Eh...Palm OS doesn't use these 3 anyway...
-		EmMemPut16 (frame + offsetof (ExceptionStackFrame2, functionCode), 0);
-		EmMemPut32 (frame + offsetof (ExceptionStackFrame2, accessAddress), 0);
-		EmMemPut16 (frame + offsetof (ExceptionStackFrame2, instructionRegister), 0);
+		EmMemCPUPut16 (frame + offsetof (ExceptionStackFrame2, functionCode), 0);
+		EmMemCPUPut32 (frame + offsetof (ExceptionStackFrame2, accessAddress), 0);
+		EmMemCPUPut16 (frame + offsetof (ExceptionStackFrame2, instructionRegister), 0);
 
-		EmMemPut16 (frame + offsetof (ExceptionStackFrame2, statusRegister), regs.sr);
-		EmMemPut32 (frame + offsetof (ExceptionStackFrame2, programCounter), m68k_getpc ());
+		EmMemCPUPut16 (frame + offsetof (ExceptionStackFrame2, statusRegister), regs.sr);
+		EmMemCPUPut32 (frame + offsetof (ExceptionStackFrame2, programCounter), m68k_getpc ());
 	}
 	else
 	{
@@ -1392,8 +1673,8 @@ void EmCPU68K::ProcessException (ExceptionNumber exception)
 
 		emuptr frame = m68k_areg (regs, 7);
 
-		EmMemPut16 (frame + offsetof (ExceptionStackFrame1, statusRegister), regs.sr);
-		EmMemPut32 (frame + offsetof (ExceptionStackFrame1, programCounter), m68k_getpc ());
+		EmMemCPUPut16 (frame + offsetof (ExceptionStackFrame1, statusRegister), regs.sr);
+		EmMemCPUPut32 (frame + offsetof (ExceptionStackFrame1, programCounter), m68k_getpc ());
 	}
 
 	emuptr newpc;
@@ -1401,7 +1682,7 @@ void EmCPU68K::ProcessException (ExceptionNumber exception)
 		CEnableFullAccess	munge;	// Remove blocks on memory access.
 
 		// Get the exception handler address.
-		newpc = EmMemGet32 (regs.vbr + 4 * exception);
+		newpc = EmMemCPUGet32 (regs.vbr + 4 * exception);
 	}
 
 	// Check the exception handler address and jam it into the PC.
@@ -1569,7 +1850,32 @@ void EmCPU68K::CheckNewPC (emuptr dest)
 		++iter;
 	}
 
+	// Keep track of the cycles spent running code from RAM, which the
+	// throttle charges at a different rate from code in Flash.
+
+	Bool	wasInRAM = gPCInRAM;
+
 	EmMemory::CheckNewPC (dest);
+
+	if (gPCInRAM && !wasInRAM)
+		fRAMCycleMark = fCycleCount;
+	else if (!gPCInRAM && wasInRAM)
+		fRAMCycleCount += fCycleCount - fRAMCycleMark;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmCPU68K::GetRAMCycleCount
+// ---------------------------------------------------------------------------
+// The number of cycles run with the PC in RAM, wrapping like fCycleCount.
+// Cycles skipped while idle aren't included.
+
+uint32 EmCPU68K::GetRAMCycleCount (void)
+{
+	if (gPCInRAM)
+		return fRAMCycleCount + (fCycleCount - fRAMCycleMark);
+
+	return fRAMCycleCount;
 }
 
 
@@ -1892,6 +2198,108 @@ uint32 EmCPU68K::GetCycleCount (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		� EmCPU68K::ReportIdleSkipped
+// ---------------------------------------------------------------------------
+
+double EmCPU68K::ReportIdleSkipped (void)
+{
+	uint64	cycles = fIdleSkippedCycles;
+	int32	clockFreq = EmHAL::GetSystemClockFrequency ();
+
+	fIdleSkippedCycles = 0;
+
+	if (cycles == 0 || clockFreq <= 0)
+		return 0.0;
+
+	double	seconds = (double) cycles / clockFreq;
+
+	LogAppendMsg ("Idle fast-forward skipped %.3f seconds of emulated time", seconds);
+
+	return seconds;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmCPU68K::SyncHardware
+// ---------------------------------------------------------------------------
+// Hand any cycles executed since the hardware was last serviced to the HAL.
+// Register handlers call this before reading or changing timer state, so
+// that they see the same values they would have had the HAL been called
+// after every instruction.
+
+void EmCPU68K::SyncHardware (void)
+{
+	if (fCycleCount != fHALCycleCount)
+	{
+		this->ServiceHardware ();
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmCPU68K::ScheduleEvent
+// ---------------------------------------------------------------------------
+// Post the number of cycles from the last EmHAL::Cycle call until the given
+// event needs servicing.  A value of zero asks for service after the next
+// instruction (the legacy timers count calls rather than cycles, and so
+// always ask for that).
+
+void EmCPU68K::ScheduleEvent (EmEventID id, int32 cycles)
+{
+	if (cycles < 0)
+		cycles = 0;
+
+	fEvents.Schedule (id, fHALCycleCount + cycles);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmCPU68K::CancelEvent
+// ---------------------------------------------------------------------------
+
+void EmCPU68K::CancelEvent (EmEventID id)
+{
+	fEvents.Cancel (id);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmCPU68K::ServiceHardware
+// ---------------------------------------------------------------------------
+// Called from the CPU loops when the earliest scheduled event is due.  The
+// events that are due are dropped first; the HAL handlers post new ones
+// from within EmHAL::Cycle.
+
+void EmCPU68K::ServiceHardware (void)
+{
+	int32	cycles = fCycleCount - fHALCycleCount;
+
+	fHALCycleCount = fCycleCount;
+	fEvents.Advance (fHALCycleCount);
+
+	EmHAL::Cycle (false, cycles);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmCPU68K::CycleSleeping
+// ---------------------------------------------------------------------------
+// Advance the clock while the CPU is stopped.  Sleeping cycles always go
+// straight to the HAL, which uses them to fast-forward its timers.
+
+void EmCPU68K::CycleSleeping (int32 cycles)
+{
+	this->SyncHardware ();
+
+	fCycleCount		+= cycles;
+	fHALCycleCount	= fCycleCount;
+	fEvents.Advance (fHALCycleCount);
+
+	EmHAL::Cycle (true, cycles);
+}
+
+
 // ---------------------------------------------------------------------------
 //		� EmCPU68K::BusError
 // ---------------------------------------------------------------------------
@@ -2026,6 +2434,10 @@ void EmCPU68K::InitializeUAETables (void)
 		}
 	}
 
+	// Let the block cache classify opcodes while table68k is still around.
+
+	EmBlockCache68K::InitializeOpcodeTable ();
+
 	// (hey readcpu doesn't free this guy!)
 
 	Platform::DisposeMemory (table68k);
@@ -15,6 +15,8 @@
 #define EmCPU68K_h
 
 #include "EmCPU.h"				// EmCPU
+#include "EmDeviceBenchmark.h"	// EmBusTiming
+#include "EmEventScheduler.h"	// EmEventScheduler
 
 #include <vector>				// vector
 
@@ -244,6 +246,11 @@ class EmCPU68K : public EmCPU
 
 		virtual Bool			Stopped				(void);
 
+		// Idle the CPU as the STOP instruction would, until an interrupt
+		// comes in.  Used to park a system call that's waiting on the host.
+
+		void					Park				(void);
+
 		// Called from routines in EmUAEGlue.cpp
 
 		void					ProcessException			(ExceptionNumber);
@@ -292,15 +299,36 @@ class EmCPU68K : public EmCPU
 
 		uint32					GetCycleCount			(void);
 
+		// Idle fast-forward.  Returns the emulated time skipped over while
+		// the OS was idle under Gremlins, event replay, or minimization
+		// since the last call, and logs it if non-zero.
+
+		double					ReportIdleSkipped		(void);
+
+		// Hardware event scheduling.  The CPU loop only calls EmHAL::Cycle
+		// when the earliest posted deadline has passed.  Register handlers
+		// call SyncHardware before looking at or changing timer state, and
+		// ScheduleEvent to post the cycle count (relative to the cycles
+		// already handed to the HAL) at which they next need servicing.
+
+		void					SyncHardware			(void);
+		void					ScheduleEvent			(EmEventID, int32 cycles);
+		void					CancelEvent				(EmEventID);
+
 		void					BusError				(emuptr address, long size, Bool forRead);
 		void					AddressError			(emuptr address, long size, Bool forRead);
 
 	private:
+		void					ExecuteBlocks			(void);
 		Bool 					ExecuteSpecial			(void);
 		Bool	 				ExecuteStoppedLoop		(void);
 
+		void					ServiceHardware			(void);
+		void					CycleSleeping			(int32 cycles);
 		void					CycleSlowly				(Bool sleeping);
+		Bool					CanSkipIdleTime			(void);
 		Bool					CheckForBreak			(void);
+		uint32					GetRAMCycleCount		(void);
 
 		void					ProcessInterrupt		(int32 interrupt);
 
@@ -309,6 +337,8 @@ class EmCPU68K : public EmCPU
 	private:
 		emuptr					fLastTraceAddress;
 		uint32					fCycleCount;
+		uint32					fHALCycleCount;		// Cycles handed to EmHAL::Cycle so far
+		EmEventScheduler		fEvents;
 		Hook68KExceptionList	fExceptionHandlers[kException_LastException];
 		Hook68KJSRList			fHookJSR;
 		Hook68KJSR_IndList		fHookJSR_Ind;
@@ -321,6 +351,14 @@ class EmCPU68K : public EmCPU
 		int			fThrottlePrevSpeed = 0;
 		uint32		fThrottleBaseCycles = 0;
 		int64_t		fThrottleBaseTimeUs = 0;
+		uint32		fThrottleBaseGets[kEmMemRegionCount];
+		uint32		fThrottleBasePuts[kEmMemRegionCount];
+		uint32		fThrottleBaseRAMCycles = 0;
+		uint32		fRAMCycleCount = 0;		// Cycles run with the PC in RAM, up to fRAMCycleMark
+		uint32		fRAMCycleMark = 0;		// fCycleCount when the PC last went into RAM
+		EmBusTiming	fBusTiming;
+		Bool		fBusTimingChecked = false;
+		uint64		fIdleSkippedCycles = 0;
 
 #if REGISTER_HISTORY
 		#define kRegHistorySize	512
@@ -0,0 +1,127 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Deadline-based scheduler for hardware events.  See
+	EmEventScheduler.h for an overview.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmEventScheduler.h"
+
+#include <algorithm>			// push_heap, pop_heap, make_heap
+
+
+// ---------------------------------------------------------------------------
+//		� EmEventScheduler::EmEventScheduler
+// ---------------------------------------------------------------------------
+
+EmEventScheduler::EmEventScheduler (void) :
+	fHeap (),
+	fNow (0),
+	fNextDeadline (0)
+{
+	for (int ii = 0; ii < kEventLast; ++ii)
+		fStamp[ii] = 0;
+
+	fHeap.reserve (4 * kEventLast);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmEventScheduler::Reset
+// ---------------------------------------------------------------------------
+
+void EmEventScheduler::Reset (uint32 now)
+{
+	fHeap.clear ();
+
+	fNow			= now;
+	fNextDeadline	= now;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmEventScheduler::Schedule
+// ---------------------------------------------------------------------------
+
+void EmEventScheduler::Schedule (EmEventID id, uint32 deadline)
+{
+	EmAssert (id >= 0 && id < kEventLast);
+
+	if ((int32) (deadline - fNow) > (int32) kMaxHorizon)
+		deadline = fNow + kMaxHorizon;
+
+	// Bumping the stamp orphans any earlier entry for this event; it's
+	// dropped when it reaches the top of the heap.
+
+	Entry	e;
+	e.fDeadline	= deadline;
+	e.fStamp	= ++fStamp[id];
+	e.fID		= id;
+
+	fHeap.push_back (e);
+	std::push_heap (fHeap.begin (), fHeap.end (), Later ());
+
+	if ((int32) (deadline - fNextDeadline) < 0)
+		fNextDeadline = deadline;
+
+	// Register writes can reschedule the same event many times between
+	// deadlines.  Don't let the orphans pile up.
+
+	if (fHeap.size () > 4 * kEventLast)
+		this->Compact ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmEventScheduler::Cancel
+// ---------------------------------------------------------------------------
+
+void EmEventScheduler::Cancel (EmEventID id)
+{
+	EmAssert (id >= 0 && id < kEventLast);
+
+	++fStamp[id];
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmEventScheduler::Advance
+// ---------------------------------------------------------------------------
+
+void EmEventScheduler::Advance (uint32 now)
+{
+	fNow = now;
+
+	while (!fHeap.empty ())
+	{
+		const Entry&	top = fHeap.front ();
+
+		if (!this->IsStale (top) && (int32) (now - top.fDeadline) < 0)
+			break;
+
+		std::pop_heap (fHeap.begin (), fHeap.end (), Later ());
+		fHeap.pop_back ();
+	}
+
+	fNextDeadline = fHeap.empty () ? now + kMaxHorizon : fHeap.front ().fDeadline;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmEventScheduler::Compact
+// ---------------------------------------------------------------------------
+
+void EmEventScheduler::Compact (void)
+{
+	size_t	kept = 0;
+
+	for (size_t ii = 0; ii < fHeap.size (); ++ii)
+	{
+		if (!this->IsStale (fHeap[ii]))
+			fHeap[kept++] = fHeap[ii];
+	}
+
+	fHeap.resize (kept);
+
+	std::make_heap (fHeap.begin (), fHeap.end (), Later ());
+}
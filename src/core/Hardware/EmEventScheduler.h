@@ -0,0 +1,86 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Deadline-based scheduler for hardware events.
+
+	The hardware register handlers (EmRegsVZ, EmRegsEZ, EmRegs328)
+	post the absolute CPU cycle at which each of their events next
+	needs attention -- a timer reaching its compare value, a prescaler
+	rolling over, etc.  The deadlines are kept in a min-heap so that
+	the CPU loop only has to compare its cycle counter against the
+	earliest one, instead of calling EmHAL::Cycle after every
+	instruction.
+
+	Cycle counts are 32-bit and wrap, so all comparisons are done on
+	the signed difference.  Deadlines are clamped to kMaxHorizon
+	cycles in the future, which keeps them well inside that range.
+\* ===================================================================== */
+
+#ifndef EmEventScheduler_h
+#define EmEventScheduler_h
+
+#include <vector>
+
+enum EmEventID
+{
+	kEventTimer1,
+	kEventTimer2,
+
+	kEventLast
+};
+
+
+class EmEventScheduler
+{
+	public:
+								EmEventScheduler		(void);
+
+		// Forget all events.  The next call to IsDue returns true so
+		// that the handlers get a chance to post their events again.
+
+		void					Reset					(uint32 now);
+
+		// Post (or move) the deadline for the given event.  Only the
+		// most recent deadline for an event is honored.
+
+		void					Schedule				(EmEventID, uint32 deadline);
+		void					Cancel					(EmEventID);
+
+		// Remove all events due at "now" and compute the next deadline.
+		// The caller then services the hardware, which reschedules.
+
+		void					Advance					(uint32 now);
+
+		Bool					IsDue					(uint32 now) const
+									{ return (int32) (now - fNextDeadline) >= 0; }
+
+		uint32					GetNextDeadline			(void) const
+									{ return fNextDeadline; }
+
+		enum { kMaxHorizon = 0x00100000 };
+
+	private:
+		struct Entry
+		{
+			uint32				fDeadline;
+			uint32				fStamp;
+			EmEventID			fID;
+		};
+
+		struct Later
+		{
+			bool operator() (const Entry& a, const Entry& b) const
+				{ return (int32) (a.fDeadline - b.fDeadline) > 0; }
+		};
+
+		Bool					IsStale					(const Entry& e) const
+									{ return e.fStamp != fStamp[e.fID]; }
+
+		void					Compact					(void);
+
+		std::vector<Entry>		fHeap;
+		uint32					fStamp[kEventLast];
+		uint32					fNow;
+		uint32					fNextDeadline;
+};
+
+#endif	/* EmEventScheduler_h */
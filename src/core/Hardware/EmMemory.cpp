@@ -14,12 +14,14 @@
 #include "EmCommon.h"
 #include "EmMemory.h"
 
+#include "Byteswapping.h"		// ByteswapWords
 #include "EmBankDRAM.h"			// EmBankDRAM::Initialize
 #include "EmBankDummy.h"		// EmBankDummy::Initialize
 #include "EmBankMapped.h"		// EmBankMapped::Initialize
 #include "EmBankRegs.h"			// EmBankRegs::Initialize
 #include "EmBankROM.h"			// EmBankROM::Initialize
 #include "EmBankSRAM.h"			// EmBankSRAM::Initialize
+#include "EmBlockCache68K.h"	// EmBlockCache68K::Flush
 #include "EmSession.h"			// gSession, GetDevice
 #include "MetaMemory.h"			// MetaMemory::Initialize
 
@@ -168,6 +170,11 @@ using namespace std;
 	EmMemCallGetFunc
 		Merely calls the given function through the EmAddressBank fn ptr.
 
+	EmMemIsPlainGet, EmMemIsPlainSet, EmMemPageAddress
+		Used by EmMemGetFoo and EmMemPutFoo to bypass the bank functions
+		for ordinary RAM and ROM when no checking is needed.  See the
+		"Direct page table" comments in EmMemory.h.
+
 	EmMemDoGet32, EmMemDoGet16, EmMemDoGet8
 	EmMemDoPut32, EmMemDoPut16, EmMemDoPut8
 		Very low-level memory access.  They return the value at the
@@ -184,6 +191,16 @@ using namespace std;
 
 EmAddressBank*	gEmMemBanks[65536];		// (normally defined in memory.c)
 
+uint8*			gEmMemPageBase[65536];
+uint8			gEmMemPageFlags[65536];
+uint8			gEmMemGetMask;
+uint8			gEmMemSetMask;
+
+EMMEM_THREAD_LOCAL uint32	gEmMemRegionGets[kEmMemRegionCount];
+EMMEM_THREAD_LOCAL uint32	gEmMemRegionPuts[kEmMemRegionCount];
+
+static uint8	gPageInitialFlags[65536];	// Flags before MetaMemory restrictions.
+
 Bool			gPCInRAM;
 Bool			gPCInROM;
 
@@ -343,6 +360,9 @@ void Memory::Initialize (	EmStream&		hROM,
 	// Clear everything out.
 	
 	memset (gEmMemBanks, 0, sizeof (gEmMemBanks));
+	memset (gEmMemPageBase, 0, sizeof (gEmMemPageBase));
+	memset (gEmMemPageFlags, 0, sizeof (gEmMemPageFlags));
+	memset (gPageInitialFlags, 0, sizeof (gPageInitialFlags));
 
 	// Initialize the valid memory banks.
 
@@ -495,6 +515,8 @@ void Memory::Load (SessionFile& f)
 
 void Memory::Dispose (void)
 {
+	EmBlockCache68K::Dispose ();
+
 	EmBankDummy::Dispose ();
 	EmBankRegs::Dispose ();
 	EmBankSRAM::Dispose ();
@@ -525,17 +547,162 @@ void Memory::Dispose (void)
 
 void Memory::InitializeBanks (	EmAddressBank&	iBankInitializer,
 								int32			iStartingBankIndex,
-								int32			iNumberOfBanks)
+								int32			iNumberOfBanks,
+								int				iRegion)
 {
+	uint8	regionFlags = (uint8) (iRegion << kEmMemPageRegionShift);
+
 	for (int32 aBankIndex = iStartingBankIndex;
 		aBankIndex < iStartingBankIndex + iNumberOfBanks;
 		aBankIndex++)
 	{
 		gEmMemBanks[aBankIndex] = &iBankInitializer;
+
+		// Whoever owned these pages before, they're not plain memory
+		// unless the new owner says so.
+
+		gEmMemPageBase[aBankIndex]		= NULL;
+		gEmMemPageFlags[aBankIndex]		= regionFlags;
+		gPageInitialFlags[aBankIndex]	= regionFlags;
 	}
 }
 
 
+// ---------------------------------------------------------------------------
+//		� Memory::InitializePages
+// ---------------------------------------------------------------------------
+// Called by banks backed by ordinary host memory after InitializeBanks, to
+// let EmMemGetFoo and EmMemPutFoo access that memory directly.  Only pages
+// that the bank can translate in their entirety are entered.
+
+void Memory::InitializePages (	int32	iStartingBankIndex,
+								int32	iNumberOfBanks,
+								uint8	iFlags)
+{
+	for (int32 aBankIndex = iStartingBankIndex;
+		aBankIndex < iStartingBankIndex + iNumberOfBanks;
+		aBankIndex++)
+	{
+		EmAddressBank*	bank	= gEmMemBanks[aBankIndex];
+		emuptr			start	= ((emuptr) aBankIndex) << 16;
+
+		EmAssert (bank);
+
+		if (!bank->checkaddr (start, 0x10000))
+			continue;
+
+		uint8			flags	= iFlags |
+								  (gPageInitialFlags[aBankIndex] & kEmMemPageRegionMask);
+
+		gEmMemPageBase[aBankIndex]		= bank->xlateaddr (start);
+		gEmMemPageFlags[aBankIndex]		= flags;
+		gPageInitialFlags[aBankIndex]	= flags;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvAliasPage
+// ---------------------------------------------------------------------------
+// DRAM and SRAM are two views onto the same memory (on the EZ and VZ, the
+// same view).  Meta-memory changes made through one affect both.
+
+static uint32 PrvAliasPage (uint32 page)
+{
+	uint32	ramFirst	= EmMemBankIndex (gMemoryStart);
+	uint32	ramPages	= gRAMBank_Size >> 16;
+
+	if (page >= ramFirst && page < ramFirst + ramPages)
+		return page - ramFirst;
+
+	if (page < ramPages)
+		return page + ramFirst;
+
+	return page;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvResyncPage
+// ---------------------------------------------------------------------------
+
+static void PrvResyncPage (uint32 page)
+{
+	if ((gPageInitialFlags[page] & ~kEmMemPageRegionMask) == 0)
+		return;
+
+	gEmMemPageFlags[page] = gPageInitialFlags[page] &
+		~MetaMemory::GetPageRestrictions (((emuptr) page) << 16);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� Memory::RestrictPages
+// ---------------------------------------------------------------------------
+// Take away the given plain bits from the pages covering [begin, end).
+// Called by MetaMemory when it marks bytes that the bank handlers need to
+// see accesses to.
+
+void Memory::RestrictPages (emuptr begin, emuptr end, uint8 flags)
+{
+	if (end <= begin)
+		return;
+
+	uint32	first	= EmMemBankIndex (begin);
+	uint32	last	= EmMemBankIndex (end - 1);
+
+	for (uint32 page = first; page <= last; ++page)
+	{
+		gEmMemPageFlags[page] &= ~flags;
+		gEmMemPageFlags[::PrvAliasPage (page)] &= ~flags;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� Memory::ResyncPages
+// ---------------------------------------------------------------------------
+// Recompute the plain bits for the pages covering [begin, end) from their
+// meta-memory.  Called when meta-memory bits are removed, and after the
+// bank handlers are reset.
+
+void Memory::ResyncPages (emuptr begin, emuptr end)
+{
+	if (end <= begin)
+		return;
+
+	uint32	first	= EmMemBankIndex (begin);
+	uint32	last	= EmMemBankIndex (end - 1);
+
+	for (uint32 page = first; page <= last; ++page)
+	{
+		::PrvResyncPage (page);
+
+		uint32	alias = ::PrvAliasPage (page);
+
+		if (alias != page)
+			::PrvResyncPage (alias);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� Memory::UpdateAccessMasks
+// ---------------------------------------------------------------------------
+// Recompute gEmMemGetMask and gEmMemSetMask.  Called whenever something
+// they depend on changes: the PC moving between RAM and ROM, or full access
+// being granted or revoked.  Debugger watchpoints don't need the masks;
+// they take the plain bits away from just their own pages.
+
+void Memory::UpdateAccessMasks (void)
+{
+	uint8	checks = (gPCInRAM && !CEnableFullAccess::AccessOK ()) ? kEmMemPageAppChecks : 0;
+
+	gEmMemGetMask = kEmMemPagePlainGet | checks;
+	gEmMemSetMask = kEmMemPagePlainSet | checks;
+}
+
+
 // ---------------------------------------------------------------------------
 //		� Memory::ResetBankHandlers
 // ---------------------------------------------------------------------------
@@ -545,6 +712,10 @@ void Memory::InitializeBanks (	EmAddressBank&	iBankInitializer,
 
 void Memory::ResetBankHandlers (void)
 {
+	// Any predecoded code may now be somewhere else.
+
+	EmBlockCache68K::Flush ();
+
 	EmBankDummy::SetBankHandlers ();
 	EmBankRegs::SetBankHandlers ();
 	EmBankSRAM::SetBankHandlers ();
@@ -565,6 +736,11 @@ void Memory::ResetBankHandlers (void)
 	EmAssert (gSession);
 	if (gSession->GetDevice ().HasFlash ())
 		EmBankFlash::SetBankHandlers ();
+
+	// Pick up any screen and breakpoint marks in the new layout.
+
+	Memory::ResyncPages (0, 0xFFFFFFFF);
+	Memory::UpdateAccessMasks ();
 }
 
 
@@ -610,6 +786,8 @@ void Memory::CheckNewPC (emuptr newPC)
 {
 	gPCInRAM = newPC < EmBankROM::GetMemoryStart ();
 	gPCInROM = newPC >= EmBankROM::GetMemoryStart ();
+
+	Memory::UpdateAccessMasks ();
 }
 
 
@@ -639,6 +817,8 @@ CEnableFullAccess::CEnableFullAccess (void) :
 #endif
 
 	++fgAccessCount;
+
+	Memory::UpdateAccessMasks ();
 }
 
 
@@ -655,6 +835,8 @@ CEnableFullAccess::~CEnableFullAccess (void)
 #endif
 
 	--fgAccessCount;
+
+	Memory::UpdateAccessMasks ();
 }
 
 
@@ -773,6 +955,159 @@ inline void		_decrement (T& v)
 }
 
 
+// ---------------------------------------------------------------------------
+// Bulk transfers.  Rather than dispatching each byte through the bank
+// functions, EmMem_memcpy, EmMem_memmove, and EmMem_memset break their
+// ranges into spans that lie within one 64K page of emulated memory.  Spans
+// of plain memory (see "Direct page table" in EmMemory.h) are transferred
+// with memmove or memset.  Anything else (registers, unmapped memory, the
+// screen, watched memory, etc.) is still handled a byte at a time through
+// the bank functions, so those still see every access.
+//
+// On WORDSWAP_MEMORY hosts, emulated memory is stored as native 16-bit
+// words, so the byte at emulated address "a" lives at host address "a ^ 1".
+// Host buffers are plain byte arrays.
+// ---------------------------------------------------------------------------
+
+inline size_t	_span_length (const void*, size_t len)
+{
+	return len;
+}
+
+inline size_t	_span_length (emuptr p, size_t len)
+{
+	size_t	toPageEnd = 0x10000 - EmMemPageOffset (p);
+
+	return len < toPageEnd ? len : toPageEnd;
+}
+
+inline uint8*	_get_span (const void* p, Bool /*forWrite*/)
+{
+	return (uint8*) p;
+}
+
+inline uint8*	_get_span (emuptr p, Bool forWrite)
+{
+#if EMMEM_PAGE_TABLE
+	if (forWrite ? EmMemIsPlainSet (p) : EmMemIsPlainGet (p))
+		return EmMemPageAddress (p);
+#else
+	UNUSED_PARAM (p)
+	UNUSED_PARAM (forWrite)
+#endif
+
+	return NULL;
+}
+
+// Length of the span ending just before "p", up to "len" bytes.
+
+inline size_t	_span_before (const void*, size_t len)
+{
+	return len;
+}
+
+inline size_t	_span_before (emuptr p, size_t len)
+{
+	size_t	fromPageStart = EmMemPageOffset (p - 1) + 1;
+
+	return len < fromPageStart ? len : fromPageStart;
+}
+
+inline Bool		_is_swapped (const void*)
+{
+	return false;
+}
+
+inline Bool		_is_swapped (emuptr)
+{
+	return WORDSWAP_MEMORY;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvMoveSpan
+// ---------------------------------------------------------------------------
+// Move "len" bytes between two host spans, either of which may be in
+// emulated (possibly word-swapped) memory.  The spans may overlap only if
+// they're both emulated memory; "backward" says which end to start from.
+
+static void PrvMoveSpan (uint8* q, Bool qSwapped,
+						 const uint8* p, Bool pSwapped,
+						 size_t len, Bool backward)
+{
+	if (!qSwapped && !pSwapped)
+	{
+		memmove (q, p, len);
+		return;
+	}
+
+	// Word-swapped memory can only be moved wholesale between spans that
+	// start on the same side of a word; otherwise go a byte at a time.
+	// (Host buffers have the same alignment as the emulated addresses
+	// they stand in for, so the host pointers tell us the parity.)
+
+	if (qSwapped && pSwapped && ((((uintptr_t) q) ^ ((uintptr_t) p)) & 1) != 0)
+	{
+		if (backward)
+		{
+			while (len--)
+				EmMemDoPut8 (q + len, EmMemDoGet8 ((void*) (p + len)));
+		}
+		else
+		{
+			for (size_t ii = 0; ii < len; ++ii)
+				EmMemDoPut8 (q + ii, EmMemDoGet8 ((void*) (p + ii)));
+		}
+
+		return;
+	}
+
+	// Split off the odd leading and trailing bytes of the emulated side.
+	// The middle is then a whole number of words.
+
+	uint8*	emu		= qSwapped ? q : (uint8*) p;
+	size_t	lead	= ((uintptr_t) emu) & 1;
+
+	if (lead > len)
+		lead = len;
+
+	size_t	middle	= (len - lead) & ~(size_t) 1;
+	size_t	trail	= len - lead - middle;
+
+	// Copy one byte from p to q, swapping the address on the emulated side(s).
+
+	#define MOVE_BYTE(offset)																\
+		do {																				\
+			uint8	v = pSwapped ? EmMemDoGet8 ((void*) (p + (offset))) : p[offset];		\
+			if (qSwapped) EmMemDoPut8 (q + (offset), v); else q[offset] = v;				\
+		} while (0)
+
+	if (backward && trail)
+		MOVE_BYTE (lead + middle);
+
+	if (!backward && lead)
+		MOVE_BYTE (0);
+
+	if (middle)
+	{
+		memmove (q + lead, p + lead, middle);
+
+		// Host <-> emulated moves change the byte order of each word.
+
+		if (qSwapped != pSwapped)
+			ByteswapWords (q + lead, middle);
+	}
+
+	if (backward && lead)
+		MOVE_BYTE (0);
+
+	if (!backward && trail)
+		MOVE_BYTE (lead + middle);
+
+	#undef MOVE_BYTE
+}
+
+
 #pragma mark -
 
 /***********************************************************************
@@ -791,32 +1126,41 @@ emuptr 	EmMem_memset(emuptr dst, int val, size_t len)
 {
 	emuptr 	q = dst;
 
-	uint32 longVal = val;
-	longVal |= (longVal << 8);
-	longVal |= (longVal << 16);
+	while (len > 0)
+	{
+		size_t	n		= _span_length (q, len);
+		uint8*	span	= _get_span (q, true);
 
-	EmMemPutFunc	longPutter = EmMemGetBank(dst).lput;
-	EmMemPutFunc	bytePutter = EmMemGetBank(dst).bput;
+		if (span)
+		{
+			// Every byte is the same, so word-swapping doesn't matter,
+			// except for an odd byte at either end: its host neighbour
+			// belongs to the word outside the range.
 
-	while ((q & 3) && len > 0)		// while there are leading bytes
-	{
-		bytePutter(q, val);
-		q += sizeof (char);
-		len -= sizeof (char);
-	}
+			size_t	lead	= 0;
+			size_t	trail	= 0;
 
-	while (len >= sizeof (uint32))	// while there are middle longs
-	{
-		longPutter(q, longVal);
-		q += sizeof (uint32);
-		len -= sizeof (uint32);
-	}
+#if WORDSWAP_MEMORY
+			lead	= q & 1;
+			trail	= (n - lead) & 1;
+#endif
 
-	while (len > 0) 				// while there are trailing bytes
-	{
-		bytePutter(q, val);
-		q += sizeof (char);
-		len -= sizeof (char);
+			if (lead)
+				EmMemDoPut8 (span, (uint8) val);
+
+			memset (span + lead, val, n - lead - trail);
+
+			if (trail)
+				EmMemDoPut8 (span + n - 1, (uint8) val);
+		}
+		else
+		{
+			for (size_t ii = 0; ii < n; ++ii)
+				_put_byte (q + ii, (uint8) val);
+		}
+
+		q += n;
+		len -= n;
 	}
 
 	return dst;
@@ -923,11 +1267,31 @@ T1		EmMem_memcpy (T1 dst, T2 src, size_t len)
 	T1		q = dst;
 	T2		p = src;
 
-	while (len--)
+	while (len > 0)
 	{
-		_put_byte(q, _get_byte(p));
-		_increment (q);
-		_increment (p);
+		size_t	n = _span_length (p, _span_length (q, len));
+
+		uint8*	qSpan = _get_span (q, true);
+		uint8*	pSpan = _get_span (p, false);
+
+		if (qSpan && pSpan)
+		{
+			::PrvMoveSpan (qSpan, _is_swapped (q), pSpan, _is_swapped (p), n, false);
+
+			_add_delta (q, n);
+			_add_delta (p, n);
+		}
+		else
+		{
+			for (size_t ii = 0; ii < n; ++ii)
+			{
+				_put_byte(q, _get_byte(p));
+				_increment (q);
+				_increment (p);
+			}
+		}
+
+		len -= n;
 	}
 
 	return dst;
@@ -970,11 +1334,31 @@ T1		EmMem_memmove (T1 dst, T2 src, size_t len)
 
 	if (backward)
 	{
-		while (len--)
+		while (len > 0)
 		{
-			_put_byte(q, _get_byte(p));
-			_increment (q);
-			_increment (p);
+			size_t	n = _span_length (p, _span_length (q, len));
+
+			uint8*	qSpan = _get_span (q, true);
+			uint8*	pSpan = _get_span (p, false);
+
+			if (qSpan && pSpan)
+			{
+				::PrvMoveSpan (qSpan, _is_swapped (q), pSpan, _is_swapped (p), n, false);
+
+				_add_delta (q, n);
+				_add_delta (p, n);
+			}
+			else
+			{
+				for (size_t ii = 0; ii < n; ++ii)
+				{
+					_put_byte(q, _get_byte(p));
+					_increment (q);
+					_increment (p);
+				}
+			}
+
+			len -= n;
 		}
 	}
 	else
@@ -982,11 +1366,43 @@ T1		EmMem_memmove (T1 dst, T2 src, size_t len)
 		_add_delta (q, len);
 		_add_delta (p, len);
 
-		while (len--)
+		// Work back from the end, a span at a time.  A span here ends at
+		// "q" and "p"; limit it to the pages holding their last bytes.
+
+		while (len > 0)
 		{
-			_decrement (q);
-			_decrement (p);
-			_put_byte(q, _get_byte(p));
+			size_t	n = len;
+
+			n = _span_before (q, n);
+			n = _span_before (p, n);
+
+			_add_delta (q, -(long) n);
+			_add_delta (p, -(long) n);
+
+			uint8*	qSpan = _get_span (q, true);
+			uint8*	pSpan = _get_span (p, false);
+
+			if (qSpan && pSpan)
+			{
+				::PrvMoveSpan (qSpan, _is_swapped (q), pSpan, _is_swapped (p), n, true);
+			}
+			else
+			{
+				T1		qq = q;
+				T2		pp = p;
+
+				_add_delta (qq, n);
+				_add_delta (pp, n);
+
+				for (size_t ii = 0; ii < n; ++ii)
+				{
+					_decrement (qq);
+					_decrement (pp);
+					_put_byte(qq, _get_byte(pp));
+				}
+			}
+
+			len -= n;
 		}
 	}
 
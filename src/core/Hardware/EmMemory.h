@@ -98,12 +98,180 @@ typedef struct EmAddressBank
 #define EmMemCallPutFunc(func, addr, v)	((*EmMemGetBank(addr).func)(addr, v))
 
 
+// ---------------------------------------------------------------------------
+//		� Direct page table
+// ---------------------------------------------------------------------------
+// Most loads and stores are to RAM or ROM at a time when none of the checks
+// in the bank handlers can fire.  For those, EmMemGet/Put skip the bank
+// handlers and go straight to host memory.
+//
+// gEmMemPageBase holds the host address of each 64K page that's backed by
+// ordinary memory.  gEmMemPageFlags says which kinds of access to that page
+// are "plain".  A page loses its plain bits while it holds screen, code
+// block, or data break bytes (see MetaMemory).  Pages whose bank handlers
+// check accesses made by applications are tagged with kEmMemPageAppChecks.
+//
+// The masks fold in the global state: both include kEmMemPageAppChecks
+// while the PC is in RAM (outside of CEnableFullAccess).  Data watchpoints
+// don't touch the masks; they take the plain bits away from just the pages
+// they cover, like the other meta-memory bits above.  An access takes
+// the fast path only if masking the page's flags leaves exactly the plain
+// bit for that kind of access.  See Memory::UpdateAccessMasks.
+//
+// Profiling builds count wait states in the bank handlers, so the fast
+// path is compiled out there.
+//
+// The flags also record which bus region the page belongs to.  The CPU's
+// own loads and stores (EmMemCPUGet/Put, which UAE's get_long and friends
+// map to) are counted against that region, fast path or not, so that the
+// speed throttle can charge each region its own wait states (see
+// EmDeviceBenchmark.h).  Accesses the emulator makes for itself -- patches,
+// the debugger, heap walks -- go through EmMemGet/Put and aren't counted.
+// The region bits are never part of the masks.
+//
+// The counts are kept per thread.  Only the CPU thread's are ever used:
+// they're bumped and read (by the throttle) on that thread alone.
+
+enum
+{
+	kEmMemPagePlainGet		= 0x01,
+	kEmMemPagePlainSet		= 0x02,
+	kEmMemPageAppChecks		= 0x04,
+
+	kEmMemPageRegionShift	= 4,
+	kEmMemPageRegionMask	= 0x30
+};
+
+enum
+{
+	kEmMemRegionOther,		// Unmapped, host-mapped: no bus timing
+	kEmMemRegionRAM,		// DRAM/SRAM, including the frame buffer on the EZ and VZ
+	kEmMemRegionROM,		// ROM and Flash
+	kEmMemRegionRegs,		// On-chip registers and other EmRegs sub-banks
+
+	kEmMemRegionCount
+};
+
+#if !HAS_PROFILING && !PROFILE_MEMORY && !defined (ECM_DYNAMIC_PATCH)
+	#define EMMEM_PAGE_TABLE	1
+#else
+	#define EMMEM_PAGE_TABLE	0
+#endif
+
+extern uint8*	gEmMemPageBase[65536];
+extern uint8	gEmMemPageFlags[65536];
+extern uint8	gEmMemGetMask;
+extern uint8	gEmMemSetMask;
+
+#ifdef __cplusplus
+	#define EMMEM_THREAD_LOCAL	thread_local
+#else
+	#define EMMEM_THREAD_LOCAL	_Thread_local
+#endif
+
+extern EMMEM_THREAD_LOCAL uint32	gEmMemRegionGets[kEmMemRegionCount];
+extern EMMEM_THREAD_LOCAL uint32	gEmMemRegionPuts[kEmMemRegionCount];
+
+#define EmMemPageOffset(addr)			(((emuptr)(addr)) & 0xFFFF)
+#define EmMemPageAddress(addr)			(gEmMemPageBase[EmMemBankIndex(addr)] + EmMemPageOffset(addr))
+
+#define EmMemIsPlainGet(addr)			((gEmMemPageFlags[EmMemBankIndex(addr)] & gEmMemGetMask) == kEmMemPagePlainGet)
+#define EmMemIsPlainSet(addr)			((gEmMemPageFlags[EmMemBankIndex(addr)] & gEmMemSetMask) == kEmMemPagePlainSet)
+
+#define EmMemPageRegion(addr)			((gEmMemPageFlags[EmMemBankIndex(addr)] & kEmMemPageRegionMask) >> kEmMemPageRegionShift)
+#define EmMemCountGet(addr)				(++gEmMemRegionGets[EmMemPageRegion(addr)])
+#define EmMemCountPut(addr)				(++gEmMemRegionPuts[EmMemPageRegion(addr)])
+
+// Odd word and long accesses go through the bank handlers so that they can
+// report the address error.  So do longs that straddle two pages.
+
+#define EmMemIsAligned16(addr)			((((emuptr)(addr)) & 1) == 0)
+#define EmMemIsAligned32(addr)			(EmMemIsAligned16(addr) && EmMemPageOffset(addr) != 0xFFFE)
+
+
+// ---------------------------------------------------------------------------
+//		� EmMemDoGet32
+// ---------------------------------------------------------------------------
+
+STATIC_INLINE uint32 EmMemDoGet32 (void* a)
+{
+#if WORDSWAP_MEMORY || !UNALIGNED_LONG_ACCESS
+	return	(((uint32) *(((uint16*) a) + 0)) << 16) |
+			(((uint32) *(((uint16*) a) + 1)));
+#else
+	return *(uint32*) a;
+#endif
+}
+
+// ---------------------------------------------------------------------------
+//		� EmMemDoGet16
+// ---------------------------------------------------------------------------
+
+STATIC_INLINE uint16 EmMemDoGet16 (void* a)
+{
+	return *(uint16*) a;
+}
+
+// ---------------------------------------------------------------------------
+//		� EmMemDoGet8
+// ---------------------------------------------------------------------------
+
+STATIC_INLINE uint8 EmMemDoGet8 (void* a)
+{
+#if WORDSWAP_MEMORY
+	return *(uint8*) ((intptr_t) a ^ 1);
+#else
+	return *(uint8*) a;
+#endif
+}
+
+// ---------------------------------------------------------------------------
+//		� EmMemDoPut32
+// ---------------------------------------------------------------------------
+
+STATIC_INLINE void EmMemDoPut32 (void* a, uint32 v)
+{
+#if WORDSWAP_MEMORY || !UNALIGNED_LONG_ACCESS
+	*(((uint16*) a) + 0) = (uint16) (v >> 16);
+	*(((uint16*) a) + 1) = (uint16) (v);
+#else
+	*(uint32*) a = v;
+#endif
+}
+
+// ---------------------------------------------------------------------------
+//		� EmMemDoPut16
+// ---------------------------------------------------------------------------
+
+STATIC_INLINE void EmMemDoPut16 (void* a, uint16 v)
+{
+	*(uint16*) a = v;
+}
+
+// ---------------------------------------------------------------------------
+//		� EmMemDoPut8
+// ---------------------------------------------------------------------------
+
+STATIC_INLINE void EmMemDoPut8 (void* a, uint8 v)
+{
+#if WORDSWAP_MEMORY
+	*(uint8*) ((intptr_t) a ^ 1) = v;
+#else
+	*(uint8*) a = v;
+#endif
+}
+
 // ---------------------------------------------------------------------------
 //		� EmMemGet32
 // ---------------------------------------------------------------------------
 
 STATIC_INLINE uint32 EmMemGet32(emuptr addr)
 {
+#if EMMEM_PAGE_TABLE
+	if (EmMemIsPlainGet (addr) && EmMemIsAligned32 (addr))
+		return EmMemDoGet32 (EmMemPageAddress (addr));
+#endif
+
     return EmMemCallGetFunc(lget, addr);
 }
 
@@ -113,6 +281,11 @@ STATIC_INLINE uint32 EmMemGet32(emuptr addr)
 
 STATIC_INLINE uint32 EmMemGet16(emuptr addr)
 {
+#if EMMEM_PAGE_TABLE
+	if (EmMemIsPlainGet (addr) && EmMemIsAligned16 (addr))
+		return EmMemDoGet16 (EmMemPageAddress (addr));
+#endif
+
     return EmMemCallGetFunc(wget, addr);
 }
 
@@ -122,6 +295,11 @@ STATIC_INLINE uint32 EmMemGet16(emuptr addr)
 
 STATIC_INLINE uint32 EmMemGet8(emuptr addr)
 {
+#if EMMEM_PAGE_TABLE
+	if (EmMemIsPlainGet (addr))
+		return EmMemDoGet8 (EmMemPageAddress (addr));
+#endif
+
     return EmMemCallGetFunc(bget, addr);
 }
 
@@ -131,6 +309,14 @@ STATIC_INLINE uint32 EmMemGet8(emuptr addr)
 
 STATIC_INLINE void EmMemPut32(emuptr addr, uint32 l)
 {
+#if EMMEM_PAGE_TABLE
+	if (EmMemIsPlainSet (addr) && EmMemIsAligned32 (addr))
+	{
+		EmMemDoPut32 (EmMemPageAddress (addr), l);
+		return;
+	}
+#endif
+
     EmMemCallPutFunc(lput, addr, l);
 }
 
@@ -140,6 +326,14 @@ STATIC_INLINE void EmMemPut32(emuptr addr, uint32 l)
 
 STATIC_INLINE void EmMemPut16(emuptr addr, uint32 w)
 {
+#if EMMEM_PAGE_TABLE
+	if (EmMemIsPlainSet (addr) && EmMemIsAligned16 (addr))
+	{
+		EmMemDoPut16 (EmMemPageAddress (addr), (uint16) w);
+		return;
+	}
+#endif
+
     EmMemCallPutFunc(wput, addr, w);
 }
 
@@ -149,117 +343,113 @@ STATIC_INLINE void EmMemPut16(emuptr addr, uint32 w)
 
 STATIC_INLINE void EmMemPut8(emuptr addr, uint32 b)
 {
+#if EMMEM_PAGE_TABLE
+	if (EmMemIsPlainSet (addr))
+	{
+		EmMemDoPut8 (EmMemPageAddress (addr), (uint8) b);
+		return;
+	}
+#endif
+
     EmMemCallPutFunc(bput, addr, b);
 }
 
 // ---------------------------------------------------------------------------
-//		� EmMemGetRealAddress
+//		� EmMemCPUGet32
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE uint8* EmMemGetRealAddress(emuptr addr)
+STATIC_INLINE uint32 EmMemCPUGet32(emuptr addr)
 {
-    return EmMemGetBank(addr).xlateaddr(addr);
+	EmMemCountGet (addr);
+	return EmMemGet32 (addr);
 }
 
 // ---------------------------------------------------------------------------
-//		� EmMemCheckAddress
+//		� EmMemCPUGet16
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE int EmMemCheckAddress(emuptr addr, uint32 size)
+STATIC_INLINE uint32 EmMemCPUGet16(emuptr addr)
 {
-    return EmMemGetBank(addr).checkaddr(addr, size);
+	EmMemCountGet (addr);
+	return EmMemGet16 (addr);
 }
 
 // ---------------------------------------------------------------------------
-//		� EmMemAddOpcodeCycles
+//		� EmMemCPUGet8
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE void EmMemAddOpcodeCycles(emuptr addr)
+STATIC_INLINE uint32 EmMemCPUGet8(emuptr addr)
 {
-	EmAssert (EmMemGetBank(addr).EmMemAddOpcodeCycles);
-    EmMemGetBank(addr).EmMemAddOpcodeCycles();
+	EmMemCountGet (addr);
+	return EmMemGet8 (addr);
 }
 
 // ---------------------------------------------------------------------------
-//		� EmMemGetMetaAddress
+//		� EmMemCPUPut32
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE uint8* EmMemGetMetaAddress(emuptr addr)
+STATIC_INLINE void EmMemCPUPut32(emuptr addr, uint32 l)
 {
-	EmAssert(EmMemGetBank(addr).xlatemetaaddr);
-    return EmMemGetBank(addr).xlatemetaaddr(addr);
+	EmMemCountPut (addr);
+	EmMemPut32 (addr, l);
 }
 
 // ---------------------------------------------------------------------------
-//		� EmMemDoGet32
+//		� EmMemCPUPut16
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE uint32 EmMemDoGet32 (void* a)
+STATIC_INLINE void EmMemCPUPut16(emuptr addr, uint32 w)
 {
-#if WORDSWAP_MEMORY || !UNALIGNED_LONG_ACCESS
-	return	(((uint32) *(((uint16*) a) + 0)) << 16) |
-			(((uint32) *(((uint16*) a) + 1)));
-#else
-	return *(uint32*) a;
-#endif
+	EmMemCountPut (addr);
+	EmMemPut16 (addr, w);
 }
 
 // ---------------------------------------------------------------------------
-//		� EmMemDoGet16
+//		� EmMemCPUPut8
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE uint16 EmMemDoGet16 (void* a)
+STATIC_INLINE void EmMemCPUPut8(emuptr addr, uint32 b)
 {
-	return *(uint16*) a;
+	EmMemCountPut (addr);
+	EmMemPut8 (addr, b);
 }
 
 // ---------------------------------------------------------------------------
-//		� EmMemDoGet8
+//		� EmMemGetRealAddress
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE uint8 EmMemDoGet8 (void* a)
+STATIC_INLINE uint8* EmMemGetRealAddress(emuptr addr)
 {
-#if WORDSWAP_MEMORY
-	return *(uint8*) ((intptr_t) a ^ 1);
-#else
-	return *(uint8*) a;
-#endif
+    return EmMemGetBank(addr).xlateaddr(addr);
 }
 
 // ---------------------------------------------------------------------------
-//		� EmMemDoPut32
+//		� EmMemCheckAddress
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE void EmMemDoPut32 (void* a, uint32 v)
+STATIC_INLINE int EmMemCheckAddress(emuptr addr, uint32 size)
 {
-#if WORDSWAP_MEMORY || !UNALIGNED_LONG_ACCESS
-	*(((uint16*) a) + 0) = (uint16) (v >> 16);
-	*(((uint16*) a) + 1) = (uint16) (v);
-#else
-	*(uint32*) a = v;
-#endif
+    return EmMemGetBank(addr).checkaddr(addr, size);
 }
 
 // ---------------------------------------------------------------------------
-//		� EmMemDoPut16
+//		� EmMemAddOpcodeCycles
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE void EmMemDoPut16 (void* a, uint16 v)
+STATIC_INLINE void EmMemAddOpcodeCycles(emuptr addr)
 {
-	*(uint16*) a = v;
+	EmAssert (EmMemGetBank(addr).EmMemAddOpcodeCycles);
+    EmMemGetBank(addr).EmMemAddOpcodeCycles();
 }
 
 // ---------------------------------------------------------------------------
-//		� EmMemDoPut8
+//		� EmMemGetMetaAddress
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE void EmMemDoPut8 (void* a, uint8 v)
+STATIC_INLINE uint8* EmMemGetMetaAddress(emuptr addr)
 {
-#if WORDSWAP_MEMORY
-	*(uint8*) ((intptr_t) a ^ 1) = v;
-#else
-	*(uint8*) a = v;
-#endif
+	EmAssert(EmMemGetBank(addr).xlatemetaaddr);
+    return EmMemGetBank(addr).xlatemetaaddr(addr);
 }
 
 
@@ -370,7 +560,16 @@ class Memory
 
 		static void				InitializeBanks		(EmAddressBank& iBankInitializer,
 													 int32 iStartingBankIndex,
-													 int32 iNumberOfBanks);
+													 int32 iNumberOfBanks,
+													 int iRegion = kEmMemRegionOther);
+
+		static void				InitializePages		(int32 iStartingBankIndex,
+													 int32 iNumberOfBanks,
+													 uint8 iFlags);
+
+		static void				RestrictPages		(emuptr begin, emuptr end, uint8 flags);
+		static void				ResyncPages			(emuptr begin, emuptr end);
+		static void				UpdateAccessMasks	(void);
 
 		static void				ResetBankHandlers	(void);
 
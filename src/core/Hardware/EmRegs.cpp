@@ -153,7 +153,8 @@ void EmRegs::SetBankHandlers (EmAddressBank& bank)
 	uint32	range		= this->GetAddressRange ();
 	uint32	numBanks	= EmMemBankIndex (address + range - 1) - EmMemBankIndex (address) + 1;
 
-	Memory::InitializeBanks (bank, EmMemBankIndex (address), numBanks);
+	Memory::InitializeBanks (bank, EmMemBankIndex (address), numBanks,
+		kEmMemRegionRegs);
 
 	this->SetSubBankHandlers ();
 }
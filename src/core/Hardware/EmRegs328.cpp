@@ -16,6 +16,7 @@
 #include "EmRegs328Prv.h"
 
 #include "Byteswapping.h"		// Canonical
+#include "EmCPU68K.h"			// gCPU68K->SyncHardware, ScheduleEvent
 #include "EmHAL.h"				// EmHAL
 #include "EmMemory.h"			// gMemAccessFlags, EmMem_memcpy
 #include "EmPixMap.h"			// SetSize, SetRowBytes, etc.
@@ -612,10 +613,10 @@ void EmRegs328::SetSubBankHandlers (void)
 	INSTALL_HANDLER (StdRead,			intMaskLoWrite,			intMaskLo);
 	INSTALL_HANDLER (StdRead,			StdWrite,				intWakeupEnHi);
 	INSTALL_HANDLER (StdRead,			StdWrite,				intWakeupEnLo);
-	INSTALL_HANDLER (StdRead,			intStatusHiWrite,		intStatusHi);
-	INSTALL_HANDLER (StdRead,			NullWrite,				intStatusLo);
-	INSTALL_HANDLER (StdRead,			NullWrite,				intPendingHi);
-	INSTALL_HANDLER (StdRead,			NullWrite,				intPendingLo);
+	INSTALL_HANDLER (intStatusRead,		intStatusHiWrite,		intStatusHi);
+	INSTALL_HANDLER (intStatusRead,		NullWrite,				intStatusLo);
+	INSTALL_HANDLER (intStatusRead,		NullWrite,				intPendingHi);
+	INSTALL_HANDLER (intStatusRead,		NullWrite,				intPendingLo);
 
 	INSTALL_HANDLER (StdRead,			StdWrite,				portADir);
 	INSTALL_HANDLER (portXDataRead,		portXDataWrite,			portAData);
@@ -678,10 +679,10 @@ void EmRegs328::SetSubBankHandlers (void)
 	INSTALL_HANDLER (tmr1StatusRead,	tmr1StatusWrite,		tmr1Status);
 
 	INSTALL_HANDLER (StdRead,			tmr2ControlWrite,		tmr2Control);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr2Prescaler);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr2Compare);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr2Prescaler);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr2Compare);
 	INSTALL_HANDLER (StdRead,			StdWrite,				tmr2Capture);
-	INSTALL_HANDLER (StdRead,			NullWrite,				tmr2Counter);
+	INSTALL_HANDLER (tmrCounterRead,	NullWrite,				tmr2Counter);
 	INSTALL_HANDLER (tmr2StatusRead,	tmr2StatusWrite,		tmr2Status);
 
 	INSTALL_HANDLER (StdRead,			StdWrite,				wdControl);
@@ -762,13 +763,30 @@ uint32 EmRegs328::GetAddressRange (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		PrvCyclesUntilMatch  (328)
+// ---------------------------------------------------------------------------
+// Number of system clock cycles until a timer's counter next matches its
+// compare register.  Once the counter has reached the compare value, every
+// tick matches again (see Cycle), so the next match is one tick away.
+
+static int32 PrvCyclesUntilMatch (uint16 counter, uint16 compare, int period, int accum)
+{
+	int32	ticks = (counter >= compare) ? 1 : (int32) compare - (int32) counter;
+
+	return ticks * period - accum;
+}
+
+
 // ---------------------------------------------------------------------------
 //		� EmRegs328::Cycle
 // ---------------------------------------------------------------------------
 // Handles periodic events that need to occur when the processor cycles (like
-// updating timer registers).  This function is called in two places from
-// Emulator::Execute.  Interestingly, the loop runs 3% FASTER if this function
-// is in its own separate function instead of being inline.
+// updating timer registers).  This function is called from the CPU loop
+// whenever one of the events posted by ScheduleTimerEvents is due, and from
+// register handlers (via EmCPU68K::SyncHardware) that need the timers to be
+// current.  With accurate timers, "cycles" covers everything executed since
+// the last call; the legacy timers ask to be called after every instruction.
 
 void EmRegs328::Cycle (Bool sleeping, int cycles)
 {
@@ -776,12 +794,12 @@ void EmRegs328::Cycle (Bool sleeping, int cycles)
 
 	if (fAccurateTimers)
 	{
+		fTmr2CycleAccum += cycles;
+		int ticks = fTmr2CycleAccum >> fTmr2Shift;
+		fTmr2CycleAccum &= fTmr2ShiftMask;
+
 		if ((READ_REGISTER (tmr2Control) & hwr328TmrControlEnable) != 0)
 		{
-			fTmr2CycleAccum += cycles;
-			int ticks = fTmr2CycleAccum >> fTmr2Shift;
-			fTmr2CycleAccum &= fTmr2ShiftMask;
-
 			if (ticks > 0)
 			{
 				uint16 counter = READ_REGISTER (tmr2Counter) + ticks;
@@ -803,19 +821,25 @@ void EmRegs328::Cycle (Bool sleeping, int cycles)
 			}
 		}
 
-		int grTicks = cycles >> fTmr2Shift;
-		if ((fCycle += grTicks) > READ_REGISTER (tmr2Compare))
+		// Gremlins time cascade (driven by the timer clock).  When idle time
+		// is fast-forwarded, one call can span several compare periods.
+		if ((fCycle += ticks) > READ_REGISTER (tmr2Compare))
 		{
+			uint32 periods = fCycle / ((uint32) READ_REGISTER (tmr2Compare) + 1);
 			fCycle = 0;
-			if (++fTick >= 100) { fTick = 0;
-				if (++fSec >= 60) { fSec = 0;
-					if (++fMin >= 60) { fMin = 0;
-						if (++fHour >= 24) { fHour = 0; }
+			while (periods-- > 0)
+			{
+				if (++fTick >= 100) { fTick = 0;
+					if (++fSec >= 60) { fSec = 0;
+						if (++fMin >= 60) { fMin = 0;
+							if (++fHour >= 24) { fHour = 0; }
+						}
 					}
 				}
 			}
 		}
 
+		this->ScheduleTimerEvents ();
 		return;
 	}
 
@@ -855,6 +879,8 @@ void EmRegs328::Cycle (Bool sleeping, int cycles)
 	}
 
 	#undef increment
+
+	this->ScheduleTimerEvents ();
 }
 
 
@@ -1091,16 +1117,9 @@ void EmRegs328::GetLCDScanlines (EmScreenUpdateInfo& info)
 
 	// Determine first and last scanlines to fetch, and fetch them.
 
-	info.fFirstLine		= (info.fScreenLow - baseAddr) / rowBytes;
-	info.fLastLine		= (info.fScreenHigh - baseAddr - 1) / rowBytes + 1;
-
-	int32	firstLineOffset	= info.fFirstLine * rowBytes;
-	int32	lastLineOffset	= info.fLastLine * rowBytes;
+	info.SetDirtyLines (baseAddr, rowBytes, height);
 
-	EmMem_memcpy (
-		(void*) ((uint8*) info.fImage.GetBits () + firstLineOffset),
-		baseAddr + firstLineOffset,
-		lastLineOffset - firstLineOffset);
+	info.FetchDirtyLines (baseAddr, rowBytes);
 }
 
 
@@ -1481,12 +1500,43 @@ uint32 EmRegs328::portXDataRead (emuptr address, int)
 }
 
 
+// ---------------------------------------------------------------------------
+//		� EmRegs328::intStatusRead
+// ---------------------------------------------------------------------------
+// Bring the timers up to date so that a timer interrupt that would have
+// been posted by now shows up.
+
+uint32 EmRegs328::intStatusRead (emuptr address, int size)
+{
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
+	return EmRegs328::StdRead (address, size);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmRegs328::tmrCounterRead
+// ---------------------------------------------------------------------------
+
+uint32 EmRegs328::tmrCounterRead (emuptr address, int size)
+{
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
+	return EmRegs328::StdRead (address, size);
+}
+
+
 // ---------------------------------------------------------------------------
 //		� EmRegs328::tmr1StatusRead
 // ---------------------------------------------------------------------------
 
 uint32 EmRegs328::tmr1StatusRead (emuptr address, int size)
 {
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
 	uint16	tmr1Counter = READ_REGISTER (tmr1Counter) + 16;
 	uint16	tmr1Compare = READ_REGISTER (tmr1Compare);
 	uint16	tmr1Control = READ_REGISTER (tmr1Control);
@@ -1528,6 +1578,9 @@ uint32 EmRegs328::tmr1StatusRead (emuptr address, int size)
 
 uint32 EmRegs328::tmr2StatusRead (emuptr address, int size)
 {
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
 #if 0	// (Greg doesn't do this for Timer 2...I wonder why)
 
 	/*
@@ -1605,6 +1658,9 @@ uint32 EmRegs328::rtcHourMinSecRead (emuptr address, int size)
 
 	if (Hordes::IsOn ())
 	{
+		if (gCPU68K)
+			gCPU68K->SyncHardware ();
+
 		hour = fHour;
 		min = fMin;
 		sec = fSec;
@@ -1947,8 +2003,29 @@ static void PrvUpdateTimerShift (uint16 controlReg, int& shift, int& shiftMask)
 
 void EmRegs328::tmr2ControlWrite (emuptr address, int size, uint32 value)
 {
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
 	EmRegs328::StdWrite (address, size, value);
 	PrvUpdateTimerShift (READ_REGISTER (tmr2Control), fTmr2Shift, fTmr2ShiftMask);
+
+	this->ScheduleTimerEvents ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmRegs328::tmrRegisterWrite
+// ---------------------------------------------------------------------------
+// Writes to a timer's prescaler or compare register move its next event.
+
+void EmRegs328::tmrRegisterWrite (emuptr address, int size, uint32 value)
+{
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
+	EmRegs328::StdWrite (address, size, value);
+
+	this->ScheduleTimerEvents ();
 }
 
 
@@ -2874,3 +2951,35 @@ int32 EmRegs328::GetCyclesUntilNextInterrupt (void)
 
 	return cyclesRemaining;
 }
+
+
+// ---------------------------------------------------------------------------
+//		EmRegs328::ScheduleTimerEvents
+// ---------------------------------------------------------------------------
+// Tell the CPU when Cycle next needs to be called: when the system timer's
+// counter will next match its compare register.
+
+void EmRegs328::ScheduleTimerEvents (void)
+{
+	if (!gCPU68K)
+		return;
+
+	// The legacy timers count calls rather than cycles.
+
+	if (!fAccurateTimers)
+	{
+		gCPU68K->ScheduleEvent (kEventTimer2, 0);
+		return;
+	}
+
+	if ((READ_REGISTER (tmr2Control) & hwr328TmrControlEnable) != 0)
+	{
+		gCPU68K->ScheduleEvent (kEventTimer2,
+			PrvCyclesUntilMatch (READ_REGISTER (tmr2Counter), READ_REGISTER (tmr2Compare),
+				1 << fTmr2Shift, fTmr2CycleAccum));
+	}
+	else
+	{
+		gCPU68K->CancelEvent (kEventTimer2);
+	}
+}
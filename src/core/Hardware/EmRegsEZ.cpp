@@ -16,6 +16,7 @@
 #include "EmRegsEZPrv.h"
 
 #include "Byteswapping.h"		// Canonical
+#include "EmCPU68K.h"			// gCPU68K->SyncHardware, ScheduleEvent
 #include "EmHAL.h"				// EmHAL
 #include "EmMemory.h"			// gMemAccessFlags, EmMem_memcpy
 #include "EmPixMap.h"			// SetSize, SetRowBytes, etc.
@@ -504,10 +505,10 @@ void EmRegsEZ::SetSubBankHandlers (void)
 	INSTALL_HANDLER (StdRead,			StdWrite,				intControl);
 	INSTALL_HANDLER (StdRead,			intMaskHiWrite,			intMaskHi);
 	INSTALL_HANDLER (StdRead,			intMaskLoWrite,			intMaskLo);
-	INSTALL_HANDLER (StdRead,			intStatusHiWrite,		intStatusHi);
-	INSTALL_HANDLER (StdRead,			NullWrite,				intStatusLo);
-	INSTALL_HANDLER (StdRead,			NullWrite,				intPendingHi);
-	INSTALL_HANDLER (StdRead,			NullWrite,				intPendingLo);
+	INSTALL_HANDLER (intStatusRead,		intStatusHiWrite,		intStatusHi);
+	INSTALL_HANDLER (intStatusRead,		NullWrite,				intStatusLo);
+	INSTALL_HANDLER (intStatusRead,		NullWrite,				intPendingHi);
+	INSTALL_HANDLER (intStatusRead,		NullWrite,				intPendingLo);
 
 	INSTALL_HANDLER (StdRead,			StdWrite,				portADir);
 	INSTALL_HANDLER (portXDataRead,		portXDataWrite,			portAData);
@@ -554,10 +555,10 @@ void EmRegsEZ::SetSubBankHandlers (void)
 	INSTALL_HANDLER (StdRead,			NullWrite,				pwmCounter);
 
 	INSTALL_HANDLER (StdRead,			tmr1ControlWrite,		tmr1Control);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr1Prescaler);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr1Compare);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr1Prescaler);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr1Compare);
 	INSTALL_HANDLER (StdRead,			StdWrite,				tmr1Capture);
-	INSTALL_HANDLER (StdRead,			NullWrite,				tmr1Counter);
+	INSTALL_HANDLER (tmrCounterRead,	NullWrite,				tmr1Counter);
 	INSTALL_HANDLER (tmr1StatusRead,	tmr1StatusWrite,		tmr1Status);
 
 	INSTALL_HANDLER (StdRead,			StdWrite,				spiMasterData);
@@ -643,13 +644,30 @@ uint32 EmRegsEZ::GetAddressRange (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		PrvCyclesUntilMatch  (EZ)
+// ---------------------------------------------------------------------------
+// Number of system clock cycles until a timer's counter next matches its
+// compare register.  Once the counter has reached the compare value, every
+// tick matches again (see Cycle), so the next match is one tick away.
+
+static int32 PrvCyclesUntilMatch (uint16 counter, uint16 compare, int period, int accum)
+{
+	int32	ticks = (counter >= compare) ? 1 : (int32) compare - (int32) counter;
+
+	return ticks * period - accum;
+}
+
+
 // ---------------------------------------------------------------------------
 //		� EmRegsEZ::Cycle
 // ---------------------------------------------------------------------------
 // Handles periodic events that need to occur when the processor cycles (like
-// updating timer registers).  This function is called in two places from
-// Emulator::Execute.  Interestingly, the loop runs 3% FASTER if this function
-// is in its own separate function instead of being inline.
+// updating timer registers).  This function is called from the CPU loop
+// whenever one of the events posted by ScheduleTimerEvents is due, and from
+// register handlers (via EmCPU68K::SyncHardware) that need the timers to be
+// current.  With accurate timers, "cycles" covers everything executed since
+// the last call; the legacy timers ask to be called after every instruction.
 
 void EmRegsEZ::Cycle (Bool sleeping, int cycles)
 {
@@ -657,12 +675,12 @@ void EmRegsEZ::Cycle (Bool sleeping, int cycles)
 
 	if (fAccurateTimers)
 	{
+		fTmr1CycleAccum += cycles;
+		int ticks = fTmr1CycleAccum >> fTmr1Shift;
+		fTmr1CycleAccum &= fTmr1ShiftMask;
+
 		if ((READ_REGISTER (tmr1Control) & hwrEZ328TmrControlEnable) != 0)
 		{
-			fTmr1CycleAccum += cycles;
-			int ticks = fTmr1CycleAccum >> fTmr1Shift;
-			fTmr1CycleAccum &= fTmr1ShiftMask;
-
 			if (ticks > 0)
 			{
 				uint16 counter = READ_REGISTER (tmr1Counter) + ticks;
@@ -684,20 +702,25 @@ void EmRegsEZ::Cycle (Bool sleeping, int cycles)
 			}
 		}
 
-		// Gremlins time cascade — use prescaled ticks
-		int grTicks = cycles >> fTmr1Shift;
-		if ((fCycle += grTicks) > READ_REGISTER (tmr1Compare))
+		// Gremlins time cascade (driven by the timer clock).  When idle time
+		// is fast-forwarded, one call can span several compare periods.
+		if ((fCycle += ticks) > READ_REGISTER (tmr1Compare))
 		{
+			uint32 periods = fCycle / ((uint32) READ_REGISTER (tmr1Compare) + 1);
 			fCycle = 0;
-			if (++fTick >= 100) { fTick = 0;
-				if (++fSec >= 60) { fSec = 0;
-					if (++fMin >= 60) { fMin = 0;
-						if (++fHour >= 24) { fHour = 0; }
+			while (periods-- > 0)
+			{
+				if (++fTick >= 100) { fTick = 0;
+					if (++fSec >= 60) { fSec = 0;
+						if (++fMin >= 60) { fMin = 0;
+							if (++fHour >= 24) { fHour = 0; }
+						}
 					}
 				}
 			}
 		}
 
+		this->ScheduleTimerEvents ();
 		return;
 	}
 
@@ -737,6 +760,8 @@ void EmRegsEZ::Cycle (Bool sleeping, int cycles)
 	}
 
 	#undef increment
+
+	this->ScheduleTimerEvents ();
 }
 
 
@@ -980,8 +1005,7 @@ void EmRegsEZ::GetLCDScanlines (EmScreenUpdateInfo& info)
 
 	// Determine first and last scanlines to fetch, and fetch them.
 
-	info.fFirstLine		= (info.fScreenLow - baseAddr) / rowBytes;
-	info.fLastLine		= (info.fScreenHigh - baseAddr - 1) / rowBytes + 1;
+	info.SetDirtyLines (baseAddr, rowBytes, height);
 
 	emuptr firstLineAddr = baseAddr + (info.fFirstLine * rowBytes);
 	emuptr lastLineAddr  = baseAddr + (info.fLastLine  * rowBytes);
@@ -1414,12 +1438,43 @@ uint32 EmRegsEZ::portXDataRead (emuptr address, int)
 }
 
 
+// ---------------------------------------------------------------------------
+//		� EmRegsEZ::intStatusRead
+// ---------------------------------------------------------------------------
+// Bring the timers up to date so that a timer interrupt that would have
+// been posted by now shows up.
+
+uint32 EmRegsEZ::intStatusRead (emuptr address, int size)
+{
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
+	return EmRegsEZ::StdRead (address, size);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmRegsEZ::tmrCounterRead
+// ---------------------------------------------------------------------------
+
+uint32 EmRegsEZ::tmrCounterRead (emuptr address, int size)
+{
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
+	return EmRegsEZ::StdRead (address, size);
+}
+
+
 // ---------------------------------------------------------------------------
 //		� EmRegsEZ::tmr1StatusRead
 // ---------------------------------------------------------------------------
 
 uint32 EmRegsEZ::tmr1StatusRead (emuptr address, int size)
 {
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
 	uint16	tmr1Counter = READ_REGISTER (tmr1Counter) + 16;
 	uint16	tmr1Compare = READ_REGISTER (tmr1Compare);
 	uint16	tmr1Control = READ_REGISTER (tmr1Control);
@@ -1487,6 +1542,9 @@ uint32 EmRegsEZ::rtcHourMinSecRead (emuptr address, int size)
 
 	if (Hordes::IsOn ())
 	{
+		if (gCPU68K)
+			gCPU68K->SyncHardware ();
+
 		hour = fHour;
 		min = fMin;
 		sec = fSec;
@@ -1790,8 +1848,29 @@ static void PrvUpdateTimerShift (uint16 controlReg, int& shift, int& shiftMask)
 
 void EmRegsEZ::tmr1ControlWrite (emuptr address, int size, uint32 value)
 {
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
 	EmRegsEZ::StdWrite (address, size, value);
 	PrvUpdateTimerShift (READ_REGISTER (tmr1Control), fTmr1Shift, fTmr1ShiftMask);
+
+	this->ScheduleTimerEvents ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmRegsEZ::tmrRegisterWrite
+// ---------------------------------------------------------------------------
+// Writes to a timer's prescaler or compare register move its next event.
+
+void EmRegsEZ::tmrRegisterWrite (emuptr address, int size, uint32 value)
+{
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
+	EmRegsEZ::StdWrite (address, size, value);
+
+	this->ScheduleTimerEvents ();
 }
 
 
@@ -2784,3 +2863,35 @@ int32 EmRegsEZ::GetCyclesUntilNextInterrupt (void)
 
 	return cyclesRemaining;
 }
+
+
+// ---------------------------------------------------------------------------
+//		EmRegsEZ::ScheduleTimerEvents
+// ---------------------------------------------------------------------------
+// Tell the CPU when Cycle next needs to be called: when the system timer's
+// counter will next match its compare register.
+
+void EmRegsEZ::ScheduleTimerEvents (void)
+{
+	if (!gCPU68K)
+		return;
+
+	// The legacy timers count calls rather than cycles.
+
+	if (!fAccurateTimers)
+	{
+		gCPU68K->ScheduleEvent (kEventTimer1, 0);
+		return;
+	}
+
+	if ((READ_REGISTER (tmr1Control) & hwrEZ328TmrControlEnable) != 0)
+	{
+		gCPU68K->ScheduleEvent (kEventTimer1,
+			PrvCyclesUntilMatch (READ_REGISTER (tmr1Counter), READ_REGISTER (tmr1Compare),
+				1 << fTmr1Shift, fTmr1CycleAccum));
+	}
+	else
+	{
+		gCPU68K->CancelEvent (kEventTimer1);
+	}
+}
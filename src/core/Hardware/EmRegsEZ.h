@@ -81,6 +81,8 @@ class EmRegsEZ : public EmRegs, public EmHALHandler
 	protected:
 		uint32					pllFreqSelRead			(emuptr address, int size);
 		uint32					portXDataRead			(emuptr address, int size);
+		uint32					intStatusRead			(emuptr address, int size);
+		uint32					tmrCounterRead			(emuptr address, int size);
 		uint32					tmr1StatusRead			(emuptr address, int size);
 		uint32					uartRead				(emuptr address, int size);
 		uint32					rtcHourMinSecRead		(emuptr address, int size);
@@ -93,6 +95,7 @@ class EmRegsEZ : public EmRegs, public EmHALHandler
 		void					portXDataWrite			(emuptr address, int size, uint32 value);
 		void					portDIntReqEnWrite		(emuptr address, int size, uint32 value);
 		void					tmr1ControlWrite		(emuptr address, int size, uint32 value);
+		void					tmrRegisterWrite		(emuptr address, int size, uint32 value);
 		void					tmr1StatusWrite			(emuptr address, int size, uint32 value);
 		void					spiMasterControlWrite	(emuptr address, int size, uint32 value);
 		void					uartWrite				(emuptr address, int size, uint32 value);
@@ -112,6 +115,7 @@ class EmRegsEZ : public EmRegs, public EmHALHandler
 		void					UpdateInterrupts		(void);
 		void					UpdatePortDInterrupts	(void);
 		void					UpdateRTCInterrupts		(void);
+		void					ScheduleTimerEvents		(void);
 
 	protected:
 		Bool					IDDetectAsserted		(void);
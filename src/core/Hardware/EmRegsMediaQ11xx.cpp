@@ -1601,16 +1601,9 @@ void EmRegsMediaQ11xx::GetLCDScanlines (EmScreenUpdateInfo& info)
 
 		// Determine first and last scanlines to fetch, and fetch them.
 
-		info.fFirstLine		= (info.fScreenLow - baseAddr) / rowBytes;
-		info.fLastLine		= (info.fScreenHigh - baseAddr - 1) / rowBytes + 1;
+		info.SetDirtyLines (baseAddr, rowBytes, height);
 
-		int32	firstLineOffset	= info.fFirstLine * rowBytes;
-		int32	lastLineOffset	= info.fLastLine * rowBytes;
-
-		EmMem_memcpy (
-			(void*)(uintptr_t) ((uint8*)(uintptr_t) info.fImage.GetBits () + firstLineOffset),
-			baseAddr + firstLineOffset,
-			lastLineOffset - firstLineOffset);
+		info.FetchDirtyLines (baseAddr, rowBytes);
 	}
 	else
 	{
@@ -1621,8 +1614,7 @@ void EmRegsMediaQ11xx::GetLCDScanlines (EmScreenUpdateInfo& info)
 
 		// Determine first and last scanlines to fetch.
 
-		info.fFirstLine		= (info.fScreenLow - baseAddr) / rowBytes;
-		info.fLastLine		= (info.fScreenHigh - baseAddr - 1) / rowBytes + 1;
+		info.SetDirtyLines (baseAddr, rowBytes, height);
 
 		// Get location and rowBytes of source bytes.
 
@@ -337,16 +337,9 @@ void EmRegsSED1375::GetLCDScanlines (EmScreenUpdateInfo& info)
 
 	// Determine first and last scanlines to fetch, and fetch them.
 
-	info.fFirstLine		= (info.fScreenLow - baseAddr) / rowBytes;
-	info.fLastLine		= (info.fScreenHigh - baseAddr - 1) / rowBytes + 1;
+	info.SetDirtyLines (baseAddr, rowBytes, height);
 
-	int32	firstLineOffset	= info.fFirstLine * rowBytes;
-	int32	lastLineOffset	= info.fLastLine * rowBytes;
-
-	EmMem_memcpy (
-		(void*) ((uint8*) info.fImage.GetBits () + firstLineOffset),
-		baseAddr + firstLineOffset,
-		lastLineOffset - firstLineOffset);
+	info.FetchDirtyLines (baseAddr, rowBytes);
 }
 
 
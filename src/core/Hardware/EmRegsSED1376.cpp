@@ -527,16 +527,9 @@ void EmRegsSED1376VisorPrism::GetLCDScanlines (EmScreenUpdateInfo& info)
 
 		// Determine first and last scanlines to fetch, and fetch them.
 
-		info.fFirstLine		= (info.fScreenLow - baseAddr) / rowBytes;
-		info.fLastLine		= (info.fScreenHigh - baseAddr - 1) / rowBytes + 1;
+		info.SetDirtyLines (baseAddr, rowBytes, height);
 
-		int32	firstLineOffset	= info.fFirstLine * rowBytes;
-		int32	lastLineOffset	= info.fLastLine * rowBytes;
-
-		EmMem_memcpy (
-			(void*) ((uint8*) info.fImage.GetBits () + firstLineOffset),
-			baseAddr + firstLineOffset,
-			lastLineOffset - firstLineOffset);
+		info.FetchDirtyLines (baseAddr, rowBytes);
 	}
 	else
 	{
@@ -547,8 +540,7 @@ void EmRegsSED1376VisorPrism::GetLCDScanlines (EmScreenUpdateInfo& info)
 
 		// Determine first and last scanlines to fetch.
 
-		info.fFirstLine		= (info.fScreenLow - baseAddr) / rowBytes;
-		info.fLastLine		= (info.fScreenHigh - baseAddr - 1) / rowBytes + 1;
+		info.SetDirtyLines (baseAddr, rowBytes, height);
 
 		// Get location and rowBytes of source bytes.
 
@@ -767,16 +759,9 @@ void EmRegsSED1376PalmGeneric::GetLCDScanlines (EmScreenUpdateInfo& info)
 
 		// Determine first and last scanlines to fetch, and fetch them.
 
-		info.fFirstLine		= (info.fScreenLow - baseAddr) / rowBytes;
-		info.fLastLine		= (info.fScreenHigh - baseAddr - 1) / rowBytes + 1;
-
-		int32	firstLineOffset	= info.fFirstLine * rowBytes;
-		int32	lastLineOffset	= info.fLastLine * rowBytes;
+		info.SetDirtyLines (baseAddr, rowBytes, height);
 
-		EmMem_memcpy (
-			(void*) ((uint8*) info.fImage.GetBits () + firstLineOffset),
-			baseAddr + firstLineOffset,
-			lastLineOffset - firstLineOffset);
+		info.FetchDirtyLines (baseAddr, rowBytes);
 	}
 	else
 	{
@@ -787,8 +772,7 @@ void EmRegsSED1376PalmGeneric::GetLCDScanlines (EmScreenUpdateInfo& info)
 
 		// Determine first and last scanlines to fetch.
 
-		info.fFirstLine		= (info.fScreenLow - baseAddr) / rowBytes;
-		info.fLastLine		= (info.fScreenHigh - baseAddr - 1) / rowBytes + 1;
+		info.SetDirtyLines (baseAddr, rowBytes, height);
 
 		// Get location and rowBytes of source bytes.
 
@@ -16,6 +16,7 @@
 #include "EmRegsVZPrv.h"
 
 #include "Byteswapping.h"		// Canonical
+#include "EmCPU68K.h"			// gCPU68K->SyncHardware, ScheduleEvent
 #include "EmDevice.h"
 #include "EmHAL.h"				// EmHAL
 #include "EmMemory.h"			// gMemAccessFlags, EmMem_memcpy
@@ -611,10 +612,10 @@ void EmRegsVZ::SetSubBankHandlers (void)
 	INSTALL_HANDLER (StdRead,			StdWrite,				intControl);
 	INSTALL_HANDLER (StdRead,			intMaskHiWrite,			intMaskHi);
 	INSTALL_HANDLER (StdRead,			intMaskLoWrite,			intMaskLo);
-	INSTALL_HANDLER (StdRead,			intStatusHiWrite,		intStatusHi);
-	INSTALL_HANDLER (StdRead,			NullWrite,				intStatusLo);
-	INSTALL_HANDLER (StdRead,			NullWrite,				intPendingHi);
-	INSTALL_HANDLER (StdRead,			NullWrite,				intPendingLo);
+	INSTALL_HANDLER (intStatusRead,		intStatusHiWrite,		intStatusHi);
+	INSTALL_HANDLER (intStatusRead,		NullWrite,				intStatusLo);
+	INSTALL_HANDLER (intStatusRead,		NullWrite,				intPendingHi);
+	INSTALL_HANDLER (intStatusRead,		NullWrite,				intPendingLo);
 	INSTALL_HANDLER (StdRead,			StdWrite,				intLevelControl);
 
 	INSTALL_HANDLER (StdRead,			StdWrite,				portADir);
@@ -682,17 +683,17 @@ void EmRegsVZ::SetSubBankHandlers (void)
 	INSTALL_HANDLER (StdRead,			NullWrite,				pwm2Counter);
 
 	INSTALL_HANDLER (StdRead,			tmr1ControlWrite,		tmr1Control);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr1Prescaler);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr1Compare);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr1Prescaler);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr1Compare);
 	INSTALL_HANDLER (StdRead,			StdWrite,				tmr1Capture);
-	INSTALL_HANDLER (StdRead,			NullWrite,				tmr1Counter);
+	INSTALL_HANDLER (tmrCounterRead,	NullWrite,				tmr1Counter);
 	INSTALL_HANDLER (tmr1StatusRead,	tmr1StatusWrite,		tmr1Status);
 
 	INSTALL_HANDLER (StdRead,			tmr2ControlWrite,		tmr2Control);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr2Prescaler);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr2Compare);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr2Prescaler);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr2Compare);
 	INSTALL_HANDLER (StdRead,			StdWrite,				tmr2Capture);
-	INSTALL_HANDLER (StdRead,			NullWrite,				tmr2Counter);
+	INSTALL_HANDLER (tmrCounterRead,	NullWrite,				tmr2Counter);
 	INSTALL_HANDLER (tmr2StatusRead,	tmr2StatusWrite,		tmr2Status);
 
 	INSTALL_HANDLER (StdRead,			StdWrite,				spiRxD);
@@ -797,13 +798,41 @@ uint32 EmRegsVZ::GetAddressRange (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		PrvTmr2Period  (VZ)
+// ---------------------------------------------------------------------------
+// Number of system clock cycles per timer 2 tick.
+
+static inline int PrvTmr2Period (uint16 prescaler, int shift)
+{
+	return ((prescaler & 0xFF) + 1) << shift;
+}
+
+
+// ---------------------------------------------------------------------------
+//		PrvCyclesUntilMatch  (VZ)
+// ---------------------------------------------------------------------------
+// Number of system clock cycles until a timer's counter next matches its
+// compare register.  Once the counter has reached the compare value, every
+// tick matches again (see Cycle), so the next match is one tick away.
+
+static int32 PrvCyclesUntilMatch (uint16 counter, uint16 compare, int period, int accum)
+{
+	int32	ticks = (counter >= compare) ? 1 : (int32) compare - (int32) counter;
+
+	return ticks * period - accum;
+}
+
+
 // ---------------------------------------------------------------------------
 //		� EmRegsVZ::Cycle
 // ---------------------------------------------------------------------------
 // Handles periodic events that need to occur when the processor cycles (like
-// updating timer registers).  This function is called in two places from
-// Emulator::Execute.  Interestingly, the loop runs 3% FASTER if this function
-// is in its own separate function instead of being inline.
+// updating timer registers).  This function is called from the CPU loop
+// whenever one of the events posted by ScheduleTimerEvents is due, and from
+// register handlers (via EmCPU68K::SyncHardware) that need the timers to be
+// current.  With accurate timers, "cycles" covers everything executed since
+// the last call; the legacy timers ask to be called after every instruction.
 
 void EmRegsVZ::Cycle (Bool sleeping, int cycles)
 {
@@ -811,13 +840,13 @@ void EmRegsVZ::Cycle (Bool sleeping, int cycles)
 
 	if (fAccurateTimers)
 	{
+		fTmr1CycleAccum += cycles;
+		int ticks = fTmr1CycleAccum >> fTmr1Shift;
+		fTmr1CycleAccum &= fTmr1ShiftMask;
+
 		// --- Timer 1 ---
 		if ((READ_REGISTER (tmr1Control) & hwrVZ328TmrControlEnable) != 0)
 		{
-			fTmr1CycleAccum += cycles;
-			int ticks = fTmr1CycleAccum >> fTmr1Shift;
-			fTmr1CycleAccum &= fTmr1ShiftMask;
-
 			if (ticks > 0)
 			{
 				uint16 counter = READ_REGISTER (tmr1Counter) + ticks;
@@ -839,55 +868,58 @@ void EmRegsVZ::Cycle (Bool sleeping, int cycles)
 			}
 		}
 
-		// --- Timer 2 (with software prescaler) ---
+		// --- Timer 2 (prescaled) ---
+		// The prescaler divides the timer clock by (prescaler + 1).  The
+		// remainder is carried over, so the result doesn't depend on how
+		// the cycles are batched up.
 		if ((READ_REGISTER (tmr2Control) & hwrVZ328TmrControlEnable) != 0)
 		{
-			static int prescaleCounter;
+			int period = PrvTmr2Period (READ_REGISTER (tmr2Prescaler), fTmr1Shift);
 
-			if ((prescaleCounter -= cycles) <= 0)
-			{
-				prescaleCounter = READ_REGISTER (tmr2Prescaler) * 1024;
+			fTmr2CycleAccum += cycles;
+			int t2ticks = fTmr2CycleAccum / period;
+			fTmr2CycleAccum -= t2ticks * period;
 
-				fTmr2CycleAccum += cycles;
-				int t2ticks = fTmr2CycleAccum >> fTmr1Shift;
-				fTmr2CycleAccum &= fTmr1ShiftMask;
+			if (t2ticks > 0)
+			{
+				uint16 counter = READ_REGISTER (tmr2Counter) + t2ticks;
+				WRITE_REGISTER (tmr2Counter, counter);
 
-				if (t2ticks > 0)
+				if (counter >= READ_REGISTER (tmr2Compare))
 				{
-					uint16 counter = READ_REGISTER (tmr2Counter) + t2ticks;
-					WRITE_REGISTER (tmr2Counter, counter);
-
-					if (counter >= READ_REGISTER (tmr2Compare))
-					{
-						WRITE_REGISTER (tmr2Status, READ_REGISTER (tmr2Status) | hwrVZ328TmrStatusCompare);
+					WRITE_REGISTER (tmr2Status, READ_REGISTER (tmr2Status) | hwrVZ328TmrStatusCompare);
 
-						if ((READ_REGISTER (tmr2Control) & hwrVZ328TmrControlFreeRun) == 0)
-							WRITE_REGISTER (tmr2Counter, 0);
+					if ((READ_REGISTER (tmr2Control) & hwrVZ328TmrControlFreeRun) == 0)
+						WRITE_REGISTER (tmr2Counter, 0);
 
-						if ((READ_REGISTER (tmr2Control) & hwrVZ328TmrControlEnInterrupt) != 0)
-						{
-							WRITE_REGISTER (intPendingLo, READ_REGISTER (intPendingLo) | hwrVZ328IntLoTimer2);
-							EmRegsVZ::UpdateInterrupts ();
-						}
+					if ((READ_REGISTER (tmr2Control) & hwrVZ328TmrControlEnInterrupt) != 0)
+					{
+						WRITE_REGISTER (intPendingLo, READ_REGISTER (intPendingLo) | hwrVZ328IntLoTimer2);
+						EmRegsVZ::UpdateInterrupts ();
 					}
 				}
 			}
 		}
 
-		// Gremlins time cascade
-		int grTicks = cycles >> fTmr1Shift;
-		if ((fCycle += grTicks) > READ_REGISTER (tmr1Compare))
+		// Gremlins time cascade (driven by the timer 1 clock).  When idle time
+		// is fast-forwarded, one call can span several compare periods.
+		if ((fCycle += ticks) > READ_REGISTER (tmr1Compare))
 		{
+			uint32 periods = fCycle / ((uint32) READ_REGISTER (tmr1Compare) + 1);
 			fCycle = 0;
-			if (++fTick >= 100) { fTick = 0;
-				if (++fSec >= 60) { fSec = 0;
-					if (++fMin >= 60) { fMin = 0;
-						if (++fHour >= 24) { fHour = 0; }
+			while (periods-- > 0)
+			{
+				if (++fTick >= 100) { fTick = 0;
+					if (++fSec >= 60) { fSec = 0;
+						if (++fMin >= 60) { fMin = 0;
+							if (++fHour >= 24) { fHour = 0; }
+						}
 					}
 				}
 			}
 		}
 
+		this->ScheduleTimerEvents ();
 		return;
 	}
 
@@ -958,6 +990,8 @@ void EmRegsVZ::Cycle (Bool sleeping, int cycles)
 	}
 
 	#undef increment
+
+	this->ScheduleTimerEvents ();
 }
 
 
@@ -1269,16 +1303,9 @@ void EmRegsVZ::GetLCDScanlines (EmScreenUpdateInfo& info)
 
 	// Determine first and last scanlines to fetch, and fetch them.
 
-	info.fFirstLine		= (info.fScreenLow - baseAddr) / rowBytes;
-	info.fLastLine		= (info.fScreenHigh - baseAddr - 1) / rowBytes + 1;
+	info.SetDirtyLines (baseAddr, rowBytes, height);
 
-	int32	firstLineOffset	= info.fFirstLine * rowBytes;
-	int32	lastLineOffset	= info.fLastLine * rowBytes;
-
-	EmMem_memcpy (
-		(void*) ((uint8*) info.fImage.GetBits () + firstLineOffset),
-		baseAddr + firstLineOffset,
-		lastLineOffset - firstLineOffset);
+	info.FetchDirtyLines (baseAddr, rowBytes);
 }
 
 
@@ -1658,12 +1685,43 @@ uint32 EmRegsVZ::portXDataRead (emuptr address, int)
 }
 
 
+// ---------------------------------------------------------------------------
+//		� EmRegsVZ::intStatusRead
+// ---------------------------------------------------------------------------
+// Bring the timers up to date so that a timer interrupt that would have
+// been posted by now shows up.
+
+uint32 EmRegsVZ::intStatusRead (emuptr address, int size)
+{
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
+	return EmRegsVZ::StdRead (address, size);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmRegsVZ::tmrCounterRead
+// ---------------------------------------------------------------------------
+
+uint32 EmRegsVZ::tmrCounterRead (emuptr address, int size)
+{
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
+	return EmRegsVZ::StdRead (address, size);
+}
+
+
 // ---------------------------------------------------------------------------
 //		� EmRegsVZ::tmr1StatusRead
 // ---------------------------------------------------------------------------
 
 uint32 EmRegsVZ::tmr1StatusRead (emuptr address, int size)
 {
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
 	uint16	tmr1Counter = READ_REGISTER (tmr1Counter) + 16;
 	uint16	tmr1Compare = READ_REGISTER (tmr1Compare);
 	uint16	tmr1Control = READ_REGISTER (tmr1Control);
@@ -1705,6 +1763,9 @@ uint32 EmRegsVZ::tmr1StatusRead (emuptr address, int size)
 
 uint32 EmRegsVZ::tmr2StatusRead (emuptr address, int size)
 {
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
 	uint16	tmr2Counter = READ_REGISTER (tmr2Counter) + 16;
 	uint16	tmr2Compare = READ_REGISTER (tmr2Compare);
 	uint16	tmr2Control = READ_REGISTER (tmr2Control);
@@ -1792,6 +1853,9 @@ uint32 EmRegsVZ::rtcHourMinSecRead (emuptr address, int size)
 
 	if (Hordes::IsOn ())
 	{
+		if (gCPU68K)
+			gCPU68K->SyncHardware ();
+
 		hour = fHour;
 		min = fMin;
 		sec = fSec;
@@ -2172,8 +2236,13 @@ static void PrvUpdateTimerShift (uint16 controlReg, int& shift, int& shiftMask)
 
 void EmRegsVZ::tmr1ControlWrite (emuptr address, int size, uint32 value)
 {
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
 	EmRegsVZ::StdWrite (address, size, value);
 	PrvUpdateTimerShift (READ_REGISTER (tmr1Control), fTmr1Shift, fTmr1ShiftMask);
+
+	this->ScheduleTimerEvents ();
 }
 
 
@@ -2183,9 +2252,30 @@ void EmRegsVZ::tmr1ControlWrite (emuptr address, int size, uint32 value)
 
 void EmRegsVZ::tmr2ControlWrite (emuptr address, int size, uint32 value)
 {
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
+	EmRegsVZ::StdWrite (address, size, value);
+	// VZ Timer 2 is clocked from timer 1's clock source through its
+	// own prescaler (see Cycle).
+
+	this->ScheduleTimerEvents ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmRegsVZ::tmrRegisterWrite
+// ---------------------------------------------------------------------------
+// Writes to a timer's prescaler or compare register move its next event.
+
+void EmRegsVZ::tmrRegisterWrite (emuptr address, int size, uint32 value)
+{
+	if (gCPU68K)
+		gCPU68K->SyncHardware ();
+
 	EmRegsVZ::StdWrite (address, size, value);
-	// VZ Timer 2 uses its own software prescaler in Cycle(),
-	// but cache shift for consistency.
+
+	this->ScheduleTimerEvents ();
 }
 
 
@@ -3276,3 +3366,47 @@ int32 EmRegsVZ::GetCyclesUntilNextInterrupt (void)
 
 	return cyclesRemaining;
 }
+
+
+// ---------------------------------------------------------------------------
+//		EmRegsVZ::ScheduleTimerEvents
+// ---------------------------------------------------------------------------
+// Tell the CPU when Cycle next needs to be called: when either timer's
+// counter will next match its compare register.
+
+void EmRegsVZ::ScheduleTimerEvents (void)
+{
+	if (!gCPU68K)
+		return;
+
+	// The legacy timers count calls rather than cycles.
+
+	if (!fAccurateTimers)
+	{
+		gCPU68K->ScheduleEvent (kEventTimer1, 0);
+		gCPU68K->CancelEvent (kEventTimer2);
+		return;
+	}
+
+	if ((READ_REGISTER (tmr1Control) & hwrVZ328TmrControlEnable) != 0)
+	{
+		gCPU68K->ScheduleEvent (kEventTimer1,
+			PrvCyclesUntilMatch (READ_REGISTER (tmr1Counter), READ_REGISTER (tmr1Compare),
+				1 << fTmr1Shift, fTmr1CycleAccum));
+	}
+	else
+	{
+		gCPU68K->CancelEvent (kEventTimer1);
+	}
+
+	if ((READ_REGISTER (tmr2Control) & hwrVZ328TmrControlEnable) != 0)
+	{
+		gCPU68K->ScheduleEvent (kEventTimer2,
+			PrvCyclesUntilMatch (READ_REGISTER (tmr2Counter), READ_REGISTER (tmr2Compare),
+				PrvTmr2Period (READ_REGISTER (tmr2Prescaler), fTmr1Shift), fTmr2CycleAccum));
+	}
+	else
+	{
+		gCPU68K->CancelEvent (kEventTimer2);
+	}
+}
@@ -80,6 +80,8 @@ class EmRegsVZ : public EmRegs, public EmHALHandler
 	private:
 		uint32					pllFreqSelRead			(emuptr address, int size);
 		uint32					portXDataRead			(emuptr address, int size);
+		uint32					intStatusRead			(emuptr address, int size);
+		uint32					tmrCounterRead			(emuptr address, int size);
 		uint32					tmr1StatusRead			(emuptr address, int size);
 		uint32					tmr2StatusRead			(emuptr address, int size);
 		uint32					uart1Read				(emuptr address, int size);
@@ -98,6 +100,7 @@ class EmRegsVZ : public EmRegs, public EmHALHandler
 		void					tmr1StatusWrite			(emuptr address, int size, uint32 value);
 		void					tmr2ControlWrite		(emuptr address, int size, uint32 value);
 		void					tmr2StatusWrite			(emuptr address, int size, uint32 value);
+		void					tmrRegisterWrite		(emuptr address, int size, uint32 value);
 		void					spiCont1Write			(emuptr address, int size, uint32 value);
 		void					spiMasterControlWrite	(emuptr address, int size, uint32 value);
 		void					uart1Write				(emuptr address, int size, uint32 value);
@@ -118,6 +121,7 @@ class EmRegsVZ : public EmRegs, public EmHALHandler
 		void					UpdateInterrupts		(void);
 		void					UpdatePortDInterrupts	(void);
 		void					UpdateRTCInterrupts		(void);
+		void					ScheduleTimerEvents		(void);
 
 	protected:
 		void					UARTStateChanged		(Bool sendTxData, int uartNum);
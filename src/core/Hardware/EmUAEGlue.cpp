@@ -16,6 +16,7 @@
 
 #include "EmCPU68K.h"			// ProcessException, etc.
 #include "EmSession.h"			// gSession->Reset
+#include "Logging.h"				// LogAppendMsg
 #include "Platform.h"			// AllocateMemory
 #include "UAE.h"				// MakeSR, uae_s32, etc.
 
@@ -150,6 +151,147 @@ void MakeFromSR (void)
 }
 
 
+// Compute the condition codes for the operation recorded by the last
+// SET_LAZY_FLAGS.  The operands are shifted so that the operation's
+// sign bit is bit 31, letting all sizes share the 32-bit formulas.
+
+void m68k_flush_flags (void)
+{
+	static const int	kShift[] = { 24, 16, 0, 0 };
+
+	uint32	op		= regflags.op;
+	int		shift	= kShift[op & 3];
+	uint32	src		= regflags.src << shift;
+	uint32	dst		= regflags.dst << shift;
+	uint32	res		= regflags.res << shift;
+
+	regflags.op = LAZY_FLAGS_NONE;
+
+	regflags.z = res == 0;
+	regflags.n = res >> 31;
+
+	switch (op >> 2)
+	{
+		case LAZY_FLAGS_LOGICAL:
+			regflags.v = 0;
+			regflags.c = 0;
+			break;
+
+		case LAZY_FLAGS_ADD:
+			regflags.v = ((src ^ res) & (dst ^ res)) >> 31;
+			regflags.c = res < dst;
+			regflags.x = regflags.c;
+			break;
+
+		case LAZY_FLAGS_SUB:
+			regflags.v = ((src ^ dst) & (res ^ dst)) >> 31;
+			regflags.c = src > dst;
+			regflags.x = regflags.c;
+			break;
+
+		case LAZY_FLAGS_CMP:
+			regflags.v = ((src ^ dst) & (res ^ dst)) >> 31;
+			regflags.c = src > dst;
+			break;
+
+		default:
+			EmAssert (false);
+			break;
+	}
+
+#if LAZY_FLAGS_CHECK
+	if (regflags.c != regflags.check_c || regflags.z != regflags.check_z ||
+		regflags.n != regflags.check_n || regflags.v != regflags.check_v ||
+		regflags.x != regflags.check_x)
+	{
+		LogAppendMsg ("Lazy flags mismatch: op = 0x%02X, src = 0x%08X, dst = 0x%08X, res = 0x%08X, "
+			"lazy XNZVC = %d%d%d%d%d, eager XNZVC = %d%d%d%d%d",
+			op, regflags.src, regflags.dst, regflags.res,
+			regflags.x, regflags.n, regflags.z, regflags.v, regflags.c,
+			regflags.check_x, regflags.check_n, regflags.check_z,
+			regflags.check_v, regflags.check_c);
+		EmAssert (false);
+	}
+#endif
+}
+
+
+#if LAZY_FLAGS_CHECK
+
+// Compute the condition codes for the operation just recorded by
+// SET_LAZY_FLAGS the way the eager genflags_normal code in gencpu does,
+// so that m68k_flush_flags can check its result against them.
+
+void m68k_record_check_flags (void)
+{
+	uint32	op		= regflags.op;
+	int32	src, dst, res;
+
+	switch (op & 3)
+	{
+		case 0:
+			src = (int8) regflags.src;
+			dst = (int8) regflags.dst;
+			res = (int8) regflags.res;
+			break;
+
+		case 1:
+			src = (int16) regflags.src;
+			dst = (int16) regflags.dst;
+			res = (int16) regflags.res;
+			break;
+
+		default:
+			src = (int32) regflags.src;
+			dst = (int32) regflags.dst;
+			res = (int32) regflags.res;
+			break;
+	}
+
+	uint32	mask	= (op & 3) == 0 ? 0xFF : (op & 3) == 1 ? 0xFFFF : 0xFFFFFFFF;
+	uint32	usrc	= (uint32) src & mask;
+	uint32	udst	= (uint32) dst & mask;
+	int		flgs	= src < 0;
+	int		flgo	= dst < 0;
+	int		flgn	= res < 0;
+
+	regflags.check_z = res == 0;
+	regflags.check_n = flgn;
+	regflags.check_x = regflags.x;
+
+	switch (op >> 2)
+	{
+		case LAZY_FLAGS_LOGICAL:
+			regflags.check_v = 0;
+			regflags.check_c = 0;
+			break;
+
+		case LAZY_FLAGS_ADD:
+			regflags.check_v = (flgs ^ flgn) & (flgo ^ flgn);
+			regflags.check_c = (~udst & mask) < usrc;
+			regflags.check_x = regflags.check_c;
+			break;
+
+		case LAZY_FLAGS_SUB:
+			regflags.check_v = (flgs ^ flgo) & (flgn ^ flgo);
+			regflags.check_c = usrc > udst;
+			regflags.check_x = regflags.check_c;
+			break;
+
+		case LAZY_FLAGS_CMP:
+			regflags.check_v = (flgs != flgo) && (flgn != flgo);
+			regflags.check_c = usrc > udst;
+			break;
+
+		default:
+			EmAssert (false);
+			break;
+	}
+}
+
+#endif
+
+
 void* xmalloc (size_t size)
 {
 	return Platform::AllocateMemory (size);
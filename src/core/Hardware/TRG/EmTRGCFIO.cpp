@@ -35,6 +35,7 @@ using namespace std;
 // ---------------------------------------------------------------------------
 EmCFIO::EmCFIO (void)
 {
+	State.Writing = false;
 }
 
 // ---------------------------------------------------------------------------
@@ -49,6 +50,8 @@ EmCFIO::~EmCFIO (void)
 // ---------------------------------------------------------------------------
 void EmCFIO::Reset(void)
 {
+	FlushWrite();
+
 	State.NumSectorsRequested = 0;
 	State.NumSectorsCompleted = 0;
 	State.SectorIndex         = 0;
@@ -71,30 +74,30 @@ void EmCFIO::Initialize (EmDiskTypeID ID)
 // ---------------------------------------------------------------------------
 void EmCFIO::Dispose (void)
 {
+	FlushWrite();
     DiskIO.Dispose();
 }
 
 
 // ---------------------------------------------------------------------------
-//		� EmCFIO::ReadSector
+//		� EmCFIO::FlushWrite
+// Write the sectors a write command has collected so far.  Normally that's
+// all of them, once the last byte arrives; a transfer cut short by a new
+// command or a reset still keeps its complete sectors.
 // ---------------------------------------------------------------------------
-DiskIOStatus EmCFIO::ReadSector(void)
+DiskIOStatus EmCFIO::FlushWrite(void)
 {
-    if ((DiskIO.ReadSector(State.Lba, (char *)State.Sector.Bytes)) != 0)
-        return DIO_ERROR;
-
-    return DIO_SUCCESS;
-}
+	DiskIOStatus status = DIO_SUCCESS;
 
-// ---------------------------------------------------------------------------
-//		� EmCFIO::WriteSector
-// ---------------------------------------------------------------------------
-DiskIOStatus EmCFIO::WriteSector(void)
-{
-    if ((DiskIO.WriteSector(State.Lba, (char *)State.Sector.Bytes)) != 0)
-        return DIO_ERROR;
+	if (State.Writing && State.NumSectorsCompleted > 0)
+	{
+		if ((DiskIO.WriteSectors(State.Lba, State.NumSectorsCompleted,
+				&Data[0])) != 0)
+			status = DIO_ERROR;
+	}
+	State.Writing = false;
 
-    return DIO_SUCCESS;
+	return status;
 }
 
 // ---------------------------------------------------------------------------
@@ -108,15 +111,11 @@ void EmCFIO::ReadNextDataByte(uint8 * val)
 		*val = 0;
 	else
 	{
-		*val = State.Sector.Bytes[State.SectorIndex++];
+		*val = Data[State.NumSectorsCompleted * SECTOR_SIZE + State.SectorIndex++];
 		if (State.SectorIndex >= SECTOR_SIZE)
 		{
-			if (++State.NumSectorsCompleted < State.NumSectorsRequested)
-			{
-				State.Lba++;
-				State.SectorIndex = 0;
-				State.Status = ReadSector();
-			}
+			State.NumSectorsCompleted++;
+			State.SectorIndex = 0;
 		}
 	}
     if (State.Status != DIO_SUCCESS)
@@ -128,20 +127,14 @@ void EmCFIO::ReadNextDataByte(uint8 * val)
 // ---------------------------------------------------------------------------
 void EmCFIO::WriteNextDataByte(uint8 val)
 {
-	State.Status = DIO_SUCCESS;
 	if (State.NumSectorsCompleted < State.NumSectorsRequested)
 	{
-		State.Sector.Bytes[State.SectorIndex++] = val;
+		Data[State.NumSectorsCompleted * SECTOR_SIZE + State.SectorIndex++] = val;
 		if (State.SectorIndex >= SECTOR_SIZE)
 		{
-			if (WriteSector() == DIO_ERROR)
-				State.Status = DIO_ERROR;
-			else if (++State.NumSectorsCompleted < State.NumSectorsRequested)
-			{
-				State.Status = DIO_SUCCESS;
-				State.Lba++;
-				State.SectorIndex = 0;
-			}
+			State.SectorIndex = 0;
+			if (++State.NumSectorsCompleted == State.NumSectorsRequested)
+				State.Status = FlushWrite();
 		}
 	}
     if (State.Status != DIO_SUCCESS)
@@ -161,8 +154,11 @@ uint32 EmCFIO::GetSectorCount(void)
 // ---------------------------------------------------------------------------
 void EmCFIO::StartDriveID(void)
 {
+	FlushWrite();
+
 	CurrDisk.GetDriveID(DiskTypeID,
                             &State.Sector);
+	Data.assign(State.Sector.Bytes, State.Sector.Bytes + SECTOR_SIZE);
 	State.NumSectorsRequested = 1;
 	State.NumSectorsCompleted = 0;
 	State.SectorIndex    = 0;
@@ -175,12 +171,19 @@ void EmCFIO::StartDriveID(void)
 // ---------------------------------------------------------------------------
 void EmCFIO::StartRead(DiskIOParams * params)
 {
+	FlushWrite();
+
 	State.Lba = params->Lba;
 	State.NumSectorsRequested = params->SectorCnt;
 	State.NumSectorsCompleted = 0;
 	State.SectorIndex    = 0;
 	State.Error  = 0;
-	State.Status = ReadSector();
+	State.Status = DIO_SUCCESS;
+
+	Data.resize(State.NumSectorsRequested * SECTOR_SIZE);
+	if ((DiskIO.ReadSectors(State.Lba, State.NumSectorsRequested,
+			&Data[0])) != 0)
+		State.Status = DIO_ERROR;
 }
 
 // ---------------------------------------------------------------------------
@@ -188,12 +191,17 @@ void EmCFIO::StartRead(DiskIOParams * params)
 // ---------------------------------------------------------------------------
 void EmCFIO::StartWrite(DiskIOParams * params)
 {
+	FlushWrite();
+
 	State.Lba = params->Lba;
 	State.NumSectorsRequested = params->SectorCnt;
 	State.NumSectorsCompleted = 0;
 	State.SectorIndex    = 0;
+	State.Writing = true;
 	State.Status = DIO_SUCCESS;
 	State.Error  = 0;
+
+	Data.resize(State.NumSectorsRequested * SECTOR_SIZE);
 }
 
 // ---------------------------------------------------------------------------
@@ -17,6 +17,7 @@
 #include "EmTRGCFDefs.h"
 #include "EmTRGDiskType.h"
 #include "EmTRGDiskIO.h"
+#include "EmStructs.h"			// ByteList
 
 #include <stdio.h>				// FILE
 
@@ -50,6 +51,7 @@ typedef struct {
 	uint32			NumSectorsCompleted;
 	EmSector		Sector;
 	int             SectorIndex;
+	Bool            Writing;
 	DiskIOStatus	Status;
 	DiskIOError     Error;
 } DiskIOState; 
@@ -79,11 +81,14 @@ public:
 private:
 	EmDiskTypeID	DiskTypeID;
 	EmCurrDiskType	CurrDisk;
-	DiskIOStatus	WriteSector(void);
-	DiskIOStatus	ReadSector(void);
+	DiskIOStatus	FlushWrite(void);
 	void			CloseFile(void);
 	DiskIOState		State;
 
+	// All the sectors of the current transfer, so that each command
+	// reads or writes the disk image once.
+	ByteList		Data;
+
     EmTRGDiskIO     DiskIO;
 };
 
@@ -16,11 +16,25 @@
 
 /************************************************************************
  * This class handles the generic low level disk access.
+ *
+ * The disk image file is opened once, on the first sector access, and
+ * kept open until Dispose.  On Unix it's mapped into memory, so sector
+ * reads and writes are just copies to and from the mapping and the
+ * kernel's page cache acts as the sector cache.  Elsewhere, the image
+ * is read into memory and writes are passed through to the still-open
+ * file.  An image that can only be opened read-only is treated as a
+ * write-protected card: reads work, and writes fail.
  ************************************************************************/
 #include <stdio.h>
-
-#include "EmCommon.h"
-#include "EmTRGDiskIO.h"
+#include <string.h>				// memcmp, memcpy, memset
+
+#if PLATFORM_UNIX
+#include <errno.h>				// errno, ENOENT
+#include <fcntl.h>				// open
+#include <sys/mman.h>			// mmap, munmap
+#include <sys/stat.h>			// fstat
+#include <unistd.h>				// close, ftruncate
+#endif
 
 using namespace std;
 
@@ -33,11 +47,20 @@ using namespace std;
 EmTRGDiskIO::EmTRGDiskIO()
 {
     m_driveNo = UNKNOWN_DRIVE;
+    m_image = NULL;
+    m_numSectors = 0;
+    m_readOnly = false;
+#if PLATFORM_UNIX
+    m_fd = -1;
+#else
+    m_fp = NULL;
+#endif
 }
 
 
 EmTRGDiskIO::~EmTRGDiskIO()
 {
+    Close();
 }
 
 
@@ -59,118 +82,225 @@ char * EmTRGDiskIO::GetFilePath(int driveNo)
 #endif
 }
 
-int EmTRGDiskIO::Format(void)
+// Open the disk image and make its contents available through m_image.
+// A missing or short image is created and formatted.
+
+int EmTRGDiskIO::Open(void)
 {
-    EmSector *buffer;
-    uint32    num, lba;
-    FILE      *fp;
+    if (m_image != NULL)
+        return 0;
+
+    m_numSectors = m_currDisk.GetNumSectors(m_diskTypeID);
+
+    size_t size = (size_t) m_numSectors * SECTOR_SIZE;
 
-   	fp = fopen(GetFilePath(m_driveNo), "wb");
-    if (fp == NULL)
+    if (size == 0)
         return -1;
 
-    buffer = new EmSector;
-	num = m_currDisk.GetNumSectors(m_diskTypeID);
-	for (lba=0; lba<num; lba++)
-	{
-		m_currDisk.GetSector(m_diskTypeID, lba, buffer);		                   
+    m_readOnly = false;
 
-		// The most probable error condition is
-		// attempting to write to a full drive ... it could also
-		// be write-protected, or on a disconnected network drive.
-		if (fwrite(buffer, SECTOR_SIZE, 1, fp) == 0)
-        {
-            delete buffer;
-            fclose(fp);
-			return -1;
-        }
-	}
-    delete buffer;
+#if PLATFORM_UNIX
+    int  fd = open(GetFilePath(m_driveNo), O_RDWR);
 
-	return 0;
-}
+    if (fd < 0 && errno == ENOENT)
+        fd = open(GetFilePath(m_driveNo), O_RDWR | O_CREAT, 0666);
 
-int EmTRGDiskIO::Read(uint32 sectorNum, void *buffer)
-{
-    FILE *fp;
+    if (fd < 0)
+    {
+        fd = open(GetFilePath(m_driveNo), O_RDONLY);
+        m_readOnly = true;
+    }
 
-    if ((fp = fopen(GetFilePath(m_driveNo), "rb")) == NULL)
+    if (fd < 0)
         return -1;
 
-    if (fseek(fp, sectorNum * SECTOR_SIZE, SEEK_SET) == -1)
+    struct stat st;
+    Bool        needsFormat = false;
+
+    if (fstat(fd, &st) != 0)
     {
-        fclose(fp);
+        close(fd);
         return -1;
     }
 
-    if (fread(buffer, SECTOR_SIZE, 1, fp) != 1)
+    if ((size_t) st.st_size < size)
+    {
+        // Extending the file leaves a sparse hole that reads as zeros;
+        // Format only fills in the sectors that aren't empty.
+        if (m_readOnly || ftruncate(fd, size) != 0)
+        {
+            close(fd);
+            return -1;
+        }
+
+        needsFormat = true;
+    }
+
+    int   prot = m_readOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+    void *image = mmap(NULL, size, prot, MAP_SHARED, fd, 0);
+    if (image == MAP_FAILED)
     {
-        fclose(fp);
+        close(fd);
         return -1;
     }
-    fclose(fp);
 
-    return 0;
-}
+    m_fd = fd;
+    m_image = (uint8 *) image;
 
-int EmTRGDiskIO::Write(uint32 sectorNum, void *buffer)
-{
-    FILE *fp;
+    if (needsFormat)
+        Format();
+#else
+    Bool needsFormat = false;
 
-    if ((fp = fopen(GetFilePath(m_driveNo), "r+b")) == NULL)
-        return -1;
+    m_fp = fopen(GetFilePath(m_driveNo), "r+b");
+    if (m_fp == NULL)
+        m_fp = fopen(GetFilePath(m_driveNo), "w+b");
 
-    if (fseek(fp, sectorNum * SECTOR_SIZE, SEEK_SET) == -1)
+    if (m_fp == NULL)
     {
-        fclose(fp);
+        m_fp = fopen(GetFilePath(m_driveNo), "rb");
+        m_readOnly = true;
+    }
+
+    if (m_fp == NULL)
         return -1;
+
+    m_image = new uint8[size];
+
+    if (fread(m_image, SECTOR_SIZE, m_numSectors, m_fp) != m_numSectors)
+    {
+        memset(m_image, 0, size);
+        needsFormat = true;
     }
 
-    if (fwrite(buffer, SECTOR_SIZE, 1, fp) != 1)
+    if (needsFormat && m_readOnly)
     {
-        fclose(fp);
+        Close();
         return -1;
     }
-    fclose(fp);
+
+    if (needsFormat)
+    {
+        Format();
+
+		// The most probable error condition is
+		// attempting to write to a full drive ... it could also
+		// be write-protected, or on a disconnected network drive.
+        if (fseek(m_fp, 0, SEEK_SET) != 0 ||
+            fwrite(m_image, SECTOR_SIZE, m_numSectors, m_fp) != m_numSectors)
+        {
+            Close();
+            return -1;
+        }
+        fflush(m_fp);
+    }
+#endif
 
     return 0;
 }
 
+void EmTRGDiskIO::Close(void)
+{
+#if PLATFORM_UNIX
+    if (m_image != NULL)
+        munmap(m_image, (size_t) m_numSectors * SECTOR_SIZE);
+
+    if (m_fd >= 0)
+        close(m_fd);
+
+    m_fd = -1;
+#else
+    delete [] m_image;
+
+    if (m_fp != NULL)
+        fclose(m_fp);
+
+    m_fp = NULL;
+#endif
+
+    m_image = NULL;
+}
+
+// Fill the image with the disk type's initial contents.  Sectors that
+// already hold the right data aren't touched, which keeps the zero
+// sectors of a freshly created image sparse.
+
+void EmTRGDiskIO::Format(void)
+{
+    EmSector *buffer;
+    uint32    lba;
+
+    buffer = new EmSector;
+	for (lba=0; lba<m_numSectors; lba++)
+	{
+		m_currDisk.GetSector(m_diskTypeID, lba, buffer);		                   
+
+        uint8 *sector = m_image + lba * SECTOR_SIZE;
+        if (memcmp(sector, buffer, SECTOR_SIZE) != 0)
+            memcpy(sector, buffer, SECTOR_SIZE);
+	}
+    delete buffer;
+}
+
 
 void EmTRGDiskIO::Initialize(EmDiskTypeID DiskTypeID, int driveNo)
 {
+    // Release any image opened for the previous disk type or drive;
+    // the new one is opened on first access.
+    Close();
+
     m_diskTypeID = DiskTypeID;
     m_driveNo = driveNo;
 }
 
 void EmTRGDiskIO::Dispose(void)
 {
+    Close();
 }
 
 int EmTRGDiskIO::ReadSector(uint32 sectorNum, void *buffer)
 {
-    int retval;
+    return ReadSectors(sectorNum, 1, buffer);
+}
 
-    if ((retval = Read(sectorNum, buffer)) != 0)
-    {
-        Format();
-        retval = Read(sectorNum, buffer);
-    }
 
-    return retval;
+
+int EmTRGDiskIO::WriteSector(uint32 sectorNum, void *buffer)
+{
+    return WriteSectors(sectorNum, 1, buffer);
 }
 
+int EmTRGDiskIO::ReadSectors(uint32 sectorNum, uint32 count, void *buffer)
+{
+    if (Open() != 0)
+        return -1;
 
+    if (sectorNum >= m_numSectors || count > m_numSectors - sectorNum)
+        return -1;
 
-int EmTRGDiskIO::WriteSector(uint32 sectorNum, void *buffer)
+    memcpy(buffer, m_image + sectorNum * SECTOR_SIZE, count * SECTOR_SIZE);
+
+    return 0;
+}
+
+int EmTRGDiskIO::WriteSectors(uint32 sectorNum, uint32 count, void *buffer)
 {
-    int retval;
+    if (Open() != 0)
+        return -1;
 
-    if ((retval = Write(sectorNum, buffer)) != 0)
-    {
-        Format();
-        retval = Write(sectorNum, buffer);
-    }
+    if (m_readOnly)
+        return -1;
+
+    if (sectorNum >= m_numSectors || count > m_numSectors - sectorNum)
+        return -1;
+
+    memcpy(m_image + sectorNum * SECTOR_SIZE, buffer, count * SECTOR_SIZE);
+
+#if !PLATFORM_UNIX
+    if (fseek(m_fp, sectorNum * SECTOR_SIZE, SEEK_SET) != 0 ||
+        fwrite(buffer, SECTOR_SIZE, count, m_fp) != count)
+        return -1;
+#endif
 
-    return retval;
+    return 0;
 }
@@ -20,6 +20,8 @@
 #include "EmTRGCFDefs.h"
 #include "EmTRGDiskType.h"
 
+#include <stdio.h>				// FILE
+
 #define UNKNOWN_DRIVE 0
 #define CF_DRIVE  1
 #define SD_DRIVE  2
@@ -33,11 +35,21 @@ private:
     EmDiskTypeID    m_diskTypeID;
 	EmCurrDiskType	m_currDisk;
 
-    int     Format(void);
-    char   *GetFilePath(int driveNo);
+	// The disk image stays open (and on Unix, mapped) from the first
+	// access until Dispose.
+	uint8          *m_image;
+	uint32			m_numSectors;
+	Bool			m_readOnly;
+#if PLATFORM_UNIX
+	int				m_fd;
+#else
+	FILE           *m_fp;
+#endif
 
-    int     Read(uint32 sectorNum, void *buffer);
-    int     Write(uint32 sectorNum, void *buffer);
+    int     Open(void);
+    void    Close(void);
+    void    Format(void);
+    char   *GetFilePath(int driveNo);
 
 public:
     EmTRGDiskIO(void);
@@ -48,6 +60,9 @@ public:
 
     int  ReadSector(uint32 sectorNum, void *buffer);
     int  WriteSector(uint32 sectorNum, void *buffer);
+
+    int  ReadSectors(uint32 sectorNum, uint32 count, void *buffer);
+    int  WriteSectors(uint32 sectorNum, uint32 count, void *buffer);
 };
 
 #endif	/* EmTRGDiskIO_h */
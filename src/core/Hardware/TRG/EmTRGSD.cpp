@@ -26,13 +26,13 @@ using namespace std;
 #define   SD_CMD1_GO_OPERATIONAL       1
 #define   SD_CMD9_SEND_CSD             9
 #define   SD_CMD10_SEND_CID           10
-#define   SD_CMD12_STOP_TRANS         12 // not supported
+#define   SD_CMD12_STOP_TRANS         12
 #define   SD_CMD13_SEND_STATUS        13
 #define   SD_CMD16_SET_BLOCKLEN       16 // not supported
 #define   SD_CMD17_READ_SECTOR        17
-#define   SD_CMD18_READ_MULTI         18 // not supported
+#define   SD_CMD18_READ_MULTI         18
 #define   SD_CMD24_WRITE_SECTOR       24
-#define   SD_CMD25_WRITE_MULTI        25 // not supported
+#define   SD_CMD25_WRITE_MULTI        25
 #define   SD_CMD27_PROGRAM_CSD        27 // not supported
 #define   SD_CMD28_SET_WRITE_PROT     28 // not supported
 #define   SD_CMD29_CLR_WRITE_PROT     29 // not supported
@@ -55,9 +55,17 @@ using namespace std;
 #define   SD_R1_ILLEGAL_CMD      0x04
 
 #define   SD_STATUS_OK           0x00
+#define   SD_STATUS_ERROR        0x04
 #define   SD_DATA_START          0xFE
+#define   SD_DATA_START_MULTI    0xFC
+#define   SD_DATA_STOP_MULTI     0xFD
+#define   SD_DATA_ERROR_TOKEN    0x01
 
 #define   SD_DATA_OK        0xE5
+#define   SD_DATA_WRITE_ERROR 0xED
+
+// sectors moved per disk image access in a multi-block transfer
+#define   SD_RUN_SECTORS    32
 
 // ---------------------------------------------------------------------------
 //		� EmTRGSD::EmTRGSD
@@ -66,6 +74,10 @@ EmTRGSD::EmTRGSD()
 {
     cmdIndex = 0;
     sdBusState = sdBusGetCmdState;
+    sectorCount = 0;
+    multiRead = false;
+    multiWrite = false;
+    writeStatus = SD_STATUS_OK;
 }
 
 
@@ -83,6 +95,10 @@ EmTRGSD::~EmTRGSD()
 void EmTRGSD::Initialize(void)
 {
     DiskIO.Initialize(EM_DISK_GENERIC_8MB, SD_DRIVE);
+    sectorCount = m_currDisk.GetNumSectors(EM_DISK_GENERIC_8MB);
+    multiRead = false;
+    multiWrite = false;
+    writeStatus = SD_STATUS_OK;
 }
 
 // ---------------------------------------------------------------------------
@@ -90,10 +106,76 @@ void EmTRGSD::Initialize(void)
 // ---------------------------------------------------------------------------
 void EmTRGSD::Dispose(void)
 {
+    if (multiWrite)
+        FlushWriteRun();
+    multiWrite = false;
+
     DiskIO.Dispose();
 }
 
 
+// ---------------------------------------------------------------------------
+//		� EmTRGSD::NextReadBlock
+// put the next sector of a CMD18 transfer in dataBuffer, reading another
+// run of sectors from the image when the last one has been sent
+// ---------------------------------------------------------------------------
+void EmTRGSD::NextReadBlock(void)
+{
+    dataIndex = 0;
+
+    if (runIndex >= runCount)
+    {
+        runStart = sectorNum;
+        runCount = 0;
+        runIndex = 0;
+        if (sectorNum < sectorCount)
+            runCount = min((uint32) SD_RUN_SECTORS, sectorCount - sectorNum);
+
+        runBuffer.resize(runCount * SECTOR_SIZE);
+        if ((runCount == 0) ||
+            (DiskIO.ReadSectors(runStart, runCount, &runBuffer[0]) != 0))
+        {
+            // end the transfer with an error token
+            runCount = 0;
+            multiRead = false;
+            dataBuffer[0] = SD_DATA_ERROR_TOKEN;
+            dataSize = 1;
+            return;
+        }
+    }
+
+    dataBuffer[0] = SD_DATA_START;
+    memcpy(&dataBuffer[1], &runBuffer[runIndex * SECTOR_SIZE], SECTOR_SIZE);
+    dataBuffer[SECTOR_SIZE+1] = 0x00; // 16 bit crc (unused)
+    dataBuffer[SECTOR_SIZE+2] = 0x00;
+    dataSize = SECTOR_SIZE+3;
+
+    runIndex++;
+    sectorNum++;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� EmTRGSD::FlushWriteRun
+// write the sectors a CMD25 transfer has collected so far
+// ---------------------------------------------------------------------------
+Bool EmTRGSD::FlushWriteRun(void)
+{
+    Bool ok = true;
+
+    if ((runIndex > 0) &&
+        (DiskIO.WriteSectors(runStart, runIndex, &runBuffer[0]) != 0))
+    {
+        writeStatus = SD_STATUS_ERROR;
+        ok = false;
+    }
+
+    runStart += runIndex;
+    runIndex = 0;
+    return ok;
+}
+
+
 // ---------------------------------------------------------------------------
 //		� EmTRGSD::CompleteCommand
 // complete command processing now that we have the data for it too
@@ -109,11 +191,33 @@ void EmTRGSD::CompleteCommand(void)
     switch (cmdBuffer[0] & 0x3f)
     {
         case SD_CMD24_WRITE_SECTOR :
-            DiskIO.WriteSector(sectorNum, &dataBuffer[1]);
-
             // send data OK response
             responseBuffer[0] = SD_DATA_OK;
+            if (DiskIO.WriteSector(sectorNum, &dataBuffer[1]) != 0)
+                responseBuffer[0] = SD_DATA_WRITE_ERROR;
+            responseSize = 1;
+            break;
+
+        case SD_CMD25_WRITE_MULTI :
+            // wait for the next block, or the stop token
+            sdBusNextState = sdBusGetDataState;
+            responseBuffer[0] = SD_DATA_OK;
             responseSize = 1;
+
+            if (sectorNum >= sectorCount)
+            {
+                responseBuffer[0] = SD_DATA_WRITE_ERROR;
+                break;
+            }
+
+            memcpy(&runBuffer[runIndex * SECTOR_SIZE], &dataBuffer[1], SECTOR_SIZE);
+            runIndex++;
+            sectorNum++;
+            if ((runIndex == SD_RUN_SECTORS) || (sectorNum == sectorCount))
+            {
+                if (!FlushWriteRun())
+                    responseBuffer[0] = SD_DATA_WRITE_ERROR;
+            }
             break;
 
         default :
@@ -137,6 +241,7 @@ void EmTRGSD::ProcessCommand(void)
     responseIndex = 0;
     dataIndex = 0;
     dataSize = 0;
+    multiRead = false;
 
     switch (cmdBuffer[0] & 0x3f)
     {
@@ -174,10 +279,17 @@ void EmTRGSD::ProcessCommand(void)
             dataSize = SD_CID_SIZE+3;
             break;
 
+        case SD_CMD12_STOP_TRANS :
+            // the CMD18 transfer already ended when this command started
+            responseBuffer[0] = SD_R1_OP_STATE;
+            responseSize = 1;
+            break;
+
         case SD_CMD13_SEND_STATUS :
             responseBuffer[0] = SD_R1_OP_STATE;
-            responseBuffer[1] = SD_STATUS_OK;
+            responseBuffer[1] = writeStatus;
             responseSize = 2;
+            writeStatus = SD_STATUS_OK;
             break;
 
         case SD_CMD17_READ_SECTOR :
@@ -189,12 +301,33 @@ void EmTRGSD::ProcessCommand(void)
             sectorNum = ((cmdBuffer[1] << 24) | (cmdBuffer[2] << 16) | (cmdBuffer[3] << 8) | cmdBuffer[4]);
             // SD sector number is really a byte address...
             sectorNum /= SECTOR_SIZE; 
-            DiskIO.ReadSector(sectorNum, &dataBuffer[1]);
+            if (DiskIO.ReadSector(sectorNum, &dataBuffer[1]) != 0)
+            {
+                dataBuffer[0] = SD_DATA_ERROR_TOKEN;
+                dataSize = 1;
+                break;
+            }
             dataBuffer[SECTOR_SIZE+1] = 0x00; // 16 bit crc (unused)
             dataBuffer[SECTOR_SIZE+2] = 0x00; 
             dataSize = SECTOR_SIZE+3;
             break;
 
+        case SD_CMD18_READ_MULTI :
+            responseBuffer[0] = SD_R1_OP_STATE;
+            responseSize = 1;
+
+            sdBusNextState = sdBusSendDataState;
+            sectorNum = ((cmdBuffer[1] << 24) | (cmdBuffer[2] << 16) | (cmdBuffer[3] << 8) | cmdBuffer[4]);
+            // SD sector number is really a byte address...
+            sectorNum /= SECTOR_SIZE;
+
+            // blocks follow one another until CMD12
+            multiRead = true;
+            runCount = 0;
+            runIndex = 0;
+            NextReadBlock();
+            break;
+
         case SD_CMD24_WRITE_SECTOR :
             responseBuffer[0] = SD_R1_OP_STATE;
             responseSize = 1;
@@ -206,6 +339,23 @@ void EmTRGSD::ProcessCommand(void)
             dataSize = SECTOR_SIZE+3;
             break;
 
+        case SD_CMD25_WRITE_MULTI :
+            responseBuffer[0] = SD_R1_OP_STATE;
+            responseSize = 1;
+            sectorNum = ((cmdBuffer[1] << 24) | (cmdBuffer[2] << 16) | (cmdBuffer[3] << 8) | cmdBuffer[4]);
+            // SD sector number is really a byte address...
+            sectorNum /= SECTOR_SIZE;
+
+            // blocks are collected in runBuffer until the stop token
+            multiWrite = true;
+            runStart = sectorNum;
+            runIndex = 0;
+            runBuffer.resize(SD_RUN_SECTORS * SECTOR_SIZE);
+
+            sdBusNextState = sdBusGetDataState;
+            dataSize = SECTOR_SIZE+3;
+            break;
+
         default:  // unimplemented
             responseBuffer[0] = SD_R1_ILLEGAL_CMD;
             responseSize = 1;
@@ -243,8 +393,15 @@ void EmTRGSD::ExchangeBits(uint16 txData, uint16 *rxData, uint16 bits)
                     break;
 
                 case sdBusGetDataState :
+                    if (multiWrite && (dataIndex == 0) && (txData == SD_DATA_STOP_MULTI))
+                    {
+                        FlushWriteRun();
+                        multiWrite = false;
+                        sdBusState = sdBusGetCmdState;
+                    }
                     // all data blocks start with SD_DATA_START
-                    if ((dataIndex != 0) || (txData == SD_DATA_START))
+                    else if ((dataIndex != 0) || (txData == SD_DATA_START) ||
+                        (multiWrite && (txData == SD_DATA_START_MULTI)))
                     {
                         dataBuffer[dataIndex++] = txData;
                         if (dataIndex == dataSize)
@@ -257,9 +414,24 @@ void EmTRGSD::ExchangeBits(uint16 txData, uint16 *rxData, uint16 bits)
                     break;
                 
                 case sdBusSendDataState :
+                    // CMD12 ends a CMD18 transfer
+                    if (multiRead && (txData == (0x40 | SD_CMD12_STOP_TRANS)))
+                    {
+                        multiRead = false;
+                        cmdBuffer[0] = txData;
+                        cmdIndex = 1;
+                        sdBusState = sdBusGetCmdState;
+                        *rxData = 0xffff;
+                        break;
+                    }
                     *rxData = dataBuffer[dataIndex++];
                     if (dataIndex == dataSize)
-                        sdBusState = sdBusGetCmdState;
+                    {
+                        if (multiRead)
+                            NextReadBlock();
+                        else
+                            sdBusState = sdBusGetCmdState;
+                    }
                     break;
 
                 default :
@@ -290,6 +462,15 @@ void EmTRGSD::ExchangeBits(uint16 txData, uint16 *rxData, uint16 bits)
                     break;
 
                 case sdBusGetDataState :
+                    if (multiWrite && (dataIndex == 0) &&
+                        (((txData & 0xff00) >> 8) == SD_DATA_STOP_MULTI))
+                    {
+                        FlushWriteRun();
+                        multiWrite = false;
+                        sdBusState = sdBusGetCmdState;
+                        *rxData = 0xffff;
+                        break;
+                    }
                     dataBuffer[dataIndex++] = (txData & 0xff00) >> 8;
                     dataBuffer[dataIndex++] = (txData & 0x00ff);
                     if (dataIndex >= dataSize)
@@ -297,16 +478,33 @@ void EmTRGSD::ExchangeBits(uint16 txData, uint16 *rxData, uint16 bits)
                         // finish processing command waiting for this data...
                         CompleteCommand();
 
-                        sdBusState = sdBusGetCmdState;
+                        sdBusState = multiWrite ? sdBusGetDataState : sdBusGetCmdState;
                     }
                     *rxData = 0xffff;
                     break;
 
                 case sdBusSendDataState :
+                    // CMD12 ends a CMD18 transfer
+                    if (multiRead &&
+                        (((txData & 0xff00) >> 8) == (0x40 | SD_CMD12_STOP_TRANS)))
+                    {
+                        multiRead = false;
+                        cmdBuffer[0] = (txData & 0xff00) >> 8;
+                        cmdBuffer[1] = (txData & 0x00ff);
+                        cmdIndex = 2;
+                        sdBusState = sdBusGetCmdState;
+                        *rxData = 0xffff;
+                        break;
+                    }
                     *rxData = dataBuffer[dataIndex++] << 8;
                     *rxData |= dataBuffer[dataIndex++];
                     if (dataIndex >= dataSize)
-                        sdBusState = sdBusGetCmdState;
+                    {
+                        if (multiRead)
+                            NextReadBlock();
+                        else
+                            sdBusState = sdBusGetCmdState;
+                    }
                     break;
 
                 default :
@@ -14,6 +14,7 @@
 #define _EmTRGSD_h_
 
 #include "EmTRGDiskIO.h"
+#include "EmStructs.h"			// ByteList
 
 /************************************************************************
  * This class handles the SPI SD controller interface used in the 
@@ -42,14 +43,27 @@ class EmTRGSD
         int            dataIndex;
         int            dataSize;
         uint32         sectorNum;
+        uint32         sectorCount;
         sdBusStateType sdBusState;
         sdBusStateType sdBusNextState; // next state after sending response
 
         EmTRGDiskIO    DiskIO;
     	EmCurrDiskType m_currDisk;
 
+        // Multi-block transfers (CMD18/CMD25) move runs of sectors
+        // between the card image and runBuffer.
+        Bool           multiRead;
+        Bool           multiWrite;
+        ByteList       runBuffer;
+        uint32         runStart;
+        uint32         runCount;
+        uint32         runIndex;
+        uint8          writeStatus; // reported by the next CMD13
+
         void ProcessCommand(void);
         void CompleteCommand(void);
+        void NextReadBlock(void);
+        Bool FlushWriteRun(void);
 
     public :
         EmTRGSD();
@@ -17,14 +17,19 @@
 #include "CGremlins.h"			// Gremlins
 #include "CGremlinsStubs.h"		// StubAppGremlinsOff
 #include "EmApplication.h"		// ScheduleQuit
+#include "EmCPU68K.h"			// gCPU68K->ReportIdleSkipped
 #include "EmEventPlayback.h"	// SaveEvents, LoadEvents, Clear, RecordEvents
 #include "EmMapFile.h"			// EmMapFile::Write, etc.
 #include "EmMinimize.h"			// EmMinimize::IsDone
+#include "EmPatchMgr.h"			// EmPatchMgr::GetSystemCallCacheStats
 #include "EmPatchState.h"		// EmPatchState::UIInitialized
 #include "EmSession.h"			// gSession, ScheduleResumeHordesFromFile
+#include "EmScreen.h"			// EmScreen::ReportDirtyLines
+#include "EmSessionSnapshot.h"	// EmSessionSnapshot
 #include "EmStreamFile.h"		// kCreateOrOpenForWrite
 #include "ErrorHandling.h"		// Errors::ThrowIfPalmError
 #include "Logging.h"			// LogStartNew, etc.
+#include "Miscellaneous.h"		// SeparateList
 #include "Platform.h"			// Platform::GetMilliseconds
 #include "PreferenceMgr.h"		// Preference, gEmuPrefs
 #include "ROMStubs.h"			// EvtWakeup
@@ -35,6 +40,7 @@
 #include "SystemMgr.h"			// sysGetROMVerMajor
 
 #include <math.h>				// sqrt
+#include <map>					// map
 #include <time.h>				// time, localtime
 
 using namespace std;
@@ -66,6 +72,24 @@ static	EmDirRef	gHomeForHordesFiles;
 static Bool			gForceNewHordesDirectory;
 static EmDirRef		gGremlinDir;
 
+// In-memory copies of the root and suspended states, and of the events
+// each suspended Gremlin had recorded.  Switching between Gremlins
+// restores these instead of reloading the .psf and .pev files.  The
+// files are only written by ExportStates.
+
+typedef map<int32, EmSessionSnapshot>	EmSnapshotMap;
+
+static EmSessionSnapshot	gRootSnapshot;
+static EmSnapshotMap		gSuspendedSnapshots;
+static EmSnapshotMap		gSuspendedEvents;
+
+// The snapshot last written to each .psf file, so that saving a state
+// that hasn't changed doesn't compress and write it again.
+
+typedef map<EmFileRef, EmSessionSnapshot>	EmExportedMap;
+
+static EmExportedMap		gExportedSnapshots;
+
 Bool				gWarningHappened;
 Bool				gErrorHappened;
 
@@ -179,6 +203,13 @@ void Hordes::Load (SessionFile& f)
 void Hordes::Dispose (void)
 {
 	gTheGremlin.Reset ();
+
+	gRootSnapshot.Clear ();
+	gSuspendedSnapshots.clear ();
+	gSuspendedEvents.clear ();
+	gExportedSnapshots.clear ();
+
+	EmSessionSnapshot::DisposeBase ();
 }
 
 
@@ -197,33 +228,7 @@ void Hordes::Dispose (void)
 void
 Hordes::New(const HordeInfo& info)
 {
-	gGremlinStartNumber	= min(info.fStartNumber, info.fStopNumber);
-	gGremlinStopNumber	= max(info.fStartNumber, info.fStopNumber);
-	
-	if (info.fSwitchDepth == -1 || gGremlinStartNumber == gGremlinStopNumber)
-		gSwitchDepth = info.fMaxDepth;
-
-	else
-		gSwitchDepth = info.fSwitchDepth;
-	
-	gMaxDepth				= info.fMaxDepth;
-	gGremlinSaveFrequency	= info.fSaveFrequency;
-	gGremlinAppList			= info.fAppList;
-	gCurrentDepth			= 0;
-	gCurrentGremlin			= gGremlinStartNumber;
-
-	if (gSwitchDepth == 0)
-		gSwitchDepth = -1;
-
-	if (gMaxDepth == 0)
-		gMaxDepth = -1;
-
-	for (int counter = 0; counter <= MAXGREMLINS; counter++)
-	{
-		gGremlinHaltedInError[counter].fHalted		= false;
-		gGremlinHaltedInError[counter].fErrorEvent	= 0;
-		gGremlinHaltedInError[counter].fMessageID	= -1;
-	}
+	Hordes::SetHordeInfo (info);
 
 	GremlinInfo gremInfo;
 	
@@ -265,6 +270,149 @@ Hordes::New(const HordeInfo& info)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	Hordes::NewCoordinated
+ *
+ * DESCRIPTION: Starts a new Horde whose Gremlins are run by worker
+ *				processes (see EmHordeCoordinator).  This process
+ *				doesn't run any Gremlins itself; it saves the root
+ *				state the workers start from and starts the log that
+ *				EndCoordinated adds the merged results to.
+ *
+ * PARAMETERS:	HordeInfo& info - Horde initialization info
+ *
+ * RETURNED:	none
+ *
+ ***********************************************************************/
+
+void
+Hordes::NewCoordinated (const HordeInfo& info)
+{
+	Hordes::SetHordeInfo (info);
+
+	gStartTime = Platform::GetMilliseconds ();
+
+	Hordes::UseNewAutoSaveDirectory ();
+
+	EmEventPlayback::Clear ();
+
+	Hordes::TurnOn (false);
+
+	Hordes::SaveRootState ();
+
+	// The workers load the root state from its file.
+
+	Hordes::ExportStates ();
+
+	// Logging only works while Hordes is on; see EndHordes.
+
+	Hordes::TurnOn (true);
+
+	Hordes::StartLog ();
+
+	Hordes::TurnOn (false);
+
+	gWarningHappened	= false;
+	gErrorHappened		= false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Hordes::EndCoordinated
+ *
+ * DESCRIPTION: Called when all the worker processes started for
+ *				NewCoordinated have exited.  Merges the error stats
+ *				each worker recorded in its search progress file and
+ *				logs the same summary EndHordes would have for the
+ *				whole range.
+ *
+ * PARAMETERS:	progressFiles - the workers' search progress files.
+ *
+ * RETURNED:	none
+ *
+ ***********************************************************************/
+
+void
+Hordes::EndCoordinated (const EmFileRefList& progressFiles)
+{
+	for (int counter = 0; counter <= MAXGREMLINS; counter++)
+	{
+		gGremlinHaltedInError[counter].fHalted		= false;
+		gGremlinHaltedInError[counter].fErrorEvent	= 0;
+		gGremlinHaltedInError[counter].fMessageID	= -1;
+	}
+
+	EmFileRefList::const_iterator	iter = progressFiles.begin ();
+	while (iter != progressFiles.end ())
+	{
+		Hordes::MergeSearchProgress (*iter);
+		++iter;
+	}
+
+	gStopTime = Platform::GetMilliseconds ();
+
+	Hordes::TurnOn (true);
+
+	LogAppendMsg ("*************   Gremlin Horde ended at Gremlin #%ld (%ld workers, %ld ms)\n",
+		(long) gGremlinStopNumber, (long) progressFiles.size (), (long) (gStopTime - gStartTime));
+
+	Hordes::LogSummary ();
+
+	Hordes::TurnOn (false);
+
+	LogClear ();
+	EmEventPlayback::Clear ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Hordes::SetHordeInfo
+ *
+ * DESCRIPTION: Sets up the Gremlin range and search depths for a new
+ *				Horde and clears the error stats from the last one.
+ *
+ * PARAMETERS:	HordeInfo& info - Horde initialization info
+ *
+ * RETURNED:	none
+ *
+ ***********************************************************************/
+
+void
+Hordes::SetHordeInfo (const HordeInfo& info)
+{
+	gGremlinStartNumber	= min(info.fStartNumber, info.fStopNumber);
+	gGremlinStopNumber	= max(info.fStartNumber, info.fStopNumber);
+	
+	if (info.fSwitchDepth == -1 || gGremlinStartNumber == gGremlinStopNumber)
+		gSwitchDepth = info.fMaxDepth;
+
+	else
+		gSwitchDepth = info.fSwitchDepth;
+	
+	gMaxDepth				= info.fMaxDepth;
+	gGremlinSaveFrequency	= info.fSaveFrequency;
+	gGremlinAppList			= info.fAppList;
+	gCurrentDepth			= 0;
+	gCurrentGremlin			= gGremlinStartNumber;
+
+	if (gSwitchDepth == 0)
+		gSwitchDepth = -1;
+
+	if (gMaxDepth == 0)
+		gMaxDepth = -1;
+
+	for (int counter = 0; counter <= MAXGREMLINS; counter++)
+	{
+		gGremlinHaltedInError[counter].fHalted		= false;
+		gGremlinHaltedInError[counter].fErrorEvent	= 0;
+		gGremlinHaltedInError[counter].fMessageID	= -1;
+	}
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	Hordes::NewGremlin
@@ -341,6 +489,85 @@ Hordes::GremlinsFlagsFromString(string& inFlags)
 	}
 }
 
+// The error event and message ID of each Gremlin that recorded an error,
+// as a comma-separated list of "number:event:messageID" entries.
+
+string
+Hordes::GremlinsErrorsToString (void)
+{
+	string output;
+
+	for (int ii = 0; ii <= MAXGREMLINS; ++ii)
+	{
+		const EmGremlinThreadInfo&	info = gGremlinHaltedInError[ii];
+
+		if (info.fErrorEvent == 0 && info.fMessageID == -1)
+			continue;
+
+		char	buffer[40];
+		sprintf (buffer, "%d:%ld:%ld", ii, (long) info.fErrorEvent, (long) info.fMessageID);
+
+		if (!output.empty ())
+			output += ",";
+
+		output += buffer;
+	}
+
+	return output;
+}
+
+void
+Hordes::GremlinsErrorsFromString (string& inErrors)
+{
+	StringList	entries;
+	::SeparateList (entries, inErrors, ',');
+
+	StringList::iterator	iter = entries.begin ();
+	while (iter != entries.end ())
+	{
+		int		number;
+		long	errorEvent;
+		long	messageID;
+
+		if (sscanf (iter->c_str (), "%d:%ld:%ld", &number, &errorEvent, &messageID) == 3 &&
+			number >= 0 && number <= MAXGREMLINS)
+		{
+			gGremlinHaltedInError[number].fErrorEvent	= errorEvent;
+			gGremlinHaltedInError[number].fMessageID	= messageID;
+		}
+
+		++iter;
+	}
+}
+
+// Fold the results in a Horde worker's search progress file into ours.
+// Only the worker's own range of Gremlins is taken from it.
+
+void
+Hordes::MergeSearchProgress (const EmFileRef& f)
+{
+	StringStringMap	searchProgress;
+
+	EmMapFile::Read (f, searchProgress);
+
+	int32	startNumber = 0;
+	int32	stopNumber = -1;
+
+	::FromString (searchProgress["gGremlinStartNumber"],	startNumber);
+	::FromString (searchProgress["gGremlinStopNumber"],		stopNumber);
+
+	const string&	flags = searchProgress["gGremlinHaltedInError"];
+
+	for (int32 ii = max (startNumber, (int32) 0);
+		 ii <= stopNumber && ii < (int32) flags.size ();
+		 ++ii)
+	{
+		gGremlinHaltedInError[ii].fHalted = (flags[ii] == '1');
+	}
+
+	Hordes::GremlinsErrorsFromString (searchProgress["gGremlinErrors"]);
+}
+
 void
 Hordes::SaveSearchProgress()
 {
@@ -354,6 +581,7 @@ Hordes::SaveSearchProgress()
 	searchProgress["gCurrentGremlin"]		= ::ToString (gCurrentGremlin);
 	searchProgress["gCurrentDepth"]			= ::ToString (gCurrentDepth);
 	searchProgress["gGremlinHaltedInError"]	= Hordes::GremlinsFlagsToString ();
+	searchProgress["gGremlinErrors"]		= Hordes::GremlinsErrorsToString ();
 	searchProgress["gStartTime"]			= ::ToString (gStartTime);
 	searchProgress["gStopTime"]				= ::ToString (gStopTime);
 
@@ -380,6 +608,14 @@ Hordes::ResumeSearchProgress (const EmFileRef& f)
 
 	Hordes::GremlinsFlagsFromString (searchProgress["gGremlinHaltedInError"]);
 
+	for (int ii = 0; ii <= MAXGREMLINS; ++ii)
+	{
+		gGremlinHaltedInError[ii].fErrorEvent	= 0;
+		gGremlinHaltedInError[ii].fMessageID	= -1;
+	}
+
+	Hordes::GremlinsErrorsFromString (searchProgress["gGremlinErrors"]);
+
 	// Get, then patch up start and stop times.
 
 	::FromString (searchProgress["gStartTime"],				gStartTime);
@@ -555,6 +791,52 @@ Hordes::EndHordes (void)
 		LogAppendMsg ("*************   Gremlin Horde ended at Gremlin #%ld\n", gGremlinStopNumber);
 	}
 
+	Hordes::LogSummary ();
+
+	Hordes::TurnOn (false);
+
+	Hordes::ExportStates ();
+
+	LogClear();
+	EmEventPlayback::Clear ();
+
+	if (!Hordes::InSingleGremlinMode ())
+	{
+		EmDlg::GremlinControlClose ();
+
+		EmAssert (gSession);
+		gSession->ScheduleLoadRootState ();
+	}
+
+	if (Hordes::QuitWhenDone ())
+	{
+		EmAssert (gApplication);
+		gApplication->ScheduleQuit ();
+	}
+	else
+	{
+		gWarningHappened	= false;
+		gErrorHappened		= false;
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Hordes::LogSummary
+ *
+ * DESCRIPTION: Logs the device info and error statistics for the
+ *				Horde that just ended.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	none
+ *
+ ***********************************************************************/
+
+void
+Hordes::LogSummary (void)
+{
 	// It's time to print out some basic info:
 	//	ROM version
 	//	ROM file name
@@ -618,31 +900,21 @@ Hordes::EndHordes (void)
 		LogAppendMsg ("No Gremlins found errors.\n");
 	}
 
-	LogDump ();
-
-	Hordes::TurnOn (false);
+	// How often a system call's patches came from the cache instead of
+	// being looked up (counted since the emulator started).
 
-	LogClear();
-	EmEventPlayback::Clear ();
+	uint64	hits, misses;
+	EmPatchMgr::GetSystemCallCacheStats (hits, misses);
 
-	if (!Hordes::InSingleGremlinMode ())
+	if (hits + misses > 0)
 	{
-		EmDlg::GremlinControlClose ();
-
-		EmAssert (gSession);
-		gSession->ScheduleLoadRootState ();
+		LogAppendMsg ("*************   System Call Cache:");
+		LogAppendMsg ("Hits:                     %llu", (unsigned long long) hits);
+		LogAppendMsg ("Misses:                   %llu", (unsigned long long) misses);
+		LogAppendMsg ("Hit rate:                 %.1f%%\n", hits * 100.0 / (hits + misses));
 	}
 
-	if (Hordes::QuitWhenDone ())
-	{
-		EmAssert (gApplication);
-		gApplication->ScheduleQuit ();
-	}
-	else
-	{
-		gWarningHappened	= false;
-		gErrorHappened		= false;
-	}
+	LogDump ();
 }
 
 
@@ -880,6 +1152,9 @@ Hordes::ErrorEncountered (void)
 	LogAppendMsg ("=== ERROR: Gremlin #%ld terminated in error at event #%ld\n",
 		errorGremlin, errorEvent);
 
+	if (gCPU68K)
+		gCPU68K->ReportIdleSkipped ();
+
 	LogDump ();
 
 	// This is a fatal error; stop the execution of this Gremlin.
@@ -988,6 +1263,11 @@ Hordes::StopEventReached()
 	LogAppendMsg ("Gremlin #%ld finished successfully to event #%ld",
 					gremlinNumber, stopEventNumber);
 
+	if (gCPU68K)
+		gCPU68K->ReportIdleSkipped ();
+
+	EmScreen::ReportDirtyLines ();
+
 	if (stopEventNumber == gMaxDepth)
 	{
 //		LogAppendMsg ("********************************************************************************");
@@ -1140,6 +1420,30 @@ Hordes::Stop (void)
  *****************************************************************************/
 
 string Hordes::SuggestFileName (HordeFileType category, uint32 num)
+{
+	return Hordes::SuggestGremlinFileName (category, Hordes::GremlinNumber (), num);
+}
+
+
+/*****************************************************************************
+ *
+ * FUNCTION:	Hordes::SuggestGremlinFileName
+ *
+ * DESCRIPTION: Does the work for SuggestFileName, for the given Gremlin
+ *				rather than the current one.
+ *
+ * PARAMETERS:	category - file category
+ *
+ *				gremlinNumber - the Gremlin the file is for
+ *
+ *				num - Gremlin number for kHordeMinimalEventFile
+ *
+ * RETURNED:	file name or an empty string when the input category is
+ *				incorrect
+ *
+ *****************************************************************************/
+
+string Hordes::SuggestGremlinFileName (HordeFileType category, int32 gremlinNumber, uint32 num)
 {
 	static const char kStrSearchProgressFile[]	= "Gremlin_Search_Progress.dat";
 	static const char kStrRootStateFile[]		= "Gremlin_Root_State.psf";
@@ -1150,7 +1454,6 @@ string Hordes::SuggestFileName (HordeFileType category, uint32 num)
 
 	char fileName[64];
 
-	int32	gremlinNumber;
 	int32	eventCounter;
 	uint32	time;
 
@@ -1168,13 +1471,11 @@ string Hordes::SuggestFileName (HordeFileType category, uint32 num)
 
 		case kHordeSuspendFile:
 
-			gremlinNumber = Hordes::GremlinNumber ();
 			sprintf (fileName, kStrSuspendedStateFile, gremlinNumber);
 			break;
 
 		case kHordeAutoCurrentFile:
 
-			gremlinNumber = Hordes::GremlinNumber ();
 			eventCounter = Hordes::EventCounter ();
 
 			if (gGremlinSaveFrequency == 0)
@@ -1190,7 +1491,6 @@ string Hordes::SuggestFileName (HordeFileType category, uint32 num)
 
 		case kHordeEventFile:
 
-			gremlinNumber = Hordes::GremlinNumber ();
 			sprintf (fileName, kStrEventFile, gremlinNumber);
 			break;
 
@@ -1558,9 +1858,8 @@ Hordes::AutoSaveState (void)
  *
  * FUNCTION:	Hordes::SaveRootState
  *
- * DESCRIPTION: Creates a file reference to where the state
- *				should be saved.  Then calls a platform-specific
- *				routine to do the actual saving.
+ * DESCRIPTION: Saves the state a new Horde starts from, in memory.
+ *				ExportStates writes it to the root state file.
  *
  * PARAMETERS:	None.
  *
@@ -1578,34 +1877,130 @@ Hordes::SaveRootState (void)
 	if (hordesWasOn != false)
 		Hordes::TurnOn (false);
 
+	// This starts a new Horde; forget any states from the last one.
+
+	gSuspendedSnapshots.clear ();
+	gSuspendedEvents.clear ();
+
+	EmExportedMap::iterator	iter = gExportedSnapshots.begin ();
+	while (iter != gExportedSnapshots.end ())
+	{
+		if (iter->first == fileRef)
+			++iter;
+		else
+			gExportedSnapshots.erase (iter++);
+	}
+
 	EmAssert (gSession);
-	gSession->Save (fileRef, false);
+	gSession->Save (gRootSnapshot);
 
 	Hordes::TurnOn (hordesWasOn);
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	Hordes::ExportStates
+ *
+ * DESCRIPTION: Writes the root state and the suspended Gremlins'
+ *				states and events to their files, so that the Horde
+ *				can be resumed or examined later.  Called when the
+ *				user stops the Horde, when the Horde ends, and for
+ *				the workers of a coordinated Horde.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+Hordes::ExportStates (void)
+{
+	if (gRootSnapshot.IsEmpty ())
+		return;
+
+	Hordes::ExportState (Hordes::SuggestFileRef (kHordeRootFile), gRootSnapshot);
+
+	EmSnapshotMap::iterator	iter = gSuspendedSnapshots.begin ();
+	while (iter != gSuspendedSnapshots.end ())
+	{
+		int32		gremlinNumber = iter->first;
+		EmDirRef	gremlinDir = Hordes::GetGremlinDirectory ();
+
+		EmFileRef	stateRef (gremlinDir,
+						Hordes::SuggestGremlinFileName (kHordeSuspendFile, gremlinNumber, 0));
+		EmFileRef	eventRef (gremlinDir,
+						Hordes::SuggestGremlinFileName (kHordeEventFile, gremlinNumber, 0));
+
+		Hordes::ExportState (stateRef, iter->second);
+		Hordes::ExportEvents (eventRef, gSuspendedEvents[gremlinNumber]);
+
+		++iter;
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Hordes::ExportState
+ *
+ * DESCRIPTION: Writes a state out as a session file, unless the file
+ *				already holds that state.
+ *
+ * PARAMETERS:	ref - the file to write.
+ *
+ *				snapshot - the state to write.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+Hordes::ExportState (const EmFileRef& ref, const EmSessionSnapshot& snapshot)
+{
+	EmExportedMap::iterator	iter = gExportedSnapshots.find (ref);
+
+	if (iter != gExportedSnapshots.end () && ref.Exists () &&
+		iter->second.IsSameAs (snapshot))
+	{
+		return;
+	}
+
+	snapshot.Export (ref);
+
+	gExportedSnapshots[ref] = snapshot;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	Hordes::LoadState
  *
  * DESCRIPTION: Does the work of loading a state while Hordes is running.
  *
- * PARAMETERS:	None.
+ * PARAMETERS:	ref - the file holding the state.
+ *
+ *				snapshot - an in-memory copy of the same state.  If
+ *					given and not empty, it's used instead of the file.
  *
  * RETURNED:	Nothing.
  *
  ***********************************************************************/
 
 ErrCode
-Hordes::LoadState (const EmFileRef& ref)
+Hordes::LoadState (const EmFileRef& ref, EmSessionSnapshot* snapshot)
 {
 	ErrCode returnedErrCode = errNone;
 
 	try
 	{
 		EmAssert (gSession);
-		gSession->Load (ref);
+
+		if (snapshot && !snapshot->IsEmpty ())
+			gSession->Load (*snapshot);
+		else
+			gSession->Load (ref);
 	}
 	catch (ErrCode errCode)
 	{
@@ -1640,7 +2035,7 @@ Hordes::LoadRootState (void)
 {
 	EmFileRef	fileRef = Hordes::SuggestFileRef (kHordeRootFile);
 
-	ErrCode		result = Hordes::LoadState (fileRef);
+	ErrCode		result = Hordes::LoadState (fileRef, &gRootSnapshot);
 
 	if (result == 0)
 	{
@@ -1658,9 +2053,10 @@ Hordes::LoadRootState (void)
  *
  * FUNCTION:	Hordes::SaveSuspendedState
  *
- * DESCRIPTION: Creates a file reference to where the suspended state
- *				should be saved.  Then calls a platform-specific
- *				routine to do the actual saving.
+ * DESCRIPTION: Saves the current Gremlin's state and events in memory,
+ *				so that it can be resumed after the other Gremlins
+ *				have had their turn.  ExportStates writes them to the
+ *				suspended state and event files.
  *
  * PARAMETERS:	None.
  *
@@ -1671,14 +2067,14 @@ Hordes::LoadRootState (void)
 void
 Hordes::SaveSuspendedState (void)
 {
-	EmFileRef	fileRef = Hordes::SuggestFileRef (kHordeSuspendFile);
+	int32		gremlinNumber = Hordes::GremlinNumber ();
 
-	gSession->Save (fileRef, false);
+	gSession->Save (gSuspendedSnapshots[gremlinNumber]);
 
 	// This sort of overloads the function, but right now, any time we
 	// save the suspend state, we also want to save any recorded events.
 
-	Hordes::SaveEvents ();
+	Hordes::SaveEvents (gSuspendedEvents[gremlinNumber]);
 }
 
 
@@ -1701,7 +2097,10 @@ Hordes::LoadSuspendedState (void)
 {
 	EmFileRef	fileRef = Hordes::SuggestFileRef (kHordeSuspendFile);
 
-	ErrCode		result = Hordes::LoadState (fileRef);
+	EmSnapshotMap::iterator	iter = gSuspendedSnapshots.find (Hordes::GremlinNumber ());
+	EmSessionSnapshot*		snapshot = (iter != gSuspendedSnapshots.end ()) ? &iter->second : NULL;
+
+	ErrCode		result = Hordes::LoadState (fileRef, snapshot);
 
 	if (result == 0)
 	{
@@ -1713,7 +2112,10 @@ Hordes::LoadSuspendedState (void)
 		// LoadRootState, as there should not be any events associated
 		// with the root state (none have been generated!).
 
-		Hordes::LoadEvents ();
+		if (snapshot)
+			Hordes::LoadEvents (gSuspendedEvents[Hordes::GremlinNumber ()]);
+		else
+			Hordes::LoadEvents ();
 	}
 
 	return result;
@@ -1746,20 +2148,103 @@ Hordes::SaveEvents (void)
 
 	// Copy over the root state to the session file, first.
 
-	EmFileRef		rootRef = Hordes::SuggestFileRef (kHordeRootFile);
-	EmStreamFile	rootStream (rootRef, kOpenExistingForRead,
+	Hordes::WriteRootState (eventStream);
+
+	// Finally, write the events to the file.
+
+	EmEventPlayback::SaveEvents (eventSessionFile);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Hordes::SaveEvents
+ *
+ * DESCRIPTION: Save the current set of events in memory.
+ *
+ * PARAMETERS:	events - the snapshot to hold them.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+Hordes::SaveEvents (EmSessionSnapshot& events)
+{
+	events.Clear ();
+
+	EmStreamChunk	stream (events.GetState ());
+	ChunkFile		chunkFile (stream);
+	SessionFile		sessionFile (chunkFile, events);
+
+	EmEventPlayback::SaveEvents (sessionFile);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Hordes::ExportEvents
+ *
+ * DESCRIPTION: Write an event file for a set of events saved by
+ *				SaveEvents.  Like the one SaveEvents (void) writes, it
+ *				holds the root state followed by the events.
+ *
+ * PARAMETERS:	ref - the file to write.
+ *
+ *				events - the events to write.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+Hordes::ExportEvents (const EmFileRef& ref, const EmSessionSnapshot& events)
+{
+	EmStreamFile	eventStream (ref, kCreateOrEraseForWrite,
 						kFileCreatorEmulator, kFileTypeEvents);
+	ChunkFile		eventChunkFile (eventStream);
+	SessionFile		eventSessionFile (eventChunkFile);
+
+	Hordes::WriteRootState (eventStream);
 
+	eventSessionFile.WriteSnapshot (events);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Hordes::WriteRootState
+ *
+ * DESCRIPTION: Write the root state to the start of an event file.
+ *				The in-memory copy is used if there is one; otherwise
+ *				the root state file is copied.
+ *
+ * PARAMETERS:	stream - the event file.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+Hordes::WriteRootState (EmStream& stream)
+{
+	if (!gRootSnapshot.IsEmpty ())
 	{
-		int32		length = rootStream.GetLength ();
-		ByteList	buffer (length);
-		rootStream.GetBytes (&buffer[0], length);
-		eventStream.PutBytes (&buffer[0], length);
+		ChunkFile		chunkFile (stream);
+		SessionFile		sessionFile (chunkFile);
+
+		sessionFile.WriteSnapshot (gRootSnapshot);
+		return;
 	}
 
-	// Finally, write the events to the file.
+	EmFileRef		rootRef = Hordes::SuggestFileRef (kHordeRootFile);
+	EmStreamFile	rootStream (rootRef, kOpenExistingForRead,
+						kFileCreatorEmulator, kFileTypeEvents);
 
-	EmEventPlayback::SaveEvents (eventSessionFile);
+	int32		length = rootStream.GetLength ();
+	ByteList	buffer (length);
+	rootStream.GetBytes (&buffer[0], length);
+	stream.PutBytes (&buffer[0], length);
 }
 
 
@@ -1789,6 +2274,29 @@ Hordes::LoadEvents (void)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	Hordes::LoadEvents
+ *
+ * DESCRIPTION: Load a set of events saved by SaveEvents.
+ *
+ * PARAMETERS:	events - the snapshot holding them.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+Hordes::LoadEvents (EmSessionSnapshot& events)
+{
+	EmStreamChunk	stream (events.GetState ());
+	ChunkFile		chunkFile (stream);
+	SessionFile		sessionFile (chunkFile, events);
+
+	EmEventPlayback::LoadEvents (sessionFile);
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	Hordes::StartLog
@@ -34,6 +34,8 @@ enum HordeFileType
 ///////////////////////////////////////////////////////////////////////////////////////
 // HORDES CLASS
 
+class EmSessionSnapshot;
+class EmStream;
 class SessionFile;
 
 // Gremlins::Save, Gremlins::Load
@@ -60,6 +62,13 @@ class Hordes
 
 		static void				NewGremlin				(const GremlinInfo& info);
 
+		// Support for a Horde sharded across worker processes by
+		// EmHordeCoordinator.  This process only saves the root state
+		// and merges the workers' results when they're done.
+
+		static void				NewCoordinated			(const HordeInfo& info);
+		static void				EndCoordinated			(const EmFileRefList& progressFiles);
+
 		static void				SaveSearchProgress		(void);
 		static void				ResumeSearchProgress	(const EmFileRef& f);
 		
@@ -116,6 +125,12 @@ class Hordes
 		static ErrCode			LoadRootState			(void);
 		static ErrCode			LoadSuspendedState		(void);
 
+		// The root and suspended states are kept in memory while the
+		// Horde runs.  ExportStates writes them (and each suspended
+		// Gremlin's events) to the Gremlin directory.
+
+		static void				ExportStates			(void);
+
 		static void				LoadEvents				(void);
 		static void				SaveEvents				(void);
 
@@ -136,12 +151,29 @@ class Hordes
 														 int32 inFromGremlin,
 														 int32 inFromDepth);
 		static void				EndHordes				(void);
-
-		static ErrCode			LoadState				(const EmFileRef& ref);
+		static void				SetHordeInfo			(const HordeInfo& info);
+		static void				LogSummary				(void);
+		static void				MergeSearchProgress		(const EmFileRef& f);
+
+		static std::string SuggestGremlinFileName	(HordeFileType category,
+														 int32 gremlinNumber,
+														 uint32 num);
+
+		static void				ExportState				(const EmFileRef& ref,
+														 const EmSessionSnapshot& snapshot);
+		static void				ExportEvents			(const EmFileRef& ref,
+														 const EmSessionSnapshot& events);
+		static void				WriteRootState			(EmStream& stream);
+		static void				SaveEvents				(EmSessionSnapshot& events);
+		static void				LoadEvents				(EmSessionSnapshot& events);
+		static ErrCode			LoadState				(const EmFileRef& ref,
+														 EmSessionSnapshot* snapshot);
 
 		static void				StartLog				(void);
 		static std::string GremlinsFlagsToString	(void);
 		static void				GremlinsFlagsFromString	(std::string& inFlags);
+		static std::string GremlinsErrorsToString	(void);
+		static void				GremlinsErrorsFromString(std::string& inErrors);
 		static void				ComputeStatistics		(int32 &min,
 														 int32 &max,
 														 int32 &avg,
@@ -17,7 +17,7 @@
 
 #include <map>					// LP64: FILE* handle table
 
-#include "DebugMgr.h"			// gDebuggerGlobals
+#include "DebugMgr.h"			// gDebuggerGlobals, Debug::UpdateDataBreaks
 #include "EmApplication.h"		// gApplication, ScheduleQuit
 #include "EmBankMapped.h"		// EmBankMapped::GetEmulatedAddress
 #include "EmCPU68K.h"			// gCPU68K, gStackHigh, etc.
@@ -3961,6 +3961,8 @@ static void _HostDbgSetDataBreak (void)
 		gDebuggerGlobals.watchBytes = size;
 	}
 
+	Debug::UpdateDataBreaks ();
+
 	// Return the result.
 
 	PUT_RESULT_VAL (HostErrType, errNone);
@@ -3991,6 +3993,78 @@ static void _HostDbgClearDataBreak (void)
 		gDebuggerGlobals.watchBytes = 0;
 	}
 
+	Debug::UpdateDataBreaks ();
+
+	// Return the result.
+
+	PUT_RESULT_VAL (HostErrType, errNone);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� _HostDbgAddWatchpoint
+// ---------------------------------------------------------------------------
+
+static void _HostDbgAddWatchpoint (void)
+{
+	// long HostDbgAddWatchpoint (UInt32 addr, UInt32 size, UInt32 flags, const char* condition)
+
+	CALLED_SETUP_HC ("long", "UInt32 addr, UInt32 size, UInt32 flags, const char* condition");
+
+	// Get the caller's parameters.
+
+	CALLED_GET_PARAM_VAL (UInt32, addr);
+	CALLED_GET_PARAM_VAL (UInt32, size);
+	CALLED_GET_PARAM_VAL (UInt32, flags);
+	CALLED_GET_PARAM_STR (char, condition);
+
+	// Check the parameters.
+
+	BreakpointCondition*	bc = NULL;
+
+	if ((char*) condition && *(char*) condition)
+	{
+		bc = Debug::NewBreakpointCondition (condition);
+
+		if (!bc)
+		{
+			PUT_RESULT_VAL (long, 0);
+			return;
+		}
+	}
+
+	// Set the watchpoint.  AddWatchpoint checks the range and flags.
+
+	int32	id = Debug::AddWatchpoint (addr, size, flags, bc);
+
+	// Return the result.
+
+	PUT_RESULT_VAL (long, id);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� _HostDbgRemoveWatchpoint
+// ---------------------------------------------------------------------------
+
+static void _HostDbgRemoveWatchpoint (void)
+{
+	// HostErr HostDbgRemoveWatchpoint (long id)
+
+	CALLED_SETUP_HC ("HostErr", "long id");
+
+	// Get the caller's parameters.
+
+	CALLED_GET_PARAM_VAL (long, id);
+
+	// Remove the watchpoint.
+
+	if (!Debug::RemoveWatchpoint (id))
+	{
+		PUT_RESULT_VAL (HostErrType, hostErrInvalidParameter);
+		return;
+	}
+
 	// Return the result.
 
 	PUT_RESULT_VAL (HostErrType, errNone);
@@ -4748,6 +4822,8 @@ void Host::Initialize	(void)
 
 	gHandlerTable [hostSelectorDbgSetDataBreak]			= _HostDbgSetDataBreak;
 	gHandlerTable [hostSelectorDbgClearDataBreak]		= _HostDbgClearDataBreak;
+	gHandlerTable [hostSelectorDbgAddWatchpoint]		= _HostDbgAddWatchpoint;
+	gHandlerTable [hostSelectorDbgRemoveWatchpoint]		= _HostDbgRemoveWatchpoint;
 
 	gHandlerTable [hostSelectorSlotMax]					= _HostSlotMax;
 	gHandlerTable [hostSelectorSlotRoot]				= _HostSlotRoot;
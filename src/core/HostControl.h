@@ -250,6 +250,8 @@ extern "C" {
 
 #define hostSelectorDbgSetDataBreak			0x0980		// mcc 13 june 2001
 #define hostSelectorDbgClearDataBreak		0x0981		// mcc 13 june 2001
+#define hostSelectorDbgAddWatchpoint		0x0982
+#define hostSelectorDbgRemoveWatchpoint		0x0983
 
 
 	// Slot support
@@ -504,6 +506,13 @@ enum	// HostGet/SetFileAttr flags, matching EmFileAttr flags
 	hostFileAttrSystem = 4
 };
 
+enum	// HostDbgAddWatchpoint flags
+{
+	hostWatchRead = 1,		// Break when the range is read
+	hostWatchWrite = 2,		// Break when the range is written
+	hostWatchChange = 4		// Break when a write changes the range's contents
+};
+
 // Use these to call FtrGet to see if you're running under the
 // Palm OS Emulator.  If not, FtrGet will return ftrErrNoSuchFeature.
 
@@ -903,6 +912,16 @@ HostErr				HostDbgSetDataBreak (UInt32 addr, UInt32 size)
 HostErr				HostDbgClearDataBreak (void)
 						HOST_TRAP(hostSelectorDbgClearDataBreak);
 
+	// Returns an ID for HostDbgRemoveWatchpoint, or 0 on error.  The
+	// condition has the same syntax as a breakpoint condition in the
+	// Breakpoints dialog (e.g., "d0 == 5"), and may be NULL.
+
+long				HostDbgAddWatchpoint (UInt32 addr, UInt32 size, UInt32 flags, const char* condition)
+						HOST_TRAP(hostSelectorDbgAddWatchpoint);
+
+HostErr				HostDbgRemoveWatchpoint (long id)
+						HOST_TRAP(hostSelectorDbgRemoveWatchpoint);
+
 
 /* ==================================================================== */
 /* Slot related calls													*/
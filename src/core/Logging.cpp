@@ -17,6 +17,7 @@
 #include "EmApplication.h"		// gApplication, IsBound
 #include "EmMemory.h"			// EmMemGet32, EmMemGet16, EmMem_strcpy, EmMem_strncat
 #include "EmStreamFile.h"		// EmStreamFile
+#include "EmSysCallTrace.h"		// EmSysCallTrace::GetInsertions
 #include "Hordes.h"				// Hordes::IsOn, Hordes::EventCounter
 #include "Platform.h"			// GetMilliseconds
 #include "PreferenceMgr.h"		// Preference<>
@@ -165,8 +166,13 @@ LogStream::~LogStream (void)
 {
 	gPrefs->RemoveNotification (PrefChanged);
 
+	this->DumpToFile ();
+
+	// Keep ~LogStreamInner from writing the file again without the
+	// traced system calls.
+
 	omni_mutex_lock lock (fMutex);
-	fInner.DumpToFile ();
+	fInner.Clear ();
 }
 
 
@@ -323,6 +329,11 @@ void LogStream::Clear (void)
 {
 	omni_mutex_lock	lock (fMutex);
 
+	if (this == gStdLog)
+	{
+		EmSysCallTrace::Clear ();
+	}
+
 	fInner.Clear ();
 }
 
@@ -412,9 +423,39 @@ void LogStream::EnsureNewFile (void)
 
 void LogStream::DumpToFile (void)
 {
+	// Get the system calls traced by EmSysCallTrace, to be merged into
+	// the text.  Do this before taking fMutex: EmSysCallTrace may need
+	// to stop the CPU thread, which could be waiting to log something.
+
+	LogInsertionList	insertions;
+
+	if (this == gStdLog)
+	{
+		EmSysCallTrace::GetInsertions (insertions);
+	}
+
 	omni_mutex_lock	lock (fMutex);
 
-	fInner.DumpToFile ();
+	fInner.DumpToFile (insertions);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	LogStream::GetLinePosition
+ *
+ * DESCRIPTION:	Returns how many bytes had been logged as of the end of
+ *				the last complete line.  See LogInsertion.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	The position.
+ *
+ ***********************************************************************/
+
+uint64 LogStream::GetLinePosition (void) const
+{
+	return fInner.GetLinePosition ();
 }
 
 
@@ -462,6 +503,8 @@ LogStreamInner::LogStreamInner (const char* baseName) :
 	fBuffer (),
 	fBufferSize (0),
 	fDiscarded (false),
+	fPosition (0),
+	fLinePosition (0),
 	fLastGremlinEventCounter (kInvalidGremlinCounter),
 	fLastTimestampTime (kInvalidTimestamp),
 	fBaseTimestampTime (kInvalidTimestamp)
@@ -717,6 +760,28 @@ void LogStreamInner::EnsureNewFile (void)
  ***********************************************************************/
 
 void LogStreamInner::DumpToFile (void)
+{
+	this->DumpToFile (LogInsertionList ());
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	LogStreamInner::DumpToFile
+ *
+ * DESCRIPTION:	Like DumpToFile (void), but merges the given lines into
+ *				the text.  Each one is written in front of the text
+ *				logged after it was recorded.  Lines recorded before
+ *				the oldest text still buffered are dropped along with
+ *				that text.
+ *
+ * PARAMETERS:	insertions - the lines to merge, in order.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void LogStreamInner::DumpToFile (const LogInsertionList& insertions)
 {
 	if (fBuffer.size () == 0)
 		return;
@@ -739,14 +804,35 @@ void LogStreamInner::DumpToFile (void)
 		this->DumpToFile (stream, buffer, strlen (buffer));
 	}
 
-	// Dump the text.
+	// Dump the text, stopping at each point where a line is to be
+	// inserted.
 
 	const int	kChunkSize = 1 * 1024L * 1024L;
 	StMemory	chunk (kChunkSize);
 	ByteDeque::iterator	iter = fBuffer.begin ();
 
-	while (iter != fBuffer.end ())
+	uint64		bufferStart	= fPosition - fBuffer.size ();
+	uint64		position	= bufferStart;
+
+	LogInsertionList::const_iterator	insIter = insertions.begin ();
+
+	while (true)
 	{
+		while (insIter != insertions.end () && insIter->fPosition <= position)
+		{
+			if (insIter->fPosition >= bufferStart)
+			{
+				this->DumpToFile (stream, *insIter);
+			}
+
+			++insIter;
+		}
+
+		if (iter == fBuffer.end ())
+		{
+			break;
+		}
+
 		long	amtToCopy = kChunkSize;
 		long	amtLeft = fBuffer.end () - iter;
 
@@ -755,11 +841,18 @@ void LogStreamInner::DumpToFile (void)
 			amtToCopy = amtLeft;
 		}
 
+		if (insIter != insertions.end () &&
+			(uint64) amtToCopy > insIter->fPosition - position)
+		{
+			amtToCopy = (long) (insIter->fPosition - position);
+		}
+
 		copy (iter, iter + amtToCopy, chunk.Get ());
 
 		this->DumpToFile (stream, chunk.Get (), amtToCopy);
 
 		iter += amtToCopy;
+		position += amtToCopy;
 	}
 }
 
@@ -793,6 +886,74 @@ void LogStreamInner::DumpToFile (EmStreamFile& f, const char* s, long size)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	LogStreamInner::DumpToFile
+ *
+ * DESCRIPTION:	Dumps one inserted line to the log file, with a
+ *				timestamp for when it was recorded.
+ *
+ * PARAMETERS:	f - open file to write the line to.
+ *
+ *				insertion - the line to write.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void LogStreamInner::DumpToFile (EmStreamFile& f, const LogInsertion& insertion)
+{
+	// Make the time relative to the first line logged, like Timestamp
+	// does.  A line recorded before that one gets a time of zero.
+
+	uint32	base = fBaseTimestampTime;
+
+	if (base == kInvalidTimestamp)
+		base = insertion.fTime;
+
+	int32	time = (int32) (insertion.fTime - base);
+
+	if (time < 0)
+		time = 0;
+
+	char	buffer[40];
+
+	if (insertion.fEventCounter >= 0)
+	{
+		sprintf (buffer, "%ld.%03ld (%ld):\t", (long) (time / 1000),
+			(long) (time % 1000), (long) insertion.fEventCounter);
+	}
+	else
+	{
+		sprintf (buffer, "%ld.%03ld:\t", (long) (time / 1000), (long) (time % 1000));
+	}
+
+	string	line = buffer + insertion.fText + "\n";
+
+	this->DumpToFile (f, line.c_str (), line.size ());
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	LogStreamInner::GetLinePosition
+ *
+ * DESCRIPTION:	Returns how many bytes had been appended as of the end
+ *				of the last complete line.  Unlike the rest of this
+ *				class, it's safe to call without holding the lock.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	The position.
+ *
+ ***********************************************************************/
+
+uint64 LogStreamInner::GetLinePosition (void) const
+{
+	return fLinePosition.load (std::memory_order_acquire);
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	LogStreamInner::CreateFileReference
@@ -1001,6 +1162,13 @@ void LogStreamInner::Append (const char* buffer, long size)
 
 		this->TrimLeading ();
 #endif
+
+		fPosition += size;
+
+		if (buffer[size - 1] == '\n')
+		{
+			fLinePosition.store (fPosition, std::memory_order_release);
+		}
 	}
 }
 
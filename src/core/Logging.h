@@ -20,13 +20,32 @@
 #include "omnithread.h"			// omni_mutex
 
 #include <stdarg.h>				// va_list
+#include <atomic>				// std::atomic
 #include <deque>				// deque
+#include <string>				// string
+#include <vector>				// vector
 
 typedef std::deque<uint8>	ByteDeque;
 
 class EmStreamFile;
 
 
+// A line that's merged into the log's text when it's dumped, for things
+// recorded without being formatted (see EmSysCallTrace).  fPosition is
+// the log's GetLinePosition when the thing was recorded; the line goes
+// there, in front of any text logged after it.
+
+struct LogInsertion
+{
+	uint64					fPosition;
+	uint32					fTime;			// Platform::GetMilliseconds
+	int32					fEventCounter;	// Hordes::EventCounter, or -1
+	std::string				fText;
+};
+
+typedef std::vector<LogInsertion>	LogInsertionList;
+
+
 class LogStreamInner
 {
 	// Non-multithread-safe version of LogStream.  LogStream
@@ -47,9 +66,13 @@ class LogStreamInner
 
 		void					EnsureNewFile	(void);
 		void					DumpToFile		(void);
+		void					DumpToFile		(const LogInsertionList&);
+
+		uint64					GetLinePosition	(void) const;
 
 	private:
 		void					DumpToFile			(EmStreamFile&, const char*, long size);
+		void					DumpToFile			(EmStreamFile&, const LogInsertion&);
 		EmFileRef				CreateFileReference	(void);
 		void					Timestamp			(void);
 		void					NewLine				(void);
@@ -63,6 +86,12 @@ class LogStreamInner
 		long					fBufferSize;
 		Bool					fDiscarded;
 
+		// Total bytes ever appended, and the total as of the end of the
+		// last complete line.  The latter can be read without the lock.
+
+		uint64					fPosition;
+		std::atomic<uint64>		fLinePosition;
+
 		int32					fLastGremlinEventCounter;
 		uint32					fLastTimestampTime;
 		uint32					fBaseTimestampTime ;
@@ -91,6 +120,11 @@ class LogStream
 		void					EnsureNewFile	(void);
 		void					DumpToFile		(void);
 
+		// Doesn't take the mutex, so it can be called on the CPU thread
+		// for every traced system call.
+
+		uint64					GetLinePosition	(void) const;
+
 	private:
 		static void				PrefChanged			(PrefKeyType, PrefRefCon);	
 
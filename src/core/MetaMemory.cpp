@@ -32,6 +32,7 @@
 
 #include <algorithm>			// find
 #include <ctype.h>				// islower
+#include <unordered_map>		// unordered_map
 
 using namespace std;
 
@@ -55,6 +56,14 @@ static EmTaggedPalmChunk		gLastChunk;
 static vector<MemHandle>		gBitmapHandleList;
 static vector<MemPtr>			gBitmapPointerList;
 
+// Number of outstanding MarkInstructionBreak calls for each location
+// with kInstructionBreak set.  The debugger, the tailpatch code, and
+// anyone else can then share a location without removing and
+// re-installing each other's breaks.  Cleared along with meta-memory.
+
+typedef unordered_map<emuptr, uint32>	EmInstructionBreakCounts;
+static EmInstructionBreakCounts	gInstructionBreakCounts;
+
 enum
 {
 	kUIWindow,
@@ -90,6 +99,8 @@ void MetaMemory::Reset (void)
 	gTaggedChunks.clear ();
 	gHaveLastChunk = false;
 
+	gInstructionBreakCounts.clear ();
+
 	gBitmapHandleList.clear ();
 	gBitmapPointerList.clear ();
 }
@@ -127,6 +138,11 @@ void MetaMemory::Load (SessionFile& f)
 	gTaggedChunks.clear ();
 	gHaveLastChunk = false;
 
+	// The loaded meta-memory has its own breaks; EmSession::Load has
+	// everyone re-install theirs to rebuild the counts.
+
+	gInstructionBreakCounts.clear ();
+
 	Chunk	chunk;
 	if (f.ReadMetaInfo (chunk))
 	{
@@ -153,6 +169,56 @@ void MetaMemory::Load (SessionFile& f)
 
 void MetaMemory::Dispose (void)
 {
+	gInstructionBreakCounts.clear ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		� MetaMemory::MarkInstructionBreak
+// ---------------------------------------------------------------------------
+
+void MetaMemory::MarkInstructionBreak (emuptr opcodeLocation)
+{
+	EmAssert ((opcodeLocation & 1) == 0);
+
+	if (gInstructionBreakCounts[opcodeLocation]++ > 0)
+		return;
+
+	uint8*	ptr = EmMemGetMetaAddress (opcodeLocation);
+
+	// Predecoded blocks only look for breaks at their first instruction,
+	// so drop any block that has this one in the middle.
+
+	if (IsCodeBlock (ptr, 2))
+	{
+		EmBlockCache68K::Invalidate (ptr, 2);
+	}
+
+	*ptr |= kInstructionBreak;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� MetaMemory::UnmarkInstructionBreak
+// ---------------------------------------------------------------------------
+
+void MetaMemory::UnmarkInstructionBreak (emuptr opcodeLocation)
+{
+	EmAssert ((opcodeLocation & 1) == 0);
+
+	EmInstructionBreakCounts::iterator	iter = gInstructionBreakCounts.find (opcodeLocation);
+
+	if (iter != gInstructionBreakCounts.end ())
+	{
+		if (--(iter->second) > 0)
+			return;
+
+		gInstructionBreakCounts.erase (iter);
+	}
+
+	uint8*	ptr = EmMemGetMetaAddress (opcodeLocation);
+
+	*ptr &= ~kInstructionBreak;
 }
 
 
@@ -692,17 +758,15 @@ Bool MetaMemory::IsMemMgrData (emuptr testAddress, uint32 size)
 	
 	if (heap)
 	{
-		ITERATE_CHUNKS (*heap, iter, end)
-		{
-			if ((iter->HeaderContains (testAddress) &&
-				iter->HeaderContains (testAddress + size)) ||
-				(iter->TrailerContains (testAddress) &&
-				iter->TrailerContains (testAddress + size)))
-			{
-				return true;
-			}
+		const EmPalmChunk*	chunk = heap->GetChunkContaining (testAddress);
 
-			++iter;
+		if (chunk &&
+			((chunk->HeaderContains (testAddress) &&
+			chunk->HeaderContains (testAddress + size)) ||
+			(chunk->TrailerContains (testAddress) &&
+			chunk->TrailerContains (testAddress + size))))
+		{
+			return true;
 		}
 	}
 	
@@ -716,16 +780,13 @@ Bool MetaMemory::IsUnlockedChunk (emuptr testAddress, uint32 size)
 	
 	if (heap)
 	{
-		ITERATE_CHUNKS (*heap, iter, end)
-		{
-			if (iter->BodyContains (testAddress) &&
-				iter->BodyContains (testAddress + size) &&
-				iter->LockCount () == 0)
-			{
-				return true;
-			}
+		const EmPalmChunk*	chunk = heap->GetChunkBodyContaining (testAddress);
 
-			++iter;
+		if (chunk &&
+			chunk->BodyContains (testAddress + size) &&
+			chunk->LockCount () == 0)
+		{
+			return true;
 		}
 	}
 	
@@ -739,16 +800,13 @@ Bool MetaMemory::IsFreeChunk (emuptr testAddress, uint32 size)
 	
 	if (heap)
 	{
-		ITERATE_CHUNKS (*heap, iter, end)
-		{
-			if (iter->BodyContains (testAddress) &&
-				iter->BodyContains (testAddress + size) &&
-				iter->Free () == 0)
-			{
-				return true;
-			}
+		const EmPalmChunk*	chunk = heap->GetChunkBodyContaining (testAddress);
 
-			++iter;
+		if (chunk &&
+			chunk->BodyContains (testAddress + size) &&
+			chunk->Free () == 0)
+		{
+			return true;
 		}
 	}
 	
@@ -793,6 +851,44 @@ Bool MetaMemory::IsAllocatedChunk (emuptr testAddress, uint32 size)
 }
 
 
+// ---------------------------------------------------------------------------
+//		� MetaMemory::GetPageRestrictions
+// ---------------------------------------------------------------------------
+// Scan the meta-memory for a 64K page of RAM or ROM.  Loads and stores
+// touching data breaks must go through the bank handlers, as must stores
+// to the screen buffer or to code covered by a predecoded block.
+
+uint8 MetaMemory::GetPageRestrictions (emuptr pageStart)
+{
+	EmAssert ((pageStart & 0xFFFF) == 0);
+
+	if (EmMemGetBank (pageStart).xlatemetaaddr == NULL)
+		return 0;
+
+	const uint32*	p		= (const uint32*) EmMemGetMetaAddress (pageStart);
+	const uint32*	end		= p + 0x10000 / sizeof (uint32);
+	uint32			bits	= 0;
+
+	while (p < end)
+	{
+		bits |= *p++;
+	}
+
+	bits |= bits >> 16;
+	bits |= bits >> 8;
+
+	uint8	result = 0;
+
+	if ((bits & kDataBreak) != 0)
+		result |= kEmMemPagePlainGet | kEmMemPagePlainSet;
+
+	if ((bits & (kScreenBuffer | kCodeBlock)) != 0)
+		result |= kEmMemPagePlainSet;
+
+	return result;
+}
+
+
 // ---------------------------------------------------------------------------
 //		� MetaMemory::MarkRange
 // ---------------------------------------------------------------------------
@@ -839,7 +935,7 @@ void MetaMemory::MarkRange (emuptr start, emuptr end, uint8 v)
 	{
 		while (p < endP)
 		{
-			*p++ &= v;
+			*p++ |= v;
 		}
 	}
 	else
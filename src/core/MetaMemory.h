@@ -14,6 +14,7 @@
 #ifndef _METAMEMORY_H_
 #define _METAMEMORY_H_
 
+#include "EmBlockCache68K.h"	// EmBlockCache68K::Invalidate
 #include "EmMemory.h"			// EmMemGetMetaAddress
 #include "EmPalmHeap.h"			// EmPalmHeap, EmPalmChunkList
 #include "ErrorHandling.h"		// Errors::EAccessType
@@ -58,12 +59,21 @@ class MetaMemory
 		static void				MarkUIObjects			(void);
 		static void				UnmarkUIObjects			(void);
 
+		// Instruction breaks are reference counted: a location stays
+		// marked until everyone who marked it has unmarked it.
+
 		static void				MarkInstructionBreak	(emuptr opcodeLocation);
 		static void				UnmarkInstructionBreak	(emuptr opcodeLocation);
 
 		static void				MarkDataBreak			(emuptr begin, emuptr end);
 		static void				UnmarkDataBreak			(emuptr begin, emuptr end);
 
+		// Called by EmBlockCache68K to tag the bytes covered by predecoded
+		// blocks.  These take meta-memory addresses, not emulated ones.
+
+		static void				MarkCodeBlock			(uint8* begin, uint8* end);	// Inlined, defined below
+		static void				UnmarkCodeBlock			(uint8* begin, uint8* end);	// Inlined, defined below
+
 		// Called when memory needs to be marked as initialized or not.
 
 #if FOR_LATER
@@ -162,6 +172,14 @@ class MetaMemory
 		static Bool				IsCPUBreak				(emuptr opcodeLocation);
 		static Bool				IsCPUBreak				(uint8* metaLocation);
 
+		static Bool				IsCodeBlock				(uint8* metaAddress, uint32 size);	// Inlined, defined below
+		static Bool				IsDataBreak				(uint8* metaAddress, uint32 size);	// Inlined, defined below
+
+		// Return the kEmMemPagePlain bits that the 64K page starting at
+		// "pageStart" can't have, given the bytes marked in it.
+
+		static uint8			GetPageRestrictions		(emuptr pageStart);
+
 	private:
 		struct ChunkCheck
 		{
@@ -230,7 +248,7 @@ class MetaMemory
 			kNoAppAccess		= 0x0001,
 			kNoSystemAccess		= 0x0002,
 			kNoMemMgrAccess		= 0x0004,
-			kUnusedMeta1		= 0x0008,
+			kCodeBlock			= 0x0008,	// Covered by a predecoded block; invalidate if changed.
 			kStackBuffer		= 0x0010,	// Stack buffer; check to see if below-SP access is made.
 			kScreenBuffer		= 0x0020,	// Screen buffer; update host screen if these bytes are changed.
 			kInstructionBreak	= 0x0040,	// Halt CPU emulation and check to see why.
@@ -433,6 +451,72 @@ inline Bool MetaMemory::IsCPUBreak (uint8* metaLocation)
 }
 
 
+inline Bool MetaMemory::IsCodeBlock (uint8* metaAddress, uint32 size)
+{
+	if (size == 1)
+	{
+		const uint8 kMask = META_BITS_8 (kCodeBlock);
+
+		return (META_VALUE_8 (metaAddress) & kMask) != 0;
+	}
+	else if (size == 2)
+	{
+		const uint16 kMask = META_BITS_16 (kCodeBlock);
+
+		return (META_VALUE_16 (metaAddress) & kMask) != 0;
+	}
+	else if (size == 4)
+	{
+		const uint32 kMask = META_BITS_32 (kCodeBlock);
+
+		return (META_VALUE_32 (metaAddress) & kMask) != 0;
+	}
+
+	for (uint32 ii = 0; ii < size; ++ii)
+	{
+		if ((metaAddress[ii] & kCodeBlock) != 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+inline Bool MetaMemory::IsDataBreak (uint8* metaAddress, uint32 size)
+{
+	if (size == 1)
+	{
+		const uint8 kMask = META_BITS_8 (kDataBreak);
+
+		return (META_VALUE_8 (metaAddress) & kMask) != 0;
+	}
+	else if (size == 2)
+	{
+		const uint16 kMask = META_BITS_16 (kDataBreak);
+
+		return (META_VALUE_16 (metaAddress) & kMask) != 0;
+	}
+	else if (size == 4)
+	{
+		const uint32 kMask = META_BITS_32 (kDataBreak);
+
+		return (META_VALUE_32 (metaAddress) & kMask) != 0;
+	}
+
+	for (uint32 ii = 0; ii < size; ++ii)
+	{
+		if ((metaAddress[ii] & kDataBreak) != 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
 #define META_CHECK(metaAddress, address, op, size, forRead)		\
 do {															\
 	/* Bypass: POSE internal reads (ProcessException, etc.) */	\
@@ -578,6 +662,7 @@ inline void MetaMemory::MarkFreeChunk (emuptr begin, emuptr end)
 inline void MetaMemory::MarkScreen (emuptr begin, emuptr end)
 {
 	SetAccess (begin, end, kScreenBits);
+	Memory::RestrictPages (begin, end, kEmMemPagePlainSet);
 }
 
 
@@ -589,6 +674,7 @@ inline void MetaMemory::UnmarkScreen (emuptr begin, emuptr end)
 {
 	MarkTotalAccess (begin, end);
 	UnmarkRange (begin, end, kScreenBuffer);
+	Memory::ResyncPages (begin, end);
 }
 
 
@@ -614,50 +700,50 @@ inline void MetaMemory::UnmarkUIObject (emuptr begin, emuptr end)
 
 
 // ---------------------------------------------------------------------------
-//		� MetaMemory::MarkInstructionBreak
+//		� MetaMemory::MarkDataBreak
 // ---------------------------------------------------------------------------
 
-inline void MetaMemory::MarkInstructionBreak (emuptr opcodeLocation)
+inline void MetaMemory::MarkDataBreak (emuptr begin, emuptr end)
 {
-	EmAssert ((opcodeLocation & 1) == 0);
-
-	uint8*	ptr = EmMemGetMetaAddress (opcodeLocation);
-
-	*ptr |= kInstructionBreak;
+	MarkRange (begin, end, kDataBreak);
+	Memory::RestrictPages (begin, end, kEmMemPagePlainGet | kEmMemPagePlainSet);
 }
 
 
 // ---------------------------------------------------------------------------
-//		� MetaMemory::UnmarkInstructionBreak
+//		� MetaMemory::UnmarkDataBreak
 // ---------------------------------------------------------------------------
 
-inline void MetaMemory::UnmarkInstructionBreak (emuptr opcodeLocation)
+inline void MetaMemory::UnmarkDataBreak (emuptr begin, emuptr end)
 {
-	EmAssert ((opcodeLocation & 1) == 0);
-
-	uint8*	ptr = EmMemGetMetaAddress (opcodeLocation);
-
-	*ptr &= ~kInstructionBreak;
+	UnmarkRange (begin, end, kDataBreak);
+	Memory::ResyncPages (begin, end);
 }
 
 
 // ---------------------------------------------------------------------------
-//		� MetaMemory::MarkDataBreak
+//		� MetaMemory::MarkCodeBlock
 // ---------------------------------------------------------------------------
 
-inline void MetaMemory::MarkDataBreak (emuptr begin, emuptr end)
+inline void MetaMemory::MarkCodeBlock (uint8* begin, uint8* end)
 {
-	MarkRange (begin, end, kDataBreak);
+	while (begin < end)
+	{
+		*begin++ |= kCodeBlock;
+	}
 }
 
 
 // ---------------------------------------------------------------------------
-//		� MetaMemory::UnmarkDataBreak
+//		� MetaMemory::UnmarkCodeBlock
 // ---------------------------------------------------------------------------
 
-inline void MetaMemory::UnmarkDataBreak (emuptr begin, emuptr end)
+inline void MetaMemory::UnmarkCodeBlock (uint8* begin, uint8* end)
 {
-	UnmarkRange (begin, end, kDataBreak);
+	while (begin < end)
+	{
+		*begin++ &= ~kCodeBlock;
+	}
 }
 
 
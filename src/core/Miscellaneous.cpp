@@ -2151,15 +2151,47 @@ string GetLibraryName (uint16 refNum)
  *
  * FUNCTION:	GetSystemCallContext
  *
- * DESCRIPTION: .
+ * DESCRIPTION: Fill in a SystemCallContext for the system call being
+ *				made at the given PC.
  *
- * PARAMETERS:	None.
+ * PARAMETERS:	pc - the address of the TRAP $F or JSR (A1) making
+ *					the call.
  *
- * RETURNED:	Nothing.
+ *				context - receives the information.
+ *
+ * RETURNED:	True if the function being called could be found.  If
+ *				not, context.fError says why.
  *
  ***********************************************************************/
 
 Bool GetSystemCallContext (emuptr pc, SystemCallContext& context)
+{
+	if (!::GetSystemCallTrap (pc, context))
+		return false;
+
+	return ::GetSystemCallDestination (context);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	GetSystemCallTrap
+ *
+ * DESCRIPTION: First half of GetSystemCallContext: determine how the
+ *				system function is being called and with what trap
+ *				word and extra parameter.  This only looks at the
+ *				instruction stream and registers.
+ *
+ * PARAMETERS:	pc - the address of the TRAP $F or JSR (A1) making
+ *					the call.
+ *
+ *				context - receives the information.
+ *
+ * RETURNED:	False if pc isn't pointing to a system call.
+ *
+ ***********************************************************************/
+
+Bool GetSystemCallTrap (emuptr pc, SystemCallContext& context)
 {
 	context.fPC = pc;
 
@@ -2222,6 +2254,27 @@ Bool GetSystemCallContext (emuptr pc, SystemCallContext& context)
 
 	EmAssert ((context.fTrapWord >= sysTrapBase) && (context.fTrapWord < sysTrapBase + 0x1000));
 
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	GetSystemCallDestination
+ *
+ * DESCRIPTION: Second half of GetSystemCallContext: look up the
+ *				address of the function named by context.fTrapWord and
+ *				context.fExtra in the trap table or library table.
+ *
+ * PARAMETERS:	context - the context filled in by GetSystemCallTrap.
+ *
+ * RETURNED:	True if the function could be found.  If not,
+ *				context.fError says why.
+ *
+ ***********************************************************************/
+
+Bool GetSystemCallDestination (SystemCallContext& context)
+{
 	try
 	{
 		context.fError		= 0;
@@ -149,6 +149,8 @@ uint32		DateToDays				(uint32 year, uint32 month, uint32 day);
 std::string	GetLibraryName			(uint16 refNum);
 
 Bool		GetSystemCallContext	(emuptr, SystemCallContext&);
+Bool		GetSystemCallTrap		(emuptr, SystemCallContext&);
+Bool		GetSystemCallDestination(SystemCallContext&);
 
 void		GetHostTime				(int32* hour, int32* min, int32* sec);
 void		GetHostDate				(int32* year, int32* month, int32* day);
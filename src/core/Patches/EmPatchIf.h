@@ -29,7 +29,8 @@ enum
 enum CallROMType
 {
 	kExecuteROM,
-	kSkipROM
+	kSkipROM,
+	kRetryCall		// Not done yet; re-execute the system call later.
 };
 
 
@@ -28,9 +28,11 @@
 #include "EmPalmFunction.h"		// IsSystemTrap
 #include "EmRPC.h"				// RPC::SignalWaiters
 #include "EmSession.h"			// GetDevice
+#include "EmSysCallTrace.h"		// EmSysCallTrace::RecordReturn
 #include "Hordes.h"				// Hordes::IsOn, Hordes::PostFakeEvent, Hordes::CanSwitchToApp
 #include "Logging.h"			// LogEvtAddEventToQueue, etc.
 #include "MetaMemory.h" 		// MetaMemory mark functions
+#include "Miscellaneous.h"		// GetSystemCallTrap, GetSystemCallDestination
 #include "PreferenceMgr.h"		// Preference (kPrefKeyUserName)
 #include "Profiling.h"			// StDisableAllProfiling
 #include "ROMStubs.h"			// FtrSet, FtrUnregister, EvtWakeup, ...
@@ -68,6 +70,12 @@ static PatchedLibIndex		gPatchedLibs;
 //
 static TailPatchIndex		gInstalledTailpatches;
 
+//Resolved system calls, and how often that saved us resolving them
+//
+static SystemCallCache		gSystemCallCache;
+static uint64				gSystemCallCacheHits;
+static uint64				gSystemCallCacheMisses;
+
 
 // Magic number used to identify Htal patch
 //	See comments in HtalLibSendReply.
@@ -144,7 +152,7 @@ void EmPatchMgr::Reset (void)
 
 	// Clear the installed lib patches (for "loaded" libraries)
 	//
-	gPatchedLibs.clear ();
+	EmPatchMgr::FlushSystemCallCache ();
 
 	EmPatchState::Reset ();
 }
@@ -183,14 +191,14 @@ void EmPatchMgr::Save (SessionFile& f)
 	TailPatchIndex::iterator	iter2;
 	for (iter2 = gInstalledTailpatches.begin (); iter2 != gInstalledTailpatches.end (); ++iter2)
 	{
-		s << iter2->fContext.fDestPC1;	// !!! Need to support fDestPC2, too.  But since only fNextPC seems to be used, it doesn't really matter.
-		s << iter2->fContext.fExtra;
-		s << iter2->fContext.fNextPC;
-		s << iter2->fContext.fPC;
-		s << iter2->fContext.fTrapIndex;
-		s << iter2->fContext.fTrapWord;
-		s << iter2->fCount;
-//		s << iter2->fTailpatch; // Patched up in ::Load
+		s << iter2->second.fContext.fDestPC1;	// !!! Need to support fDestPC2, too.  But since only fNextPC seems to be used, it doesn't really matter.
+		s << iter2->second.fContext.fExtra;
+		s << iter2->second.fContext.fNextPC;
+		s << iter2->second.fContext.fPC;
+		s << iter2->second.fContext.fTrapIndex;
+		s << iter2->second.fContext.fTrapWord;
+		s << iter2->second.fCount;
+//		s << iter2->second.fTailpatch; // Patched up in ::Load
 	}
 
 	EmPatchState::Save (s, kCurrentVersion, EmPatchState::PSPersistStep2);
@@ -226,7 +234,7 @@ void EmPatchMgr::Load (SessionFile& f)
 		{
 			EmPatchState::Load (s, version, EmPatchState::PSPersistStep1);
 
-			gPatchedLibs.clear ();
+			EmPatchMgr::FlushSystemCallCache ();
 			gInstalledTailpatches.clear ();
 
 
@@ -252,7 +260,7 @@ void EmPatchMgr::Load (SessionFile& f)
 				HeadpatchProc	dummy;
 				GetPatches (patch.fContext, dummy, patch.fTailpatch);
 
-				gInstalledTailpatches.push_back (patch);
+				gInstalledTailpatches[patch.fContext.fNextPC] = patch;
 			}
 		}
 		
@@ -282,7 +290,7 @@ void EmPatchMgr::Load (SessionFile& f)
 void EmPatchMgr::Dispose (void)
 {
 	gInstalledTailpatches.clear ();
-	gPatchedLibs.clear ();
+	EmPatchMgr::FlushSystemCallCache ();
 
 	EmPatchState::Dispose ();
 
@@ -475,6 +483,164 @@ IEmPatchModule* EmPatchMgr::GetLibPatchTable (uint16 refNum)
 
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	EmPatchMgr::GetSystemCallContext
+ *
+ * DESCRIPTION:	Cached version of ::GetSystemCallContext, used for
+ *				every system call the emulated CPU makes.  Along with
+ *				the context, it returns the call's head- and
+ *				tailpatches, so that HandleSystemCall doesn't have to
+ *				look them up again.
+ *
+ *				Resolving a call means walking the trap table or the
+ *				library table (and, for libraries, comparing the
+ *				library name against the ones we know), and then
+ *				finding the patch module.  None of that changes
+ *				unless the trap table or library table does, so the
+ *				results are kept in gSystemCallCache until
+ *				FlushSystemCallCache is called: on reset, session
+ *				load, and after SysSetTrapAddress, SysLibInstall,
+ *				SysLibLoad, and SysLibRemove.  Each hit is still
+ *				checked against the trap table slot or library
+ *				dispatch entry (see FunctionAddressChanged), since
+ *				those can be written to directly.
+ *
+ * PARAMETERS:	pc - the address of the TRAP $F or JSR (A1) making
+ *					the call.
+ *
+ *				context - receives the information.
+ *
+ *				hp, tp - receive the call's patches.
+ *
+ * RETURNED:	True if the function being called could be found.  If
+ *				not, context.fError says why.  Failures aren't cached.
+ *
+ ***********************************************************************/
+
+Bool EmPatchMgr::GetSystemCallContext (emuptr pc,
+									   SystemCallContext& context,
+									   HeadpatchProc& hp,
+									   TailpatchProc& tp)
+{
+	if (!::GetSystemCallTrap (pc, context))
+		return false;
+
+	// The extra parameter is only part of the key where it changes the
+	// destination: library refNums, and D2 for sub-dispatched functions.
+
+	uint32	extra = context.fExtra;
+
+	if (::IsSystemTrap (context.fTrapWord) && !::IsSubDispatchTrap (context.fTrapWord))
+	{
+		extra = 0;
+	}
+
+	uint64	key = ((uint64) context.fTrapWord << 32) | extra;
+
+	SystemCallCache::iterator	iter = gSystemCallCache.find (key);
+
+	// The cached addresses are about to be jumped to, so make sure that
+	// the trap table or library table still agrees with them.  It can
+	// change behind our back: the tables live in emulated RAM, and
+	// nothing stops an application from writing to them directly.
+
+	if (iter != gSystemCallCache.end () &&
+		::FunctionAddressChanged (context.fTrapWord, context.fExtra,
+			iter->second.fDestPC1, iter->second.fDestPC2))
+	{
+		if (!::IsSystemTrap (context.fTrapWord) && context.fExtra < gPatchedLibs.size ())
+		{
+			gPatchedLibs[context.fExtra].SetDirty (true);
+		}
+
+		gSystemCallCache.erase (iter);
+		iter = gSystemCallCache.end ();
+	}
+
+	if (iter != gSystemCallCache.end ())
+	{
+		++gSystemCallCacheHits;
+
+		context.fDestPC1	= iter->second.fDestPC1;
+		context.fDestPC2	= iter->second.fDestPC2;
+		context.fError		= 0;
+
+		hp = iter->second.fHeadpatch;
+		tp = iter->second.fTailpatch;
+
+		return true;
+	}
+
+	++gSystemCallCacheMisses;
+
+	if (!::GetSystemCallDestination (context))
+		return false;
+
+	EmPatchMgr::GetPatches (context, hp, tp);
+
+	SystemCallCacheEntry&	entry = gSystemCallCache[key];
+
+	entry.fDestPC1		= context.fDestPC1;
+	entry.fDestPC2		= context.fDestPC2;
+	entry.fHeadpatch	= hp;
+	entry.fTailpatch	= tp;
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPatchMgr::FlushSystemCallCache
+ *
+ * DESCRIPTION:	Forget all resolved system calls, along with which
+ *				patch module goes with which library refNum.  Called
+ *				whenever the trap table or library table may have
+ *				changed.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void EmPatchMgr::FlushSystemCallCache (void)
+{
+	if (LogSystemCalls () && !gSystemCallCache.empty ())
+	{
+		LogAppendMsg ("--- System call cache flushed (%ld entries); %llu hits, %llu misses so far.",
+			(long) gSystemCallCache.size (),
+			(unsigned long long) gSystemCallCacheHits,
+			(unsigned long long) gSystemCallCacheMisses);
+	}
+
+	gSystemCallCache.clear ();
+	gPatchedLibs.clear ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPatchMgr::GetSystemCallCacheStats
+ *
+ * DESCRIPTION:	Return how many system calls were resolved from the
+ *				cache, and how many had to be looked up, since the
+ *				emulator started.
+ *
+ * PARAMETERS:	hits, misses - receive the counts.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void EmPatchMgr::GetSystemCallCacheStats (uint64& hits, uint64& misses)
+{
+	hits	= gSystemCallCacheHits;
+	misses	= gSystemCallCacheMisses;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	EmPatchMgr::HandleSystemCall
@@ -482,13 +648,19 @@ IEmPatchModule* EmPatchMgr::GetLibPatchTable (uint16 refNum)
  * DESCRIPTION:	If this is a trap we could possibly have head- or
  *				tail-patched, handle those cases.
  *
- * PARAMETERS:	none
+ * PARAMETERS:	context - the system call, as returned by
+ *					GetSystemCallContext.
  *
- * RETURNED:	nothing
+ *				hp, tp - the call's patches, as returned by
+ *					GetSystemCallContext.
+ *
+ * RETURNED:	What to do about the ROM function.
  *
  ***********************************************************************/
 
-CallROMType EmPatchMgr::HandleSystemCall (const SystemCallContext& context)
+CallROMType EmPatchMgr::HandleSystemCall (const SystemCallContext& context,
+										  HeadpatchProc hp,
+										  TailpatchProc tp)
 {
 	EmAssert (gSession);
 	if (gSession->GetNeedPostLoad ())
@@ -497,10 +669,6 @@ CallROMType EmPatchMgr::HandleSystemCall (const SystemCallContext& context)
 		EmPatchMgr::PostLoad ();
 	}
 
-	HeadpatchProc	hp;
-	TailpatchProc	tp;
-	EmPatchMgr::GetPatches (context, hp, tp);
-
 	CallROMType handled = EmPatchMgr::HandlePatches (context, hp, tp);
 
 	return handled;
@@ -614,9 +782,14 @@ CallROMType EmPatchMgr::HandlePatches (const SystemCallContext& context,
 		{
 			SetupForTailpatch (tp, context);
 		}
-		else
+		else if (handled == kSkipROM)
 		{
 			CallTailpatch (tp);
+
+			if (!gSession->IsNested () && LogSystemCalls ())
+			{
+				EmSysCallTrace::RecordReturn (context);
+			}
 		}
 	}
 
@@ -670,7 +843,7 @@ void EmPatchMgr::InstallInstructionBreaks (void)
 
 	while (iter != gInstalledTailpatches.end ())
 	{
-		MetaMemory::MarkInstructionBreak (iter->fContext.fNextPC);
+		MetaMemory::MarkInstructionBreak (iter->first);
 		++iter;
 	}
 }
@@ -695,7 +868,7 @@ void EmPatchMgr::RemoveInstructionBreaks (void)
 
 	while (iter != gInstalledTailpatches.end ())
 	{
-		MetaMemory::UnmarkInstructionBreak (iter->fContext.fNextPC);
+		MetaMemory::UnmarkInstructionBreak (iter->first);
 		++iter;
 	}
 }
@@ -718,34 +891,26 @@ void EmPatchMgr::SetupForTailpatch (TailpatchProc tp, const SystemCallContext& c
 	// See if this function is already tailpatched.  If so, merely increment
 	// the use-count field.
 
-	TailPatchIndex::iterator	iter = gInstalledTailpatches.begin ();
+	TailPatchIndex::iterator	iter = gInstalledTailpatches.find (context.fNextPC);
 
-	while (iter != gInstalledTailpatches.end ())
+	if (iter != gInstalledTailpatches.end ())
 	{
-		if (iter->fContext.fNextPC == context.fNextPC)
-		{
-			++(iter->fCount);
-			return;
-		}
-
-		++iter;
+		++(iter->second.fCount);
+		return;
 	}
 
 	// This function is not already tailpatched, so add a new entry
-	// for the the PC/opcode we want to save.
-
-	EmAssert (gSession);
-	gSession->RemoveInstructionBreaks ();
+	// for the the PC/opcode we want to save.  Instruction breaks are
+	// reference counted, so marking the return address doesn't disturb
+	// anyone else's break there.
 
-	TailpatchType	newTailpatch;
+	TailpatchType&	newTailpatch = gInstalledTailpatches[context.fNextPC];
 
 	newTailpatch.fContext	= context;
 	newTailpatch.fCount 	= 1;
 	newTailpatch.fTailpatch = tp;
 
-	gInstalledTailpatches.push_back (newTailpatch);
-
-	gSession->InstallInstructionBreaks ();
+	MetaMemory::MarkInstructionBreak (context.fNextPC);
 }
 
 
@@ -769,34 +934,29 @@ TailpatchProc EmPatchMgr::RecoverFromTailpatch (emuptr startPC)
 
 	// Find the PC.
 
-	TailPatchIndex::iterator	iter = gInstalledTailpatches.begin ();
+	TailPatchIndex::iterator	iter = gInstalledTailpatches.find (patchPC);
 
-	while (iter != gInstalledTailpatches.end ())
-	{
-		if (iter->fContext.fNextPC == patchPC)
-		{
-			TailpatchProc	result = iter->fTailpatch;
-
-			// Decrement the use-count.  If it reaches zero, remove the
-			// patch from our list.
+	if (iter == gInstalledTailpatches.end ())
+		return NULL;
 
-			if (--(iter->fCount) == 0)
-			{
-				EmAssert (gSession);
-				gSession->RemoveInstructionBreaks ();
+	TailpatchProc	result = iter->second.fTailpatch;
 
-				gInstalledTailpatches.erase (iter);
+	if (!gSession->IsNested () && LogSystemCalls ())
+	{
+		EmSysCallTrace::RecordReturn (iter->second.fContext);
+	}
 
-				gSession->InstallInstructionBreaks ();
-			}
+	// Decrement the use-count.  If it reaches zero, remove the
+	// patch from our list.
 
-			return result;
-		}
+	if (--(iter->second.fCount) == 0)
+	{
+		gInstalledTailpatches.erase (iter);
 
-		++iter;
+		MetaMemory::UnmarkInstructionBreak (patchPC);
 	}
 
-	return NULL;
+	return result;
 }
 
 
@@ -67,7 +67,16 @@ class EmPatchMgr : public EcmObject,
 
 		static void				PostLoad				(void);
 
-		static CallROMType		HandleSystemCall		(const SystemCallContext&);
+		static Bool				GetSystemCallContext	(emuptr pc,
+														 SystemCallContext&,
+														 HeadpatchProc& hp,
+														 TailpatchProc& tp);
+		static void				FlushSystemCallCache	(void);
+		static void				GetSystemCallCacheStats	(uint64& hits, uint64& misses);
+
+		static CallROMType		HandleSystemCall		(const SystemCallContext&,
+														 HeadpatchProc hp,
+														 TailpatchProc tp);
 
 		static void				HandleInstructionBreak	(void);
 		static void				InstallInstructionBreaks(void);
@@ -202,7 +202,10 @@ CallROMType MemMgrHeadpatch::MemHandleFree (void)
 	::PrvRememberHeapAndPtr (heap, (emuptr)(uintptr_t) (MemHandle) h);
 
 	// In case this chunk contained a stack, forget all references
-	// to that stack (or those stacks).
+	// to that stack (or those stacks).  Also remember the chunk, as
+	// the tailpatch can't get to it through the freed handle.
+
+	EmPatchState::fgData.fFreedChunkHdr = EmMemNULL;
 
 	if (heap)
 	{
@@ -210,6 +213,8 @@ CallROMType MemMgrHeadpatch::MemHandleFree (void)
 		if (chunk)
 		{
 			EmPalmOS::ForgetStacksIn (chunk->BodyStart (), chunk->BodySize ());
+
+			EmPatchState::fgData.fFreedChunkHdr = chunk->HeaderStart ();
 		}
 	}
 
@@ -423,7 +428,7 @@ void MemMgrTailpatch::MemChunkFree (void)
 	EmPalmHeap*	heap = ::PrvGetRememberedHeap ((emuptr)(uintptr_t)(MemPtr) p);
 
 	EmPalmChunkList	delta;
-	EmPalmHeap::MemChunkFree (heap, &delta);
+	EmPalmHeap::MemChunkFree (heap, p, &delta);
 	MetaMemory::Resync (delta);
 
 	{
@@ -559,7 +564,7 @@ void MemMgrTailpatch::MemHandleFree (void)
 	EmPalmHeap*	heap = ::PrvGetRememberedHeap ((emuptr)(uintptr_t) (MemHandle) h);
 
 	EmPalmChunkList	delta;
-	EmPalmHeap::MemHandleFree (heap, &delta);
+	EmPalmHeap::MemHandleFree (heap, h, EmPatchState::fgData.fFreedChunkHdr, &delta);
 	MetaMemory::Resync (delta);
 
 	EmPatchState::ExitMemMgr ("MemHandleFree");
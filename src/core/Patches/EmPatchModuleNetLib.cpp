@@ -1247,9 +1247,19 @@ CallROMType NetLibHeadpatch::NetLibSocketAccept (void)
 	// Get the stack-based parameters.
 	CALLED_GET_PARAM_VAL (UInt16, libRefNum);
 	CALLED_GET_PARAM_VAL (NetSocketRef, socket);
+	CALLED_GET_PARAM_VAL (Int32, timeout);
+
+	// If the host isn't ready, have the call made again later rather than
+	// blocking here.  Do this before marshaling any buffers.
+	Int32	hostTimeout = timeout;
+	if (Platform_NetLib::Redirecting () &&
+		Platform_NetLib::MustWait (libRefNum, socket, false, hostTimeout))
+	{
+		return kRetryCall;
+	}
+
 	CALLED_GET_PARAM_REF (NetSocketAddrType, sockAddrP, Marshal::kOutput);
 	CALLED_GET_PARAM_REF (Int16, addrLenP, Marshal::kInOut);
-	CALLED_GET_PARAM_VAL (Int32, timeout);
 	CALLED_GET_PARAM_REF (Err, errP, Marshal::kOutput);
 
 	// Examine the parameters
@@ -1263,7 +1273,7 @@ CallROMType NetLibHeadpatch::NetLibSocketAccept (void)
 
 		// Call the host function.
 		Int16	result = Platform_NetLib::SocketAccept (libRefNum,
-			socket, sockAddrP, addrLenP, timeout, errP);
+			socket, sockAddrP, addrLenP, hostTimeout, errP);
 		PUT_RESULT_VAL (Int16, result);
 
 		// Return any pass-by-reference values.
@@ -1416,9 +1426,19 @@ CallROMType NetLibHeadpatch::NetLibSendPB (void)
 	// Get the stack-based parameters.
 	CALLED_GET_PARAM_VAL (UInt16, libRefNum);
 	CALLED_GET_PARAM_VAL (NetSocketRef, socket);
+	CALLED_GET_PARAM_VAL (Int32, timeout);
+
+	// If the host isn't ready, have the call made again later rather than
+	// blocking here.  Do this before marshaling any buffers.
+	Int32	hostTimeout = timeout;
+	if (Platform_NetLib::Redirecting () &&
+		Platform_NetLib::MustWait (libRefNum, socket, true, hostTimeout))
+	{
+		return kRetryCall;
+	}
+
 	CALLED_GET_PARAM_REF (NetIOParamType, pbP, Marshal::kInput);
 	CALLED_GET_PARAM_VAL (UInt16, flags);
-	CALLED_GET_PARAM_VAL (Int32, timeout);
 	CALLED_GET_PARAM_REF (Err, errP, Marshal::kOutput);
 
 	// Examine the parameters
@@ -1432,7 +1452,7 @@ CallROMType NetLibHeadpatch::NetLibSendPB (void)
 
 		// Call the host function.
 		Int16	result = Platform_NetLib::SendPB (libRefNum,
-			socket, pbP, flags, timeout, errP);
+			socket, pbP, flags, hostTimeout, errP);
 		PUT_RESULT_VAL (Int16, result);
 
 		// Return any pass-by-reference values.
@@ -1499,11 +1519,21 @@ CallROMType NetLibHeadpatch::NetLibSend (void)
 	// Get the stack-based parameters.
 	CALLED_GET_PARAM_VAL (UInt16, libRefNum);
 	CALLED_GET_PARAM_VAL (NetSocketRef, socket);
+	CALLED_GET_PARAM_VAL (Int32, timeout);
+
+	// If the host isn't ready, have the call made again later rather than
+	// blocking here.  Do this before marshaling any buffers.
+	Int32	hostTimeout = timeout;
+	if (Platform_NetLib::Redirecting () &&
+		Platform_NetLib::MustWait (libRefNum, socket, true, hostTimeout))
+	{
+		return kRetryCall;
+	}
+
 	CALLED_GET_PARAM_VAL (UInt16, bufLen);
 	CALLED_GET_PARAM_VAL (UInt16, flags);
 	CALLED_GET_PARAM_REF (NetSocketAddrType, toAddrP, Marshal::kInput);
 	CALLED_GET_PARAM_VAL (UInt16, toLen);
-	CALLED_GET_PARAM_VAL (Int32, timeout);
 	CALLED_GET_PARAM_REF (Err, errP, Marshal::kOutput);
 
 	CALLED_GET_PARAM_PTR (void, bufP, bufLen, Marshal::kInput);
@@ -1523,7 +1553,7 @@ CallROMType NetLibHeadpatch::NetLibSend (void)
 
 		// Call the host function.
 		Int16	result = Platform_NetLib::Send (libRefNum, socket,
-			bufP, bufLen, flags, toAddrP, toLen, timeout, errP);
+			bufP, bufLen, flags, toAddrP, toLen, hostTimeout, errP);
 		PUT_RESULT_VAL (Int16, result);
 
 		// Return any pass-by-reference values.
@@ -1595,9 +1625,19 @@ CallROMType NetLibHeadpatch::NetLibReceivePB (void)
 	// Get the stack-based parameters.
 	CALLED_GET_PARAM_VAL (UInt16, libRefNum);
 	CALLED_GET_PARAM_VAL (NetSocketRef, socket);
+	CALLED_GET_PARAM_VAL (Int32, timeout);
+
+	// If the host isn't ready, have the call made again later rather than
+	// blocking here.  Do this before marshaling any buffers.
+	Int32	hostTimeout = timeout;
+	if (Platform_NetLib::Redirecting () &&
+		Platform_NetLib::MustWait (libRefNum, socket, false, hostTimeout))
+	{
+		return kRetryCall;
+	}
+
 	CALLED_GET_PARAM_REF (NetIOParamType, pbP, Marshal::kInOut);
 	CALLED_GET_PARAM_VAL (UInt16, flags);
-	CALLED_GET_PARAM_VAL (Int32, timeout);
 	CALLED_GET_PARAM_REF (Err, errP, Marshal::kOutput);
 
 	// Examine the parameters
@@ -1612,7 +1652,7 @@ CallROMType NetLibHeadpatch::NetLibReceivePB (void)
 
 		// Call the host function.
 		Int16	result = Platform_NetLib::ReceivePB (libRefNum,
-			socket, pbP, flags, timeout, errP);
+			socket, pbP, flags, hostTimeout, errP);
 		PUT_RESULT_VAL (Int16, result);
 
 		// Return any pass-by-reference values.
@@ -1679,11 +1719,21 @@ CallROMType NetLibHeadpatch::NetLibReceive (void)
 	// Get the stack-based parameters.
 	CALLED_GET_PARAM_VAL (UInt16, libRefNum);
 	CALLED_GET_PARAM_VAL (NetSocketRef, socket);
+	CALLED_GET_PARAM_VAL (Int32, timeout);
+
+	// If the host isn't ready, have the call made again later rather than
+	// blocking here.  Do this before marshaling any buffers.
+	Int32	hostTimeout = timeout;
+	if (Platform_NetLib::Redirecting () &&
+		Platform_NetLib::MustWait (libRefNum, socket, false, hostTimeout))
+	{
+		return kRetryCall;
+	}
+
 	CALLED_GET_PARAM_VAL (UInt16, bufLen);
 	CALLED_GET_PARAM_VAL (UInt16, flags);
 	CALLED_GET_PARAM_REF (NetSocketAddrType, fromAddrP, Marshal::kOutput);
 	CALLED_GET_PARAM_REF (UInt16, fromLenP, Marshal::kInOut);
-	CALLED_GET_PARAM_VAL (Int32, timeout);
 	CALLED_GET_PARAM_REF (Err, errP, Marshal::kOutput);
 
 	CALLED_GET_PARAM_PTR (void, bufP, bufLen, Marshal::kInOut);
@@ -1703,7 +1753,7 @@ CallROMType NetLibHeadpatch::NetLibReceive (void)
 
 		// Call the host function.
 		Int16	result = Platform_NetLib::Receive (libRefNum,
-			socket, bufP, bufLen, flags, fromAddrP, fromLenP, timeout, errP);
+			socket, bufP, bufLen, flags, fromAddrP, fromLenP, hostTimeout, errP);
 		PUT_RESULT_VAL (Int16, result);
 
 		// Return any pass-by-reference values.
@@ -1783,12 +1833,22 @@ CallROMType NetLibHeadpatch::NetLibDmReceive (void)
 	// Get the stack-based parameters.
 	CALLED_GET_PARAM_VAL (UInt16, libRefNum);
 	CALLED_GET_PARAM_VAL (NetSocketRef, socket);
+	CALLED_GET_PARAM_VAL (Int32, timeout);
+
+	// If the host isn't ready, have the call made again later rather than
+	// blocking here.  Do this before marshaling any buffers.
+	Int32	hostTimeout = timeout;
+	if (Platform_NetLib::Redirecting () &&
+		Platform_NetLib::MustWait (libRefNum, socket, false, hostTimeout))
+	{
+		return kRetryCall;
+	}
+
 	CALLED_GET_PARAM_VAL (UInt32, recordOffset);
 	CALLED_GET_PARAM_VAL (UInt16, rcvLen);
 	CALLED_GET_PARAM_VAL (UInt16, flags);
 	CALLED_GET_PARAM_REF (NetSocketAddrType, fromAddrP, Marshal::kOutput);
 	CALLED_GET_PARAM_REF (UInt16, fromLenP, Marshal::kInOut);
-	CALLED_GET_PARAM_VAL (Int32, timeout);
 	CALLED_GET_PARAM_REF (Err, errP, Marshal::kOutput);
 
 	CALLED_GET_PARAM_PTR (void, recordP, rcvLen + recordOffset, Marshal::kInOut);
@@ -1802,7 +1862,7 @@ CallROMType NetLibHeadpatch::NetLibDmReceive (void)
 		// Call the host function.
 		Int16	result = Platform_NetLib::DmReceive (libRefNum,
 			socket, recordP, recordOffset, rcvLen, flags,
-			fromAddrP, fromLenP, timeout, errP);
+			fromAddrP, fromLenP, hostTimeout, errP);
 		PUT_RESULT_VAL (Int16, result);
 
 		// Return any pass-by-reference values.
@@ -1878,10 +1938,34 @@ CallROMType NetLibHeadpatch::NetLibSelect (void)
 	// Get the stack-based parameters.
 	CALLED_GET_PARAM_VAL (UInt16, libRefNum);
 	CALLED_GET_PARAM_VAL (UInt16, width);
+	CALLED_GET_PARAM_VAL (Int32, timeout);
+
+	// If the host isn't ready, have the call made again later rather than
+	// blocking here.  Do this before marshaling anything; the descriptor
+	// sets are peeked at directly.
+	Int32	hostTimeout = timeout;
+	if (Platform_NetLib::Redirecting ())
+	{
+		ParamVal<emuptr>	readFDsP (sub, "readFDs");
+		ParamVal<emuptr>	writeFDsP (sub, "writeFDs");
+		ParamVal<emuptr>	exceptFDsP (sub, "exceptFDs");
+
+		NetFDSetType	readSet		= readFDsP ? EmMemGet32 (readFDsP) : 0;
+		NetFDSetType	writeSet	= writeFDsP ? EmMemGet32 (writeFDsP) : 0;
+		NetFDSetType	exceptSet	= exceptFDsP ? EmMemGet32 (exceptFDsP) : 0;
+
+		if (Platform_NetLib::MustWaitForSelect (libRefNum, width,
+				readFDsP ? &readSet : NULL,
+				writeFDsP ? &writeSet : NULL,
+				exceptFDsP ? &exceptSet : NULL, hostTimeout))
+		{
+			return kRetryCall;
+		}
+	}
+
 	CALLED_GET_PARAM_REF (NetFDSetType, readFDs, Marshal::kInOut);
 	CALLED_GET_PARAM_REF (NetFDSetType, writeFDs, Marshal::kInOut);
 	CALLED_GET_PARAM_REF (NetFDSetType, exceptFDs, Marshal::kInOut);
-	CALLED_GET_PARAM_VAL (Int32, timeout);
 	CALLED_GET_PARAM_REF (Err, errP, Marshal::kOutput);
 
 	// Examine the parameters
@@ -1897,7 +1981,7 @@ CallROMType NetLibHeadpatch::NetLibSelect (void)
 
 		// Call the host function.
 		Int16	result = Platform_NetLib::Select (libRefNum,
-			width, readFDs, writeFDs, exceptFDs, timeout, errP);
+			width, readFDs, writeFDs, exceptFDs, hostTimeout, errP);
 		PUT_RESULT_VAL (Int16, result);
 
 		// Return any pass-by-reference values.
@@ -2021,8 +2105,18 @@ CallROMType NetLibHeadpatch::NetLibGetHostByName (void)
 	// Get the stack-based parameters.
 	CALLED_GET_PARAM_VAL (UInt16, libRefNum);
 	CALLED_GET_PARAM_STR (Char, nameP);
-	CALLED_GET_PARAM_REF (NetHostInfoBufType, bufP, Marshal::kOutput);
 	CALLED_GET_PARAM_VAL (Int32, timeout);
+
+	// If the host isn't ready, have the call made again later rather than
+	// blocking here.  Do this before marshaling any buffers.
+	Int32	hostTimeout = timeout;
+	if (Platform_NetLib::Redirecting () &&
+		Platform_NetLib::MustWaitForHostByName (libRefNum, nameP, hostTimeout))
+	{
+		return kRetryCall;
+	}
+
+	CALLED_GET_PARAM_REF (NetHostInfoBufType, bufP, Marshal::kOutput);
 	CALLED_GET_PARAM_REF (Err, errP, Marshal::kOutput);
 
 	// Examine the parameters
@@ -2035,7 +2129,7 @@ CallROMType NetLibHeadpatch::NetLibGetHostByName (void)
 
 		// Call the host function.
 		NetHostInfoPtr	p = Platform_NetLib::GetHostByName (libRefNum,
-			nameP, bufP, timeout, errP);
+			nameP, bufP, hostTimeout, errP);
 		emuptr	result = p ? (emuptr) bufP + offsetof (NetHostInfoBufType, hostInfo) : EmMemNULL;
 		PUT_RESULT_VAL (emuptr, result);
 
@@ -161,6 +161,11 @@ ProtoPatchTableEntry	gProtoSysPatchTable[] =
 	{sysTrapWinAddWindow,			SysHeadpatch::UnmarkUIObjects,			SysTailpatch::MarkUIObjects},
 	{sysTrapWinRemoveWindow,		SysHeadpatch::UnmarkUIObjects,			SysTailpatch::MarkUIObjects},
 
+	{sysTrapSysLibInstall,			NULL,									SysTailpatch::FlushSystemCallCache},
+	{sysTrapSysLibLoad,				NULL,									SysTailpatch::FlushSystemCallCache},
+	{sysTrapSysLibRemove,			NULL,									SysTailpatch::FlushSystemCallCache},
+	{sysTrapSysSetTrapAddress,		NULL,									SysTailpatch::FlushSystemCallCache},
+
 	{0, 							NULL,									NULL}
 };
 
@@ -2207,6 +2212,26 @@ void SysTailpatch::MarkUIObjects (void)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	SysTailpatch::FlushSystemCallCache
+ *
+ * DESCRIPTION:	The trap table or library table may have changed, so
+ *				the system calls EmPatchMgr has resolved may now go
+ *				somewhere else.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void SysTailpatch::FlushSystemCallCache (void)
+{
+	EmPatchMgr::FlushSystemCallCache ();
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	SysTailpatch::BmpCreate
@@ -72,6 +72,7 @@ class SysTailpatch
 {
 	public:
 		static void		MarkUIObjects			(void); // 	CtlNewControl, FldNewField, FrmInitForm, FrmNewBitmap, FrmNewGadget, FrmNewGsi, FrmNewLabel, LstNewList, WinAddWindow, WinRemoveWindow
+		static void		FlushSystemCallCache	(void); //	SysLibInstall, SysLibLoad, SysLibRemove, SysSetTrapAddress
 
 		static void		BmpCreate				(void);
 		static void		BmpDelete				(void);
@@ -18,6 +18,8 @@
 #include "EmPatchIf.h"			// HeadpatchProc, TailpatchProc, IEmPatchModule
 #include "EmStructs.h"			// SystemCallContext
 
+#include <unordered_map>		// unordered_map
+
 
 // ======================================================================
 // At compile time, the list of functions we want to head- and tailpatch
@@ -80,7 +82,8 @@ typedef std::vector<InstalledLibPatchEntry> PatchedLibIndex;
 // ===========================================================================
 //		� TailpatchType
 // ===========================================================================
-// Structure used to hold tail-patch information.
+// Structure used to hold tail-patch information.  Installed tailpatches
+// are indexed by the return address (fContext.fNextPC) at which they fire.
 
 struct TailpatchType
 {
@@ -89,6 +92,24 @@ struct TailpatchType
 	TailpatchProc		fTailpatch;
 };
 
-typedef std::vector<TailpatchType>		TailPatchIndex;
+typedef std::unordered_map<emuptr, TailpatchType>	TailPatchIndex;
+
+
+// ===========================================================================
+//		� SystemCallCacheEntry
+// ===========================================================================
+// What EmPatchMgr::GetSystemCallContext remembers about a system call:
+// the function's address and its patches.  Indexed by trap word and
+// refNum (or D2, for the few system functions that sub-dispatch on it).
+
+struct SystemCallCacheEntry
+{
+	emuptr				fDestPC1;
+	emuptr				fDestPC2;
+	HeadpatchProc		fHeadpatch;
+	TailpatchProc		fTailpatch;
+};
+
+typedef std::unordered_map<uint64, SystemCallCacheEntry>	SystemCallCache;
 
 #endif // EmPatchModuleTypes_h
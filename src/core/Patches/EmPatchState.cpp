@@ -65,6 +65,7 @@ Err EmPatchState::Reset (void)
 	fgData.fMemSemaphoreReserveTime	= 0;
 	fgData.fResizeOrigSize 			= 0;
 	fgData.fHeapID 					= 0;
+	fgData.fFreedChunkHdr			= EmMemNULL;
 
 	fgData.fRememberedHeaps.clear ();
 	fgData.fTrackedChunks.clear ();
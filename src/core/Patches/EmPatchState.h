@@ -92,7 +92,8 @@ struct EmPatchStateData
 			fMemSemaphoreCount (0),
 			fMemSemaphoreReserveTime (0),
 			fResizeOrigSize (0),
-			fHeapID (0)
+			fHeapID (0),
+			fFreedChunkHdr (EmMemNULL)
 		{
 		}
 
@@ -124,6 +125,7 @@ struct EmPatchStateData
 
 		uint32					fResizeOrigSize;
 		uint16 					fHeapID;
+		emuptr					fFreedChunkHdr;
 
 		EmHeapMap				fRememberedHeaps;
 
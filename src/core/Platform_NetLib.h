@@ -95,6 +95,21 @@ class Platform_NetLib
 		static Int16			Select(UInt16 libRefNum, UInt16 width, NetFDSetType* readFDs, 
 									NetFDSetType* writeFDs, NetFDSetType* exceptFDs,
 									Int32 timeout, Err* errP);
+
+		// Called by the NetLib head patches before making a call that could
+		// block.  If these return true, the host socket isn't ready yet and
+		// the patch should retry the system call later instead of blocking
+		// the CPU thread.  Timeouts are measured in emulated ticks; if one
+		// expires, "timeout" is set to zero so that the call that follows
+		// reports it.
+
+		static Bool				MustWait (UInt16 libRefNum, NetSocketRef socket,
+									Bool forWrite, Int32& timeout);
+		static Bool				MustWaitForSelect (UInt16 libRefNum, UInt16 width,
+									NetFDSetType* readFDs, NetFDSetType* writeFDs,
+									NetFDSetType* exceptFDs, Int32& timeout);
+		static Bool				MustWaitForHostByName (UInt16 libRefNum, Char* nameP,
+									Int32& timeout);
 };
 
 #endif	// _PLATFORM_NETLIB_H_
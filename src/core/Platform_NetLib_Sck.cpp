@@ -16,11 +16,19 @@
 
 #include "PreferenceMgr.h"		// Preference
 #include "Byteswapping.h"		// Canonical
+#include "EmCPU68K.h"			// gCPU68K, e68KRegID_SR
+#include "EmLowMem.h"			// EmLowMem_GetGlobal
+#include "EmSession.h"			// gSession, IsNested
 #include "Logging.h"			// LogAppendMsg
 #include "Miscellaneous.h"		// StMemory
 #include "Platform.h"			// AllocateMemory
 #include "ROMStubs.h"			// NetLibConfigMakeActive
 
+#include "omnithread.h"			// omni_mutex, omni_thread
+
+#include <string>				// string
+#include <vector>				// vector
+
 
 #if PLATFORM_WINDOWS
 #include <winsock2.h>
@@ -54,6 +62,12 @@
 #include <unistd.h>				// close
 #endif
 
+#if PLATFORM_UNIX && defined(__linux__)
+#include <sys/epoll.h>			// epoll_create1, epoll_ctl, epoll_wait
+#include <fcntl.h>				// O_NONBLOCK, O_CLOEXEC
+#define HAVE_EPOLL	1
+#endif
+
 #if defined(__svr4__)
 #include <sys/filio.h>			// FIONBIO
 
@@ -186,6 +200,107 @@ static Err		PrvGetTranslatedHError (void);
 #endif
 static Err		PrvTranslateError (uint32 err);
 
+static Bool		PrvCanWait			(Int32 timeout);
+static Bool		PrvWaitPending		(NetSocketRef sRef, int what, Bool ready, Int32& timeout);
+static void		PrvForgetPending	(NetSocketRef sRef);
+static Bool		PrvSocketReady		(NetSocketRef sRef, int what);
+static Bool		PrvPollSocket		(SOCKET s, int what);
+
+#if HAVE_EPOLL
+static Bool		PrvReactorStart		(void);
+static void		PrvReactorStop		(void);
+static void		PrvReactorForget	(NetSocketRef sRef, SOCKET s);
+static void		PrvReactorThread	(void*);
+#endif
+
+#if PLATFORM_UNIX
+static void		PrvLookupStart		(const char* name);
+static void		PrvLookupStop		(void);
+static void		PrvLookupThread		(void*);
+#endif
+
+
+// Conditions a NetLib call can wait for.
+
+enum
+{
+	kWaitRead		= 0x01,
+	kWaitWrite		= 0x02,
+	kWaitExcept		= 0x04,
+	kWaitSelect		= 0x08,
+	kWaitLookup		= 0x10
+};
+
+
+// NetLib calls that are waiting for a host socket.  The NetLib trap is
+// re-executed until the socket is ready or the timeout expires.  The
+// caller's stack pointer tells a retry apart from a new call.
+
+struct PrvPendingWait
+{
+	NetSocketRef	fSocket;
+	int				fWhat;
+	emuptr			fSP;
+	uint32			fStartTicks;
+};
+
+typedef std::vector<PrvPendingWait>	PrvPendingWaitList;
+
+static PrvPendingWaitList	gPendingWaits;
+
+
+#if HAVE_EPOLL
+
+// The reactor thread waits on an epoll set for the sockets that NetLib
+// calls are waiting on.  Sockets are armed one-shot; when one fires, the
+// reactor clears its fArmed mask and the next retry of the call goes
+// ahead.  Until then, retries don't have to make any system calls.
+
+struct PrvReactorSocket
+{
+	int		fArmed;
+	Bool	fRegistered;
+};
+
+static omni_mutex			gReactorMutex;
+static omni_thread*			gReactorThread;
+static PrvReactorSocket		gReactorSockets[netMaxNumSockets];
+static int					gReactorEpoll = -1;
+static int					gReactorPipe[2] = { -1, -1 };
+static volatile Bool		gReactorTimeToQuit;
+
+#endif
+
+
+#if PLATFORM_UNIX
+
+// NetLibGetHostByName lookups are made with getaddrinfo on a worker thread.
+// Only the most recently requested name is kept.
+
+enum
+{
+	kLookupQueued,
+	kLookupRunning,
+	kLookupDone
+};
+
+struct PrvHostLookup
+{
+	std::string				fName;
+	int						fState;
+	int						fError;			// getaddrinfo result
+	std::string				fCanonName;
+	std::vector<in_addr>	fAddrs;
+};
+
+static omni_mutex			gLookupMutex;
+static omni_condition		gLookupCondition (&gLookupMutex);
+static omni_thread*			gLookupThread;
+static PrvHostLookup*		gHostLookup;
+static Bool					gLookupTimeToQuit;
+
+#endif
+
 
 
 /***********************************************************************
@@ -271,6 +386,16 @@ void Platform_NetLib::Load		(SessionFile&)
 
 void Platform_NetLib::Dispose		(void)
 {
+#if HAVE_EPOLL
+	PrvReactorStop ();
+#endif
+
+#if PLATFORM_UNIX
+	PrvLookupStop ();
+#endif
+
+	gPendingWaits.clear ();
+
 	for (int ii = 0; ii < netMaxNumSockets; ++ii)
 	{
 		if (gSockets[ii] != INVALID_SOCKET)
@@ -588,6 +713,12 @@ Int16 Platform_NetLib::SocketClose(UInt16 libRefNum,
 		return -1;
 	}
 
+	PrvForgetPending (sRef);
+
+#if HAVE_EPOLL
+	PrvReactorForget (sRef, s);
+#endif
+
 	int	result = closesocket (s);
 
 	// Drop our reference to this socket.
@@ -1111,9 +1242,8 @@ Int16 Platform_NetLib::SendPB(UInt16 libRefNum,
 		// Convert ticks to microseconds.
 
 		const uint64	kMicrosecondsPerSecond	= 1000000;
-		const uint64	kSysTicksPerSecond		= 100;	// !!! Should really call SysTicksPerSecond.
 
-		uint64	usecs = timeout * kMicrosecondsPerSecond / kSysTicksPerSecond;
+		uint64	usecs = timeout * kMicrosecondsPerSecond / sysTicksPerSecond;
 
 		hostTimeout.tv_sec = usecs / kMicrosecondsPerSecond;
 		hostTimeout.tv_usec = usecs % kMicrosecondsPerSecond;
@@ -1281,9 +1411,8 @@ Int16 Platform_NetLib::ReceivePB(UInt16 libRefNum,
 		// Convert ticks to microseconds.
 
 		const uint64	kMicrosecondsPerSecond	= 1000000;
-		const uint64	kSysTicksPerSecond		= 100;	// !!! Should really call SysTicksPerSecond.
 
-		uint64	usecs = timeout * kMicrosecondsPerSecond / kSysTicksPerSecond;
+		uint64	usecs = timeout * kMicrosecondsPerSecond / sysTicksPerSecond;
 
 		hostTimeout.tv_sec = usecs / kMicrosecondsPerSecond;
 		hostTimeout.tv_usec = usecs % kMicrosecondsPerSecond;
@@ -1481,7 +1610,68 @@ NetHostInfoPtr Platform_NetLib::GetHostByName(UInt16 libRefNum,
 												Err* errP)
 {
 	UNUSED_PARAM(libRefNum)
+
+#if PLATFORM_UNIX
+	// Use the results of a lookup started by MustWaitForHostByName, if any.
+
+	{
+		omni_mutex_lock	lock (gLookupMutex);
+
+		if (gHostLookup && gHostLookup->fName == nameP)
+		{
+			if (gHostLookup->fState == kLookupDone)
+			{
+				PrvHostLookup*	lookup = gHostLookup;
+				gHostLookup = NULL;
+
+				Err	err = errNone;
+
+				if (lookup->fError == EAI_NONAME)
+					err = netErrDNSNonexistantName;
+				else if (lookup->fError == EAI_AGAIN)
+					err = netErrDNSTimeout;
+				else if (lookup->fError != 0 || lookup->fAddrs.empty ())
+					err = netErrDNSServerFailure;
+
+				if (!err)
+				{
+					std::vector<char*>	addrList;
+					for (size_t ii = 0; ii < lookup->fAddrs.size (); ++ii)
+						addrList.push_back ((char*) &lookup->fAddrs[ii]);
+					addrList.push_back (NULL);
+
+					char*	aliasList[] = { NULL };
+
+					hostent	hostEnt;
+					hostEnt.h_name		= (char*) lookup->fCanonName.c_str ();
+					hostEnt.h_aliases	= aliasList;
+					hostEnt.h_addrtype	= AF_INET;
+					hostEnt.h_length	= sizeof (in_addr);
+					hostEnt.h_addr_list	= &addrList[0];
+
+					if (!SocketsToNetLibHostEnt (hostEnt, *bufP))
+						err = netErrParamErr;
+				}
+
+				delete lookup;
+
+				*errP = err;
+				return err ? NULL : &(bufP->hostInfo);
+			}
+
+			// Still looking.  Don't block if the caller didn't want to
+			// wait; otherwise (say, a nested call) do it the old way.
+
+			if (timeout == 0)
+			{
+				*errP = netErrDNSTimeout;
+				return NULL;
+			}
+		}
+	}
+#else
 	UNUSED_PARAM(timeout)
+#endif
 
 	hostent*	pHostEnt = gethostbyname (nameP);
 
@@ -1632,10 +1822,10 @@ Int16 Platform_NetLib::Select(UInt16 libRefNum,
 	timeval *hTp = NULL;
 	if (netTimeout >= 0)
 	{
-		// Convert ticks (100ths of a second) to microseconds.
+		// Convert ticks to microseconds.
 
-		hostTimeout.tv_sec = netTimeout / 100;
-		hostTimeout.tv_usec = (netTimeout % 100) * 10000;
+		hostTimeout.tv_sec = netTimeout / sysTicksPerSecond;
+		hostTimeout.tv_usec = (netTimeout % sysTicksPerSecond) * (1000000 / sysTicksPerSecond);
 		hTp = &hostTimeout;
 	}
 
@@ -1661,6 +1851,732 @@ Int16 Platform_NetLib::Select(UInt16 libRefNum,
 }
 
 
+//--------------------------------------------------
+// Non-blocking support
+//--------------------------------------------------
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform_NetLib::MustWait
+ *
+ * DESCRIPTION:	Determine if a send or receive on the given socket
+ *				would block.  If so, the NetLib call should be retried
+ *				later.
+ *
+ * PARAMETERS:	sRef - the socket to check.
+ *
+ *				forWrite - true if about to send, false if about to
+ *					receive or accept.
+ *
+ *				timeout - the call's timeout, in ticks.  Set to zero
+ *					if it has expired.
+ *
+ * RETURNED:	True if the call should be retried.
+ *
+ ***********************************************************************/
+
+Bool Platform_NetLib::MustWait (UInt16 libRefNum,
+								NetSocketRef sRef,
+								Bool forWrite,
+								Int32& timeout)
+{
+	UNUSED_PARAM(libRefNum)
+
+	if (!PrvCanWait (timeout))
+		return false;
+
+	int		what	= forWrite ? kWaitWrite : kWaitRead;
+	Bool	ready	= PrvSocketReady (sRef, what);
+
+	return PrvWaitPending (sRef, what, ready, timeout);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform_NetLib::MustWaitForSelect
+ *
+ * DESCRIPTION:	Determine if a NetLibSelect call would block.
+ *
+ * PARAMETERS:	width, readFDs, writeFDs, exceptFDs - the parameters
+ *					passed to NetLibSelect.
+ *
+ *				timeout - as for MustWait.
+ *
+ * RETURNED:	True if the call should be retried.
+ *
+ ***********************************************************************/
+
+Bool Platform_NetLib::MustWaitForSelect (UInt16 libRefNum,
+										UInt16 width,
+										NetFDSetType* readFDs,
+										NetFDSetType* writeFDs,
+										NetFDSetType* exceptFDs,
+										Int32& timeout)
+{
+	UNUSED_PARAM(libRefNum)
+
+	if (!PrvCanWait (timeout))
+		return false;
+
+	if (width > netMaxNumSockets)
+	{
+		width = netMaxNumSockets;
+	}
+
+	// Check (and arm) every socket, rather than stopping at the first one
+	// that's ready, so that the reactor is watching all of them.
+
+	Bool	ready = false;
+
+	for (int ii = 0; ii < width; ++ii)
+	{
+		NetSocketRef	sRef = ii + netMinSocketRefNum;
+		int				what = 0;
+
+		if (readFDs && netFDIsSet (sRef, readFDs))
+			what |= kWaitRead;
+
+		if (writeFDs && netFDIsSet (sRef, writeFDs))
+			what |= kWaitWrite;
+
+		if (exceptFDs && netFDIsSet (sRef, exceptFDs))
+			what |= kWaitExcept;
+
+		if (what && PrvSocketReady (sRef, what))
+			ready = true;
+	}
+
+	return PrvWaitPending (0, kWaitSelect, ready, timeout);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform_NetLib::MustWaitForHostByName
+ *
+ * DESCRIPTION:	Start looking up the given host name on a worker
+ *				thread, and determine if the lookup has finished.
+ *				GetHostByName picks up the result.
+ *
+ * PARAMETERS:	nameP - the name to look up.
+ *
+ *				timeout - as for MustWait.
+ *
+ * RETURNED:	True if the call should be retried.
+ *
+ ***********************************************************************/
+
+Bool Platform_NetLib::MustWaitForHostByName (UInt16 libRefNum,
+											Char* nameP,
+											Int32& timeout)
+{
+	UNUSED_PARAM(libRefNum)
+
+#if PLATFORM_UNIX
+	if (!PrvCanWait (timeout))
+		return false;
+
+	omni_mutex_lock	lock (gLookupMutex);
+
+	Bool	ready = false;
+
+	if (gHostLookup && gHostLookup->fName == nameP)
+	{
+		ready = gHostLookup->fState == kLookupDone;
+	}
+	else
+	{
+		PrvLookupStart (nameP);
+	}
+
+	return PrvWaitPending (0, kWaitLookup, ready, timeout);
+#else
+	UNUSED_PARAM(nameP)
+	UNUSED_PARAM(timeout)
+
+	return false;
+#endif
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvCanWait
+ *
+ * DESCRIPTION:	Determine if a NetLib call with the given timeout can
+ *				be retried rather than blocking.  Polls never wait.
+ *				Nested calls and calls made with interrupts masked
+ *				can't, since emulated time doesn't move forward for
+ *				them.
+ *
+ * PARAMETERS:	timeout - the call's timeout, in ticks.
+ *
+ * RETURNED:	True if the call can be retried.
+ *
+ ***********************************************************************/
+
+Bool PrvCanWait (Int32 timeout)
+{
+	if (timeout == 0)
+		return false;
+
+	if (gSession && gSession->IsNested ())
+		return false;
+
+	if (gCPU68K && ((gCPU68K->GetRegister (e68KRegID_SR) >> 8) & 7) != 0)
+		return false;
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvWaitPending
+ *
+ * DESCRIPTION:	Track how long a NetLib call has been waiting.
+ *
+ * PARAMETERS:	sRef, what - identify the condition being waited for.
+ *
+ *				ready - true if the condition has been met.
+ *
+ *				timeout - the call's timeout, in ticks.  Set to zero
+ *					if it has expired.
+ *
+ * RETURNED:	True if the call should be retried.
+ *
+ ***********************************************************************/
+
+Bool PrvWaitPending (NetSocketRef sRef, int what, Bool ready, Int32& timeout)
+{
+	emuptr	sp	= gCPU->GetSP ();
+	uint32	now	= EmLowMem_GetGlobal (hwrCurTicks);
+
+	PrvPendingWaitList::iterator	iter = gPendingWaits.begin ();
+	while (iter != gPendingWaits.end ())
+	{
+		if (iter->fSocket == sRef && iter->fWhat == what)
+			break;
+
+		++iter;
+	}
+
+	// A record left behind by a call that was abandoned (say, the
+	// application quit while waiting) doesn't count.
+
+	if (iter != gPendingWaits.end () && iter->fSP != sp)
+	{
+		gPendingWaits.erase (iter);
+		iter = gPendingWaits.end ();
+	}
+
+	if (ready)
+	{
+		if (iter != gPendingWaits.end ())
+			gPendingWaits.erase (iter);
+
+		return false;
+	}
+
+	if (iter == gPendingWaits.end ())
+	{
+		PrvPendingWait	wait;
+
+		wait.fSocket		= sRef;
+		wait.fWhat			= what;
+		wait.fSP			= sp;
+		wait.fStartTicks	= now;
+
+		gPendingWaits.push_back (wait);
+
+		return true;
+	}
+
+	if (timeout > 0 && now - iter->fStartTicks >= (uint32) timeout)
+	{
+		PRINTF ("\tTimed out after %ld ticks", (long) (now - iter->fStartTicks));
+
+		gPendingWaits.erase (iter);
+		timeout = 0;
+
+		return false;
+	}
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvForgetPending
+ *
+ * DESCRIPTION:	Drop any waits on the given socket.
+ *
+ * PARAMETERS:	sRef - the socket being closed.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void PrvForgetPending (NetSocketRef sRef)
+{
+	PrvPendingWaitList::iterator	iter = gPendingWaits.begin ();
+	while (iter != gPendingWaits.end ())
+	{
+		if (iter->fSocket == sRef)
+			iter = gPendingWaits.erase (iter);
+		else
+			++iter;
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvSocketReady
+ *
+ * DESCRIPTION:	Determine if a socket is ready for the given
+ *				operations.  If the reactor is available and the
+ *				socket isn't ready, arm the reactor so that later
+ *				checks don't need to make a system call.
+ *
+ * PARAMETERS:	sRef - the socket to check.
+ *
+ *				what - kWaitRead, kWaitWrite, and/or kWaitExcept.
+ *
+ * RETURNED:	True if ready.  Bad sockets and sockets with errors
+ *				are "ready" so that the NetLib call reports the error.
+ *
+ ***********************************************************************/
+
+Bool PrvSocketReady (NetSocketRef sRef, int what)
+{
+	SOCKET	s;
+	if (!NetLibToSocketsRef (sRef, s))
+		return true;
+
+#if HAVE_EPOLL
+	if (PrvReactorStart ())
+	{
+		omni_mutex_lock		lock (gReactorMutex);
+		PrvReactorSocket&	rs = gReactorSockets[sRef - netMinSocketRefNum];
+
+		// Still armed: nothing has happened on the socket yet.
+
+		if ((rs.fArmed & what) == what)
+			return false;
+
+		if (PrvPollSocket (s, what))
+			return true;
+
+		epoll_event	event;
+		event.events	= EPOLLONESHOT;
+		event.data.u32	= sRef - netMinSocketRefNum;
+
+		int	armed = rs.fArmed | what;
+
+		if (armed & kWaitRead)
+			event.events |= EPOLLIN;
+
+		if (armed & kWaitWrite)
+			event.events |= EPOLLOUT;
+
+		if (armed & kWaitExcept)
+			event.events |= EPOLLPRI;
+
+		int	op = rs.fRegistered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+
+		if (epoll_ctl (gReactorEpoll, op, s, &event) == 0)
+		{
+			rs.fArmed		= armed;
+			rs.fRegistered	= true;
+		}
+
+		return false;
+	}
+#endif
+
+	return PrvPollSocket (s, what);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvPollSocket
+ *
+ * DESCRIPTION:	Check a socket's readiness without blocking.
+ *
+ * PARAMETERS:	s - the host socket.
+ *
+ *				what - kWaitRead, kWaitWrite, and/or kWaitExcept.
+ *
+ * RETURNED:	True if ready or in error.
+ *
+ ***********************************************************************/
+
+Bool PrvPollSocket (SOCKET s, int what)
+{
+	fd_set	readFDs;
+	fd_set	writeFDs;
+	fd_set	exceptFDs;
+
+	FD_ZERO (&readFDs);
+	FD_ZERO (&writeFDs);
+	FD_ZERO (&exceptFDs);
+
+	if (what & kWaitRead)
+		FD_SET (s, &readFDs);
+
+	if (what & kWaitWrite)
+		FD_SET (s, &writeFDs);
+
+	if (what & kWaitExcept)
+		FD_SET (s, &exceptFDs);
+
+	timeval	hostTimeout = { 0, 0 };
+
+	int	result = select (s + 1, &readFDs, &writeFDs, &exceptFDs, &hostTimeout);
+
+	return result != 0;
+}
+
+
+#if HAVE_EPOLL
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorStart
+ *
+ * DESCRIPTION:	Create the reactor thread if it isn't running yet.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	True if the reactor is running.
+ *
+ ***********************************************************************/
+
+Bool PrvReactorStart (void)
+{
+	if (gReactorThread)
+		return true;
+
+	gReactorEpoll = epoll_create1 (EPOLL_CLOEXEC);
+	if (gReactorEpoll < 0)
+		return false;
+
+	if (pipe2 (gReactorPipe, O_NONBLOCK | O_CLOEXEC) != 0)
+	{
+		close (gReactorEpoll);
+		gReactorEpoll = -1;
+		return false;
+	}
+
+	// The signal pipe wakes the thread up when it's time to quit.
+
+	epoll_event	event;
+	event.events	= EPOLLIN;
+	event.data.u32	= netMaxNumSockets;
+
+	epoll_ctl (gReactorEpoll, EPOLL_CTL_ADD, gReactorPipe[0], &event);
+
+	for (int ii = 0; ii < netMaxNumSockets; ++ii)
+	{
+		gReactorSockets[ii].fArmed		= 0;
+		gReactorSockets[ii].fRegistered	= false;
+	}
+
+	gReactorTimeToQuit = false;
+	gReactorThread = omni_thread::create (PrvReactorThread, NULL);
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorStop
+ *
+ * DESCRIPTION:	Shut down the reactor thread.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void PrvReactorStop (void)
+{
+	if (!gReactorThread)
+		return;
+
+	gReactorTimeToQuit = true;
+
+	// The pipe is non-blocking.  If it's full (EAGAIN), the thread has a
+	// wake-up waiting already, so there's nothing more to do.
+
+	int		dummy = 0;
+	ssize_t	written;
+
+	do
+	{
+		written = write (gReactorPipe[1], &dummy, sizeof (dummy));
+	}
+	while (written < 0 && errno == EINTR);
+
+	(void) written;
+
+	gReactorThread->join (NULL);
+
+	delete gReactorThread;
+	gReactorThread = NULL;
+
+	close (gReactorEpoll);
+	close (gReactorPipe[0]);
+	close (gReactorPipe[1]);
+
+	gReactorEpoll = gReactorPipe[0] = gReactorPipe[1] = -1;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorForget
+ *
+ * DESCRIPTION:	Stop watching a socket that's about to be closed.
+ *
+ * PARAMETERS:	sRef - the NetLib socket.
+ *
+ *				s - the host socket.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void PrvReactorForget (NetSocketRef sRef, SOCKET s)
+{
+	if (!gReactorThread)
+		return;
+
+	omni_mutex_lock		lock (gReactorMutex);
+	PrvReactorSocket&	rs = gReactorSockets[sRef - netMinSocketRefNum];
+
+	if (rs.fRegistered)
+	{
+		epoll_ctl (gReactorEpoll, EPOLL_CTL_DEL, s, NULL);
+	}
+
+	rs.fArmed		= 0;
+	rs.fRegistered	= false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorThread
+ *
+ * DESCRIPTION:	Wait for armed sockets to become ready and disarm them.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void PrvReactorThread (void*)
+{
+	while (!gReactorTimeToQuit)
+	{
+		epoll_event	events[netMaxNumSockets + 1];
+
+		int	count = epoll_wait (gReactorEpoll, events, netMaxNumSockets + 1, -1);
+
+		if (gReactorTimeToQuit)
+			break;
+
+		if (count < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			break;
+		}
+
+		omni_mutex_lock	lock (gReactorMutex);
+
+		for (int ii = 0; ii < count; ++ii)
+		{
+			uint32	index = events[ii].data.u32;
+
+			if (index < netMaxNumSockets)
+			{
+				gReactorSockets[index].fArmed = 0;
+			}
+		}
+	}
+}
+
+#endif	// HAVE_EPOLL
+
+
+#if PLATFORM_UNIX
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvLookupStart
+ *
+ * DESCRIPTION:	Queue up a host name lookup, replacing any previous
+ *				one.  gLookupMutex must be held.
+ *
+ * PARAMETERS:	name - the host name.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void PrvLookupStart (const char* name)
+{
+	// A lookup that's running belongs to the lookup thread, which
+	// deletes it when it sees it's been replaced.
+
+	if (gHostLookup && gHostLookup->fState != kLookupRunning)
+	{
+		delete gHostLookup;
+	}
+
+	gHostLookup = new PrvHostLookup;
+	gHostLookup->fName	= name;
+	gHostLookup->fState	= kLookupQueued;
+	gHostLookup->fError	= 0;
+
+	if (!gLookupThread)
+	{
+		gLookupTimeToQuit = false;
+		gLookupThread = omni_thread::create (PrvLookupThread, NULL);
+	}
+
+	gLookupCondition.signal ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvLookupStop
+ *
+ * DESCRIPTION:	Shut down the lookup thread, waiting for any lookup
+ *				in progress to finish.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void PrvLookupStop (void)
+{
+	if (gLookupThread)
+	{
+		gLookupMutex.lock ();
+		gLookupTimeToQuit = true;
+		gLookupCondition.signal ();
+		gLookupMutex.unlock ();
+
+		gLookupThread->join (NULL);
+
+		delete gLookupThread;
+		gLookupThread = NULL;
+	}
+
+	delete gHostLookup;
+	gHostLookup = NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvLookupThread
+ *
+ * DESCRIPTION:	Look up queued host names.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void PrvLookupThread (void*)
+{
+	omni_mutex_lock	lock (gLookupMutex);
+
+	while (!gLookupTimeToQuit)
+	{
+		if (!gHostLookup || gHostLookup->fState != kLookupQueued)
+		{
+			gLookupCondition.wait ();
+			continue;
+		}
+
+		PrvHostLookup*	lookup = gHostLookup;
+		lookup->fState = kLookupRunning;
+
+		std::string				name (lookup->fName);
+		std::string				canonName (name);
+		std::vector<in_addr>	addrs;
+		int						error;
+
+		{
+			omni_mutex_unlock	unlock (gLookupMutex);
+
+			addrinfo	hints;
+			memset (&hints, 0, sizeof (hints));
+			hints.ai_family		= AF_INET;
+			hints.ai_socktype	= SOCK_STREAM;
+			hints.ai_flags		= AI_CANONNAME;
+
+			addrinfo*	results = NULL;
+
+			error = getaddrinfo (name.c_str (), NULL, &hints, &results);
+
+			if (error == 0)
+			{
+				if (results->ai_canonname)
+				{
+					canonName = results->ai_canonname;
+				}
+
+				for (addrinfo* ai = results; ai; ai = ai->ai_next)
+				{
+					addrs.push_back (((sockaddr_in*) ai->ai_addr)->sin_addr);
+				}
+
+				freeaddrinfo (results);
+			}
+		}
+
+		// If another name was asked for in the meantime, this one's
+		// no longer wanted.
+
+		if (lookup != gHostLookup)
+		{
+			delete lookup;
+			continue;
+		}
+
+		if (canonName.size () > netDNSMaxDomainName)
+		{
+			canonName.resize (netDNSMaxDomainName);
+		}
+
+		lookup->fError		= error;
+		lookup->fCanonName	= canonName;
+		lookup->fAddrs		= addrs;
+		lookup->fState		= kLookupDone;
+	}
+}
+
+#endif	// PLATFORM_UNIX
+
+
 /***********************************************************************
  *
  * FUNCTION:	NetLibToSocketsRef
@@ -412,6 +412,12 @@ extern EmulatorPreferences* gEmuPrefs;
 	DO_TO_PREF(EmulationSpeed,		long,				(100))					\
 																				\
 	DO_TO_PREF(TimerAccuracy,		long,				(1))					\
+																				\
+	DO_TO_PREF(CPUEngine,			long,				(0))					\
+																				\
+	DO_TO_PREF(IdleFastForward,		bool,				(false))				\
+																				\
+	DO_TO_PREF(LCDRefreshRate,		long,				(60))					\
 
 
 // Declare all the keys
@@ -14,9 +14,11 @@
 #include "EmCommon.h"
 #include "Profiling.h"
 
+#include "EmDevice.h"			// GetWaitStates
 #include "EmHAL.h"				// GetSystemClockFrequency
 #include "EmMemory.h"			// EmMemCheckAddress, EmMemGet16
 #include "EmPalmFunction.h"		// FindFunctionName, GetTrapName
+#include "EmSession.h"			// gSession, GetDevice
 #include "EmStreamFile.h"		// EmStreamFile
 #include "Miscellaneous.h"		// IsSystemTrap, StMemory
 #include "Platform.h"			// Platform::Debugger
@@ -239,6 +241,8 @@ int		gProfilingOn;
 int		gProfilingCounted;
 int		gProfilingDetailed;
 
+EmWaitStates	gWaitStates;
+
 emuptr	gProfilingEnterAddress;
 emuptr	gProfilingReturnAddress;
 emuptr	gProfilingExitAddress;
@@ -1107,6 +1111,13 @@ void ProfileInit(int maxCalls, int maxDepth)
 	gExtraPopCount		= 0;		// debug
 	gInterruptMismatch	= 0;		// debug
 
+	// Charge memory accesses according to the device being emulated.
+
+	if (gSession)
+	{
+		gSession->GetDevice ().GetWaitStates (gWaitStates);
+	}
+
 	// initialize call tree
 	// Llamagraphics, Inc: Dispose of old gCallTree rather than calling Debugger()
 
@@ -1281,7 +1292,9 @@ static Boolean ScanROMMapFile(FILE* iROMMapFile, char* oRoutineName, emuptr* oAd
 	// 	MenuGetVisible                     $10d06916
 	// WARNING - the scan length for the name _must_ match MAX_ROUTINE_NAME
 
-	int numArgs = fscanf (iROMMapFile, " %256s $%lx \n", oRoutineName, oAddr);
+	unsigned long	addr;
+	int numArgs = fscanf (iROMMapFile, " %256s $%lx \n", oRoutineName, &addr);
+	*oAddr = (emuptr) addr;
 
 	if (numArgs != 2)
 	{
@@ -1305,6 +1318,76 @@ static Boolean ScanROMMapFile(FILE* iROMMapFile, char* oRoutineName, emuptr* oAd
 }
 
 
+// ---------------------------------------------------------------------------
+//		� WriteCallgrindFile
+// ---------------------------------------------------------------------------
+// Write the call tree out in callgrind format, which KCachegrind, QCachegrind,
+// gprof2dot and friends can read.  Must be called after LinearAddressToStrings,
+// so that each record's address is the offset of its name in the string table.
+// That offset doubles as the function's ID in the file.
+//
+// Callgrind aggregates by function rather than by call path, so each node in
+// the tree contributes its self cost to its function and its inclusive cost
+// to the call arc from its parent.  Viewers sum repeated entries.
+
+static void WriteCallgrindFile (const char* fileName)
+{
+	FILE*	f = fopen (fileName, "w");
+	if (!f)
+		return;
+
+	vector<Bool>	named (gStringTableEnd, false);
+
+	fputs ("# callgrind format\n", f);
+	fputs ("version: 1\n", f);
+	fputs ("creator: Palm OS Emulator\n", f);
+	fputs ("positions: line\n", f);
+	fputs ("event: Cycles : 68K clock cycles, including memory wait states\n", f);
+	fputs ("events: Cycles\n", f);
+	fputs ("\n", f);
+
+	for (int32 ii = 0; ii < gFirstFreeCallRec; ++ii)
+	{
+		const FnCallRecord&	rec = gCallTree[ii];
+
+		fprintf (f, "fn=(%ld)", (long) rec.address + 1);
+		if (!named[rec.address])
+		{
+			fprintf (f, " %s", &gStringTable[rec.address]);
+			named[rec.address] = true;
+		}
+		fputs ("\n", f);
+
+		fprintf (f, "0 %lld\n", (long long) rec.cyclesSelf);
+
+		int32	kid = rec.kid;
+		while (kid != NORECORD)
+		{
+			const FnCallRecord&	kidRec = gCallTree[kid];
+
+			fprintf (f, "cfn=(%ld)", (long) kidRec.address + 1);
+			if (!named[kidRec.address])
+			{
+				fprintf (f, " %s", &gStringTable[kidRec.address]);
+				named[kidRec.address] = true;
+			}
+			fputs ("\n", f);
+
+			fprintf (f, "calls=%ld 0\n", (long) kidRec.entries);
+			fprintf (f, "0 %lld\n", (long long) kidRec.cyclesPlusKids);
+
+			kid = kidRec.sib;
+		}
+
+		fputs ("\n", f);
+	}
+
+	fprintf (f, "totals: %lld\n", (long long) gCyclesCounted);
+
+	fclose (f);
+}
+
+
 // ---------------------------------------------------------------------------
 //		� ProfileDump
 // ---------------------------------------------------------------------------
@@ -1451,6 +1534,14 @@ void ProfileDump (const char* fileName)
 	// the stack on the Macintosh.
 	LinearAddressToStrings();
 
+	// Write a callgrind version for viewers other than the MW profiler.
+	string	callgrindName (fileName);
+	if (::EndsWith (callgrindName.c_str (), ".mwp"))
+		callgrindName.resize (callgrindName.size () - 4);
+	callgrindName += ".callgrind";
+	EmFileRef callgrindRef (callgrindName);
+	WriteCallgrindFile (callgrindRef.GetFullPath().c_str());
+
 	// do a little cleanup now
 	Platform::DisposeMemory (gROMMap);
 
@@ -16,127 +16,68 @@
 
 #include "sysconfig.h"			// STATIC_INLINE
 
-// wait states vary with hardware
+// Wait states vary with hardware.  They're filled in by ProfileInit from
+// EmDevice::GetWaitStates for the device being emulated.
 
-// !!! Yow, this stuff is all wrong!  This sets up values at *compile* time.
-// We need them to change at *run* time.
-
-#define PILOT		1
-#define	PALM_PILOT	2
-#define PALM_III	3
-#define PALM_V		5		// also PALM_IIIx
-#define PALM_VII	7
-#define PALM_VII_EZ	8
-#define	AUSTIN		9
-
-
-#define PALM_HARDWARE_TYPE PALM_III
-
-
-
-#if PALM_HARDWARE_TYPE == PILOT
-
-#define WAITSTATES_ROM			2
-#define WAITSTATES_SRAM			4	
-#define WAITSTATES_DRAM			4	
-#define WAITSTATES_REGISTERS	0
-#define WAITSTATES_SED1375		4
-#define WAITSTATES_PLD			0	// !!! What's this value?
-#define WAITSTATES_DUMMYBANK	99	// hopefully won't be used!
-
-
-#elif PALM_HARDWARE_TYPE == PALM_PILOT
-
-#define WAITSTATES_ROM			2
-#define WAITSTATES_SRAM			4	
-#define WAITSTATES_DRAM			4	
-#define WAITSTATES_REGISTERS	0
-#define WAITSTATES_SED1375		4
-#define WAITSTATES_PLD			0	// !!! What's this value?
-#define WAITSTATES_DUMMYBANK	99	// hopefully won't be used!
-
-
-#elif PALM_HARDWARE_TYPE == PALM_III
-
-#define WAITSTATES_ROM			2
-#define WAITSTATES_SRAM			4	// according to Wayne Harrington
-#define WAITSTATES_DRAM			4	// according to Wayne Harrington
-#define WAITSTATES_REGISTERS	0
-#define WAITSTATES_SED1375		4
-#define WAITSTATES_PLD			0	// !!! What's this value?
-#define WAITSTATES_DUMMYBANK	99	// hopefully won't be used!
-
-#elif PALM_HARDWARE_TYPE == PALM_V
-
-#define WAITSTATES_ROM			1
-#define WAITSTATES_SRAM			1	
-#define WAITSTATES_DRAM			1	
-#define WAITSTATES_REGISTERS	0
-#define WAITSTATES_SED1375		4
-#define WAITSTATES_PLD			0	// !!! What's this value?
-#define WAITSTATES_DUMMYBANK	99	// hopefully won't be used!
-
-
-#elif PALM_HARDWARE_TYPE == PALM_VII
-
-#define WAITSTATES_ROM			1
-#define WAITSTATES_SRAM			2	// not sure about this yet	
-#define WAITSTATES_DRAM			2	// not sure about this yet
-#define WAITSTATES_REGISTERS	0
-#define WAITSTATES_SED1375		4
-#define WAITSTATES_PLD			0	// !!! What's this value?
-#define WAITSTATES_DUMMYBANK	99	// hopefully won't be used!
-
-#elif PALM_HARDWARE_TYPE == AUSTIN
+typedef struct EmWaitStates
+{
+	int		fROM;
+	int		fSRAM;
+	int		fDRAM;
+	int		fRegisters;
+	int		fSED1375;
+	int		fPLD;
+	int		fDummyBank;
+} EmWaitStates;
 
-#define WAITSTATES_ROM			1
-#define WAITSTATES_SRAM			1	
-#define WAITSTATES_DRAM			1	
-#define WAITSTATES_REGISTERS	0
-#define WAITSTATES_SED1375		4
-#define WAITSTATES_PLD			0	// !!! What's this value?
-#define WAITSTATES_DUMMYBANK	99	// hopefully won't be used!
+#ifdef __cplusplus
+extern "C" {
+#endif
 
-#elif PALM_HARDWARE_TYPE == PALM_VII_EZ
+extern EmWaitStates gWaitStates;
 
-#define WAITSTATES_ROM			1
-#define WAITSTATES_SRAM			1	
-#define WAITSTATES_DRAM			1	
-#define WAITSTATES_REGISTERS	0
-#define WAITSTATES_SED1375		4
-#define WAITSTATES_PLD			0	// !!! What's this value?
-#define WAITSTATES_DUMMYBANK	99	// hopefully won't be used!
+#ifdef __cplusplus
+}
+#endif
 
-#endif	// PALM_HARDWARE_TYPE
+#define WAITSTATES_ROM			(gWaitStates.fROM)
+#define WAITSTATES_SRAM			(gWaitStates.fSRAM)
+#define WAITSTATES_DRAM			(gWaitStates.fDRAM)
+#define WAITSTATES_REGISTERS	(gWaitStates.fRegisters)
+#define WAITSTATES_SED1375		(gWaitStates.fSED1375)
+#define WAITSTATES_PLD			(gWaitStates.fPLD)
+#define WAITSTATES_DUMMYBANK	(gWaitStates.fDummyBank)
 
 
 
 
-// Standard macros for incrementing our counters
+// Standard macros for incrementing our counters.  gProfilingCounted is
+// tested first: it's only set while profiling, so when the profiler is
+// off, each memory access pays for a single well-predicted branch.
 
 #define CYCLE_GETLONG(waitstates)						\
-	if (!(gProfilingEnabled && gProfilingCounted)) ;	\
+	if (!(gProfilingCounted && gProfilingEnabled)) ;	\
 	else ProfileIncrementRead (2, waitstates)
 
 #define CYCLE_GETWORD(waitstates)						\
-	if (!(gProfilingEnabled && gProfilingCounted)) ;	\
+	if (!(gProfilingCounted && gProfilingEnabled)) ;	\
 	else ProfileIncrementRead (1, waitstates)
 
 #define CYCLE_GETBYTE(waitstates)						\
-	if (!(gProfilingEnabled && gProfilingCounted)) ;	\
+	if (!(gProfilingCounted && gProfilingEnabled)) ;	\
 	else ProfileIncrementRead (1, waitstates)
 
 
 #define CYCLE_PUTLONG(waitstates)						\
-	if (!(gProfilingEnabled && gProfilingCounted)) ;	\
+	if (!(gProfilingCounted && gProfilingEnabled)) ;	\
 	else ProfileIncrementWrite (2, waitstates)
 
 #define CYCLE_PUTWORD(waitstates)						\
-	if (!(gProfilingEnabled && gProfilingCounted)) ;	\
+	if (!(gProfilingCounted && gProfilingEnabled)) ;	\
 	else ProfileIncrementWrite (1, waitstates)
 
 #define CYCLE_PUTBYTE(waitstates)						\
-	if (!(gProfilingEnabled && gProfilingCounted)) ;	\
+	if (!(gProfilingCounted && gProfilingEnabled)) ;	\
 	else ProfileIncrementWrite (1, waitstates)
 
 
@@ -17,6 +17,7 @@
 #include "Byteswapping.h"		// Canonical
 #include "EmErrCodes.h"			// kError_InvalidDevice
 #include "EmPalmStructs.h"		// EmProxySED1376RegsType
+#include "EmSessionSnapshot.h"	// EmSessionSnapshot
 #include "EmStreamFile.h"		// EmStreamFile
 #include "ErrorHandling.h"		// Errors::Throw
 #include "Miscellaneous.h"		// StMemory, RunLengthEncode, GzipEncode, etc.
@@ -40,6 +41,38 @@ using namespace std;
 
 SessionFile::SessionFile (ChunkFile& f) :
 	fFile (f),
+	fSnapshot (NULL),
+	fCanReload (false),
+	fCfg (),
+	fReadBugFixes (false),
+	fChangedBugFixes (false),
+	fBugFixes (0)
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	SessionFile constructor
+ *
+ * DESCRIPTION:	Initialize a SessionFile object that reads from or
+ *				writes to an in-memory snapshot.  The small chunks go
+ *				to the given ChunkFile, which should be layered on the
+ *				snapshot's state chunk.  The large images (anything
+ *				that would be compressed in a file) go to the snapshot
+ *				itself, uncompressed.
+ *
+ * PARAMETERS:	f - ChunkFile for the snapshot's state chunk.
+ *
+ *				snapshot - snapshot to hold the images.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+SessionFile::SessionFile (ChunkFile& f, EmSessionSnapshot& snapshot) :
+	fFile (f),
+	fSnapshot (&snapshot),
 	fCanReload (false),
 	fCfg (),
 	fReadBugFixes (false),
@@ -534,6 +567,13 @@ int32 SessionFile::GetRAMImageSize (void)
 {
 	int32	numBytes;
 
+	if (fSnapshot)
+	{
+		numBytes = fSnapshot->GetImageSize (kRAMDataTag);
+		if (numBytes != ChunkFile::kChunkNotFound)
+			return numBytes;
+	}
+
 	Chunk	chunk;
 	if (fFile.ReadChunk (kRAMDataTag, chunk) || fFile.ReadChunk (kRLERAMDataTag, chunk))
 	{
@@ -920,6 +960,51 @@ Bool SessionFile::IncludesBugFix (BugFix val)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	SessionFile::WriteSnapshot
+ *
+ * DESCRIPTION:	Write the contents of an in-memory snapshot to this
+ *				session file.  The state chunks are copied over as-is;
+ *				the images are compressed the way they would have been
+ *				had the session been saved directly to this file.
+ *
+ * PARAMETERS:	snapshot - the snapshot to write.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void SessionFile::WriteSnapshot (const EmSessionSnapshot& snapshot)
+{
+	EmAssert (!fSnapshot);
+
+	const Chunk&	state = snapshot.GetState ();
+	fFile.GetStream ().PutBytes (state.GetPointer (), state.GetLength ());
+
+	vector<ChunkFile::Tag>	tags;
+	snapshot.GetImageTags (tags);
+
+	vector<ChunkFile::Tag>::iterator	iter = tags.begin ();
+	while (iter != tags.end ())
+	{
+		StMemory	image (snapshot.GetImageSize (*iter));
+
+		snapshot.ReadImage (*iter, image.Get ());
+
+		this->WriteChunk (*iter, snapshot.GetImageSize (*iter), image.Get (),
+			(CompressionType) snapshot.GetImageCompression (*iter));
+
+		if (*iter == kRAMDataTag)
+		{
+			fCfg.fRAMSize = snapshot.GetImageSize (*iter) / 1024;
+		}
+
+		++iter;
+	}
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	SessionFile::ReadChunk
@@ -949,6 +1034,13 @@ Bool SessionFile::IncludesBugFix (BugFix val)
 Bool SessionFile::ReadChunk (ChunkFile::Tag tag, void* image,
 							 CompressionType compType)
 {
+	// Images in a snapshot are kept apart from the rest of the chunks.
+
+	if (fSnapshot && fSnapshot->ReadImage (tag, image))
+	{
+		return true;
+	}
+
 	// Get the size of the chunk.
 
 	int32	chunkSize = fFile.FindChunk (tag);
@@ -1006,6 +1098,21 @@ Bool SessionFile::ReadChunk (ChunkFile::Tag tag, void* image,
 Bool SessionFile::ReadChunk (ChunkFile::Tag tag, Chunk& chunk,
 							 CompressionType compType)
 {
+	// Images in a snapshot are kept apart from the rest of the chunks.
+
+	if (fSnapshot)
+	{
+		int32	imageSize = fSnapshot->GetImageSize (tag);
+
+		if (imageSize != ChunkFile::kChunkNotFound)
+		{
+			chunk.SetLength (imageSize);
+			fSnapshot->ReadImage (tag, chunk.GetPointer ());
+
+			return true;
+		}
+	}
+
 	// Get the size of the chunk.
 
 	int32	chunkSize = fFile.FindChunk (tag);
@@ -1085,6 +1192,15 @@ Bool SessionFile::ReadChunk (ChunkFile::Tag tag, Chunk& chunk,
 void SessionFile::WriteChunk (ChunkFile::Tag tag, uint32 size,
 				const void* image, CompressionType compType)
 {
+	// When writing to a snapshot, keep the image as-is.  Export will
+	// compress it if the snapshot is later written to a file.
+
+	if (fSnapshot)
+	{
+		fSnapshot->WriteImage (tag, size, image, compType);
+		return;
+	}
+
 	// No compression to be used; just write the data out as-is.
 
 	if (compType == kNoCompression)
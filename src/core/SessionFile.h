@@ -19,6 +19,8 @@
 #include "EmStructs.h"			// Configuration, RGBType
 #include "Platform.h"			// Platform
 
+class EmSessionSnapshot;
+
 struct HwrJerryPLDType;
 struct HwrM68328Type;
 struct HwrM68EZ328Type;
@@ -40,6 +42,7 @@ class SessionFile
 
 	public:
 								SessionFile				(ChunkFile& f);
+								SessionFile				(ChunkFile& f, EmSessionSnapshot& snapshot);
 								~SessionFile			(void);
 
 		// ---------- Reading ----------
@@ -156,6 +159,8 @@ class SessionFile
 		void					FixBug					(BugFix);
 		Bool					IncludesBugFix			(BugFix);
 
+		void					WriteSnapshot			(const EmSessionSnapshot&);
+
 	private:
 		enum CompressionType
 		{
@@ -247,6 +252,7 @@ class SessionFile
 
 	private:
 		ChunkFile&				fFile;
+		EmSessionSnapshot*		fSnapshot;
 		Bool					fCanReload;
 		Configuration			fCfg;
 		bool					fReadBugFixes;
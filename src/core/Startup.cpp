@@ -40,6 +40,7 @@ static Bool				gMinimize;
 // Post-startup actions.
 static Bool				gStartNewHorde;
 static Bool				gHordeQuitWhenDone;
+static int32			gHordeWorkers;
 static Bool				gMinimizeQuitWhenDone;
 // Quit actions.
 static Bool				gQuitOnExit;
@@ -50,6 +51,7 @@ static EmFileRef		gSessionOpenRef;	// For OpenSession.
 static EmFileRef		gMinimizeRef;		// For Minimize
 static HordeInfo		gHorde;				// For StartNewGremlin
 static StringList		gHordeApps;			// For StartNewGremlin
+static StringList		gHordeWorkerArgs;	// For GetHordeWorkerArgs
 
 	// These are the files listed on the command line.
 static string			gAutoRunApp;
@@ -83,6 +85,7 @@ static const char		kOptHordeSaveFreq[]		= "horde_save_freq";
 static const char		kOptHordeDepthMax[]		= "horde_depth_max";
 static const char		kOptHordeDepthSwitch[]	= "horde_depth_switch";
 static const char		kOptHordeQuitWhenDone[]	= "horde_quit_when_done";
+static const char		kOptHordeWorkers[]		= "horde_workers";
 
 
 // These are the options the user can specify on the command line.
@@ -117,7 +120,8 @@ kOptionMap [] =
 	{ "-horde_save_freq",		kOptHordeSaveFreq,		1 },
 	{ "-horde_depth_max",		kOptHordeDepthMax,		1 },
 	{ "-horde_depth_switch",	kOptHordeDepthSwitch,	1 },
-	{ "-horde_quit_when_done",	kOptHordeQuitWhenDone,	0 }
+	{ "-horde_quit_when_done",	kOptHordeQuitWhenDone,	0 },
+	{ "-horde_workers",			kOptHordeWorkers,		1 }
 };
 
 
@@ -724,6 +728,7 @@ Bool Startup::PrvHandleCreateSessionParameters (OptionList& options)
  *					kOptHordeDepthMax
  *					kOptHordeDepthSwitch
  *					kOptHordeQuitWhenDone
+ *					kOptHordeWorkers
  *
  * PARAMETERS:  options - the OptionList containing the complete set
  *					of parsed switches and parameters.
@@ -744,9 +749,12 @@ Bool Startup::PrvHandleNewHordeParameters (OptionList& options)
 	DEFINE_VARS(HordeDepthMax);
 	DEFINE_VARS(HordeDepthSwitch);
 	DEFINE_VARS(HordeQuitWhenDone);
+	DEFINE_VARS(HordeWorkers);
 
 	UNUSED_PARAM(optHordeQuitWhenDone);
 
+	gHordeWorkerArgs.clear ();
+
 	if (haveHordeFirst ||
 		haveHordeLast ||
 		haveHordeApps ||
@@ -794,6 +802,8 @@ Bool Startup::PrvHandleNewHordeParameters (OptionList& options)
 
 			::SeparateList (appNames, optHordeApps, ',');
 
+			gHordeWorkerArgs.push_back ("-horde_apps");
+			gHordeWorkerArgs.push_back (optHordeApps);
 		}
 
 		if (haveHordeSaveDir)
@@ -808,16 +818,25 @@ Bool Startup::PrvHandleNewHordeParameters (OptionList& options)
 		if (haveHordeSaveFreq)
 		{
 			info.fSaveFrequency = atoi (optHordeSaveFreq.c_str ());
+
+			gHordeWorkerArgs.push_back ("-horde_save_freq");
+			gHordeWorkerArgs.push_back (optHordeSaveFreq);
 		}
 
 		if (haveHordeDepthMax)
 		{
 			info.fMaxDepth = atoi (optHordeDepthMax.c_str ());
+
+			gHordeWorkerArgs.push_back ("-horde_depth_max");
+			gHordeWorkerArgs.push_back (optHordeDepthMax);
 		}
 
 		if (haveHordeDepthSwitch)
 		{
 			info.fSwitchDepth = atoi (optHordeDepthSwitch.c_str ());
+
+			gHordeWorkerArgs.push_back ("-horde_depth_switch");
+			gHordeWorkerArgs.push_back (optHordeDepthSwitch);
 		}
 
 		if (haveHordeFirst || haveHordeLast)
@@ -830,6 +849,14 @@ Bool Startup::PrvHandleNewHordeParameters (OptionList& options)
 
 	gHordeQuitWhenDone = haveHordeQuitWhenDone;
 
+	gHordeWorkers = haveHordeWorkers ? atoi (optHordeWorkers.c_str ()) : 0;
+
+	if (gHordeWorkers < 0)
+	{
+		Startup::PrvDontUnderstand (optHordeWorkers.c_str ());
+		return false;
+	}
+
 	return true;
 }
 
@@ -963,6 +990,9 @@ Bool Startup::PrvHandlePreferenceParameters (PreferenceList& prefs)
 		Preference<string>	pref (key.c_str ());
 		pref = value;
 
+		gHordeWorkerArgs.push_back ("-pref");
+		gHordeWorkerArgs.push_back (fullPrefString);
+
 		++iter;
 	}
 
@@ -1006,8 +1036,8 @@ Bool Startup::PrvParseCommandLine (int argc, char** argv)
 		goto BadParameter;
 
 	// Handle kOptHordeFirst, kOptHordeLast, kOptHordeApps, kOptHordeSaveDir,
-	// kOptHordeSaveFreq, kOptHordeDepthMax, kOptHordeDepthSwitch, and
-	// kOptHordeQuitWhenDone.
+	// kOptHordeSaveFreq, kOptHordeDepthMax, kOptHordeDepthSwitch,
+	// kOptHordeQuitWhenDone, and kOptHordeWorkers.
 
 	if (!Startup::PrvHandleNewHordeParameters (options))
 		goto BadParameter;
@@ -1453,6 +1483,49 @@ Bool Startup::HordeQuitWhenDone (void)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:    Startup::HordeWorkers
+ *
+ * DESCRIPTION: Return the number of worker processes the Horde
+ *				specified on the command line should be sharded
+ *				across.
+ *
+ * PARAMETERS:  none.
+ *
+ * RETURNED:    The -horde_workers count; zero or one means to run the
+ *				Horde in this process.
+ *
+ ***********************************************************************/
+
+int32 Startup::HordeWorkers (void)
+{
+	return gHordeWorkers;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:    Startup::GetHordeWorkerArgs
+ *
+ * DESCRIPTION: Return the command line options that each Horde worker
+ *				process should be passed along with its share of the
+ *				Gremlin range: the -horde_apps, -horde_save_freq,
+ *				-horde_depth_max, -horde_depth_switch, and -pref
+ *				options that were given to this process.
+ *
+ * PARAMETERS:  args - receives the options and their parameters.
+ *
+ * RETURNED:    Nothing.
+ *
+ ***********************************************************************/
+
+void Startup::GetHordeWorkerArgs (StringList& args)
+{
+	args = gHordeWorkerArgs;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:    Startup::MinimizeQuitWhenDone
@@ -43,6 +43,8 @@ class Startup
 		static Bool				Minimize				(EmFileRef&);
 		static Bool				NewHorde				(HordeInfo*);
 		static Bool				HordeQuitWhenDone		(void);
+		static int32			HordeWorkers			(void);
+		static void				GetHordeWorkerArgs		(StringList&);
 		static Bool				MinimizeQuitWhenDone	(void);
 		static Bool				CloseSession			(EmFileRef&);
 		static Bool				QuitOnExit				(void);
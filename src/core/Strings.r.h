@@ -236,6 +236,9 @@
 #define kStr_MenuSettings				1468
 #define kStr_MenuEmpty					1469
 #define kStr_MenuBlank					1470
+#define kStr_MenuCPUInterpreter			1471
+#define kStr_MenuCPUBlocks				1472
+#define kStr_MenuIdleFastForward		1473
 
 
 // --------------------------------------------------------------------------------
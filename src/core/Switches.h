@@ -172,6 +172,15 @@
 #define EXCEPTION_HISTORY		ON_IN_DEBUG_MODE
 
 
+// Define LAZY_FLAGS_CHECK to 1 to compute the 68K condition codes
+// eagerly alongside the lazy evaluation and report any instruction
+// where the two disagree.  Normally set with -DPOSE_LAZY_FLAGS_CHECK=ON.
+
+#ifndef LAZY_FLAGS_CHECK
+#define LAZY_FLAGS_CHECK		0
+#endif
+
+
 // The number of ticks between calls to WaitNextEvent (Mac only).
 
 #define EVENT_THRESHHOLD		6
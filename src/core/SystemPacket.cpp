@@ -551,6 +551,8 @@ ErrCode SystemPacket::Continue (SLP& slp)
 	// ssCount is ignored?
 	gDebuggerGlobals.ssValue	= packet.ssCheckSum;
 
+	Debug::UpdateDataBreaks ();
+
 	ErrCode result = Debug::ExitDebugger ();
 
 	// Perform any platform-specific actions.
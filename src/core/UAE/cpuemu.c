@@ -21,9 +21,7 @@ unsigned long REGPARAM2 op_0_3(uae_u32 opcode) /* OR */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 4;
@@ -35,9 +33,7 @@ unsigned long REGPARAM2 op_10_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -50,9 +46,7 @@ unsigned long REGPARAM2 op_18_3(uae_u32 opcode) /* OR */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -66,9 +60,7 @@ unsigned long REGPARAM2 op_20_3(uae_u32 opcode) /* OR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -80,9 +72,7 @@ unsigned long REGPARAM2 op_28_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -94,9 +84,7 @@ unsigned long REGPARAM2 op_30_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -107,9 +95,7 @@ unsigned long REGPARAM2 op_38_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -120,9 +106,7 @@ unsigned long REGPARAM2 op_39_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -143,9 +127,7 @@ unsigned long REGPARAM2 op_40_3(uae_u32 opcode) /* OR */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 4;
@@ -157,9 +139,7 @@ unsigned long REGPARAM2 op_50_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -172,9 +152,7 @@ unsigned long REGPARAM2 op_58_3(uae_u32 opcode) /* OR */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -188,9 +166,7 @@ unsigned long REGPARAM2 op_60_3(uae_u32 opcode) /* OR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -202,9 +178,7 @@ unsigned long REGPARAM2 op_68_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -216,9 +190,7 @@ unsigned long REGPARAM2 op_70_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -229,9 +201,7 @@ unsigned long REGPARAM2 op_78_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -242,9 +212,7 @@ unsigned long REGPARAM2 op_79_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -266,9 +234,7 @@ unsigned long REGPARAM2 op_80_3(uae_u32 opcode) /* OR */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 6;
@@ -280,9 +246,7 @@ unsigned long REGPARAM2 op_90_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -295,9 +259,7 @@ unsigned long REGPARAM2 op_98_3(uae_u32 opcode) /* OR */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -311,9 +273,7 @@ unsigned long REGPARAM2 op_a0_3(uae_u32 opcode) /* OR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -325,9 +285,7 @@ unsigned long REGPARAM2 op_a8_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -339,9 +297,7 @@ unsigned long REGPARAM2 op_b0_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -352,9 +308,7 @@ unsigned long REGPARAM2 op_b8_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -365,9 +319,7 @@ unsigned long REGPARAM2 op_b9_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 return 18;
@@ -978,9 +930,7 @@ unsigned long REGPARAM2 op_200_3(uae_u32 opcode) /* AND */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 4;
@@ -992,9 +942,7 @@ unsigned long REGPARAM2 op_210_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -1007,9 +955,7 @@ unsigned long REGPARAM2 op_218_3(uae_u32 opcode) /* AND */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -1023,9 +969,7 @@ unsigned long REGPARAM2 op_220_3(uae_u32 opcode) /* AND */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -1037,9 +981,7 @@ unsigned long REGPARAM2 op_228_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -1051,9 +993,7 @@ unsigned long REGPARAM2 op_230_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -1064,9 +1004,7 @@ unsigned long REGPARAM2 op_238_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -1077,9 +1015,7 @@ unsigned long REGPARAM2 op_239_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -1100,9 +1036,7 @@ unsigned long REGPARAM2 op_240_3(uae_u32 opcode) /* AND */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 4;
@@ -1114,9 +1048,7 @@ unsigned long REGPARAM2 op_250_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -1129,9 +1061,7 @@ unsigned long REGPARAM2 op_258_3(uae_u32 opcode) /* AND */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -1145,9 +1075,7 @@ unsigned long REGPARAM2 op_260_3(uae_u32 opcode) /* AND */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -1159,9 +1087,7 @@ unsigned long REGPARAM2 op_268_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -1173,9 +1099,7 @@ unsigned long REGPARAM2 op_270_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -1186,9 +1110,7 @@ unsigned long REGPARAM2 op_278_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -1199,9 +1121,7 @@ unsigned long REGPARAM2 op_279_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -1223,9 +1143,7 @@ unsigned long REGPARAM2 op_280_3(uae_u32 opcode) /* AND */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 6;
@@ -1237,9 +1155,7 @@ unsigned long REGPARAM2 op_290_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -1252,9 +1168,7 @@ unsigned long REGPARAM2 op_298_3(uae_u32 opcode) /* AND */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -1268,9 +1182,7 @@ unsigned long REGPARAM2 op_2a0_3(uae_u32 opcode) /* AND */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -1282,9 +1194,7 @@ unsigned long REGPARAM2 op_2a8_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -1296,9 +1206,7 @@ unsigned long REGPARAM2 op_2b0_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -1309,9 +1217,7 @@ unsigned long REGPARAM2 op_2b8_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -1322,9 +1228,7 @@ unsigned long REGPARAM2 op_2b9_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 return 18;
@@ -1335,16 +1239,9 @@ unsigned long REGPARAM2 op_400_3(uae_u32 opcode) /* SUB */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_410_3(uae_u32 opcode) /* SUB */
@@ -1354,16 +1251,9 @@ unsigned long REGPARAM2 op_410_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_418_3(uae_u32 opcode) /* SUB */
@@ -1374,16 +1264,9 @@ unsigned long REGPARAM2 op_418_3(uae_u32 opcode) /* SUB */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_420_3(uae_u32 opcode) /* SUB */
@@ -1395,16 +1278,9 @@ unsigned long REGPARAM2 op_420_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_428_3(uae_u32 opcode) /* SUB */
@@ -1414,16 +1290,9 @@ unsigned long REGPARAM2 op_428_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_430_3(uae_u32 opcode) /* SUB */
@@ -1433,16 +1302,9 @@ unsigned long REGPARAM2 op_430_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_438_3(uae_u32 opcode) /* SUB */
@@ -1451,16 +1313,9 @@ unsigned long REGPARAM2 op_438_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_439_3(uae_u32 opcode) /* SUB */
@@ -1469,16 +1324,9 @@ unsigned long REGPARAM2 op_439_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_440_3(uae_u32 opcode) /* SUB */
@@ -1487,16 +1335,9 @@ unsigned long REGPARAM2 op_440_3(uae_u32 opcode) /* SUB */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_450_3(uae_u32 opcode) /* SUB */
@@ -1506,16 +1347,9 @@ unsigned long REGPARAM2 op_450_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_458_3(uae_u32 opcode) /* SUB */
@@ -1526,16 +1360,9 @@ unsigned long REGPARAM2 op_458_3(uae_u32 opcode) /* SUB */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_460_3(uae_u32 opcode) /* SUB */
@@ -1547,16 +1374,9 @@ unsigned long REGPARAM2 op_460_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_468_3(uae_u32 opcode) /* SUB */
@@ -1566,16 +1386,9 @@ unsigned long REGPARAM2 op_468_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_470_3(uae_u32 opcode) /* SUB */
@@ -1585,16 +1398,9 @@ unsigned long REGPARAM2 op_470_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_478_3(uae_u32 opcode) /* SUB */
@@ -1603,16 +1409,9 @@ unsigned long REGPARAM2 op_478_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_479_3(uae_u32 opcode) /* SUB */
@@ -1621,16 +1420,9 @@ unsigned long REGPARAM2 op_479_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_480_3(uae_u32 opcode) /* SUB */
@@ -1639,16 +1431,9 @@ unsigned long REGPARAM2 op_480_3(uae_u32 opcode) /* SUB */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 6;
 }
 unsigned long REGPARAM2 op_490_3(uae_u32 opcode) /* SUB */
@@ -1658,16 +1443,9 @@ unsigned long REGPARAM2 op_490_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_498_3(uae_u32 opcode) /* SUB */
@@ -1678,16 +1456,9 @@ unsigned long REGPARAM2 op_498_3(uae_u32 opcode) /* SUB */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_4a0_3(uae_u32 opcode) /* SUB */
@@ -1699,16 +1470,9 @@ unsigned long REGPARAM2 op_4a0_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_4a8_3(uae_u32 opcode) /* SUB */
@@ -1718,16 +1482,9 @@ unsigned long REGPARAM2 op_4a8_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 16;
 }
 unsigned long REGPARAM2 op_4b0_3(uae_u32 opcode) /* SUB */
@@ -1737,16 +1494,9 @@ unsigned long REGPARAM2 op_4b0_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 16;
 }
 unsigned long REGPARAM2 op_4b8_3(uae_u32 opcode) /* SUB */
@@ -1755,16 +1505,9 @@ unsigned long REGPARAM2 op_4b8_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 16;
 }
 unsigned long REGPARAM2 op_4b9_3(uae_u32 opcode) /* SUB */
@@ -1773,16 +1516,9 @@ unsigned long REGPARAM2 op_4b9_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(10);
+}}}}}}m68k_incpc(10);
 return 18;
 }
 unsigned long REGPARAM2 op_600_3(uae_u32 opcode) /* ADD */
@@ -1791,16 +1527,9 @@ unsigned long REGPARAM2 op_600_3(uae_u32 opcode) /* ADD */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_610_3(uae_u32 opcode) /* ADD */
@@ -1810,16 +1539,9 @@ unsigned long REGPARAM2 op_610_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_618_3(uae_u32 opcode) /* ADD */
@@ -1830,16 +1552,9 @@ unsigned long REGPARAM2 op_618_3(uae_u32 opcode) /* ADD */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_620_3(uae_u32 opcode) /* ADD */
@@ -1851,16 +1566,9 @@ unsigned long REGPARAM2 op_620_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_628_3(uae_u32 opcode) /* ADD */
@@ -1870,16 +1578,9 @@ unsigned long REGPARAM2 op_628_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_630_3(uae_u32 opcode) /* ADD */
@@ -1889,16 +1590,9 @@ unsigned long REGPARAM2 op_630_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_638_3(uae_u32 opcode) /* ADD */
@@ -1907,16 +1601,9 @@ unsigned long REGPARAM2 op_638_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_639_3(uae_u32 opcode) /* ADD */
@@ -1925,16 +1612,9 @@ unsigned long REGPARAM2 op_639_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_640_3(uae_u32 opcode) /* ADD */
@@ -1943,16 +1623,9 @@ unsigned long REGPARAM2 op_640_3(uae_u32 opcode) /* ADD */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_650_3(uae_u32 opcode) /* ADD */
@@ -1962,16 +1635,9 @@ unsigned long REGPARAM2 op_650_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_658_3(uae_u32 opcode) /* ADD */
@@ -1982,16 +1648,9 @@ unsigned long REGPARAM2 op_658_3(uae_u32 opcode) /* ADD */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_660_3(uae_u32 opcode) /* ADD */
@@ -2003,16 +1662,9 @@ unsigned long REGPARAM2 op_660_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_668_3(uae_u32 opcode) /* ADD */
@@ -2022,16 +1674,9 @@ unsigned long REGPARAM2 op_668_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_670_3(uae_u32 opcode) /* ADD */
@@ -2041,16 +1686,9 @@ unsigned long REGPARAM2 op_670_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_678_3(uae_u32 opcode) /* ADD */
@@ -2059,16 +1697,9 @@ unsigned long REGPARAM2 op_678_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_679_3(uae_u32 opcode) /* ADD */
@@ -2077,16 +1708,9 @@ unsigned long REGPARAM2 op_679_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_680_3(uae_u32 opcode) /* ADD */
@@ -2095,16 +1719,9 @@ unsigned long REGPARAM2 op_680_3(uae_u32 opcode) /* ADD */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 6;
 }
 unsigned long REGPARAM2 op_690_3(uae_u32 opcode) /* ADD */
@@ -2114,16 +1731,9 @@ unsigned long REGPARAM2 op_690_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_698_3(uae_u32 opcode) /* ADD */
@@ -2134,16 +1744,9 @@ unsigned long REGPARAM2 op_698_3(uae_u32 opcode) /* ADD */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_6a0_3(uae_u32 opcode) /* ADD */
@@ -2155,16 +1758,9 @@ unsigned long REGPARAM2 op_6a0_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_6a8_3(uae_u32 opcode) /* ADD */
@@ -2174,16 +1770,9 @@ unsigned long REGPARAM2 op_6a8_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 16;
 }
 unsigned long REGPARAM2 op_6b0_3(uae_u32 opcode) /* ADD */
@@ -2193,16 +1782,9 @@ unsigned long REGPARAM2 op_6b0_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 16;
 }
 unsigned long REGPARAM2 op_6b8_3(uae_u32 opcode) /* ADD */
@@ -2211,16 +1793,9 @@ unsigned long REGPARAM2 op_6b8_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 16;
 }
 unsigned long REGPARAM2 op_6b9_3(uae_u32 opcode) /* ADD */
@@ -2229,16 +1804,9 @@ unsigned long REGPARAM2 op_6b9_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(10);
+}}}}}}m68k_incpc(10);
 return 18;
 }
 unsigned long REGPARAM2 op_800_3(uae_u32 opcode) /* BTST */
@@ -2764,9 +2332,7 @@ unsigned long REGPARAM2 op_a00_3(uae_u32 opcode) /* EOR */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 4;
@@ -2778,9 +2344,7 @@ unsigned long REGPARAM2 op_a10_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -2793,9 +2357,7 @@ unsigned long REGPARAM2 op_a18_3(uae_u32 opcode) /* EOR */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -2809,9 +2371,7 @@ unsigned long REGPARAM2 op_a20_3(uae_u32 opcode) /* EOR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -2823,9 +2383,7 @@ unsigned long REGPARAM2 op_a28_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -2837,9 +2395,7 @@ unsigned long REGPARAM2 op_a30_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -2850,9 +2406,7 @@ unsigned long REGPARAM2 op_a38_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -2863,9 +2417,7 @@ unsigned long REGPARAM2 op_a39_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -2886,9 +2438,7 @@ unsigned long REGPARAM2 op_a40_3(uae_u32 opcode) /* EOR */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 4;
@@ -2900,9 +2450,7 @@ unsigned long REGPARAM2 op_a50_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -2915,9 +2463,7 @@ unsigned long REGPARAM2 op_a58_3(uae_u32 opcode) /* EOR */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -2931,9 +2477,7 @@ unsigned long REGPARAM2 op_a60_3(uae_u32 opcode) /* EOR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -2945,9 +2489,7 @@ unsigned long REGPARAM2 op_a68_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -2959,9 +2501,7 @@ unsigned long REGPARAM2 op_a70_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -2975,9 +2515,7 @@ unsigned long REGPARAM2 op_a78_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -2988,9 +2526,7 @@ unsigned long REGPARAM2 op_a79_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -3012,9 +2548,7 @@ unsigned long REGPARAM2 op_a80_3(uae_u32 opcode) /* EOR */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 6;
@@ -3026,9 +2560,7 @@ unsigned long REGPARAM2 op_a90_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -3041,9 +2573,7 @@ unsigned long REGPARAM2 op_a98_3(uae_u32 opcode) /* EOR */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -3057,9 +2587,7 @@ unsigned long REGPARAM2 op_aa0_3(uae_u32 opcode) /* EOR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -3071,9 +2599,7 @@ unsigned long REGPARAM2 op_aa8_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -3085,9 +2611,7 @@ unsigned long REGPARAM2 op_ab0_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -3098,9 +2622,7 @@ unsigned long REGPARAM2 op_ab8_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -3111,9 +2633,7 @@ unsigned long REGPARAM2 op_ab9_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 return 18;
@@ -3124,14 +2644,8 @@ unsigned long REGPARAM2 op_c00_3(uae_u32 opcode) /* CMP */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_c10_3(uae_u32 opcode) /* CMP */
@@ -3141,14 +2655,8 @@ unsigned long REGPARAM2 op_c10_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_c18_3(uae_u32 opcode) /* CMP */
@@ -3159,14 +2667,8 @@ unsigned long REGPARAM2 op_c18_3(uae_u32 opcode) /* CMP */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_c20_3(uae_u32 opcode) /* CMP */
@@ -3178,14 +2680,8 @@ unsigned long REGPARAM2 op_c20_3(uae_u32 opcode) /* CMP */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_c28_3(uae_u32 opcode) /* CMP */
@@ -3195,14 +2691,8 @@ unsigned long REGPARAM2 op_c28_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c30_3(uae_u32 opcode) /* CMP */
@@ -3212,14 +2702,8 @@ unsigned long REGPARAM2 op_c30_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c38_3(uae_u32 opcode) /* CMP */
@@ -3228,14 +2712,8 @@ unsigned long REGPARAM2 op_c38_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c39_3(uae_u32 opcode) /* CMP */
@@ -3244,14 +2722,8 @@ unsigned long REGPARAM2 op_c39_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 10;
 }
 unsigned long REGPARAM2 op_c3a_3(uae_u32 opcode) /* CMP */
@@ -3262,14 +2734,8 @@ unsigned long REGPARAM2 op_c3a_3(uae_u32 opcode) /* CMP */
 	dsta += (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c3b_3(uae_u32 opcode) /* CMP */
@@ -3280,14 +2746,8 @@ unsigned long REGPARAM2 op_c3b_3(uae_u32 opcode) /* CMP */
 	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c40_3(uae_u32 opcode) /* CMP */
@@ -3296,14 +2756,8 @@ unsigned long REGPARAM2 op_c40_3(uae_u32 opcode) /* CMP */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_c50_3(uae_u32 opcode) /* CMP */
@@ -3313,14 +2767,8 @@ unsigned long REGPARAM2 op_c50_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_c58_3(uae_u32 opcode) /* CMP */
@@ -3331,14 +2779,8 @@ unsigned long REGPARAM2 op_c58_3(uae_u32 opcode) /* CMP */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_c60_3(uae_u32 opcode) /* CMP */
@@ -3350,14 +2792,8 @@ unsigned long REGPARAM2 op_c60_3(uae_u32 opcode) /* CMP */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_c68_3(uae_u32 opcode) /* CMP */
@@ -3367,14 +2803,8 @@ unsigned long REGPARAM2 op_c68_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c70_3(uae_u32 opcode) /* CMP */
@@ -3384,14 +2814,8 @@ unsigned long REGPARAM2 op_c70_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c78_3(uae_u32 opcode) /* CMP */
@@ -3400,14 +2824,8 @@ unsigned long REGPARAM2 op_c78_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c79_3(uae_u32 opcode) /* CMP */
@@ -3416,14 +2834,8 @@ unsigned long REGPARAM2 op_c79_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 10;
 }
 unsigned long REGPARAM2 op_c7a_3(uae_u32 opcode) /* CMP */
@@ -3434,14 +2846,8 @@ unsigned long REGPARAM2 op_c7a_3(uae_u32 opcode) /* CMP */
 	dsta += (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c7b_3(uae_u32 opcode) /* CMP */
@@ -3452,14 +2858,8 @@ unsigned long REGPARAM2 op_c7b_3(uae_u32 opcode) /* CMP */
 	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c80_3(uae_u32 opcode) /* CMP */
@@ -3468,14 +2868,8 @@ unsigned long REGPARAM2 op_c80_3(uae_u32 opcode) /* CMP */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}m68k_incpc(6);
 return 6;
 }
 unsigned long REGPARAM2 op_c90_3(uae_u32 opcode) /* CMP */
@@ -3485,14 +2879,8 @@ unsigned long REGPARAM2 op_c90_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_c98_3(uae_u32 opcode) /* CMP */
@@ -3503,14 +2891,8 @@ unsigned long REGPARAM2 op_c98_3(uae_u32 opcode) /* CMP */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_ca0_3(uae_u32 opcode) /* CMP */
@@ -3522,14 +2904,8 @@ unsigned long REGPARAM2 op_ca0_3(uae_u32 opcode) /* CMP */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_ca8_3(uae_u32 opcode) /* CMP */
@@ -3539,14 +2915,8 @@ unsigned long REGPARAM2 op_ca8_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_cb0_3(uae_u32 opcode) /* CMP */
@@ -3556,14 +2926,8 @@ unsigned long REGPARAM2 op_cb0_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_cb8_3(uae_u32 opcode) /* CMP */
@@ -3572,14 +2936,8 @@ unsigned long REGPARAM2 op_cb8_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_cb9_3(uae_u32 opcode) /* CMP */
@@ -3588,14 +2946,8 @@ unsigned long REGPARAM2 op_cb9_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(10);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(10);
 return 14;
 }
 unsigned long REGPARAM2 op_cba_3(uae_u32 opcode) /* CMP */
@@ -3606,14 +2958,8 @@ unsigned long REGPARAM2 op_cba_3(uae_u32 opcode) /* CMP */
 	dsta += (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_cbb_3(uae_u32 opcode) /* CMP */
@@ -3624,14 +2970,8 @@ unsigned long REGPARAM2 op_cbb_3(uae_u32 opcode) /* CMP */
 	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_1000_3(uae_u32 opcode) /* MOVE */
@@ -3639,9 +2979,7 @@ unsigned long REGPARAM2 op_1000_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 2;
@@ -3652,9 +2990,7 @@ unsigned long REGPARAM2 op_1010_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -3666,9 +3002,7 @@ unsigned long REGPARAM2 op_1018_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -3681,9 +3015,7 @@ unsigned long REGPARAM2 op_1020_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -3694,9 +3026,7 @@ unsigned long REGPARAM2 op_1028_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -3707,9 +3037,7 @@ unsigned long REGPARAM2 op_1030_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -3719,9 +3047,7 @@ unsigned long REGPARAM2 op_1038_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -3731,9 +3057,7 @@ unsigned long REGPARAM2 op_1039_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 return 8;
@@ -3744,9 +3068,7 @@ unsigned long REGPARAM2 op_103a_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -3757,9 +3079,7 @@ unsigned long REGPARAM2 op_103b_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -3768,9 +3088,7 @@ unsigned long REGPARAM2 op_103c_3(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 4;
@@ -3781,9 +3099,7 @@ unsigned long REGPARAM2 op_1080_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -3795,9 +3111,7 @@ unsigned long REGPARAM2 op_1090_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -3810,9 +3124,7 @@ unsigned long REGPARAM2 op_1098_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -3826,9 +3138,7 @@ unsigned long REGPARAM2 op_10a0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -3840,9 +3150,7 @@ unsigned long REGPARAM2 op_10a8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -3854,9 +3162,7 @@ unsigned long REGPARAM2 op_10b0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -3867,9 +3173,7 @@ unsigned long REGPARAM2 op_10b8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -3880,9 +3184,7 @@ unsigned long REGPARAM2 op_10b9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -3894,9 +3196,7 @@ unsigned long REGPARAM2 op_10ba_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -3908,9 +3208,7 @@ unsigned long REGPARAM2 op_10bb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -3920,9 +3218,7 @@ unsigned long REGPARAM2 op_10bc_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -3934,9 +3230,7 @@ unsigned long REGPARAM2 op_10c0_3(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -3949,9 +3243,7 @@ unsigned long REGPARAM2 op_10d0_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -3965,9 +3257,7 @@ unsigned long REGPARAM2 op_10d8_3(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -3982,9 +3272,7 @@ unsigned long REGPARAM2 op_10e0_3(uae_u32 opcode) /* MOVE */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -3997,9 +3285,7 @@ unsigned long REGPARAM2 op_10e8_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4012,9 +3298,7 @@ unsigned long REGPARAM2 op_10f0_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4026,9 +3310,7 @@ unsigned long REGPARAM2 op_10f8_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4040,9 +3322,7 @@ unsigned long REGPARAM2 op_10f9_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4055,9 +3335,7 @@ unsigned long REGPARAM2 op_10fa_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4070,9 +3348,7 @@ unsigned long REGPARAM2 op_10fb_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4083,9 +3359,7 @@ unsigned long REGPARAM2 op_10fc_3(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -4098,9 +3372,7 @@ unsigned long REGPARAM2 op_1100_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -4114,9 +3386,7 @@ unsigned long REGPARAM2 op_1110_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -4131,9 +3401,7 @@ unsigned long REGPARAM2 op_1118_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -4149,9 +3417,7 @@ unsigned long REGPARAM2 op_1120_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -4165,9 +3431,7 @@ unsigned long REGPARAM2 op_1128_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4181,9 +3445,7 @@ unsigned long REGPARAM2 op_1130_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4196,9 +3458,7 @@ unsigned long REGPARAM2 op_1138_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4211,9 +3471,7 @@ unsigned long REGPARAM2 op_1139_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4227,9 +3485,7 @@ unsigned long REGPARAM2 op_113a_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4243,9 +3499,7 @@ unsigned long REGPARAM2 op_113b_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4257,9 +3511,7 @@ unsigned long REGPARAM2 op_113c_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -4270,9 +3522,7 @@ unsigned long REGPARAM2 op_1140_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -4284,9 +3534,7 @@ unsigned long REGPARAM2 op_1150_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4299,9 +3547,7 @@ unsigned long REGPARAM2 op_1158_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4315,9 +3561,7 @@ unsigned long REGPARAM2 op_1160_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4329,9 +3573,7 @@ unsigned long REGPARAM2 op_1168_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4343,9 +3585,7 @@ unsigned long REGPARAM2 op_1170_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4356,9 +3596,7 @@ unsigned long REGPARAM2 op_1178_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4369,9 +3607,7 @@ unsigned long REGPARAM2 op_1179_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4383,9 +3619,7 @@ unsigned long REGPARAM2 op_117a_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4397,9 +3631,7 @@ unsigned long REGPARAM2 op_117b_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4409,9 +3641,7 @@ unsigned long REGPARAM2 op_117c_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -4422,9 +3652,7 @@ unsigned long REGPARAM2 op_1180_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -4436,9 +3664,7 @@ unsigned long REGPARAM2 op_1190_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4451,9 +3677,7 @@ unsigned long REGPARAM2 op_1198_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4467,9 +3691,7 @@ unsigned long REGPARAM2 op_11a0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4481,9 +3703,7 @@ unsigned long REGPARAM2 op_11a8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4495,9 +3715,7 @@ unsigned long REGPARAM2 op_11b0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4508,9 +3726,7 @@ unsigned long REGPARAM2 op_11b8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4521,9 +3737,7 @@ unsigned long REGPARAM2 op_11b9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4535,9 +3749,7 @@ unsigned long REGPARAM2 op_11ba_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4549,9 +3761,7 @@ unsigned long REGPARAM2 op_11bb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4561,9 +3771,7 @@ unsigned long REGPARAM2 op_11bc_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -4573,9 +3781,7 @@ unsigned long REGPARAM2 op_11c0_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -4586,9 +3792,7 @@ unsigned long REGPARAM2 op_11d0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4600,9 +3804,7 @@ unsigned long REGPARAM2 op_11d8_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4615,9 +3817,7 @@ unsigned long REGPARAM2 op_11e0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4628,9 +3828,7 @@ unsigned long REGPARAM2 op_11e8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4641,9 +3839,7 @@ unsigned long REGPARAM2 op_11f0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4653,9 +3849,7 @@ unsigned long REGPARAM2 op_11f8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4665,9 +3859,7 @@ unsigned long REGPARAM2 op_11f9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4678,9 +3870,7 @@ unsigned long REGPARAM2 op_11fa_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4691,9 +3881,7 @@ unsigned long REGPARAM2 op_11fb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4702,9 +3890,7 @@ unsigned long REGPARAM2 op_11fc_3(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -4714,9 +3900,7 @@ unsigned long REGPARAM2 op_13c0_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -4727,9 +3911,7 @@ unsigned long REGPARAM2 op_13d0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4741,9 +3923,7 @@ unsigned long REGPARAM2 op_13d8_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4756,9 +3936,7 @@ unsigned long REGPARAM2 op_13e0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4769,9 +3947,7 @@ unsigned long REGPARAM2 op_13e8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4782,9 +3958,7 @@ unsigned long REGPARAM2 op_13f0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4794,9 +3968,7 @@ unsigned long REGPARAM2 op_13f8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4806,9 +3978,7 @@ unsigned long REGPARAM2 op_13f9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(10);
 return 14;
@@ -4819,9 +3989,7 @@ unsigned long REGPARAM2 op_13fa_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4832,9 +4000,7 @@ unsigned long REGPARAM2 op_13fb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4843,9 +4009,7 @@ unsigned long REGPARAM2 op_13fc_3(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}m68k_incpc(8);
 return 10;
@@ -4855,9 +4019,7 @@ unsigned long REGPARAM2 op_2000_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 2;
@@ -4867,9 +4029,7 @@ unsigned long REGPARAM2 op_2008_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 2;
@@ -4880,9 +4040,7 @@ unsigned long REGPARAM2 op_2010_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -4894,9 +4052,7 @@ unsigned long REGPARAM2 op_2018_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -4909,9 +4065,7 @@ unsigned long REGPARAM2 op_2020_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -4922,9 +4076,7 @@ unsigned long REGPARAM2 op_2028_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4935,9 +4087,7 @@ unsigned long REGPARAM2 op_2030_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4947,9 +4097,7 @@ unsigned long REGPARAM2 op_2038_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4959,9 +4107,7 @@ unsigned long REGPARAM2 op_2039_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4972,9 +4118,7 @@ unsigned long REGPARAM2 op_203a_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4985,9 +4129,7 @@ unsigned long REGPARAM2 op_203b_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4996,9 +4138,7 @@ unsigned long REGPARAM2 op_203c_3(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 6;
@@ -5150,9 +4290,7 @@ unsigned long REGPARAM2 op_2080_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 6;
@@ -5163,9 +4301,7 @@ unsigned long REGPARAM2 op_2088_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 6;
@@ -5177,9 +4313,7 @@ unsigned long REGPARAM2 op_2090_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5192,9 +4326,7 @@ unsigned long REGPARAM2 op_2098_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5208,9 +4340,7 @@ unsigned long REGPARAM2 op_20a0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5222,9 +4352,7 @@ unsigned long REGPARAM2 op_20a8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5236,9 +4364,7 @@ unsigned long REGPARAM2 op_20b0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5249,9 +4375,7 @@ unsigned long REGPARAM2 op_20b8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5262,9 +4386,7 @@ unsigned long REGPARAM2 op_20b9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5276,9 +4398,7 @@ unsigned long REGPARAM2 op_20ba_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5290,9 +4410,7 @@ unsigned long REGPARAM2 op_20bb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5302,9 +4420,7 @@ unsigned long REGPARAM2 op_20bc_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 return 10;
@@ -5316,9 +4432,7 @@ unsigned long REGPARAM2 op_20c0_3(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 6;
@@ -5330,9 +4444,7 @@ unsigned long REGPARAM2 op_20c8_3(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 6;
@@ -5345,9 +4457,7 @@ unsigned long REGPARAM2 op_20d0_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5361,9 +4471,7 @@ unsigned long REGPARAM2 op_20d8_3(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5378,9 +4486,7 @@ unsigned long REGPARAM2 op_20e0_3(uae_u32 opcode) /* MOVE */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5393,9 +4499,7 @@ unsigned long REGPARAM2 op_20e8_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5408,9 +4512,7 @@ unsigned long REGPARAM2 op_20f0_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5422,9 +4524,7 @@ unsigned long REGPARAM2 op_20f8_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5436,9 +4536,7 @@ unsigned long REGPARAM2 op_20f9_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5451,9 +4549,7 @@ unsigned long REGPARAM2 op_20fa_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5466,9 +4562,7 @@ unsigned long REGPARAM2 op_20fb_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5479,9 +4573,7 @@ unsigned long REGPARAM2 op_20fc_3(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 return 10;
@@ -5494,9 +4586,7 @@ unsigned long REGPARAM2 op_2100_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 6;
@@ -5509,9 +4599,7 @@ unsigned long REGPARAM2 op_2108_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 6;
@@ -5525,9 +4613,7 @@ unsigned long REGPARAM2 op_2110_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5542,9 +4628,7 @@ unsigned long REGPARAM2 op_2118_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5560,9 +4644,7 @@ unsigned long REGPARAM2 op_2120_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5576,9 +4658,7 @@ unsigned long REGPARAM2 op_2128_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5592,9 +4672,7 @@ unsigned long REGPARAM2 op_2130_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5607,9 +4685,7 @@ unsigned long REGPARAM2 op_2138_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5622,9 +4698,7 @@ unsigned long REGPARAM2 op_2139_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5638,9 +4712,7 @@ unsigned long REGPARAM2 op_213a_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5654,9 +4726,7 @@ unsigned long REGPARAM2 op_213b_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5671,9 +4741,7 @@ unsigned long REGPARAM2 op_213c_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 return 10;
@@ -5684,9 +4752,7 @@ unsigned long REGPARAM2 op_2140_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 8;
@@ -5697,9 +4763,7 @@ unsigned long REGPARAM2 op_2148_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 8;
@@ -5711,9 +4775,7 @@ unsigned long REGPARAM2 op_2150_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5726,9 +4788,7 @@ unsigned long REGPARAM2 op_2158_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5742,9 +4802,7 @@ unsigned long REGPARAM2 op_2160_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5756,9 +4814,7 @@ unsigned long REGPARAM2 op_2168_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5770,9 +4826,7 @@ unsigned long REGPARAM2 op_2170_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5783,9 +4837,7 @@ unsigned long REGPARAM2 op_2178_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5796,9 +4848,7 @@ unsigned long REGPARAM2 op_2179_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -5810,9 +4860,7 @@ unsigned long REGPARAM2 op_217a_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5824,9 +4872,7 @@ unsigned long REGPARAM2 op_217b_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5836,9 +4882,7 @@ unsigned long REGPARAM2 op_217c_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 return 12;
@@ -5849,9 +4893,7 @@ unsigned long REGPARAM2 op_2180_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 8;
@@ -5862,9 +4904,7 @@ unsigned long REGPARAM2 op_2188_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 8;
@@ -5876,9 +4916,7 @@ unsigned long REGPARAM2 op_2190_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5891,9 +4929,7 @@ unsigned long REGPARAM2 op_2198_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5907,9 +4943,7 @@ unsigned long REGPARAM2 op_21a0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5921,9 +4955,7 @@ unsigned long REGPARAM2 op_21a8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5935,9 +4967,7 @@ unsigned long REGPARAM2 op_21b0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5948,9 +4978,7 @@ unsigned long REGPARAM2 op_21b8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5961,9 +4989,7 @@ unsigned long REGPARAM2 op_21b9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -5975,9 +5001,7 @@ unsigned long REGPARAM2 op_21ba_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5989,9 +5013,7 @@ unsigned long REGPARAM2 op_21bb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6001,9 +5023,7 @@ unsigned long REGPARAM2 op_21bc_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 return 12;
@@ -6013,9 +5033,7 @@ unsigned long REGPARAM2 op_21c0_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 8;
@@ -6025,9 +5043,7 @@ unsigned long REGPARAM2 op_21c8_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 8;
@@ -6038,9 +5054,7 @@ unsigned long REGPARAM2 op_21d0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -6052,9 +5066,7 @@ unsigned long REGPARAM2 op_21d8_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -6067,9 +5079,7 @@ unsigned long REGPARAM2 op_21e0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -6080,9 +5090,7 @@ unsigned long REGPARAM2 op_21e8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6093,9 +5101,7 @@ unsigned long REGPARAM2 op_21f0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6105,9 +5111,7 @@ unsigned long REGPARAM2 op_21f8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6117,9 +5121,7 @@ unsigned long REGPARAM2 op_21f9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -6130,9 +5132,7 @@ unsigned long REGPARAM2 op_21fa_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6143,9 +5143,7 @@ unsigned long REGPARAM2 op_21fb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6154,9 +5152,7 @@ unsigned long REGPARAM2 op_21fc_3(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 return 12;
@@ -6166,9 +5162,7 @@ unsigned long REGPARAM2 op_23c0_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 return 10;
@@ -6178,9 +5172,7 @@ unsigned long REGPARAM2 op_23c8_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 return 10;
@@ -6191,9 +5183,7 @@ unsigned long REGPARAM2 op_23d0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6205,9 +5195,7 @@ unsigned long REGPARAM2 op_23d8_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6220,9 +5208,7 @@ unsigned long REGPARAM2 op_23e0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6233,9 +5219,7 @@ unsigned long REGPARAM2 op_23e8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -6246,9 +5230,7 @@ unsigned long REGPARAM2 op_23f0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -6258,9 +5240,7 @@ unsigned long REGPARAM2 op_23f8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -6270,9 +5250,7 @@ unsigned long REGPARAM2 op_23f9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 return 18;
@@ -6283,9 +5261,7 @@ unsigned long REGPARAM2 op_23fa_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -6296,9 +5272,7 @@ unsigned long REGPARAM2 op_23fb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -6307,9 +5281,7 @@ unsigned long REGPARAM2 op_23fc_3(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}m68k_incpc(10);
 return 14;
@@ -6319,9 +5291,7 @@ unsigned long REGPARAM2 op_3000_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 2;
@@ -6331,9 +5301,7 @@ unsigned long REGPARAM2 op_3008_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 2;
@@ -6344,9 +5312,7 @@ unsigned long REGPARAM2 op_3010_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -6358,9 +5324,7 @@ unsigned long REGPARAM2 op_3018_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -6373,9 +5337,7 @@ unsigned long REGPARAM2 op_3020_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -6386,9 +5348,7 @@ unsigned long REGPARAM2 op_3028_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -6399,9 +5359,7 @@ unsigned long REGPARAM2 op_3030_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -6411,9 +5369,7 @@ unsigned long REGPARAM2 op_3038_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -6423,9 +5379,7 @@ unsigned long REGPARAM2 op_3039_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 return 8;
@@ -6436,9 +5390,7 @@ unsigned long REGPARAM2 op_303a_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -6449,9 +5401,7 @@ unsigned long REGPARAM2 op_303b_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -6460,9 +5410,7 @@ unsigned long REGPARAM2 op_303c_3(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 4;
@@ -6614,9 +5562,7 @@ unsigned long REGPARAM2 op_3080_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -6627,9 +5573,7 @@ unsigned long REGPARAM2 op_3088_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -6641,9 +5585,7 @@ unsigned long REGPARAM2 op_3090_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -6656,9 +5598,7 @@ unsigned long REGPARAM2 op_3098_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -6672,9 +5612,7 @@ unsigned long REGPARAM2 op_30a0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -6686,9 +5624,7 @@ unsigned long REGPARAM2 op_30a8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6700,9 +5636,7 @@ unsigned long REGPARAM2 op_30b0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6713,9 +5647,7 @@ unsigned long REGPARAM2 op_30b8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6726,9 +5658,7 @@ unsigned long REGPARAM2 op_30b9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -6740,9 +5670,7 @@ unsigned long REGPARAM2 op_30ba_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6754,9 +5682,7 @@ unsigned long REGPARAM2 op_30bb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6766,9 +5692,7 @@ unsigned long REGPARAM2 op_30bc_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -6780,9 +5704,7 @@ unsigned long REGPARAM2 op_30c0_3(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -6794,9 +5716,7 @@ unsigned long REGPARAM2 op_30c8_3(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -6809,9 +5729,7 @@ unsigned long REGPARAM2 op_30d0_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -6825,9 +5743,7 @@ unsigned long REGPARAM2 op_30d8_3(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -6842,9 +5758,7 @@ unsigned long REGPARAM2 op_30e0_3(uae_u32 opcode) /* MOVE */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -6857,9 +5771,7 @@ unsigned long REGPARAM2 op_30e8_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6872,9 +5784,7 @@ unsigned long REGPARAM2 op_30f0_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6886,9 +5796,7 @@ unsigned long REGPARAM2 op_30f8_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6900,9 +5808,7 @@ unsigned long REGPARAM2 op_30f9_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -6915,9 +5821,7 @@ unsigned long REGPARAM2 op_30fa_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6930,9 +5834,7 @@ unsigned long REGPARAM2 op_30fb_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6943,9 +5845,7 @@ unsigned long REGPARAM2 op_30fc_3(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -6958,9 +5858,7 @@ unsigned long REGPARAM2 op_3100_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -6973,9 +5871,7 @@ unsigned long REGPARAM2 op_3108_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -6989,9 +5885,7 @@ unsigned long REGPARAM2 op_3110_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -7006,9 +5900,7 @@ unsigned long REGPARAM2 op_3118_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -7024,9 +5916,7 @@ unsigned long REGPARAM2 op_3120_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -7040,9 +5930,7 @@ unsigned long REGPARAM2 op_3128_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7056,9 +5944,7 @@ unsigned long REGPARAM2 op_3130_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7071,9 +5957,7 @@ unsigned long REGPARAM2 op_3138_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7086,9 +5970,7 @@ unsigned long REGPARAM2 op_3139_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7102,9 +5984,7 @@ unsigned long REGPARAM2 op_313a_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7118,9 +5998,7 @@ unsigned long REGPARAM2 op_313b_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7132,9 +6010,7 @@ unsigned long REGPARAM2 op_313c_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -7145,9 +6021,7 @@ unsigned long REGPARAM2 op_3140_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -7158,9 +6032,7 @@ unsigned long REGPARAM2 op_3148_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -7172,9 +6044,7 @@ unsigned long REGPARAM2 op_3150_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7187,9 +6057,7 @@ unsigned long REGPARAM2 op_3158_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7203,9 +6071,7 @@ unsigned long REGPARAM2 op_3160_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7217,9 +6083,7 @@ unsigned long REGPARAM2 op_3168_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7231,9 +6095,7 @@ unsigned long REGPARAM2 op_3170_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7244,9 +6106,7 @@ unsigned long REGPARAM2 op_3178_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7257,9 +6117,7 @@ unsigned long REGPARAM2 op_3179_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7271,9 +6129,7 @@ unsigned long REGPARAM2 op_317a_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7285,9 +6141,7 @@ unsigned long REGPARAM2 op_317b_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7297,9 +6151,7 @@ unsigned long REGPARAM2 op_317c_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -7310,9 +6162,7 @@ unsigned long REGPARAM2 op_3180_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -7323,9 +6173,7 @@ unsigned long REGPARAM2 op_3188_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -7337,9 +6185,7 @@ unsigned long REGPARAM2 op_3190_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7352,9 +6198,7 @@ unsigned long REGPARAM2 op_3198_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7368,9 +6212,7 @@ unsigned long REGPARAM2 op_31a0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7382,9 +6224,7 @@ unsigned long REGPARAM2 op_31a8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7396,9 +6236,7 @@ unsigned long REGPARAM2 op_31b0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7409,9 +6247,7 @@ unsigned long REGPARAM2 op_31b8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7422,9 +6258,7 @@ unsigned long REGPARAM2 op_31b9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7436,9 +6270,7 @@ unsigned long REGPARAM2 op_31ba_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7450,9 +6282,7 @@ unsigned long REGPARAM2 op_31bb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7462,9 +6292,7 @@ unsigned long REGPARAM2 op_31bc_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -7474,9 +6302,7 @@ unsigned long REGPARAM2 op_31c0_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -7486,9 +6312,7 @@ unsigned long REGPARAM2 op_31c8_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -7499,9 +6323,7 @@ unsigned long REGPARAM2 op_31d0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7513,9 +6335,7 @@ unsigned long REGPARAM2 op_31d8_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7528,9 +6348,7 @@ unsigned long REGPARAM2 op_31e0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7541,9 +6359,7 @@ unsigned long REGPARAM2 op_31e8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7554,9 +6370,7 @@ unsigned long REGPARAM2 op_31f0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7566,9 +6380,7 @@ unsigned long REGPARAM2 op_31f8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7578,9 +6390,7 @@ unsigned long REGPARAM2 op_31f9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7591,9 +6401,7 @@ unsigned long REGPARAM2 op_31fa_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7604,9 +6412,7 @@ unsigned long REGPARAM2 op_31fb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7615,9 +6421,7 @@ unsigned long REGPARAM2 op_31fc_3(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -7627,9 +6431,7 @@ unsigned long REGPARAM2 op_33c0_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -7639,9 +6441,7 @@ unsigned long REGPARAM2 op_33c8_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -7652,9 +6452,7 @@ unsigned long REGPARAM2 op_33d0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7666,9 +6464,7 @@ unsigned long REGPARAM2 op_33d8_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7681,9 +6477,7 @@ unsigned long REGPARAM2 op_33e0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7694,9 +6488,7 @@ unsigned long REGPARAM2 op_33e8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7707,9 +6499,7 @@ unsigned long REGPARAM2 op_33f0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7719,9 +6509,7 @@ unsigned long REGPARAM2 op_33f8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7731,9 +6519,7 @@ unsigned long REGPARAM2 op_33f9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(10);
 return 14;
@@ -7744,9 +6530,7 @@ unsigned long REGPARAM2 op_33fa_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7757,9 +6541,7 @@ unsigned long REGPARAM2 op_33fb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7768,9 +6550,7 @@ unsigned long REGPARAM2 op_33fc_3(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}m68k_incpc(8);
 return 10;
@@ -8678,9 +7458,7 @@ return 4;
 unsigned long REGPARAM2 op_4200_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+{{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), 0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((0) & 0xff);
 }}m68k_incpc(2);
 return 2;
@@ -8689,9 +7467,7 @@ unsigned long REGPARAM2 op_4210_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), 0);
 	put_byte(srca,0);
 }}m68k_incpc(2);
 return 4;
@@ -8701,9 +7477,7 @@ unsigned long REGPARAM2 op_4218_3(uae_u32 opcode) /* CLR */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), 0);
 	put_byte(srca,0);
 }}m68k_incpc(2);
 return 4;
@@ -8714,9 +7488,7 @@ unsigned long REGPARAM2 op_4220_3(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), 0);
 	put_byte(srca,0);
 }}m68k_incpc(2);
 return 4;
@@ -8725,9 +7497,7 @@ unsigned long REGPARAM2 op_4228_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), 0);
 	put_byte(srca,0);
 }}m68k_incpc(4);
 return 6;
@@ -8736,9 +7506,7 @@ unsigned long REGPARAM2 op_4230_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), 0);
 	put_byte(srca,0);
 }}m68k_incpc(4);
 return 6;
@@ -8746,9 +7514,7 @@ return 6;
 unsigned long REGPARAM2 op_4238_3(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), 0);
 	put_byte(srca,0);
 }}m68k_incpc(4);
 return 6;
@@ -8756,9 +7522,7 @@ return 6;
 unsigned long REGPARAM2 op_4239_3(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), 0);
 	put_byte(srca,0);
 }}m68k_incpc(6);
 return 8;
@@ -8766,9 +7530,7 @@ return 8;
 unsigned long REGPARAM2 op_4240_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+{{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), 0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((0) & 0xffff);
 }}m68k_incpc(2);
 return 2;
@@ -8777,9 +7539,7 @@ unsigned long REGPARAM2 op_4250_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), 0);
 	put_word(srca,0);
 }}m68k_incpc(2);
 return 4;
@@ -8789,9 +7549,7 @@ unsigned long REGPARAM2 op_4258_3(uae_u32 opcode) /* CLR */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), 0);
 	put_word(srca,0);
 }}m68k_incpc(2);
 return 4;
@@ -8802,9 +7560,7 @@ unsigned long REGPARAM2 op_4260_3(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), 0);
 	put_word(srca,0);
 }}m68k_incpc(2);
 return 4;
@@ -8813,9 +7569,7 @@ unsigned long REGPARAM2 op_4268_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), 0);
 	put_word(srca,0);
 }}m68k_incpc(4);
 return 6;
@@ -8827,9 +7581,7 @@ unsigned long REGPARAM2 op_4270_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), 0);
 	put_word(srca,0);
 }}m68k_incpc(4);
 return 6;
@@ -8837,9 +7589,7 @@ return 6;
 unsigned long REGPARAM2 op_4278_3(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), 0);
 	put_word(srca,0);
 }}m68k_incpc(4);
 return 6;
@@ -8847,9 +7597,7 @@ return 6;
 unsigned long REGPARAM2 op_4279_3(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), 0);
 	put_word(srca,0);
 }}m68k_incpc(6);
 return 8;
@@ -8857,9 +7605,7 @@ return 8;
 unsigned long REGPARAM2 op_4280_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+{{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), 0);
 	m68k_dreg(regs, srcreg) = (0);
 }}m68k_incpc(2);
 return 2;
@@ -8868,9 +7614,7 @@ unsigned long REGPARAM2 op_4290_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), 0);
 	put_long(srca,0);
 }}m68k_incpc(2);
 return 6;
@@ -8880,9 +7624,7 @@ unsigned long REGPARAM2 op_4298_3(uae_u32 opcode) /* CLR */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), 0);
 	put_long(srca,0);
 }}m68k_incpc(2);
 return 6;
@@ -8893,9 +7635,7 @@ unsigned long REGPARAM2 op_42a0_3(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), 0);
 	put_long(srca,0);
 }}m68k_incpc(2);
 return 6;
@@ -8904,9 +7644,7 @@ unsigned long REGPARAM2 op_42a8_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), 0);
 	put_long(srca,0);
 }}m68k_incpc(4);
 return 8;
@@ -8915,9 +7653,7 @@ unsigned long REGPARAM2 op_42b0_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), 0);
 	put_long(srca,0);
 }}m68k_incpc(4);
 return 8;
@@ -8925,9 +7661,7 @@ return 8;
 unsigned long REGPARAM2 op_42b8_3(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), 0);
 	put_long(srca,0);
 }}m68k_incpc(4);
 return 8;
@@ -8935,9 +7669,7 @@ return 8;
 unsigned long REGPARAM2 op_42b9_3(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), 0);
 	put_long(srca,0);
 }}m68k_incpc(6);
 return 10;
@@ -8947,16 +7679,9 @@ unsigned long REGPARAM2 op_4400_3(uae_u32 opcode) /* NEG */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, 0, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_4410_3(uae_u32 opcode) /* NEG */
@@ -8965,16 +7690,9 @@ unsigned long REGPARAM2 op_4410_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, 0, dst);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_4418_3(uae_u32 opcode) /* NEG */
@@ -8984,16 +7702,9 @@ unsigned long REGPARAM2 op_4418_3(uae_u32 opcode) /* NEG */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, 0, dst);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_4420_3(uae_u32 opcode) /* NEG */
@@ -9004,16 +7715,9 @@ unsigned long REGPARAM2 op_4420_3(uae_u32 opcode) /* NEG */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, 0, dst);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_4428_3(uae_u32 opcode) /* NEG */
@@ -9022,16 +7726,9 @@ unsigned long REGPARAM2 op_4428_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, 0, dst);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_4430_3(uae_u32 opcode) /* NEG */
@@ -9040,16 +7737,9 @@ unsigned long REGPARAM2 op_4430_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, 0, dst);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_4438_3(uae_u32 opcode) /* NEG */
@@ -9057,16 +7747,9 @@ unsigned long REGPARAM2 op_4438_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, 0, dst);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_4439_3(uae_u32 opcode) /* NEG */
@@ -9074,16 +7757,9 @@ unsigned long REGPARAM2 op_4439_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, 0, dst);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_4440_3(uae_u32 opcode) /* NEG */
@@ -9091,16 +7767,9 @@ unsigned long REGPARAM2 op_4440_3(uae_u32 opcode) /* NEG */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, 0, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_4450_3(uae_u32 opcode) /* NEG */
@@ -9109,16 +7778,9 @@ unsigned long REGPARAM2 op_4450_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, 0, dst);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_4458_3(uae_u32 opcode) /* NEG */
@@ -9128,16 +7790,9 @@ unsigned long REGPARAM2 op_4458_3(uae_u32 opcode) /* NEG */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, 0, dst);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_4460_3(uae_u32 opcode) /* NEG */
@@ -9148,16 +7803,9 @@ unsigned long REGPARAM2 op_4460_3(uae_u32 opcode) /* NEG */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, 0, dst);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_4468_3(uae_u32 opcode) /* NEG */
@@ -9166,16 +7814,9 @@ unsigned long REGPARAM2 op_4468_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, 0, dst);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_4470_3(uae_u32 opcode) /* NEG */
@@ -9184,16 +7825,9 @@ unsigned long REGPARAM2 op_4470_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, 0, dst);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_4478_3(uae_u32 opcode) /* NEG */
@@ -9201,16 +7835,9 @@ unsigned long REGPARAM2 op_4478_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, 0, dst);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_4479_3(uae_u32 opcode) /* NEG */
@@ -9218,16 +7845,9 @@ unsigned long REGPARAM2 op_4479_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, 0, dst);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_4480_3(uae_u32 opcode) /* NEG */
@@ -9235,16 +7855,9 @@ unsigned long REGPARAM2 op_4480_3(uae_u32 opcode) /* NEG */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, 0, dst);
 	m68k_dreg(regs, srcreg) = (dst);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_4490_3(uae_u32 opcode) /* NEG */
@@ -9253,16 +7866,9 @@ unsigned long REGPARAM2 op_4490_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, 0, dst);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_4498_3(uae_u32 opcode) /* NEG */
@@ -9272,16 +7878,9 @@ unsigned long REGPARAM2 op_4498_3(uae_u32 opcode) /* NEG */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, 0, dst);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_44a0_3(uae_u32 opcode) /* NEG */
@@ -9292,16 +7891,9 @@ unsigned long REGPARAM2 op_44a0_3(uae_u32 opcode) /* NEG */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, 0, dst);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_44a8_3(uae_u32 opcode) /* NEG */
@@ -9310,16 +7902,9 @@ unsigned long REGPARAM2 op_44a8_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, 0, dst);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_44b0_3(uae_u32 opcode) /* NEG */
@@ -9328,16 +7913,9 @@ unsigned long REGPARAM2 op_44b0_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, 0, dst);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_44b8_3(uae_u32 opcode) /* NEG */
@@ -9345,16 +7923,9 @@ unsigned long REGPARAM2 op_44b8_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, 0, dst);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_44b9_3(uae_u32 opcode) /* NEG */
@@ -9362,16 +7933,9 @@ unsigned long REGPARAM2 op_44b9_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, 0, dst);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_44c0_3(uae_u32 opcode) /* MV2SR */
@@ -9509,9 +8073,7 @@ unsigned long REGPARAM2 op_4600_3(uae_u32 opcode) /* NOT */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}m68k_incpc(2);
 return 2;
@@ -9522,9 +8084,7 @@ unsigned long REGPARAM2 op_4610_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 return 6;
@@ -9536,9 +8096,7 @@ unsigned long REGPARAM2 op_4618_3(uae_u32 opcode) /* NOT */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 return 6;
@@ -9551,9 +8109,7 @@ unsigned long REGPARAM2 op_4620_3(uae_u32 opcode) /* NOT */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 return 6;
@@ -9564,9 +8120,7 @@ unsigned long REGPARAM2 op_4628_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 return 8;
@@ -9577,9 +8131,7 @@ unsigned long REGPARAM2 op_4630_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 return 8;
@@ -9589,9 +8141,7 @@ unsigned long REGPARAM2 op_4638_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 return 8;
@@ -9601,9 +8151,7 @@ unsigned long REGPARAM2 op_4639_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(6);
 return 10;
@@ -9613,9 +8161,7 @@ unsigned long REGPARAM2 op_4640_3(uae_u32 opcode) /* NOT */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 return 2;
@@ -9626,9 +8172,7 @@ unsigned long REGPARAM2 op_4650_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 return 6;
@@ -9640,9 +8184,7 @@ unsigned long REGPARAM2 op_4658_3(uae_u32 opcode) /* NOT */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 return 6;
@@ -9655,9 +8197,7 @@ unsigned long REGPARAM2 op_4660_3(uae_u32 opcode) /* NOT */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 return 6;
@@ -9668,9 +8208,7 @@ unsigned long REGPARAM2 op_4668_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 return 8;
@@ -9681,9 +8219,7 @@ unsigned long REGPARAM2 op_4670_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 return 8;
@@ -9693,9 +8229,7 @@ unsigned long REGPARAM2 op_4678_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 return 8;
@@ -9705,9 +8239,7 @@ unsigned long REGPARAM2 op_4679_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(6);
 return 10;
@@ -9717,9 +8249,7 @@ unsigned long REGPARAM2 op_4680_3(uae_u32 opcode) /* NOT */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 return 2;
@@ -9730,9 +8260,7 @@ unsigned long REGPARAM2 op_4690_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 return 10;
@@ -9744,9 +8272,7 @@ unsigned long REGPARAM2 op_4698_3(uae_u32 opcode) /* NOT */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 return 10;
@@ -9759,9 +8285,7 @@ unsigned long REGPARAM2 op_46a0_3(uae_u32 opcode) /* NOT */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 return 10;
@@ -9772,9 +8296,7 @@ unsigned long REGPARAM2 op_46a8_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 return 12;
@@ -9785,9 +8307,7 @@ unsigned long REGPARAM2 op_46b0_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 return 12;
@@ -9797,9 +8317,7 @@ unsigned long REGPARAM2 op_46b8_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 return 12;
@@ -9809,9 +8327,7 @@ unsigned long REGPARAM2 op_46b9_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(6);
 return 14;
@@ -10103,9 +8619,7 @@ unsigned long REGPARAM2 op_4840_3(uae_u32 opcode) /* SWAP */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 return 2;
@@ -10190,9 +8704,7 @@ unsigned long REGPARAM2 op_4880_3(uae_u32 opcode) /* EXT */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u16 dst = (uae_s16)(uae_s8)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 return 2;
@@ -10269,9 +8781,7 @@ unsigned long REGPARAM2 op_48c0_3(uae_u32 opcode) /* EXT */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 return 2;
@@ -10348,9 +8858,7 @@ unsigned long REGPARAM2 op_49c0_3(uae_u32 opcode) /* EXT */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s8)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 return 2;
@@ -10359,9 +8867,7 @@ unsigned long REGPARAM2 op_4a00_3(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 }}m68k_incpc(2);
 return 2;
 }
@@ -10370,9 +8876,7 @@ unsigned long REGPARAM2 op_4a10_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 }}}m68k_incpc(2);
 return 4;
 }
@@ -10382,9 +8886,7 @@ unsigned long REGPARAM2 op_4a18_3(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 }}}m68k_incpc(2);
 return 4;
 }
@@ -10395,9 +8897,7 @@ unsigned long REGPARAM2 op_4a20_3(uae_u32 opcode) /* TST */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 }}}m68k_incpc(2);
 return 4;
 }
@@ -10406,9 +8906,7 @@ unsigned long REGPARAM2 op_4a28_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10417,9 +8915,7 @@ unsigned long REGPARAM2 op_4a30_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10427,9 +8923,7 @@ unsigned long REGPARAM2 op_4a38_3(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10437,9 +8931,7 @@ unsigned long REGPARAM2 op_4a39_3(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 }}}m68k_incpc(6);
 return 8;
 }
@@ -10448,9 +8940,7 @@ unsigned long REGPARAM2 op_4a3a_3(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10459,18 +8949,14 @@ unsigned long REGPARAM2 op_4a3b_3(uae_u32 opcode) /* TST */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 }}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_4a3c_3(uae_u32 opcode) /* TST */
 {
 {{	uae_s8 src = get_ibyte(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 }}m68k_incpc(4);
 return 4;
 }
@@ -10478,9 +8964,7 @@ unsigned long REGPARAM2 op_4a40_3(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 }}m68k_incpc(2);
 return 2;
 }
@@ -10488,9 +8972,7 @@ unsigned long REGPARAM2 op_4a48_3(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 }}m68k_incpc(2);
 return 2;
 }
@@ -10499,9 +8981,7 @@ unsigned long REGPARAM2 op_4a50_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 }}}m68k_incpc(2);
 return 4;
 }
@@ -10511,9 +8991,7 @@ unsigned long REGPARAM2 op_4a58_3(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 }}}m68k_incpc(2);
 return 4;
 }
@@ -10524,9 +9002,7 @@ unsigned long REGPARAM2 op_4a60_3(uae_u32 opcode) /* TST */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 }}}m68k_incpc(2);
 return 4;
 }
@@ -10535,9 +9011,7 @@ unsigned long REGPARAM2 op_4a68_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10546,9 +9020,7 @@ unsigned long REGPARAM2 op_4a70_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10556,9 +9028,7 @@ unsigned long REGPARAM2 op_4a78_3(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10566,9 +9036,7 @@ unsigned long REGPARAM2 op_4a79_3(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 }}}m68k_incpc(6);
 return 8;
 }
@@ -10577,9 +9045,7 @@ unsigned long REGPARAM2 op_4a7a_3(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10588,18 +9054,14 @@ unsigned long REGPARAM2 op_4a7b_3(uae_u32 opcode) /* TST */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 }}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_4a7c_3(uae_u32 opcode) /* TST */
 {
 {{	uae_s16 src = get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 }}m68k_incpc(4);
 return 4;
 }
@@ -10607,9 +9069,7 @@ unsigned long REGPARAM2 op_4a80_3(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 }}m68k_incpc(2);
 return 2;
 }
@@ -10617,9 +9077,7 @@ unsigned long REGPARAM2 op_4a88_3(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 }}m68k_incpc(2);
 return 2;
 }
@@ -10628,9 +9086,7 @@ unsigned long REGPARAM2 op_4a90_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 }}}m68k_incpc(2);
 return 6;
 }
@@ -10640,9 +9096,7 @@ unsigned long REGPARAM2 op_4a98_3(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 }}}m68k_incpc(2);
 return 6;
 }
@@ -10653,9 +9107,7 @@ unsigned long REGPARAM2 op_4aa0_3(uae_u32 opcode) /* TST */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 }}}m68k_incpc(2);
 return 6;
 }
@@ -10664,9 +9116,7 @@ unsigned long REGPARAM2 op_4aa8_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 }}}m68k_incpc(4);
 return 8;
 }
@@ -10675,9 +9125,7 @@ unsigned long REGPARAM2 op_4ab0_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 }}}m68k_incpc(4);
 return 8;
 }
@@ -10685,9 +9133,7 @@ unsigned long REGPARAM2 op_4ab8_3(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 }}}m68k_incpc(4);
 return 8;
 }
@@ -10695,9 +9141,7 @@ unsigned long REGPARAM2 op_4ab9_3(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 }}}m68k_incpc(6);
 return 10;
 }
@@ -10706,9 +9150,7 @@ unsigned long REGPARAM2 op_4aba_3(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 }}}m68k_incpc(4);
 return 8;
 }
@@ -10717,18 +9159,14 @@ unsigned long REGPARAM2 op_4abb_3(uae_u32 opcode) /* TST */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 }}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_4abc_3(uae_u32 opcode) /* TST */
 {
 {{	uae_s32 src = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 }}m68k_incpc(6);
 return 6;
 }
@@ -10736,9 +9174,7 @@ unsigned long REGPARAM2 op_4ac0_3(uae_u32 opcode) /* TAS */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	src |= 0x80;
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((src) & 0xff);
 }}m68k_incpc(2);
@@ -10749,9 +9185,7 @@ unsigned long REGPARAM2 op_4ad0_3(uae_u32 opcode) /* TAS */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -10763,9 +9197,7 @@ unsigned long REGPARAM2 op_4ad8_3(uae_u32 opcode) /* TAS */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -10778,9 +9210,7 @@ unsigned long REGPARAM2 op_4ae0_3(uae_u32 opcode) /* TAS */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -10791,9 +9221,7 @@ unsigned long REGPARAM2 op_4ae8_3(uae_u32 opcode) /* TAS */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -10804,9 +9232,7 @@ unsigned long REGPARAM2 op_4af0_3(uae_u32 opcode) /* TAS */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -10816,9 +9242,7 @@ unsigned long REGPARAM2 op_4af8_3(uae_u32 opcode) /* TAS */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -10828,9 +9252,7 @@ unsigned long REGPARAM2 op_4af9_3(uae_u32 opcode) /* TAS */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(6);
@@ -11253,16 +9675,9 @@ unsigned long REGPARAM2 op_5000_3(uae_u32 opcode) /* ADD */
 {{	uae_u32 src = srcreg;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_5010_3(uae_u32 opcode) /* ADD */
@@ -11273,16 +9688,9 @@ unsigned long REGPARAM2 op_5010_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5018_3(uae_u32 opcode) /* ADD */
@@ -11294,16 +9702,9 @@ unsigned long REGPARAM2 op_5018_3(uae_u32 opcode) /* ADD */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5020_3(uae_u32 opcode) /* ADD */
@@ -11316,16 +9717,9 @@ unsigned long REGPARAM2 op_5020_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5028_3(uae_u32 opcode) /* ADD */
@@ -11336,16 +9730,9 @@ unsigned long REGPARAM2 op_5028_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5030_3(uae_u32 opcode) /* ADD */
@@ -11356,16 +9743,9 @@ unsigned long REGPARAM2 op_5030_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5038_3(uae_u32 opcode) /* ADD */
@@ -11375,16 +9755,9 @@ unsigned long REGPARAM2 op_5038_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5039_3(uae_u32 opcode) /* ADD */
@@ -11394,16 +9767,9 @@ unsigned long REGPARAM2 op_5039_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_5040_3(uae_u32 opcode) /* ADD */
@@ -11413,16 +9779,9 @@ unsigned long REGPARAM2 op_5040_3(uae_u32 opcode) /* ADD */
 {{	uae_u32 src = srcreg;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_5048_3(uae_u32 opcode) /* ADDA */
@@ -11445,16 +9804,9 @@ unsigned long REGPARAM2 op_5050_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5058_3(uae_u32 opcode) /* ADD */
@@ -11466,16 +9818,9 @@ unsigned long REGPARAM2 op_5058_3(uae_u32 opcode) /* ADD */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5060_3(uae_u32 opcode) /* ADD */
@@ -11488,16 +9833,9 @@ unsigned long REGPARAM2 op_5060_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5068_3(uae_u32 opcode) /* ADD */
@@ -11508,16 +9846,9 @@ unsigned long REGPARAM2 op_5068_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5070_3(uae_u32 opcode) /* ADD */
@@ -11528,16 +9859,9 @@ unsigned long REGPARAM2 op_5070_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5078_3(uae_u32 opcode) /* ADD */
@@ -11547,16 +9871,9 @@ unsigned long REGPARAM2 op_5078_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5079_3(uae_u32 opcode) /* ADD */
@@ -11566,16 +9883,9 @@ unsigned long REGPARAM2 op_5079_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_5080_3(uae_u32 opcode) /* ADD */
@@ -11585,16 +9895,9 @@ unsigned long REGPARAM2 op_5080_3(uae_u32 opcode) /* ADD */
 {{	uae_u32 src = srcreg;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_5088_3(uae_u32 opcode) /* ADDA */
@@ -11617,16 +9920,9 @@ unsigned long REGPARAM2 op_5090_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_5098_3(uae_u32 opcode) /* ADD */
@@ -11638,16 +9934,9 @@ unsigned long REGPARAM2 op_5098_3(uae_u32 opcode) /* ADD */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_50a0_3(uae_u32 opcode) /* ADD */
@@ -11660,16 +9949,9 @@ unsigned long REGPARAM2 op_50a0_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_50a8_3(uae_u32 opcode) /* ADD */
@@ -11680,16 +9962,9 @@ unsigned long REGPARAM2 op_50a8_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_50b0_3(uae_u32 opcode) /* ADD */
@@ -11700,16 +9975,9 @@ unsigned long REGPARAM2 op_50b0_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_50b8_3(uae_u32 opcode) /* ADD */
@@ -11719,16 +9987,9 @@ unsigned long REGPARAM2 op_50b8_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_50b9_3(uae_u32 opcode) /* ADD */
@@ -11738,16 +9999,9 @@ unsigned long REGPARAM2 op_50b9_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_50c0_3(uae_u32 opcode) /* Scc */
@@ -11853,16 +10107,9 @@ unsigned long REGPARAM2 op_5100_3(uae_u32 opcode) /* SUB */
 {{	uae_u32 src = srcreg;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_5110_3(uae_u32 opcode) /* SUB */
@@ -11873,16 +10120,9 @@ unsigned long REGPARAM2 op_5110_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5118_3(uae_u32 opcode) /* SUB */
@@ -11894,16 +10134,9 @@ unsigned long REGPARAM2 op_5118_3(uae_u32 opcode) /* SUB */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5120_3(uae_u32 opcode) /* SUB */
@@ -11916,16 +10149,9 @@ unsigned long REGPARAM2 op_5120_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5128_3(uae_u32 opcode) /* SUB */
@@ -11936,16 +10162,9 @@ unsigned long REGPARAM2 op_5128_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5130_3(uae_u32 opcode) /* SUB */
@@ -11956,16 +10175,9 @@ unsigned long REGPARAM2 op_5130_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5138_3(uae_u32 opcode) /* SUB */
@@ -11975,16 +10187,9 @@ unsigned long REGPARAM2 op_5138_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5139_3(uae_u32 opcode) /* SUB */
@@ -11994,16 +10199,9 @@ unsigned long REGPARAM2 op_5139_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_5140_3(uae_u32 opcode) /* SUB */
@@ -12013,16 +10211,9 @@ unsigned long REGPARAM2 op_5140_3(uae_u32 opcode) /* SUB */
 {{	uae_u32 src = srcreg;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_5148_3(uae_u32 opcode) /* SUBA */
@@ -12045,16 +10236,9 @@ unsigned long REGPARAM2 op_5150_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5158_3(uae_u32 opcode) /* SUB */
@@ -12066,16 +10250,9 @@ unsigned long REGPARAM2 op_5158_3(uae_u32 opcode) /* SUB */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5160_3(uae_u32 opcode) /* SUB */
@@ -12088,16 +10265,9 @@ unsigned long REGPARAM2 op_5160_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5168_3(uae_u32 opcode) /* SUB */
@@ -12108,16 +10278,9 @@ unsigned long REGPARAM2 op_5168_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5170_3(uae_u32 opcode) /* SUB */
@@ -12128,16 +10291,9 @@ unsigned long REGPARAM2 op_5170_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5178_3(uae_u32 opcode) /* SUB */
@@ -12147,16 +10303,9 @@ unsigned long REGPARAM2 op_5178_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5179_3(uae_u32 opcode) /* SUB */
@@ -12166,16 +10315,9 @@ unsigned long REGPARAM2 op_5179_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_5180_3(uae_u32 opcode) /* SUB */
@@ -12185,16 +10327,9 @@ unsigned long REGPARAM2 op_5180_3(uae_u32 opcode) /* SUB */
 {{	uae_u32 src = srcreg;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_5188_3(uae_u32 opcode) /* SUBA */
@@ -12217,16 +10352,9 @@ unsigned long REGPARAM2 op_5190_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_5198_3(uae_u32 opcode) /* SUB */
@@ -12238,16 +10366,9 @@ unsigned long REGPARAM2 op_5198_3(uae_u32 opcode) /* SUB */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_51a0_3(uae_u32 opcode) /* SUB */
@@ -12260,16 +10381,9 @@ unsigned long REGPARAM2 op_51a0_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_51a8_3(uae_u32 opcode) /* SUB */
@@ -12280,16 +10394,9 @@ unsigned long REGPARAM2 op_51a8_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_51b0_3(uae_u32 opcode) /* SUB */
@@ -12300,16 +10407,9 @@ unsigned long REGPARAM2 op_51b0_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_51b8_3(uae_u32 opcode) /* SUB */
@@ -12319,16 +10419,9 @@ unsigned long REGPARAM2 op_51b8_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_51b9_3(uae_u32 opcode) /* SUB */
@@ -12338,16 +10431,9 @@ unsigned long REGPARAM2 op_51b9_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_51c0_3(uae_u32 opcode) /* Scc */
@@ -14585,9 +12671,7 @@ unsigned long REGPARAM2 op_7000_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_u32 src = srcreg;
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 2;
@@ -14599,9 +12683,7 @@ unsigned long REGPARAM2 op_8000_3(uae_u32 opcode) /* OR */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 2;
@@ -14614,9 +12696,7 @@ unsigned long REGPARAM2 op_8010_3(uae_u32 opcode) /* OR */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -14630,9 +12710,7 @@ unsigned long REGPARAM2 op_8018_3(uae_u32 opcode) /* OR */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -14647,9 +12725,7 @@ unsigned long REGPARAM2 op_8020_3(uae_u32 opcode) /* OR */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -14662,9 +12738,7 @@ unsigned long REGPARAM2 op_8028_3(uae_u32 opcode) /* OR */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14677,9 +12751,7 @@ unsigned long REGPARAM2 op_8030_3(uae_u32 opcode) /* OR */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14691,9 +12763,7 @@ unsigned long REGPARAM2 op_8038_3(uae_u32 opcode) /* OR */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14705,9 +12775,7 @@ unsigned long REGPARAM2 op_8039_3(uae_u32 opcode) /* OR */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 return 8;
@@ -14720,9 +12788,7 @@ unsigned long REGPARAM2 op_803a_3(uae_u32 opcode) /* OR */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14735,9 +12801,7 @@ unsigned long REGPARAM2 op_803b_3(uae_u32 opcode) /* OR */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14748,9 +12812,7 @@ unsigned long REGPARAM2 op_803c_3(uae_u32 opcode) /* OR */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 4;
@@ -14762,9 +12824,7 @@ unsigned long REGPARAM2 op_8040_3(uae_u32 opcode) /* OR */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 2;
@@ -14777,9 +12837,7 @@ unsigned long REGPARAM2 op_8050_3(uae_u32 opcode) /* OR */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -14793,9 +12851,7 @@ unsigned long REGPARAM2 op_8058_3(uae_u32 opcode) /* OR */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -14810,9 +12866,7 @@ unsigned long REGPARAM2 op_8060_3(uae_u32 opcode) /* OR */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -14825,9 +12879,7 @@ unsigned long REGPARAM2 op_8068_3(uae_u32 opcode) /* OR */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14840,9 +12892,7 @@ unsigned long REGPARAM2 op_8070_3(uae_u32 opcode) /* OR */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14854,9 +12904,7 @@ unsigned long REGPARAM2 op_8078_3(uae_u32 opcode) /* OR */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14868,9 +12916,7 @@ unsigned long REGPARAM2 op_8079_3(uae_u32 opcode) /* OR */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 return 8;
@@ -14883,9 +12929,7 @@ unsigned long REGPARAM2 op_807a_3(uae_u32 opcode) /* OR */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14898,9 +12942,7 @@ unsigned long REGPARAM2 op_807b_3(uae_u32 opcode) /* OR */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14911,9 +12953,7 @@ unsigned long REGPARAM2 op_807c_3(uae_u32 opcode) /* OR */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 4;
@@ -14925,9 +12965,7 @@ unsigned long REGPARAM2 op_8080_3(uae_u32 opcode) /* OR */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 2;
@@ -14940,9 +12978,7 @@ unsigned long REGPARAM2 op_8090_3(uae_u32 opcode) /* OR */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -14956,9 +12992,7 @@ unsigned long REGPARAM2 op_8098_3(uae_u32 opcode) /* OR */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -14973,9 +13007,7 @@ unsigned long REGPARAM2 op_80a0_3(uae_u32 opcode) /* OR */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -14988,9 +13020,7 @@ unsigned long REGPARAM2 op_80a8_3(uae_u32 opcode) /* OR */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15003,9 +13033,7 @@ unsigned long REGPARAM2 op_80b0_3(uae_u32 opcode) /* OR */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15017,9 +13045,7 @@ unsigned long REGPARAM2 op_80b8_3(uae_u32 opcode) /* OR */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15031,9 +13057,7 @@ unsigned long REGPARAM2 op_80b9_3(uae_u32 opcode) /* OR */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 return 10;
@@ -15046,9 +13070,7 @@ unsigned long REGPARAM2 op_80ba_3(uae_u32 opcode) /* OR */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15061,9 +13083,7 @@ unsigned long REGPARAM2 op_80bb_3(uae_u32 opcode) /* OR */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15074,9 +13094,7 @@ unsigned long REGPARAM2 op_80bc_3(uae_u32 opcode) /* OR */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 6;
@@ -15093,9 +13111,7 @@ unsigned long REGPARAM2 op_80c0_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15117,9 +13133,7 @@ unsigned long REGPARAM2 op_80d0_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15142,9 +13156,7 @@ unsigned long REGPARAM2 op_80d8_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15168,9 +13180,7 @@ unsigned long REGPARAM2 op_80e0_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15192,9 +13202,7 @@ unsigned long REGPARAM2 op_80e8_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15216,9 +13224,7 @@ unsigned long REGPARAM2 op_80f0_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15239,9 +13245,7 @@ unsigned long REGPARAM2 op_80f8_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15262,9 +13266,7 @@ unsigned long REGPARAM2 op_80f9_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15286,9 +13288,7 @@ unsigned long REGPARAM2 op_80fa_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15310,9 +13310,7 @@ unsigned long REGPARAM2 op_80fb_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15332,9 +13330,7 @@ unsigned long REGPARAM2 op_80fc_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15405,9 +13401,7 @@ unsigned long REGPARAM2 op_8110_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -15421,9 +13415,7 @@ unsigned long REGPARAM2 op_8118_3(uae_u32 opcode) /* OR */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -15438,9 +13430,7 @@ unsigned long REGPARAM2 op_8120_3(uae_u32 opcode) /* OR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -15453,9 +13443,7 @@ unsigned long REGPARAM2 op_8128_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15468,9 +13456,7 @@ unsigned long REGPARAM2 op_8130_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15482,9 +13468,7 @@ unsigned long REGPARAM2 op_8138_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15496,9 +13480,7 @@ unsigned long REGPARAM2 op_8139_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -15511,9 +13493,7 @@ unsigned long REGPARAM2 op_8150_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -15527,9 +13507,7 @@ unsigned long REGPARAM2 op_8158_3(uae_u32 opcode) /* OR */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -15544,9 +13522,7 @@ unsigned long REGPARAM2 op_8160_3(uae_u32 opcode) /* OR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -15559,9 +13535,7 @@ unsigned long REGPARAM2 op_8168_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15574,9 +13548,7 @@ unsigned long REGPARAM2 op_8170_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15588,9 +13560,7 @@ unsigned long REGPARAM2 op_8178_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15602,9 +13572,7 @@ unsigned long REGPARAM2 op_8179_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -15617,9 +13585,7 @@ unsigned long REGPARAM2 op_8190_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -15633,9 +13599,7 @@ unsigned long REGPARAM2 op_8198_3(uae_u32 opcode) /* OR */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -15650,9 +13614,7 @@ unsigned long REGPARAM2 op_81a0_3(uae_u32 opcode) /* OR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -15665,9 +13627,7 @@ unsigned long REGPARAM2 op_81a8_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -15680,9 +13640,7 @@ unsigned long REGPARAM2 op_81b0_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -15694,9 +13652,7 @@ unsigned long REGPARAM2 op_81b8_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -15708,9 +13664,7 @@ unsigned long REGPARAM2 op_81b9_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -15728,9 +13682,7 @@ unsigned long REGPARAM2 op_81c0_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15753,9 +13705,7 @@ unsigned long REGPARAM2 op_81d0_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15779,9 +13729,7 @@ unsigned long REGPARAM2 op_81d8_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15806,9 +13754,7 @@ unsigned long REGPARAM2 op_81e0_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15831,9 +13777,7 @@ unsigned long REGPARAM2 op_81e8_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15856,9 +13800,7 @@ unsigned long REGPARAM2 op_81f0_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15880,9 +13822,7 @@ unsigned long REGPARAM2 op_81f8_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15904,9 +13844,7 @@ unsigned long REGPARAM2 op_81f9_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15929,9 +13867,7 @@ unsigned long REGPARAM2 op_81fa_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15954,9 +13890,7 @@ unsigned long REGPARAM2 op_81fb_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15977,9 +13911,7 @@ unsigned long REGPARAM2 op_81fc_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15995,16 +13927,9 @@ unsigned long REGPARAM2 op_9000_3(uae_u32 opcode) /* SUB */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_9010_3(uae_u32 opcode) /* SUB */
@@ -16015,16 +13940,9 @@ unsigned long REGPARAM2 op_9010_3(uae_u32 opcode) /* SUB */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_9018_3(uae_u32 opcode) /* SUB */
@@ -16036,16 +13954,9 @@ unsigned long REGPARAM2 op_9018_3(uae_u32 opcode) /* SUB */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_9020_3(uae_u32 opcode) /* SUB */
@@ -16058,16 +13969,9 @@ unsigned long REGPARAM2 op_9020_3(uae_u32 opcode) /* SUB */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_9028_3(uae_u32 opcode) /* SUB */
@@ -16078,16 +13982,9 @@ unsigned long REGPARAM2 op_9028_3(uae_u32 opcode) /* SUB */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_9030_3(uae_u32 opcode) /* SUB */
@@ -16098,16 +13995,9 @@ unsigned long REGPARAM2 op_9030_3(uae_u32 opcode) /* SUB */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_9038_3(uae_u32 opcode) /* SUB */
@@ -16117,16 +14007,9 @@ unsigned long REGPARAM2 op_9038_3(uae_u32 opcode) /* SUB */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_9039_3(uae_u32 opcode) /* SUB */
@@ -16136,16 +14019,9 @@ unsigned long REGPARAM2 op_9039_3(uae_u32 opcode) /* SUB */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_903a_3(uae_u32 opcode) /* SUB */
@@ -16156,16 +14032,9 @@ unsigned long REGPARAM2 op_903a_3(uae_u32 opcode) /* SUB */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_903b_3(uae_u32 opcode) /* SUB */
@@ -16176,16 +14045,9 @@ unsigned long REGPARAM2 op_903b_3(uae_u32 opcode) /* SUB */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_903c_3(uae_u32 opcode) /* SUB */
@@ -16194,16 +14056,9 @@ unsigned long REGPARAM2 op_903c_3(uae_u32 opcode) /* SUB */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_9040_3(uae_u32 opcode) /* SUB */
@@ -16213,16 +14068,9 @@ unsigned long REGPARAM2 op_9040_3(uae_u32 opcode) /* SUB */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_9048_3(uae_u32 opcode) /* SUB */
@@ -16232,16 +14080,9 @@ unsigned long REGPARAM2 op_9048_3(uae_u32 opcode) /* SUB */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_9050_3(uae_u32 opcode) /* SUB */
@@ -16252,16 +14093,9 @@ unsigned long REGPARAM2 op_9050_3(uae_u32 opcode) /* SUB */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_9058_3(uae_u32 opcode) /* SUB */
@@ -16273,16 +14107,9 @@ unsigned long REGPARAM2 op_9058_3(uae_u32 opcode) /* SUB */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_9060_3(uae_u32 opcode) /* SUB */
@@ -16295,16 +14122,9 @@ unsigned long REGPARAM2 op_9060_3(uae_u32 opcode) /* SUB */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_9068_3(uae_u32 opcode) /* SUB */
@@ -16315,16 +14135,9 @@ unsigned long REGPARAM2 op_9068_3(uae_u32 opcode) /* SUB */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_9070_3(uae_u32 opcode) /* SUB */
@@ -16335,16 +14148,9 @@ unsigned long REGPARAM2 op_9070_3(uae_u32 opcode) /* SUB */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_9078_3(uae_u32 opcode) /* SUB */
@@ -16354,16 +14160,9 @@ unsigned long REGPARAM2 op_9078_3(uae_u32 opcode) /* SUB */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_9079_3(uae_u32 opcode) /* SUB */
@@ -16373,16 +14172,9 @@ unsigned long REGPARAM2 op_9079_3(uae_u32 opcode) /* SUB */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_907a_3(uae_u32 opcode) /* SUB */
@@ -16393,16 +14185,9 @@ unsigned long REGPARAM2 op_907a_3(uae_u32 opcode) /* SUB */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_907b_3(uae_u32 opcode) /* SUB */
@@ -16413,16 +14198,9 @@ unsigned long REGPARAM2 op_907b_3(uae_u32 opcode) /* SUB */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_907c_3(uae_u32 opcode) /* SUB */
@@ -16431,16 +14209,9 @@ unsigned long REGPARAM2 op_907c_3(uae_u32 opcode) /* SUB */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_9080_3(uae_u32 opcode) /* SUB */
@@ -16450,16 +14221,9 @@ unsigned long REGPARAM2 op_9080_3(uae_u32 opcode) /* SUB */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_9088_3(uae_u32 opcode) /* SUB */
@@ -16469,16 +14233,9 @@ unsigned long REGPARAM2 op_9088_3(uae_u32 opcode) /* SUB */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_9090_3(uae_u32 opcode) /* SUB */
@@ -16489,16 +14246,9 @@ unsigned long REGPARAM2 op_9090_3(uae_u32 opcode) /* SUB */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_9098_3(uae_u32 opcode) /* SUB */
@@ -16510,16 +14260,9 @@ unsigned long REGPARAM2 op_9098_3(uae_u32 opcode) /* SUB */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_90a0_3(uae_u32 opcode) /* SUB */
@@ -16532,16 +14275,9 @@ unsigned long REGPARAM2 op_90a0_3(uae_u32 opcode) /* SUB */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_90a8_3(uae_u32 opcode) /* SUB */
@@ -16552,16 +14288,9 @@ unsigned long REGPARAM2 op_90a8_3(uae_u32 opcode) /* SUB */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_90b0_3(uae_u32 opcode) /* SUB */
@@ -16572,16 +14301,9 @@ unsigned long REGPARAM2 op_90b0_3(uae_u32 opcode) /* SUB */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_90b8_3(uae_u32 opcode) /* SUB */
@@ -16591,16 +14313,9 @@ unsigned long REGPARAM2 op_90b8_3(uae_u32 opcode) /* SUB */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_90b9_3(uae_u32 opcode) /* SUB */
@@ -16610,16 +14325,9 @@ unsigned long REGPARAM2 op_90b9_3(uae_u32 opcode) /* SUB */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_90ba_3(uae_u32 opcode) /* SUB */
@@ -16630,16 +14338,9 @@ unsigned long REGPARAM2 op_90ba_3(uae_u32 opcode) /* SUB */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_90bb_3(uae_u32 opcode) /* SUB */
@@ -16650,16 +14351,9 @@ unsigned long REGPARAM2 op_90bb_3(uae_u32 opcode) /* SUB */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_90bc_3(uae_u32 opcode) /* SUB */
@@ -16668,16 +14362,9 @@ unsigned long REGPARAM2 op_90bc_3(uae_u32 opcode) /* SUB */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 6;
 }
 unsigned long REGPARAM2 op_90c0_3(uae_u32 opcode) /* SUBA */
@@ -16885,16 +14572,9 @@ unsigned long REGPARAM2 op_9110_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_9118_3(uae_u32 opcode) /* SUB */
@@ -16906,16 +14586,9 @@ unsigned long REGPARAM2 op_9118_3(uae_u32 opcode) /* SUB */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_9120_3(uae_u32 opcode) /* SUB */
@@ -16928,16 +14601,9 @@ unsigned long REGPARAM2 op_9120_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_9128_3(uae_u32 opcode) /* SUB */
@@ -16948,16 +14614,9 @@ unsigned long REGPARAM2 op_9128_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_9130_3(uae_u32 opcode) /* SUB */
@@ -16968,16 +14627,9 @@ unsigned long REGPARAM2 op_9130_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_9138_3(uae_u32 opcode) /* SUB */
@@ -16987,16 +14639,9 @@ unsigned long REGPARAM2 op_9138_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_9139_3(uae_u32 opcode) /* SUB */
@@ -17006,16 +14651,9 @@ unsigned long REGPARAM2 op_9139_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_9140_3(uae_u32 opcode) /* SUBX */
@@ -17070,16 +14708,9 @@ unsigned long REGPARAM2 op_9150_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_9158_3(uae_u32 opcode) /* SUB */
@@ -17091,16 +14722,9 @@ unsigned long REGPARAM2 op_9158_3(uae_u32 opcode) /* SUB */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_9160_3(uae_u32 opcode) /* SUB */
@@ -17113,16 +14737,9 @@ unsigned long REGPARAM2 op_9160_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_9168_3(uae_u32 opcode) /* SUB */
@@ -17133,16 +14750,9 @@ unsigned long REGPARAM2 op_9168_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_9170_3(uae_u32 opcode) /* SUB */
@@ -17153,16 +14763,9 @@ unsigned long REGPARAM2 op_9170_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_9178_3(uae_u32 opcode) /* SUB */
@@ -17172,16 +14775,9 @@ unsigned long REGPARAM2 op_9178_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_9179_3(uae_u32 opcode) /* SUB */
@@ -17191,16 +14787,9 @@ unsigned long REGPARAM2 op_9179_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_9180_3(uae_u32 opcode) /* SUBX */
@@ -17255,16 +14844,9 @@ unsigned long REGPARAM2 op_9190_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_9198_3(uae_u32 opcode) /* SUB */
@@ -17276,16 +14858,9 @@ unsigned long REGPARAM2 op_9198_3(uae_u32 opcode) /* SUB */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_91a0_3(uae_u32 opcode) /* SUB */
@@ -17298,16 +14873,9 @@ unsigned long REGPARAM2 op_91a0_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_91a8_3(uae_u32 opcode) /* SUB */
@@ -17318,16 +14886,9 @@ unsigned long REGPARAM2 op_91a8_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_91b0_3(uae_u32 opcode) /* SUB */
@@ -17338,16 +14899,9 @@ unsigned long REGPARAM2 op_91b0_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_91b8_3(uae_u32 opcode) /* SUB */
@@ -17357,16 +14911,9 @@ unsigned long REGPARAM2 op_91b8_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_91b9_3(uae_u32 opcode) /* SUB */
@@ -17376,16 +14923,9 @@ unsigned long REGPARAM2 op_91b9_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_SUB, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_91c0_3(uae_u32 opcode) /* SUBA */
@@ -17548,14 +15088,8 @@ unsigned long REGPARAM2 op_b000_3(uae_u32 opcode) /* CMP */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b010_3(uae_u32 opcode) /* CMP */
@@ -17566,14 +15100,8 @@ unsigned long REGPARAM2 op_b010_3(uae_u32 opcode) /* CMP */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 #endif
@@ -17588,14 +15116,8 @@ unsigned long REGPARAM2 op_b018_3(uae_u32 opcode) /* CMP */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b020_3(uae_u32 opcode) /* CMP */
@@ -17608,14 +15130,8 @@ unsigned long REGPARAM2 op_b020_3(uae_u32 opcode) /* CMP */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b028_3(uae_u32 opcode) /* CMP */
@@ -17626,14 +15142,8 @@ unsigned long REGPARAM2 op_b028_3(uae_u32 opcode) /* CMP */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b030_3(uae_u32 opcode) /* CMP */
@@ -17644,14 +15154,8 @@ unsigned long REGPARAM2 op_b030_3(uae_u32 opcode) /* CMP */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b038_3(uae_u32 opcode) /* CMP */
@@ -17661,14 +15165,8 @@ unsigned long REGPARAM2 op_b038_3(uae_u32 opcode) /* CMP */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b039_3(uae_u32 opcode) /* CMP */
@@ -17678,14 +15176,8 @@ unsigned long REGPARAM2 op_b039_3(uae_u32 opcode) /* CMP */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_b03a_3(uae_u32 opcode) /* CMP */
@@ -17696,14 +15188,8 @@ unsigned long REGPARAM2 op_b03a_3(uae_u32 opcode) /* CMP */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b03b_3(uae_u32 opcode) /* CMP */
@@ -17714,14 +15200,8 @@ unsigned long REGPARAM2 op_b03b_3(uae_u32 opcode) /* CMP */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b03c_3(uae_u32 opcode) /* CMP */
@@ -17730,14 +15210,8 @@ unsigned long REGPARAM2 op_b03c_3(uae_u32 opcode) /* CMP */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_b040_3(uae_u32 opcode) /* CMP */
@@ -17747,14 +15221,8 @@ unsigned long REGPARAM2 op_b040_3(uae_u32 opcode) /* CMP */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b048_3(uae_u32 opcode) /* CMP */
@@ -17764,14 +15232,8 @@ unsigned long REGPARAM2 op_b048_3(uae_u32 opcode) /* CMP */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b050_3(uae_u32 opcode) /* CMP */
@@ -17782,14 +15244,8 @@ unsigned long REGPARAM2 op_b050_3(uae_u32 opcode) /* CMP */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b058_3(uae_u32 opcode) /* CMP */
@@ -17801,14 +15257,8 @@ unsigned long REGPARAM2 op_b058_3(uae_u32 opcode) /* CMP */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b060_3(uae_u32 opcode) /* CMP */
@@ -17821,14 +15271,8 @@ unsigned long REGPARAM2 op_b060_3(uae_u32 opcode) /* CMP */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b068_3(uae_u32 opcode) /* CMP */
@@ -17839,14 +15283,8 @@ unsigned long REGPARAM2 op_b068_3(uae_u32 opcode) /* CMP */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b070_3(uae_u32 opcode) /* CMP */
@@ -17857,14 +15295,8 @@ unsigned long REGPARAM2 op_b070_3(uae_u32 opcode) /* CMP */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b078_3(uae_u32 opcode) /* CMP */
@@ -17874,14 +15306,8 @@ unsigned long REGPARAM2 op_b078_3(uae_u32 opcode) /* CMP */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b079_3(uae_u32 opcode) /* CMP */
@@ -17891,14 +15317,8 @@ unsigned long REGPARAM2 op_b079_3(uae_u32 opcode) /* CMP */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_b07a_3(uae_u32 opcode) /* CMP */
@@ -17909,14 +15329,8 @@ unsigned long REGPARAM2 op_b07a_3(uae_u32 opcode) /* CMP */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b07b_3(uae_u32 opcode) /* CMP */
@@ -17927,14 +15341,8 @@ unsigned long REGPARAM2 op_b07b_3(uae_u32 opcode) /* CMP */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b07c_3(uae_u32 opcode) /* CMP */
@@ -17943,14 +15351,8 @@ unsigned long REGPARAM2 op_b07c_3(uae_u32 opcode) /* CMP */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_b080_3(uae_u32 opcode) /* CMP */
@@ -17960,14 +15362,8 @@ unsigned long REGPARAM2 op_b080_3(uae_u32 opcode) /* CMP */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b088_3(uae_u32 opcode) /* CMP */
@@ -17977,14 +15373,8 @@ unsigned long REGPARAM2 op_b088_3(uae_u32 opcode) /* CMP */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b090_3(uae_u32 opcode) /* CMP */
@@ -17995,14 +15385,8 @@ unsigned long REGPARAM2 op_b090_3(uae_u32 opcode) /* CMP */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b098_3(uae_u32 opcode) /* CMP */
@@ -18014,14 +15398,8 @@ unsigned long REGPARAM2 op_b098_3(uae_u32 opcode) /* CMP */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b0a0_3(uae_u32 opcode) /* CMP */
@@ -18034,14 +15412,8 @@ unsigned long REGPARAM2 op_b0a0_3(uae_u32 opcode) /* CMP */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b0a8_3(uae_u32 opcode) /* CMP */
@@ -18052,14 +15424,8 @@ unsigned long REGPARAM2 op_b0a8_3(uae_u32 opcode) /* CMP */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b0b0_3(uae_u32 opcode) /* CMP */
@@ -18070,14 +15436,8 @@ unsigned long REGPARAM2 op_b0b0_3(uae_u32 opcode) /* CMP */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b0b8_3(uae_u32 opcode) /* CMP */
@@ -18087,14 +15447,8 @@ unsigned long REGPARAM2 op_b0b8_3(uae_u32 opcode) /* CMP */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b0b9_3(uae_u32 opcode) /* CMP */
@@ -18104,14 +15458,8 @@ unsigned long REGPARAM2 op_b0b9_3(uae_u32 opcode) /* CMP */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_b0ba_3(uae_u32 opcode) /* CMP */
@@ -18122,14 +15470,8 @@ unsigned long REGPARAM2 op_b0ba_3(uae_u32 opcode) /* CMP */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b0bb_3(uae_u32 opcode) /* CMP */
@@ -18140,14 +15482,8 @@ unsigned long REGPARAM2 op_b0bb_3(uae_u32 opcode) /* CMP */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b0bc_3(uae_u32 opcode) /* CMP */
@@ -18156,14 +15492,8 @@ unsigned long REGPARAM2 op_b0bc_3(uae_u32 opcode) /* CMP */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}m68k_incpc(6);
 return 6;
 }
 unsigned long REGPARAM2 op_b0c0_3(uae_u32 opcode) /* CMPA */
@@ -18173,14 +15503,8 @@ unsigned long REGPARAM2 op_b0c0_3(uae_u32 opcode) /* CMPA */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b0c8_3(uae_u32 opcode) /* CMPA */
@@ -18190,14 +15514,8 @@ unsigned long REGPARAM2 op_b0c8_3(uae_u32 opcode) /* CMPA */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b0d0_3(uae_u32 opcode) /* CMPA */
@@ -18208,14 +15526,8 @@ unsigned long REGPARAM2 op_b0d0_3(uae_u32 opcode) /* CMPA */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b0d8_3(uae_u32 opcode) /* CMPA */
@@ -18227,14 +15539,8 @@ unsigned long REGPARAM2 op_b0d8_3(uae_u32 opcode) /* CMPA */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b0e0_3(uae_u32 opcode) /* CMPA */
@@ -18247,14 +15553,8 @@ unsigned long REGPARAM2 op_b0e0_3(uae_u32 opcode) /* CMPA */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b0e8_3(uae_u32 opcode) /* CMPA */
@@ -18265,14 +15565,8 @@ unsigned long REGPARAM2 op_b0e8_3(uae_u32 opcode) /* CMPA */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b0f0_3(uae_u32 opcode) /* CMPA */
@@ -18283,14 +15577,8 @@ unsigned long REGPARAM2 op_b0f0_3(uae_u32 opcode) /* CMPA */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b0f8_3(uae_u32 opcode) /* CMPA */
@@ -18300,14 +15588,8 @@ unsigned long REGPARAM2 op_b0f8_3(uae_u32 opcode) /* CMPA */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b0f9_3(uae_u32 opcode) /* CMPA */
@@ -18317,14 +15599,8 @@ unsigned long REGPARAM2 op_b0f9_3(uae_u32 opcode) /* CMPA */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_b0fa_3(uae_u32 opcode) /* CMPA */
@@ -18335,14 +15611,8 @@ unsigned long REGPARAM2 op_b0fa_3(uae_u32 opcode) /* CMPA */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b0fb_3(uae_u32 opcode) /* CMPA */
@@ -18353,14 +15623,8 @@ unsigned long REGPARAM2 op_b0fb_3(uae_u32 opcode) /* CMPA */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b0fc_3(uae_u32 opcode) /* CMPA */
@@ -18369,14 +15633,8 @@ unsigned long REGPARAM2 op_b0fc_3(uae_u32 opcode) /* CMPA */
 {{	uae_s16 src = get_iword(2);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_b100_3(uae_u32 opcode) /* EOR */
@@ -18386,9 +15644,7 @@ unsigned long REGPARAM2 op_b100_3(uae_u32 opcode) /* EOR */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 2;
@@ -18404,14 +15660,8 @@ unsigned long REGPARAM2 op_b108_3(uae_u32 opcode) /* CMPM */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 0), src, dst, newv);
+}}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b110_3(uae_u32 opcode) /* EOR */
@@ -18422,9 +15672,7 @@ unsigned long REGPARAM2 op_b110_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -18438,9 +15686,7 @@ unsigned long REGPARAM2 op_b118_3(uae_u32 opcode) /* EOR */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -18455,9 +15701,7 @@ unsigned long REGPARAM2 op_b120_3(uae_u32 opcode) /* EOR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -18470,9 +15714,7 @@ unsigned long REGPARAM2 op_b128_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -18485,9 +15727,7 @@ unsigned long REGPARAM2 op_b130_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -18499,9 +15739,7 @@ unsigned long REGPARAM2 op_b138_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -18513,9 +15751,7 @@ unsigned long REGPARAM2 op_b139_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -18527,9 +15763,7 @@ unsigned long REGPARAM2 op_b140_3(uae_u32 opcode) /* EOR */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 2;
@@ -18545,14 +15779,8 @@ unsigned long REGPARAM2 op_b148_3(uae_u32 opcode) /* CMPM */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 1), src, dst, newv);
+}}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b150_3(uae_u32 opcode) /* EOR */
@@ -18563,9 +15791,7 @@ unsigned long REGPARAM2 op_b150_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -18579,9 +15805,7 @@ unsigned long REGPARAM2 op_b158_3(uae_u32 opcode) /* EOR */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -18596,9 +15820,7 @@ unsigned long REGPARAM2 op_b160_3(uae_u32 opcode) /* EOR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -18611,9 +15833,7 @@ unsigned long REGPARAM2 op_b168_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -18626,9 +15846,7 @@ unsigned long REGPARAM2 op_b170_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -18640,9 +15858,7 @@ unsigned long REGPARAM2 op_b178_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -18654,9 +15870,7 @@ unsigned long REGPARAM2 op_b179_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -18668,9 +15882,7 @@ unsigned long REGPARAM2 op_b180_3(uae_u32 opcode) /* EOR */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 2;
@@ -18686,14 +15898,8 @@ unsigned long REGPARAM2 op_b188_3(uae_u32 opcode) /* CMPM */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_b190_3(uae_u32 opcode) /* EOR */
@@ -18704,9 +15910,7 @@ unsigned long REGPARAM2 op_b190_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -18720,9 +15924,7 @@ unsigned long REGPARAM2 op_b198_3(uae_u32 opcode) /* EOR */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -18737,9 +15939,7 @@ unsigned long REGPARAM2 op_b1a0_3(uae_u32 opcode) /* EOR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -18752,9 +15952,7 @@ unsigned long REGPARAM2 op_b1a8_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -18767,9 +15965,7 @@ unsigned long REGPARAM2 op_b1b0_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -18781,9 +15977,7 @@ unsigned long REGPARAM2 op_b1b8_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -18795,9 +15989,7 @@ unsigned long REGPARAM2 op_b1b9_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -18809,14 +16001,8 @@ unsigned long REGPARAM2 op_b1c0_3(uae_u32 opcode) /* CMPA */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b1c8_3(uae_u32 opcode) /* CMPA */
@@ -18826,14 +16012,8 @@ unsigned long REGPARAM2 op_b1c8_3(uae_u32 opcode) /* CMPA */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b1d0_3(uae_u32 opcode) /* CMPA */
@@ -18844,14 +16024,8 @@ unsigned long REGPARAM2 op_b1d0_3(uae_u32 opcode) /* CMPA */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b1d8_3(uae_u32 opcode) /* CMPA */
@@ -18863,14 +16037,8 @@ unsigned long REGPARAM2 op_b1d8_3(uae_u32 opcode) /* CMPA */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b1e0_3(uae_u32 opcode) /* CMPA */
@@ -18883,14 +16051,8 @@ unsigned long REGPARAM2 op_b1e0_3(uae_u32 opcode) /* CMPA */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b1e8_3(uae_u32 opcode) /* CMPA */
@@ -18901,14 +16063,8 @@ unsigned long REGPARAM2 op_b1e8_3(uae_u32 opcode) /* CMPA */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b1f0_3(uae_u32 opcode) /* CMPA */
@@ -18919,14 +16075,8 @@ unsigned long REGPARAM2 op_b1f0_3(uae_u32 opcode) /* CMPA */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b1f8_3(uae_u32 opcode) /* CMPA */
@@ -18936,14 +16086,8 @@ unsigned long REGPARAM2 op_b1f8_3(uae_u32 opcode) /* CMPA */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b1f9_3(uae_u32 opcode) /* CMPA */
@@ -18953,14 +16097,8 @@ unsigned long REGPARAM2 op_b1f9_3(uae_u32 opcode) /* CMPA */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_b1fa_3(uae_u32 opcode) /* CMPA */
@@ -18971,14 +16109,8 @@ unsigned long REGPARAM2 op_b1fa_3(uae_u32 opcode) /* CMPA */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b1fb_3(uae_u32 opcode) /* CMPA */
@@ -18989,14 +16121,8 @@ unsigned long REGPARAM2 op_b1fb_3(uae_u32 opcode) /* CMPA */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b1fc_3(uae_u32 opcode) /* CMPA */
@@ -19005,14 +16131,8 @@ unsigned long REGPARAM2 op_b1fc_3(uae_u32 opcode) /* CMPA */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_CMP, 2), src, dst, newv);
+}}}}}m68k_incpc(6);
 return 6;
 }
 unsigned long REGPARAM2 op_c000_3(uae_u32 opcode) /* AND */
@@ -19022,9 +16142,7 @@ unsigned long REGPARAM2 op_c000_3(uae_u32 opcode) /* AND */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 2;
@@ -19037,9 +16155,7 @@ unsigned long REGPARAM2 op_c010_3(uae_u32 opcode) /* AND */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -19053,9 +16169,7 @@ unsigned long REGPARAM2 op_c018_3(uae_u32 opcode) /* AND */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -19070,9 +16184,7 @@ unsigned long REGPARAM2 op_c020_3(uae_u32 opcode) /* AND */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -19085,9 +16197,7 @@ unsigned long REGPARAM2 op_c028_3(uae_u32 opcode) /* AND */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19100,9 +16210,7 @@ unsigned long REGPARAM2 op_c030_3(uae_u32 opcode) /* AND */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19114,9 +16222,7 @@ unsigned long REGPARAM2 op_c038_3(uae_u32 opcode) /* AND */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19128,9 +16234,7 @@ unsigned long REGPARAM2 op_c039_3(uae_u32 opcode) /* AND */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 return 8;
@@ -19143,9 +16247,7 @@ unsigned long REGPARAM2 op_c03a_3(uae_u32 opcode) /* AND */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19158,9 +16260,7 @@ unsigned long REGPARAM2 op_c03b_3(uae_u32 opcode) /* AND */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19171,9 +16271,7 @@ unsigned long REGPARAM2 op_c03c_3(uae_u32 opcode) /* AND */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 4;
@@ -19185,9 +16283,7 @@ unsigned long REGPARAM2 op_c040_3(uae_u32 opcode) /* AND */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 2;
@@ -19200,9 +16296,7 @@ unsigned long REGPARAM2 op_c050_3(uae_u32 opcode) /* AND */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -19216,9 +16310,7 @@ unsigned long REGPARAM2 op_c058_3(uae_u32 opcode) /* AND */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -19233,9 +16325,7 @@ unsigned long REGPARAM2 op_c060_3(uae_u32 opcode) /* AND */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -19248,9 +16338,7 @@ unsigned long REGPARAM2 op_c068_3(uae_u32 opcode) /* AND */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19263,9 +16351,7 @@ unsigned long REGPARAM2 op_c070_3(uae_u32 opcode) /* AND */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19277,9 +16363,7 @@ unsigned long REGPARAM2 op_c078_3(uae_u32 opcode) /* AND */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19291,9 +16375,7 @@ unsigned long REGPARAM2 op_c079_3(uae_u32 opcode) /* AND */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 return 8;
@@ -19306,9 +16388,7 @@ unsigned long REGPARAM2 op_c07a_3(uae_u32 opcode) /* AND */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19321,9 +16401,7 @@ unsigned long REGPARAM2 op_c07b_3(uae_u32 opcode) /* AND */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19334,9 +16412,7 @@ unsigned long REGPARAM2 op_c07c_3(uae_u32 opcode) /* AND */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 4;
@@ -19348,9 +16424,7 @@ unsigned long REGPARAM2 op_c080_3(uae_u32 opcode) /* AND */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 2;
@@ -19363,9 +16437,7 @@ unsigned long REGPARAM2 op_c090_3(uae_u32 opcode) /* AND */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19379,9 +16451,7 @@ unsigned long REGPARAM2 op_c098_3(uae_u32 opcode) /* AND */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19396,9 +16466,7 @@ unsigned long REGPARAM2 op_c0a0_3(uae_u32 opcode) /* AND */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19411,9 +16479,7 @@ unsigned long REGPARAM2 op_c0a8_3(uae_u32 opcode) /* AND */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19426,9 +16492,7 @@ unsigned long REGPARAM2 op_c0b0_3(uae_u32 opcode) /* AND */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19440,9 +16504,7 @@ unsigned long REGPARAM2 op_c0b8_3(uae_u32 opcode) /* AND */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19454,9 +16516,7 @@ unsigned long REGPARAM2 op_c0b9_3(uae_u32 opcode) /* AND */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 return 10;
@@ -19469,9 +16529,7 @@ unsigned long REGPARAM2 op_c0ba_3(uae_u32 opcode) /* AND */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19484,9 +16542,7 @@ unsigned long REGPARAM2 op_c0bb_3(uae_u32 opcode) /* AND */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19497,9 +16553,7 @@ unsigned long REGPARAM2 op_c0bc_3(uae_u32 opcode) /* AND */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 6;
@@ -19511,9 +16565,7 @@ unsigned long REGPARAM2 op_c0c0_3(uae_u32 opcode) /* MULU */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(2);
 return 34;
@@ -19526,9 +16578,7 @@ unsigned long REGPARAM2 op_c0d0_3(uae_u32 opcode) /* MULU */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 return 36;
@@ -19542,9 +16592,7 @@ unsigned long REGPARAM2 op_c0d8_3(uae_u32 opcode) /* MULU */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 return 36;
@@ -19559,9 +16607,7 @@ unsigned long REGPARAM2 op_c0e0_3(uae_u32 opcode) /* MULU */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 return 36;
@@ -19574,9 +16620,7 @@ unsigned long REGPARAM2 op_c0e8_3(uae_u32 opcode) /* MULU */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -19589,9 +16633,7 @@ unsigned long REGPARAM2 op_c0f0_3(uae_u32 opcode) /* MULU */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -19603,9 +16645,7 @@ unsigned long REGPARAM2 op_c0f8_3(uae_u32 opcode) /* MULU */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -19617,9 +16657,7 @@ unsigned long REGPARAM2 op_c0f9_3(uae_u32 opcode) /* MULU */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(6);
 return 40;
@@ -19632,9 +16670,7 @@ unsigned long REGPARAM2 op_c0fa_3(uae_u32 opcode) /* MULU */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -19647,9 +16683,7 @@ unsigned long REGPARAM2 op_c0fb_3(uae_u32 opcode) /* MULU */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -19660,9 +16694,7 @@ unsigned long REGPARAM2 op_c0fc_3(uae_u32 opcode) /* MULU */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(4);
 return 36;
@@ -19729,9 +16761,7 @@ unsigned long REGPARAM2 op_c110_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19745,9 +16775,7 @@ unsigned long REGPARAM2 op_c118_3(uae_u32 opcode) /* AND */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19762,9 +16790,7 @@ unsigned long REGPARAM2 op_c120_3(uae_u32 opcode) /* AND */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19777,9 +16803,7 @@ unsigned long REGPARAM2 op_c128_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19792,9 +16816,7 @@ unsigned long REGPARAM2 op_c130_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19806,9 +16828,7 @@ unsigned long REGPARAM2 op_c138_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19820,9 +16840,7 @@ unsigned long REGPARAM2 op_c139_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 0), src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -19859,9 +16877,7 @@ unsigned long REGPARAM2 op_c150_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19875,9 +16891,7 @@ unsigned long REGPARAM2 op_c158_3(uae_u32 opcode) /* AND */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19892,9 +16906,7 @@ unsigned long REGPARAM2 op_c160_3(uae_u32 opcode) /* AND */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19907,9 +16919,7 @@ unsigned long REGPARAM2 op_c168_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19922,9 +16932,7 @@ unsigned long REGPARAM2 op_c170_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19936,9 +16944,7 @@ unsigned long REGPARAM2 op_c178_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19950,9 +16956,7 @@ unsigned long REGPARAM2 op_c179_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -19977,9 +16981,7 @@ unsigned long REGPARAM2 op_c190_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -19993,9 +16995,7 @@ unsigned long REGPARAM2 op_c198_3(uae_u32 opcode) /* AND */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -20010,9 +17010,7 @@ unsigned long REGPARAM2 op_c1a0_3(uae_u32 opcode) /* AND */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -20025,9 +17023,7 @@ unsigned long REGPARAM2 op_c1a8_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -20040,9 +17036,7 @@ unsigned long REGPARAM2 op_c1b0_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -20054,9 +17048,7 @@ unsigned long REGPARAM2 op_c1b8_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -20068,9 +17060,7 @@ unsigned long REGPARAM2 op_c1b9_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -20082,9 +17072,7 @@ unsigned long REGPARAM2 op_c1c0_3(uae_u32 opcode) /* MULS */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(2);
 return 34;
@@ -20097,9 +17085,7 @@ unsigned long REGPARAM2 op_c1d0_3(uae_u32 opcode) /* MULS */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 return 36;
@@ -20113,9 +17099,7 @@ unsigned long REGPARAM2 op_c1d8_3(uae_u32 opcode) /* MULS */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 return 36;
@@ -20130,9 +17114,7 @@ unsigned long REGPARAM2 op_c1e0_3(uae_u32 opcode) /* MULS */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 return 36;
@@ -20145,9 +17127,7 @@ unsigned long REGPARAM2 op_c1e8_3(uae_u32 opcode) /* MULS */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -20160,9 +17140,7 @@ unsigned long REGPARAM2 op_c1f0_3(uae_u32 opcode) /* MULS */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -20174,9 +17152,7 @@ unsigned long REGPARAM2 op_c1f8_3(uae_u32 opcode) /* MULS */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -20188,9 +17164,7 @@ unsigned long REGPARAM2 op_c1f9_3(uae_u32 opcode) /* MULS */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(6);
 return 40;
@@ -20203,9 +17177,7 @@ unsigned long REGPARAM2 op_c1fa_3(uae_u32 opcode) /* MULS */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -20218,9 +17190,7 @@ unsigned long REGPARAM2 op_c1fb_3(uae_u32 opcode) /* MULS */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -20231,9 +17201,7 @@ unsigned long REGPARAM2 op_c1fc_3(uae_u32 opcode) /* MULS */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 2), newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(4);
 return 36;
@@ -20245,16 +17213,9 @@ unsigned long REGPARAM2 op_d000_3(uae_u32 opcode) /* ADD */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_d010_3(uae_u32 opcode) /* ADD */
@@ -20265,16 +17226,9 @@ unsigned long REGPARAM2 op_d010_3(uae_u32 opcode) /* ADD */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_d018_3(uae_u32 opcode) /* ADD */
@@ -20286,16 +17240,9 @@ unsigned long REGPARAM2 op_d018_3(uae_u32 opcode) /* ADD */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_d020_3(uae_u32 opcode) /* ADD */
@@ -20308,16 +17255,9 @@ unsigned long REGPARAM2 op_d020_3(uae_u32 opcode) /* ADD */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_d028_3(uae_u32 opcode) /* ADD */
@@ -20328,16 +17268,9 @@ unsigned long REGPARAM2 op_d028_3(uae_u32 opcode) /* ADD */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d030_3(uae_u32 opcode) /* ADD */
@@ -20348,16 +17281,9 @@ unsigned long REGPARAM2 op_d030_3(uae_u32 opcode) /* ADD */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d038_3(uae_u32 opcode) /* ADD */
@@ -20367,16 +17293,9 @@ unsigned long REGPARAM2 op_d038_3(uae_u32 opcode) /* ADD */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d039_3(uae_u32 opcode) /* ADD */
@@ -20386,16 +17305,9 @@ unsigned long REGPARAM2 op_d039_3(uae_u32 opcode) /* ADD */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_d03a_3(uae_u32 opcode) /* ADD */
@@ -20406,16 +17318,9 @@ unsigned long REGPARAM2 op_d03a_3(uae_u32 opcode) /* ADD */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d03b_3(uae_u32 opcode) /* ADD */
@@ -20426,16 +17331,9 @@ unsigned long REGPARAM2 op_d03b_3(uae_u32 opcode) /* ADD */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d03c_3(uae_u32 opcode) /* ADD */
@@ -20444,16 +17342,9 @@ unsigned long REGPARAM2 op_d03c_3(uae_u32 opcode) /* ADD */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_d040_3(uae_u32 opcode) /* ADD */
@@ -20463,16 +17354,9 @@ unsigned long REGPARAM2 op_d040_3(uae_u32 opcode) /* ADD */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_d048_3(uae_u32 opcode) /* ADD */
@@ -20482,16 +17366,9 @@ unsigned long REGPARAM2 op_d048_3(uae_u32 opcode) /* ADD */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_d050_3(uae_u32 opcode) /* ADD */
@@ -20502,16 +17379,9 @@ unsigned long REGPARAM2 op_d050_3(uae_u32 opcode) /* ADD */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_d058_3(uae_u32 opcode) /* ADD */
@@ -20523,16 +17393,9 @@ unsigned long REGPARAM2 op_d058_3(uae_u32 opcode) /* ADD */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_d060_3(uae_u32 opcode) /* ADD */
@@ -20545,16 +17408,9 @@ unsigned long REGPARAM2 op_d060_3(uae_u32 opcode) /* ADD */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_d068_3(uae_u32 opcode) /* ADD */
@@ -20565,16 +17421,9 @@ unsigned long REGPARAM2 op_d068_3(uae_u32 opcode) /* ADD */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d070_3(uae_u32 opcode) /* ADD */
@@ -20585,16 +17434,9 @@ unsigned long REGPARAM2 op_d070_3(uae_u32 opcode) /* ADD */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d078_3(uae_u32 opcode) /* ADD */
@@ -20604,16 +17446,9 @@ unsigned long REGPARAM2 op_d078_3(uae_u32 opcode) /* ADD */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d079_3(uae_u32 opcode) /* ADD */
@@ -20623,16 +17458,9 @@ unsigned long REGPARAM2 op_d079_3(uae_u32 opcode) /* ADD */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_d07a_3(uae_u32 opcode) /* ADD */
@@ -20643,16 +17471,9 @@ unsigned long REGPARAM2 op_d07a_3(uae_u32 opcode) /* ADD */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d07b_3(uae_u32 opcode) /* ADD */
@@ -20663,16 +17484,9 @@ unsigned long REGPARAM2 op_d07b_3(uae_u32 opcode) /* ADD */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d07c_3(uae_u32 opcode) /* ADD */
@@ -20681,16 +17495,9 @@ unsigned long REGPARAM2 op_d07c_3(uae_u32 opcode) /* ADD */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_d080_3(uae_u32 opcode) /* ADD */
@@ -20700,16 +17507,9 @@ unsigned long REGPARAM2 op_d080_3(uae_u32 opcode) /* ADD */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_d088_3(uae_u32 opcode) /* ADD */
@@ -20719,16 +17519,9 @@ unsigned long REGPARAM2 op_d088_3(uae_u32 opcode) /* ADD */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_d090_3(uae_u32 opcode) /* ADD */
@@ -20739,16 +17532,9 @@ unsigned long REGPARAM2 op_d090_3(uae_u32 opcode) /* ADD */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d098_3(uae_u32 opcode) /* ADD */
@@ -20760,16 +17546,9 @@ unsigned long REGPARAM2 op_d098_3(uae_u32 opcode) /* ADD */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d0a0_3(uae_u32 opcode) /* ADD */
@@ -20782,16 +17561,9 @@ unsigned long REGPARAM2 op_d0a0_3(uae_u32 opcode) /* ADD */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d0a8_3(uae_u32 opcode) /* ADD */
@@ -20802,16 +17574,9 @@ unsigned long REGPARAM2 op_d0a8_3(uae_u32 opcode) /* ADD */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d0b0_3(uae_u32 opcode) /* ADD */
@@ -20822,16 +17587,9 @@ unsigned long REGPARAM2 op_d0b0_3(uae_u32 opcode) /* ADD */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d0b8_3(uae_u32 opcode) /* ADD */
@@ -20841,16 +17599,9 @@ unsigned long REGPARAM2 op_d0b8_3(uae_u32 opcode) /* ADD */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d0b9_3(uae_u32 opcode) /* ADD */
@@ -20860,16 +17611,9 @@ unsigned long REGPARAM2 op_d0b9_3(uae_u32 opcode) /* ADD */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_d0ba_3(uae_u32 opcode) /* ADD */
@@ -20880,16 +17624,9 @@ unsigned long REGPARAM2 op_d0ba_3(uae_u32 opcode) /* ADD */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d0bb_3(uae_u32 opcode) /* ADD */
@@ -20900,16 +17637,9 @@ unsigned long REGPARAM2 op_d0bb_3(uae_u32 opcode) /* ADD */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d0bc_3(uae_u32 opcode) /* ADD */
@@ -20918,16 +17648,9 @@ unsigned long REGPARAM2 op_d0bc_3(uae_u32 opcode) /* ADD */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 6;
 }
 unsigned long REGPARAM2 op_d0c0_3(uae_u32 opcode) /* ADDA */
@@ -21135,16 +17858,9 @@ unsigned long REGPARAM2 op_d110_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d118_3(uae_u32 opcode) /* ADD */
@@ -21156,16 +17872,9 @@ unsigned long REGPARAM2 op_d118_3(uae_u32 opcode) /* ADD */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d120_3(uae_u32 opcode) /* ADD */
@@ -21178,16 +17887,9 @@ unsigned long REGPARAM2 op_d120_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d128_3(uae_u32 opcode) /* ADD */
@@ -21198,16 +17900,9 @@ unsigned long REGPARAM2 op_d128_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d130_3(uae_u32 opcode) /* ADD */
@@ -21218,16 +17913,9 @@ unsigned long REGPARAM2 op_d130_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d138_3(uae_u32 opcode) /* ADD */
@@ -21237,16 +17925,9 @@ unsigned long REGPARAM2 op_d138_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d139_3(uae_u32 opcode) /* ADD */
@@ -21256,16 +17937,9 @@ unsigned long REGPARAM2 op_d139_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 0), src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_d140_3(uae_u32 opcode) /* ADDX */
@@ -21317,19 +17991,12 @@ unsigned long REGPARAM2 op_d150_3(uae_u32 opcode) /* ADD */
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = m68k_areg(regs, dstreg);
-{	uae_s16 dst = get_word(dsta);
-{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d158_3(uae_u32 opcode) /* ADD */
@@ -21341,16 +18008,9 @@ unsigned long REGPARAM2 op_d158_3(uae_u32 opcode) /* ADD */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d160_3(uae_u32 opcode) /* ADD */
@@ -21363,16 +18023,9 @@ unsigned long REGPARAM2 op_d160_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d168_3(uae_u32 opcode) /* ADD */
@@ -21383,16 +18036,9 @@ unsigned long REGPARAM2 op_d168_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d170_3(uae_u32 opcode) /* ADD */
@@ -21403,16 +18049,9 @@ unsigned long REGPARAM2 op_d170_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d178_3(uae_u32 opcode) /* ADD */
@@ -21422,16 +18061,9 @@ unsigned long REGPARAM2 op_d178_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d179_3(uae_u32 opcode) /* ADD */
@@ -21441,16 +18073,9 @@ unsigned long REGPARAM2 op_d179_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 1), src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_d180_3(uae_u32 opcode) /* ADDX */
@@ -21508,16 +18133,9 @@ unsigned long REGPARAM2 op_d190_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_d198_3(uae_u32 opcode) /* ADD */
@@ -21529,16 +18147,9 @@ unsigned long REGPARAM2 op_d198_3(uae_u32 opcode) /* ADD */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_d1a0_3(uae_u32 opcode) /* ADD */
@@ -21551,16 +18162,9 @@ unsigned long REGPARAM2 op_d1a0_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_d1a8_3(uae_u32 opcode) /* ADD */
@@ -21571,16 +18175,9 @@ unsigned long REGPARAM2 op_d1a8_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_d1b0_3(uae_u32 opcode) /* ADD */
@@ -21591,16 +18188,9 @@ unsigned long REGPARAM2 op_d1b0_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_d1b8_3(uae_u32 opcode) /* ADD */
@@ -21610,16 +18200,9 @@ unsigned long REGPARAM2 op_d1b8_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_d1b9_3(uae_u32 opcode) /* ADD */
@@ -21629,16 +18212,9 @@ unsigned long REGPARAM2 op_d1b9_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, 2), src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_d1c0_3(uae_u32 opcode) /* ADDA */
@@ -21896,7 +18472,7 @@ unsigned long REGPARAM2 op_e018_3(uae_u32 opcode) /* ROR */
 {	uae_u8 val = data;
 	uae_u32 cmask = 0x80;
 	cnt &= 63;
-	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
 	for(;cnt;--cnt){
 	carry=val&1; val = val >> 1;
 	if(carry) val |= cmask;
@@ -22018,7 +18594,7 @@ unsigned long REGPARAM2 op_e038_3(uae_u32 opcode) /* ROR */
 {	uae_u8 val = data;
 	uae_u32 cmask = 0x80;
 	cnt &= 63;
-	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
 	for(;cnt;--cnt){
 	carry=val&1; val = val >> 1;
 	if(carry) val |= cmask;
@@ -22136,7 +18712,7 @@ unsigned long REGPARAM2 op_e058_3(uae_u32 opcode) /* ROR */
 {	uae_u16 val = data;
 	uae_u32 cmask = 0x8000;
 	cnt &= 63;
-	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
 	for(;cnt;--cnt){
 	carry=val&1; val = val >> 1;
 	if(carry) val |= cmask;
@@ -22257,7 +18833,7 @@ unsigned long REGPARAM2 op_e078_3(uae_u32 opcode) /* ROR */
 {	uae_u16 val = data;
 	uae_u32 cmask = 0x8000;
 	cnt &= 63;
-	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
 	for(;cnt;--cnt){
 	carry=val&1; val = val >> 1;
 	if(carry) val |= cmask;
@@ -22375,7 +18951,7 @@ unsigned long REGPARAM2 op_e098_3(uae_u32 opcode) /* ROR */
 {	uae_u32 val = data;
 	uae_u32 cmask = 0x80000000;
 	cnt &= 63;
-	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
 	for(;cnt;--cnt){
 	carry=val&1; val = val >> 1;
 	if(carry) val |= cmask;
@@ -22495,7 +19071,7 @@ unsigned long REGPARAM2 op_e0b8_3(uae_u32 opcode) /* ROR */
 {	uae_u32 val = data;
 	uae_u32 cmask = 0x80000000;
 	cnt &= 63;
-	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
 	for(;cnt;--cnt){
 	carry=val&1; val = val >> 1;
 	if(carry) val |= cmask;
@@ -22520,9 +19096,7 @@ unsigned long REGPARAM2 op_e0d0_3(uae_u32 opcode) /* ASRW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -22539,9 +19113,7 @@ unsigned long REGPARAM2 op_e0d8_3(uae_u32 opcode) /* ASRW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -22559,9 +19131,7 @@ unsigned long REGPARAM2 op_e0e0_3(uae_u32 opcode) /* ASRW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -22577,9 +19147,7 @@ unsigned long REGPARAM2 op_e0e8_3(uae_u32 opcode) /* ASRW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -22595,9 +19163,7 @@ unsigned long REGPARAM2 op_e0f0_3(uae_u32 opcode) /* ASRW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -22612,9 +19178,7 @@ unsigned long REGPARAM2 op_e0f8_3(uae_u32 opcode) /* ASRW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -22629,9 +19193,7 @@ unsigned long REGPARAM2 op_e0f9_3(uae_u32 opcode) /* ASRW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23373,9 +19935,7 @@ unsigned long REGPARAM2 op_e1d0_3(uae_u32 opcode) /* ASLW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -23394,9 +19954,7 @@ unsigned long REGPARAM2 op_e1d8_3(uae_u32 opcode) /* ASLW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -23416,9 +19974,7 @@ unsigned long REGPARAM2 op_e1e0_3(uae_u32 opcode) /* ASLW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -23436,9 +19992,7 @@ unsigned long REGPARAM2 op_e1e8_3(uae_u32 opcode) /* ASLW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -23456,9 +20010,7 @@ unsigned long REGPARAM2 op_e1f0_3(uae_u32 opcode) /* ASLW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -23475,9 +20027,7 @@ unsigned long REGPARAM2 op_e1f8_3(uae_u32 opcode) /* ASLW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -23494,9 +20044,7 @@ unsigned long REGPARAM2 op_e1f9_3(uae_u32 opcode) /* ASLW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -23513,9 +20061,7 @@ unsigned long REGPARAM2 op_e2d0_3(uae_u32 opcode) /* LSRW */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23531,9 +20077,7 @@ unsigned long REGPARAM2 op_e2d8_3(uae_u32 opcode) /* LSRW */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23550,9 +20094,7 @@ unsigned long REGPARAM2 op_e2e0_3(uae_u32 opcode) /* LSRW */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23567,9 +20109,7 @@ unsigned long REGPARAM2 op_e2e8_3(uae_u32 opcode) /* LSRW */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23584,9 +20124,7 @@ unsigned long REGPARAM2 op_e2f0_3(uae_u32 opcode) /* LSRW */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23600,9 +20138,7 @@ unsigned long REGPARAM2 op_e2f8_3(uae_u32 opcode) /* LSRW */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23616,9 +20152,7 @@ unsigned long REGPARAM2 op_e2f9_3(uae_u32 opcode) /* LSRW */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23633,9 +20167,7 @@ unsigned long REGPARAM2 op_e3d0_3(uae_u32 opcode) /* LSLW */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23651,9 +20183,7 @@ unsigned long REGPARAM2 op_e3d8_3(uae_u32 opcode) /* LSLW */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23670,9 +20200,7 @@ unsigned long REGPARAM2 op_e3e0_3(uae_u32 opcode) /* LSLW */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23687,9 +20215,7 @@ unsigned long REGPARAM2 op_e3e8_3(uae_u32 opcode) /* LSLW */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23704,9 +20230,7 @@ unsigned long REGPARAM2 op_e3f0_3(uae_u32 opcode) /* LSLW */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23720,9 +20244,7 @@ unsigned long REGPARAM2 op_e3f8_3(uae_u32 opcode) /* LSLW */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23736,9 +20258,7 @@ unsigned long REGPARAM2 op_e3f9_3(uae_u32 opcode) /* LSLW */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23754,9 +20274,7 @@ unsigned long REGPARAM2 op_e4d0_3(uae_u32 opcode) /* ROXRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23773,9 +20291,7 @@ unsigned long REGPARAM2 op_e4d8_3(uae_u32 opcode) /* ROXRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23793,9 +20309,7 @@ unsigned long REGPARAM2 op_e4e0_3(uae_u32 opcode) /* ROXRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23811,9 +20325,7 @@ unsigned long REGPARAM2 op_e4e8_3(uae_u32 opcode) /* ROXRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23829,9 +20341,7 @@ unsigned long REGPARAM2 op_e4f0_3(uae_u32 opcode) /* ROXRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23846,9 +20356,7 @@ unsigned long REGPARAM2 op_e4f8_3(uae_u32 opcode) /* ROXRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23863,9 +20371,7 @@ unsigned long REGPARAM2 op_e4f9_3(uae_u32 opcode) /* ROXRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23881,9 +20387,7 @@ unsigned long REGPARAM2 op_e5d0_3(uae_u32 opcode) /* ROXLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23900,9 +20404,7 @@ unsigned long REGPARAM2 op_e5d8_3(uae_u32 opcode) /* ROXLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23920,9 +20422,7 @@ unsigned long REGPARAM2 op_e5e0_3(uae_u32 opcode) /* ROXLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23938,9 +20438,7 @@ unsigned long REGPARAM2 op_e5e8_3(uae_u32 opcode) /* ROXLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23956,9 +20454,7 @@ unsigned long REGPARAM2 op_e5f0_3(uae_u32 opcode) /* ROXLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23973,9 +20469,7 @@ unsigned long REGPARAM2 op_e5f8_3(uae_u32 opcode) /* ROXLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23990,9 +20484,7 @@ unsigned long REGPARAM2 op_e5f9_3(uae_u32 opcode) /* ROXLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -24008,9 +20500,7 @@ unsigned long REGPARAM2 op_e6d0_3(uae_u32 opcode) /* RORW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -24026,9 +20516,7 @@ unsigned long REGPARAM2 op_e6d8_3(uae_u32 opcode) /* RORW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -24045,9 +20533,7 @@ unsigned long REGPARAM2 op_e6e0_3(uae_u32 opcode) /* RORW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -24062,9 +20548,7 @@ unsigned long REGPARAM2 op_e6e8_3(uae_u32 opcode) /* RORW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -24079,9 +20563,7 @@ unsigned long REGPARAM2 op_e6f0_3(uae_u32 opcode) /* RORW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -24095,9 +20577,7 @@ unsigned long REGPARAM2 op_e6f8_3(uae_u32 opcode) /* RORW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -24111,9 +20591,7 @@ unsigned long REGPARAM2 op_e6f9_3(uae_u32 opcode) /* RORW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(6);
@@ -24128,9 +20606,7 @@ unsigned long REGPARAM2 op_e7d0_3(uae_u32 opcode) /* ROLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -24146,9 +20622,7 @@ unsigned long REGPARAM2 op_e7d8_3(uae_u32 opcode) /* ROLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -24165,9 +20639,7 @@ unsigned long REGPARAM2 op_e7e0_3(uae_u32 opcode) /* ROLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -24182,9 +20654,7 @@ unsigned long REGPARAM2 op_e7e8_3(uae_u32 opcode) /* ROLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -24199,9 +20669,7 @@ unsigned long REGPARAM2 op_e7f0_3(uae_u32 opcode) /* ROLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -24215,9 +20683,7 @@ unsigned long REGPARAM2 op_e7f8_3(uae_u32 opcode) /* ROLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -24231,9 +20697,7 @@ unsigned long REGPARAM2 op_e7f9_3(uae_u32 opcode) /* ROLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, 1), val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(6);
@@ -40,6 +40,9 @@ static int cpu_level;
 #define PALM_HEADERS		1	// Changes made to accounts for Poser's header structures
 #define PALM_BUG_FIX		1	// Changes made to fix UAE bugs.
 #define PALM_SYSTEM_CALL	1	// Changes made to track system calls
+#ifndef PALM_LAZY_FLAGS
+#define PALM_LAZY_FLAGS		1	// Changes made to defer condition code evaluation
+#endif
 
 #if PALM_STACK
 int adda_hack = 0;
@@ -1124,6 +1127,41 @@ static void genflags (flagtypes type, wordsizes size, char *value, char *src, ch
 	}
 	break;
     }
+#elif PALM_LAZY_FLAGS
+    /* Record the operation and its operands; FLUSH_FLAGS (machdep_m68k.h)
+     * computes the flags if and when something looks at them.  The
+     * remaining flag types only update some of the flags, so they go
+     * through the macros in newcpu.h, which flush first. */
+    {
+	const char *cast;
+
+	switch (size) {
+	 case sz_byte: cast = "uae_s8"; break;
+	 case sz_word: cast = "uae_s16"; break;
+	 case sz_long: cast = "uae_s32"; break;
+	 default: abort ();
+	}
+
+	switch (type) {
+	 case flag_logical:
+	    printf ("\tSET_LAZY_FLAGS_NZ (LAZY_FLAGS_OP (LAZY_FLAGS_LOGICAL, %d), %s);\n", size, value);
+	    return;
+	 case flag_add:
+	    start_brace ();
+	    printf ("uae_u32 %s = ((%s)(%s)) + ((%s)(%s));\n", value, cast, dst, cast, src);
+	    printf ("\tSET_LAZY_FLAGS (LAZY_FLAGS_OP (LAZY_FLAGS_ADD, %d), %s, %s, %s);\n", size, src, dst, value);
+	    return;
+	 case flag_sub:
+	 case flag_cmp:
+	    start_brace ();
+	    printf ("uae_u32 %s = ((%s)(%s)) - ((%s)(%s));\n", value, cast, dst, cast, src);
+	    printf ("\tSET_LAZY_FLAGS (LAZY_FLAGS_OP (%s, %d), %s, %s, %s);\n",
+		    type == flag_sub ? "LAZY_FLAGS_SUB" : "LAZY_FLAGS_CMP", size, src, dst, value);
+	    return;
+	 default:
+	    break;
+	}
+    }
 #endif
     genflags_normal (type, size, value, src, dst);
 }
@@ -2499,7 +2537,7 @@ static void gen_opcode (unsigned long int opcode)
 	 default: abort ();
 	}
 	printf ("\tcnt &= 63;\n");
-	printf ("\tif (!cnt) { CFLG = 0; } else {");
+	printf ("\tif (!cnt) { SET_CFLG (0); } else {");
 	printf ("\tuae_u32 carry;\n");
 	printf ("\tfor(;cnt;--cnt){\n");
 	printf ("\tcarry=val&1; val = val >> 1;\n");
@@ -16,10 +16,82 @@ struct flag_struct {
     unsigned int n;
     unsigned int v; 
     unsigned int x;
+
+    /* Lazy condition codes.  The common flag-setting instructions
+     * (MOVE/TST/logical ops, ADD, SUB, CMP) don't compute the flags
+     * above; instead they record the operation, its size, and its
+     * operands here.  The flags are materialized by FLUSH_FLAGS the
+     * next time anything reads or partially updates them. */
+    unsigned int op;
+    uae_u32 src;
+    uae_u32 dst;
+    uae_u32 res;
+
+#if LAZY_FLAGS_CHECK
+    /* The flags as the eager genflags code would have left them,
+     * computed when the operation is recorded and compared against
+     * the lazy result when it's flushed. */
+    unsigned int check_c;
+    unsigned int check_z;
+    unsigned int check_n;
+    unsigned int check_v;
+    unsigned int check_x;
+#endif
 };
 
 extern struct flag_struct regflags;
 
+#define LAZY_FLAGS_NONE		0
+#define LAZY_FLAGS_LOGICAL	1	/* N, Z from res; V = C = 0 */
+#define LAZY_FLAGS_ADD		2	/* X, N, Z, V, C from dst + src */
+#define LAZY_FLAGS_SUB		3	/* X, N, Z, V, C from dst - src */
+#define LAZY_FLAGS_CMP		4	/* N, Z, V, C from dst - src */
+
+/* Operation kinds are combined with the operand size: 0 = byte,
+ * 1 = word, 2 = long. */
+#define LAZY_FLAGS_OP(kind, size)	(((kind) << 2) | (size))
+
+/* A pending ADD or SUB is the only record of the X flag, which the
+ * operations that replace it (MOVE, CMP, ...) leave alone.  Flush it
+ * before recording the next operation so that X survives.
+ *
+ * When checking, every operation is flushed (and so compared against
+ * the eager flags) before the next one replaces it. */
+#if LAZY_FLAGS_CHECK
+#define LAZY_FLAGS_SAVE_X FLUSH_FLAGS
+#define LAZY_FLAGS_RECORD_CHECK m68k_record_check_flags ()
+#else
+#define LAZY_FLAGS_SAVE_X \
+ ((void) ((regflags.op >> 2) == LAZY_FLAGS_ADD || (regflags.op >> 2) == LAZY_FLAGS_SUB \
+  ? (m68k_flush_flags (), 0) : 0))
+#define LAZY_FLAGS_RECORD_CHECK ((void) 0)
+#endif
+
+#define SET_LAZY_FLAGS(op_, src_, dst_, res_) do { \
+ LAZY_FLAGS_SAVE_X; \
+ regflags.op = (op_); \
+ regflags.src = (src_); \
+ regflags.dst = (dst_); \
+ regflags.res = (res_); \
+ LAZY_FLAGS_RECORD_CHECK; \
+} while (0)
+
+#define SET_LAZY_FLAGS_NZ(op_, res_) do { \
+ LAZY_FLAGS_SAVE_X; \
+ regflags.op = (op_); \
+ regflags.res = (res_); \
+ LAZY_FLAGS_RECORD_CHECK; \
+} while (0)
+
+extern void m68k_flush_flags (void);
+
+#if LAZY_FLAGS_CHECK
+extern void m68k_record_check_flags (void);
+#endif
+
+#define FLUSH_FLAGS \
+ ((void) (regflags.op != LAZY_FLAGS_NONE ? (m68k_flush_flags (), 0) : 0))
+
 #define ZFLG (regflags.z)
 #define NFLG (regflags.n)
 #define CFLG (regflags.c)
@@ -28,6 +100,7 @@ extern struct flag_struct regflags;
 
 STATIC_INLINE int cctrue(const int cc)
 {
+    FLUSH_FLAGS;
     switch(cc){
      case 0: return 1;                       /* T */
      case 1: return 0;                       /* F */
@@ -16,12 +16,12 @@
 #define do_put_mem_word		EmMemDoPut16
 #define do_put_mem_byte		EmMemDoPut8
 
-#define get_long			EmMemGet32
-#define get_word			EmMemGet16
-#define get_byte			EmMemGet8
+#define get_long			EmMemCPUGet32
+#define get_word			EmMemCPUGet16
+#define get_byte			EmMemCPUGet8
 
-#define put_long			EmMemPut32
-#define put_word			EmMemPut16
-#define put_byte			EmMemPut8
+#define put_long			EmMemCPUPut32
+#define put_word			EmMemCPUPut16
+#define put_byte			EmMemCPUPut8
 
 #define get_real_address	EmMemGetRealAddress
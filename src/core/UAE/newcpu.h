@@ -18,23 +18,27 @@ extern "C" {
 
 #ifndef SET_CFLG
 
-#define SET_CFLG(x) (CFLG = (x))
-#define SET_NFLG(x) (NFLG = (x))
-#define SET_VFLG(x) (VFLG = (x))
-#define SET_ZFLG(x) (ZFLG = (x))
-#define SET_XFLG(x) (XFLG = (x))
-
-#define GET_CFLG CFLG
-#define GET_NFLG NFLG
-#define GET_VFLG VFLG
-#define GET_ZFLG ZFLG
-#define GET_XFLG XFLG
+/* Any pending lazy flags are materialized before individual flags
+ * are read or written (see machdep_m68k.h). */
+
+#define SET_CFLG(x) (FLUSH_FLAGS, CFLG = (x))
+#define SET_NFLG(x) (FLUSH_FLAGS, NFLG = (x))
+#define SET_VFLG(x) (FLUSH_FLAGS, VFLG = (x))
+#define SET_ZFLG(x) (FLUSH_FLAGS, ZFLG = (x))
+#define SET_XFLG(x) (FLUSH_FLAGS, XFLG = (x))
+
+#define GET_CFLG (FLUSH_FLAGS, CFLG)
+#define GET_NFLG (FLUSH_FLAGS, NFLG)
+#define GET_VFLG (FLUSH_FLAGS, VFLG)
+#define GET_ZFLG (FLUSH_FLAGS, ZFLG)
+#define GET_XFLG (FLUSH_FLAGS, XFLG)
 
 #define CLEAR_CZNV do { \
- SET_CFLG (0); \
- SET_ZFLG (0); \
- SET_NFLG (0); \
- SET_VFLG (0); \
+ FLUSH_FLAGS; \
+ CFLG = 0; \
+ ZFLG = 0; \
+ NFLG = 0; \
+ VFLG = 0; \
 } while (0)
 
 #define COPY_CARRY (SET_XFLG (GET_CFLG))
@@ -0,0 +1,154 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* Headless EmApplication implementation.
+ *
+ * Follows EmApplicationQt, minus the window, menus, and host
+ * clipboard.  main_headless.cpp drives HandleIdle from a QTimer
+ * on a QCoreApplication event loop.
+ */
+
+#include "EmCommon.h"
+#include "EmApplicationHeadless.h"
+
+#include "EmDocument.h"			// gDocument
+#include "EmStructs.h"			// ByteList
+#include "omnithread.h"			// omni_mutex, omni_condition
+
+#include <stdio.h>				// fprintf
+
+// These variables are defined in Platform_Unix.cpp.
+
+extern ByteList			gClipboardDataPalm;
+extern ByteList			gClipboardDataHost;
+extern omni_mutex		gClipboardMutex;
+extern omni_condition	gClipboardCondition;
+extern Bool				gClipboardHaveOutgoingData;
+extern Bool				gClipboardNeedIncomingData;
+extern Bool				gClipboardHaveIncomingData;
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmApplicationHeadless::EmApplicationHeadless
+ *
+ * DESCRIPTION:	Constructor.
+ *
+ ***********************************************************************/
+
+EmApplicationHeadless::EmApplicationHeadless (void) :
+	EmApplication ()
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmApplicationHeadless::~EmApplicationHeadless
+ *
+ * DESCRIPTION:	Destructor.
+ *
+ ***********************************************************************/
+
+EmApplicationHeadless::~EmApplicationHeadless (void)
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmApplicationHeadless::Startup
+ *
+ * DESCRIPTION:	Performs one-time startup initialization.  No window
+ *				is created, so gWindow stays NULL and no LCD frames
+ *				are ever fetched or converted.
+ *
+ ***********************************************************************/
+
+Bool EmApplicationHeadless::Startup (int argc, char** argv)
+{
+	return EmApplication::Startup (argc, argv);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmApplicationHeadless::Run
+ *
+ * DESCRIPTION:	Run the application.  Called from main() after Startup.
+ *
+ ***********************************************************************/
+
+void EmApplicationHeadless::Run (void)
+{
+	this->HandleStartupActions ();
+
+	// Without a UI, there's nothing more to do if the command line
+	// didn't get a session going.
+
+	if (!gDocument)
+	{
+		fprintf (stderr, "POSE64: No session was opened (use -psf or -rom); quitting.\n");
+		this->ScheduleQuit ();
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmApplicationHeadless::Shutdown
+ *
+ * DESCRIPTION:	Performs one-time shutdown operations.
+ *
+ ***********************************************************************/
+
+void EmApplicationHeadless::Shutdown (void)
+{
+	EmApplication::Shutdown ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmApplicationHeadless::HandleIdle
+ *
+ * DESCRIPTION:	Perform idle-time operations.  Called from QTimer at ~10Hz.
+ *
+ ***********************************************************************/
+
+void EmApplicationHeadless::HandleIdle (void)
+{
+	// Idle the clipboard first, in case the CPU thread is blocked
+	// waiting for the data.
+
+	this->PrvIdleClipboard ();
+
+	EmApplication::HandleIdle ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmApplicationHeadless::PrvIdleClipboard
+ *
+ * DESCRIPTION:	There's no host clipboard.  Drop outgoing data, and
+ *				answer requests for incoming data with an empty
+ *				clipboard so that the CPU thread doesn't block.
+ *
+ ***********************************************************************/
+
+void EmApplicationHeadless::PrvIdleClipboard (void)
+{
+	omni_mutex_lock lock (gClipboardMutex);
+
+	gClipboardHaveOutgoingData = false;
+
+	if (gClipboardNeedIncomingData)
+	{
+		gClipboardNeedIncomingData = false;
+
+		gClipboardDataPalm.clear ();
+		gClipboardDataHost.clear ();
+
+		gClipboardHaveIncomingData = true;
+		gClipboardCondition.broadcast ();
+	}
+}
@@ -0,0 +1,31 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* Headless EmApplication subclass for the pose64-headless target.
+ *
+ * Same life cycle as EmApplicationQt, but creates no window and no
+ * menus.  Sessions and Hordes are started from the command line
+ * (-psf, -horde_*, etc.), and the application quits when they
+ * schedule it.
+ */
+
+#ifndef EmApplicationHeadless_h
+#define EmApplicationHeadless_h
+
+#include "EmApplication.h"		// EmApplication
+
+class EmApplicationHeadless : public EmApplication
+{
+	public:
+								EmApplicationHeadless	(void);
+		virtual					~EmApplicationHeadless	(void);
+
+	public:
+		virtual Bool			Startup				(int argc, char** argv);
+		void					Run					(void);
+		virtual void			Shutdown			(void);
+		void					HandleIdle			(void);
+
+	private:
+		void					PrvIdleClipboard	(void);
+};
+
+#endif	// EmApplicationHeadless_h
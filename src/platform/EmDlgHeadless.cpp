@@ -0,0 +1,241 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* Null dialogs for the pose64-headless target.
+ *
+ * Nothing here ever waits for a user.  Messages are written to stderr
+ * and answered with their default button; everything else is
+ * cancelled.  Sessions and Hordes are started from the command line
+ * (-psf, -horde_*, etc.) instead of from the New Session and New
+ * Gremlin Horde dialogs.
+ */
+
+#include "EmCommon.h"
+#include "EmDlg.h"
+
+#include <stdio.h>				// fprintf
+
+using namespace std;
+
+
+// Mirrors EditCommonDialogData in EmDlg.cpp.
+
+struct PrvCommonDialogData
+{
+	const char*				fMessage;
+	EmCommonDialogFlags		fFlags;
+};
+
+
+// ---------------------------------------------------------------------------
+//	PrvHostCommonDialog — error/warning/info message
+// ---------------------------------------------------------------------------
+// Log the message and pick the default button, or the first visible one.
+
+static EmDlgItemID PrvHostCommonDialog (void* userData)
+{
+	PrvCommonDialogData& data = *(PrvCommonDialogData*) userData;
+
+	fprintf (stderr, "POSE64: %s\n", data.fMessage ? data.fMessage : "");
+
+	int firstVisible = -1;
+
+	for (int ii = 0; ii < 3; ++ii)
+	{
+		int flags = GET_BUTTON (ii, data.fFlags);
+
+		if ((flags & kButtonVisible) == 0)
+			continue;
+
+		if (flags & kButtonDefault)
+			return (EmDlgItemID) (kDlgItemCmnButton1 + ii);
+
+		if (firstVisible < 0)
+			firstVisible = ii;
+	}
+
+	return (EmDlgItemID) (kDlgItemCmnButton1 + (firstVisible < 0 ? 0 : firstVisible));
+}
+
+
+// ---------------------------------------------------------------------------
+//	HostRunDialog
+// ---------------------------------------------------------------------------
+
+EmDlgItemID EmDlg::HostRunDialog (const void* parameters)
+{
+	const RunDialogParameters* params =
+		static_cast<const RunDialogParameters*> (parameters);
+	if (!params)
+		return kDlgItemNone;
+
+	if (params->fDlgID == kDlgCommonDialog)
+		return PrvHostCommonDialog (params->fUserData);
+
+	return kDlgItemCancel;
+}
+
+EmDlgItemID EmDlg::DoManualSpeed (int& /*numerator*/, int& /*denominator*/)
+{
+	return kDlgItemCancel;
+}
+
+EmDlgRef EmDlg::HostDialogOpen (EmDlgFn /*fn*/, void* /*userData*/, EmDlgID /*dlgID*/)
+{
+	return NULL;
+}
+
+void EmDlg::HostDialogClose (EmDlgRef /*dlgRef*/)
+{
+}
+
+void EmDlg::HostStartIdling (EmDlgContext& /*context*/)
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//	Dialog item accessors — there are no dialog items
+// ---------------------------------------------------------------------------
+
+EmRect EmDlg::GetDlgBounds (EmDlgRef /*dlg*/)
+{
+	return EmRect (0, 0, 0, 0);
+}
+
+void EmDlg::SetDlgBounds (EmDlgRef /*dlg*/, const EmRect& /*bounds*/)
+{
+}
+
+void EmDlg::SetItemText (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/, string /*text*/)
+{
+}
+
+void EmDlg::SetItemMin (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/, long /*min*/)
+{
+}
+
+void EmDlg::SetItemMax (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/, long /*max*/)
+{
+}
+
+void EmDlg::SetItemValue (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/, long /*value*/)
+{
+}
+
+void EmDlg::EnableItem (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/)
+{
+}
+
+void EmDlg::DisableItem (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/)
+{
+}
+
+void EmDlg::ShowItem (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/)
+{
+}
+
+void EmDlg::HideItem (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/)
+{
+}
+
+void EmDlg::AppendToMenu (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/, const StringList& /*items*/)
+{
+}
+
+void EmDlg::AppendToList (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/, const StringList& /*items*/)
+{
+}
+
+void EmDlg::SelectListItems (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/, const EmDlgListIndexList& /*indices*/)
+{
+}
+
+void EmDlg::UnselectListItems (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/, const EmDlgListIndexList& /*indices*/)
+{
+}
+
+void EmDlg::GetSelectedItems (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/, EmDlgListIndexList& indices)
+{
+	indices.clear ();
+}
+
+void EmDlg::ClearMenu (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/)
+{
+}
+
+void EmDlg::DisableMenuItem (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/, long /*index*/)
+{
+}
+
+void EmDlg::ClearList (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/)
+{
+}
+
+long EmDlg::GetItemValue (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/)
+{
+	return 0;
+}
+
+string EmDlg::GetItemText (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/)
+{
+	return string ();
+}
+
+void EmDlg::SetDlgDefaultButton (EmDlgContext& /*context*/, EmDlgItemID /*itemID*/)
+{
+}
+
+void EmDlg::SetDlgCancelButton (EmDlgContext& /*context*/, EmDlgItemID /*itemID*/)
+{
+}
+
+EmRect EmDlg::GetItemBounds (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/)
+{
+	return EmRect (0, 0, 0, 0);
+}
+
+int EmDlg::GetTextHeight (EmDlgRef /*dlg*/, EmDlgItemID /*itemID*/, const string& /*text*/)
+{
+	return 12;
+}
+
+void EmDlg::CenterDlg (EmDlgRef /*dlg*/)
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//	File dialogs — always cancelled
+// ---------------------------------------------------------------------------
+
+EmDlgItemID EmDlg::HostRunGetFile (const void* /*parameters*/)
+{
+	return kDlgItemCancel;
+}
+
+EmDlgItemID EmDlg::HostRunGetFileList (const void* /*parameters*/)
+{
+	return kDlgItemCancel;
+}
+
+EmDlgItemID EmDlg::HostRunPutFile (const void* /*parameters*/)
+{
+	return kDlgItemCancel;
+}
+
+EmDlgItemID EmDlg::HostRunGetDirectory (const void* /*parameters*/)
+{
+	return kDlgItemCancel;
+}
+
+EmDlgItemID EmDlg::HostRunAboutBox (const void* /*parameters*/)
+{
+	return kDlgItemOK;
+}
+
+// Batch runs never save the session on the way out; Hordes record their
+// own state files.
+
+EmDlgItemID EmDlg::HostRunSessionSave (const void* /*parameters*/)
+{
+	return kDlgItemNo;
+}
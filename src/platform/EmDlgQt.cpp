@@ -1945,7 +1945,10 @@ EmDlgRef EmDlg::HostDialogOpen (EmDlgFn fn, void* userData, EmDlgID dlgID)
 		QObject::connect (stopBtn, &QPushButton::clicked, [updateLabels]() {
 			EmSessionStopper stopper (gSession, kStopNow);
 			if (stopper.Stopped ())
+			{
 				Hordes::Stop ();
+				Hordes::ExportStates ();
+			}
 			updateLabels ();
 		});
 
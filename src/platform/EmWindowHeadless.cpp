@@ -0,0 +1,62 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* Null window for the pose64-headless target.
+ *
+ * No window is ever created, so gWindow stays NULL: EmApplication
+ * skips window idle time, and EmScreen is never asked for LCD frames
+ * except when a screenshot is requested.
+ */
+
+#include "EmCommon.h"
+#include "EmWindow.h"
+
+#include "EmDocument.h"			// EmDocument::HostSaveScreen
+#include "EmPixMap.h"			// EmPixMap
+#include "EmScreen.h"			// EmScreen, EmScreenUpdateInfo
+
+#include <QImage>
+
+
+// ---------------------------------------------------------------------------
+//		EmWindow::NewWindow
+// ---------------------------------------------------------------------------
+// Called by the document when a session opens.  Headless, there's no
+// window to open.
+
+EmWindow* EmWindow::NewWindow (void)
+{
+	return NULL;
+}
+
+
+// ---------------------------------------------------------------------------
+//		EmDocument::HostSaveScreen
+// ---------------------------------------------------------------------------
+// With no retained LCD image to save, fetch the whole frame buffer on
+// demand.  This is called from HostControl on the CPU thread, so the
+// emulated memory can be read directly.
+
+void EmDocument::HostSaveScreen (const EmFileRef& destRef)
+{
+	EmScreenUpdateInfo	info;
+
+	EmScreen::InvalidateAll ();
+	Bool	haveBits = EmScreen::GetBits (info) && info.fLCDOn;
+	EmScreen::InvalidateAll ();
+
+	if (!haveBits)
+		return;
+
+	EmPixMap&	image = info.fImage;
+	EmPoint		size = image.GetSize ();
+
+	if (size.fX <= 0 || size.fY <= 0)
+		return;
+
+	image.ConvertToFormat (kPixMapFormat32ARGB);
+
+	QImage	qImage (static_cast<const uchar*> (image.GetBits ()),
+					size.fX, size.fY, image.GetRowBytes (),
+					QImage::Format_ARGB32);
+
+	qImage.save (QString::fromStdString (destRef.GetFullPath ()), "PNG");
+}
@@ -274,6 +274,21 @@ EmWindow* EmWindow::NewWindow (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		EmDocument::HostSaveScreen
+// ---------------------------------------------------------------------------
+// Save the retained LCD image as a PNG.
+
+void EmDocument::HostSaveScreen (const EmFileRef& destRef)
+{
+	if (gHostWindow)
+	{
+		QString path = QString::fromStdString (destRef.GetFullPath ());
+		gHostWindow->getLCDImage ().save (path, "PNG");
+	}
+}
+
+
 #pragma mark -
 
 // ---------------------------------------------------------------------------
@@ -288,11 +303,19 @@ EmWindowQt::EmWindowQt () :
 	fMouseY (0),
 	fButtonFrameVisible (false),
 	fLEDVisible (false),
-	fLCDTintActive (false)
+	fLCDTintActive (false),
+	fLCDExpandDepth (0),
+	fLCDExpandTransparent (false),
+	fFramePending (false)
 {
 	EmAssert (gHostWindow == NULL);
 	gHostWindow = this;
 
+	// Repaint the LCD when the emulated one refreshes, rather than
+	// only when the idle timer fires.
+
+	EmScreen::SetFrameNotification (&EmWindowQt::FramePublished, this);
+
 	setWindowTitle ("POSE64");
 
 	// Enable keyboard focus
@@ -320,6 +343,8 @@ EmWindowQt::EmWindowQt () :
 
 EmWindowQt::~EmWindowQt ()
 {
+	EmScreen::SetFrameNotification (NULL, NULL);
+
 	this->PreDestroy ();
 
 	EmAssert (gHostWindow == this);
@@ -1185,9 +1210,9 @@ void EmWindowQt::HostPaintLCD (const EmScreenUpdateInfo& info,
 							   const EmRect& destRect,
 							   Bool scaled)
 {
-	// GetLCDScanlines only fills dirty scanlines (fFirstLine..fLastLine)
+	// GetLCDScanlines only fills dirty scanlines (info.IsLineDirty)
 	// in info.fImage — the rest is uninitialized garbage.  Keep a
-	// persistent fLCDImage and merge only the dirty portion.
+	// persistent fLCDImage and merge only the dirty lines.
 
 	Preference<bool> prefTransparent (kPrefKeyTransparentLCD);
 	bool transparent = *prefTransparent;
@@ -1198,11 +1223,12 @@ void EmWindowQt::HostPaintLCD (const EmScreenUpdateInfo& info,
 	if (transparent && info.fImage.GetDepth () >= 8)
 		transparent = false;
 
-	QImage newImage = emPixMapToQImage (info.fImage, transparent);
-
 	// Detect backlight for transparent LCD mode.  When the palette's
 	// background color (index 0) differs from the skin's normal
 	// background, the backlight is on — use it as a color wash.
+	bool tintWasActive = fLCDTintActive;
+	QColor oldTint = fLCDTint;
+
 	fLCDTintActive = false;
 	if (transparent)
 	{
@@ -1222,42 +1248,225 @@ void EmWindowQt::HostPaintLCD (const EmScreenUpdateInfo& info,
 		}
 	}
 
-	int w = newImage.width ();
-	int h = newImage.height ();
+	EmPoint size = info.fImage.GetSize ();
+	int w = size.fX;
+	int h = size.fY;
+
+	if (w <= 0 || h <= 0 || !info.fImage.GetBits ())
+		return;
+
+	// Indexed formats are converted a scanline at a time straight into
+	// fLCDImage (see convertLCDLine).  Anything else goes through
+	// emPixMapToQImage and has its dirty lines copied over.
+	bool indexed = this->prepareLCDExpand (info.fImage, transparent);
+
+	QImage newImage;
+	QImage::Format format = QImage::Format_ARGB32;
+
+	if (!indexed)
+	{
+		newImage = emPixMapToQImage (info.fImage, transparent);
+		format = newImage.format ();
+	}
+
+	bool wholeLCD = false;
 
 	if (fLCDImage.isNull ()
 		|| fLCDImage.width () != w
 		|| fLCDImage.height () != h
-		|| fLCDImage.format () != newImage.format ())
+		|| fLCDImage.format () != format)
 	{
-		// First frame or resolution change — take the whole image.
-		fLCDImage = newImage;
+		// First frame or resolution change — start from a blank image.
+		// Normally every line is dirty at this point anyway.
+		fLCDImage = QImage (w, h, format);
+		fLCDImage.fill (0);
+		wholeLCD = true;
 	}
-	else
+
+	// Qt retained-mode: paintEvent redraws from fLCDImage, scaling it
+	// into fLCDRect.  Skin coords map 1:1 to widget logical pixels.
+	EmRect lcdBounds = this->GetLCDBounds ();
+	QRect lcdRect (lcdBounds.fLeft, lcdBounds.fTop,
+				   lcdBounds.fRight - lcdBounds.fLeft,
+				   lcdBounds.fBottom - lcdBounds.fTop);
+
+	if (fLCDRect != lcdRect
+		|| fLCDTintActive != tintWasActive
+		|| (fLCDTintActive && fLCDTint != oldTint))
 	{
-		// Merge only the dirty scanlines into the persistent image.
-		int firstLine = info.fFirstLine;
-		int lastLine  = info.fLastLine;
+		wholeLCD = true;
+	}
+
+	fLCDRect = lcdRect;
+
+	// Merge only the dirty scanlines into the persistent image, and
+	// repaint only the widget rows they cover.  Adjacent dirty lines
+	// are merged into one rectangle.
+
+	int firstLine = info.fFirstLine;
+	int lastLine  = info.fLastLine;
 
-		if (firstLine < 0)        firstLine = 0;
-		if (lastLine > h)         lastLine  = h;
+	if (firstLine < 0)        firstLine = 0;
+	if (lastLine > h)         lastLine  = h;
 
-		for (int y = firstLine; y < lastLine; y++)
+	int y = firstLine;
+	while (y < lastLine)
+	{
+		if (!info.IsLineDirty (y))
 		{
-			memcpy (fLCDImage.scanLine (y),
-					newImage.scanLine (y),
-					fLCDImage.bytesPerLine ());
+			++y;
+			continue;
 		}
+
+		int runStart = y;
+
+		for (; y < lastLine && info.IsLineDirty (y); ++y)
+		{
+			if (indexed)
+			{
+				this->convertLCDLine (info.fImage, y);
+			}
+			else
+			{
+				memcpy (fLCDImage.scanLine (y),
+						newImage.scanLine (y),
+						fLCDImage.bytesPerLine ());
+			}
+		}
+
+		if (wholeLCD)
+			continue;
+
+		// Map the run to widget coordinates, rounding outwards so that
+		// scaled lines are fully covered.
+		int top    = fLCDRect.top () + (runStart * fLCDRect.height ()) / h;
+		int bottom = fLCDRect.top () + (y * fLCDRect.height () + h - 1) / h;
+
+		update (QRect (fLCDRect.left (), top, fLCDRect.width (), bottom - top));
 	}
 
-	// Qt retained-mode: paintEvent redraws the full widget, so always use
-	// the full LCD bounds.  Skin coords map 1:1 to widget logical pixels.
-	EmRect lcdBounds = this->GetLCDBounds ();
-	fLCDRect = QRect (lcdBounds.fLeft, lcdBounds.fTop,
-					  lcdBounds.fRight - lcdBounds.fLeft,
-					  lcdBounds.fBottom - lcdBounds.fTop);
+	if (wholeLCD)
+		update ();
+}
 
-	update ();
+
+// ---------------------------------------------------------------------------
+//		EmWindowQt incremental LCD conversion
+// ---------------------------------------------------------------------------
+// For the indexed LCD formats (1, 2, 4, and 8 bpp), fLCDExpand maps each
+// possible source byte to the ARGB32 pixels it holds, so converting a
+// scanline is one table lookup and a small fixed-size copy per byte,
+// which the compiler turns into vector moves.  The table follows the
+// same palette and transparency rules as emPixMapToQImage, and is only
+// rebuilt when the depth, palette, or transparency setting changes.
+// Returns false for formats that aren't indexed.
+
+bool EmWindowQt::prepareLCDExpand (const EmPixMap& pixmap, bool transparentLCD)
+{
+	int depth;
+
+	switch (pixmap.GetFormat ())
+	{
+		case kPixMapFormat1:	depth = 1;	break;
+		case kPixMapFormat2:	depth = 2;	break;
+		case kPixMapFormat4:	depth = 4;	break;
+		case kPixMapFormat8:	depth = 8;	break;
+		default:				return false;
+	}
+
+	const RGBList& colors = pixmap.GetColorTable ();
+
+	if (depth == fLCDExpandDepth
+		&& transparentLCD == fLCDExpandTransparent
+		&& colors == fLCDExpandColors)
+	{
+		return true;
+	}
+
+	// Palette lookup for each pixel value.
+	int numColors = (int) colors.size ();
+	uint32_t lut[256];
+
+	for (int idx = 0; idx < 256; idx++)
+	{
+		if (transparentLCD && numColors > 1)
+		{
+			uint8_t a = (uint8_t)(idx * 255 / (numColors - 1));
+			lut[idx] = ((uint32_t)a << 24);
+		}
+		else if (idx < numColors)
+		{
+			const RGBType& c = colors[idx];
+			lut[idx] = 0xFF000000 | (c.fRed << 16) | (c.fGreen << 8) | c.fBlue;
+		}
+		else
+		{
+			lut[idx] = 0xFF000000;  // black fallback
+		}
+	}
+
+	// Expand each byte into its pixels, MSB first.
+	int perByte = 8 / depth;
+	int mask = (1 << depth) - 1;
+
+	fLCDExpand.resize (256 * perByte);
+
+	for (int byte = 0; byte < 256; byte++)
+	{
+		for (int k = 0; k < perByte; k++)
+		{
+			int shift = 8 - depth * (k + 1);
+			fLCDExpand[byte * perByte + k] = lut[(byte >> shift) & mask];
+		}
+	}
+
+	fLCDExpandDepth = depth;
+	fLCDExpandTransparent = transparentLCD;
+	fLCDExpandColors = colors;
+
+	return true;
+}
+
+
+void EmWindowQt::convertLCDLine (const EmPixMap& pixmap, int y)
+{
+	int w = fLCDImage.width ();
+	int perByte = 8 / fLCDExpandDepth;
+	int wholeBytes = w / perByte;
+	int leftover = w % perByte;
+
+	const uint8_t* srcRow = static_cast<const uint8_t*> (pixmap.GetBits ())
+						  + y * pixmap.GetRowBytes ();
+	uint32_t* dstRow = reinterpret_cast<uint32_t*> (fLCDImage.scanLine (y));
+	const uint32_t* expand = fLCDExpand.data ();
+
+	switch (perByte)
+	{
+		// Fixed sizes so that each copy is a handful of vector moves.
+		case 8:
+			for (int i = 0; i < wholeBytes; i++, dstRow += 8)
+				memcpy (dstRow, expand + srcRow[i] * 8, 8 * sizeof (uint32_t));
+			break;
+
+		case 4:
+			for (int i = 0; i < wholeBytes; i++, dstRow += 4)
+				memcpy (dstRow, expand + srcRow[i] * 4, 4 * sizeof (uint32_t));
+			break;
+
+		case 2:
+			for (int i = 0; i < wholeBytes; i++, dstRow += 2)
+				memcpy (dstRow, expand + srcRow[i] * 2, 2 * sizeof (uint32_t));
+			break;
+
+		default:
+			for (int i = 0; i < wholeBytes; i++)
+				*dstRow++ = expand[srcRow[i]];
+			break;
+	}
+
+	if (leftover)
+		memcpy (dstRow, expand + srcRow[wholeBytes] * perByte,
+				leftover * sizeof (uint32_t));
 }
 
 
@@ -1299,3 +1508,26 @@ EmPoint EmWindowQt::HostGetCurrentMouse (void)
 {
 	return EmPoint (fMouseX, fMouseY);
 }
+
+
+// ---------------------------------------------------------------------------
+//		EmWindowQt::FramePublished
+// ---------------------------------------------------------------------------
+// Called on the CPU thread each time EmScreen::CycleSlowly publishes a new
+// LCD frame.  Queue a call to HandleIdle on the UI thread so the frame is
+// painted as soon as possible, instead of at the next idle timer tick.
+// Only one call is queued at a time; if the UI falls behind, frames that
+// were published in the meantime are skipped.
+
+void EmWindowQt::FramePublished (void* refCon)
+{
+	EmWindowQt* window = (EmWindowQt*) refCon;
+
+	if (window->fFramePending.exchange (true))
+		return;
+
+	QMetaObject::invokeMethod (window, [window] () {
+		window->fFramePending = false;
+		window->HandleIdle ();
+	}, Qt::QueuedConnection);
+}
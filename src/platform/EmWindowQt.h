@@ -4,7 +4,9 @@
  * Threading model (matches original FLTK POSE):
  *   UI Thread  — Qt event loop, QWidget painting, mouse/key/menu events,
  *                QTimer fires HandleIdle() at ~10Hz
- *   CPU Thread — omnithread, runs PalmOS CPU emulation
+ *   CPU Thread — omnithread, runs PalmOS CPU emulation, and queues a
+ *                repaint on the UI thread each time EmScreen publishes
+ *                a new LCD frame (see FramePublished)
  *
  * NO bridge thread.  The UI thread directly drives HandleIdle() via QTimer,
  * exactly as FLTK's Fl::wait(0.1) + HandleIdle() did.
@@ -22,6 +24,8 @@
 #include <QWidget>
 #include <QImage>
 
+#include <atomic>
+
 class QMenu;
 
 #include "EmMenus.h"
@@ -71,6 +75,9 @@ private:
 	virtual void HostGetDefaultSkin (EmPixMap&, int scale) override;
 	virtual EmPoint HostGetCurrentMouse () override;
 
+	// Called on the CPU thread by EmScreen::CycleSlowly
+	static void FramePublished (void* refCon);
+
 	// Menu helpers
 	void buildQMenu (QMenu& qmenu, const EmMenuItemList& items);
 
@@ -78,6 +85,10 @@ private:
 	QImage emPixMapToQImage (const EmPixMap& pixmap,
 							 bool transparentLCD = false);
 
+	// Incremental LCD conversion (indexed formats only)
+	bool prepareLCDExpand (const EmPixMap& pixmap, bool transparentLCD);
+	void convertLCDLine (const EmPixMap& pixmap, int y);
+
 private:
 	// Screen state (only accessed from UI thread)
 	QImage fSkinImage;
@@ -102,6 +113,15 @@ private:
 	// Backlight tint overlay (transparent LCD mode)
 	QColor fLCDTint;
 	bool fLCDTintActive;
+
+	// Byte-to-pixels table for convertLCDLine, and what it was built for
+	std::vector<uint32_t> fLCDExpand;
+	RGBList fLCDExpandColors;
+	int fLCDExpandDepth;
+	bool fLCDExpandTransparent;
+
+	// Set while a repaint queued by FramePublished hasn't run yet
+	std::atomic<bool> fFramePending;
 };
 
 extern EmWindowQt* gHostWindow;
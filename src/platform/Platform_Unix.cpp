@@ -32,7 +32,9 @@
 extern "C++" const char* _ResGetString(int idx);
 
 #include "omnithread.h"			// omni_mutex
+#if !POSE_HEADLESS
 #include <X11/Xlib.h>			// XKeyboardControl, XBell, XFlush
+#endif
 
 using namespace std;
 
@@ -775,6 +777,16 @@ void Platform::ViewDrawPixel( int xPos, int yPos )
 }
 
 
+#if POSE_HEADLESS
+
+// No display connection in the headless build, so no beeps.
+
+static void PrvQueueNote (int, int, int)
+{
+}
+
+#else
+
 static Display* PrvGetX11Display()
 {
 	static Display* dpy = XOpenDisplay(nullptr);
@@ -820,6 +832,8 @@ static void PrvQueueNote (int frequency, int duration, int amplitude)
 	}
 }
 
+#endif	// POSE_HEADLESS
+
 
 CallROMType Platform::SndDoCmd (SndCommandType& cmd)
 {
@@ -850,10 +864,12 @@ void Platform::StopSound (void)
 
 void Platform::Beep (void)
 {
+#if !POSE_HEADLESS
 	Display* dpy = PrvGetX11Display();
 	if (dpy)
 	{
 		XBell (dpy, 100);
 		XFlush (dpy);
 	}
+#endif
 }
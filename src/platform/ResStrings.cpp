@@ -108,7 +108,7 @@ static const struct item _ResStrTable[] = {
 	{ kStr_ErrBitmapAccess, "%App just %op memory location %mem, which is in the \"%field\" field of the bitmap starting at %bitmap.\n\nThe data at this memory location is owned by the Palm OS. Applications should not access the data directly. Instead, they should make the appropriate Palm OS calls." },
 	{ kStr_ErrProscribedFunction, "%App just called Palm OS routine \"%function_name\".\n\nApplications should not call this function because %reason." },
 	{ kStr_ErrStepSpy, "%App just %op memory location %mem, changing it from %old_value to %new_value." },
-	{ kStr_ErrWatchpoint, "%App just %op memory location %mem, which is in the range from %watch_start to %watch_end specified in the Breakpoint dialog box." },
+	{ kStr_ErrWatchpoint, "%App just %op memory location %mem, which is in the watched range from %watch_start to %watch_end." },
 	{ kStr_ErrMemoryLeak, "Found %num_leaks memory leak for %app. Information concerning the leak can be found in the log file." },
 	{ kStr_ErrMemoryLeaks, "Found %num_leaks memory leaks for %app. Information concerning the leaks can be found in the log file." },
 
@@ -230,6 +230,9 @@ static const struct item _ResStrTable[] = {
 	{ kStr_MenuSpeedMax, "&Maximum" },
 	{ kStr_MenuTimerAccurate, "&Accurate Timers" },
 	{ kStr_MenuTimerLegacy, "&Legacy Timers" },
+	{ kStr_MenuCPUInterpreter, "&Interpreter" },
+	{ kStr_MenuCPUBlocks, "&Predecoded Blocks" },
+	{ kStr_MenuIdleFastForward, "&Fast-Forward Idle Time (Gremlins/Replay)" },
 	{ kStr_MenuSpeedManual, "Ma&nual..." },
 	{ kStr_MenuGremlinsNew, "&New...\tG" },
 	{ kStr_MenuGremlinsStep, "&Step" },
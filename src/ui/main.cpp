@@ -84,6 +84,8 @@ int main (int argc, char** argv)
 					QApplication::quit ();
 				}
 			});
+			// While the CPU is running, the LCD is also repainted for each
+			// new frame; see EmWindowQt::FramePublished.
 			idleTimer.start (100);  // ~10 Hz, matching FLTK's Fl::wait(0.1)
 
 			// Enter the Qt event loop
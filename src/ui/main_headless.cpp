@@ -0,0 +1,90 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* Entry point for pose64-headless.
+ *
+ * Same structure as main.cpp, but with a QCoreApplication and
+ * EmApplicationHeadless: no display connection, window, skin, or
+ * LCD updates.  Intended for running Gremlin Hordes in batch, e.g.
+ *
+ *   pose64-headless -psf session.psf -horde_first 0 -horde_last 9
+ *                   -horde_quit_when_done 1 ...
+ *
+ * The application quits when the Horde is done (or immediately, if the
+ * command line doesn't open a session).
+ */
+
+#include "EmCommon.h"
+#include "EmApplicationHeadless.h"
+#include "EmDocument.h"
+#include "PreferenceMgr.h"
+
+// Undefine Palm OS macros that conflict with Qt
+#undef daysInYear
+#undef monthsInYear
+
+#include <QCoreApplication>
+#include <QTimer>
+
+#include <cstdio>
+#include <exception>
+
+int main (int argc, char** argv)
+{
+	setvbuf (stderr, NULL, _IONBF, 0);  // unbuffered stderr for diagnostics
+
+	QCoreApplication qtApp (argc, argv);
+	qtApp.setApplicationName ("pose64");
+	qtApp.setOrganizationDomain ("ca.vibekoder");
+	qtApp.setOrganizationName ("VibeKoder");
+	qtApp.setApplicationVersion ("0.9.0");
+
+	EmulatorPreferences		prefs;
+	EmApplicationHeadless	theApp;
+
+	try
+	{
+		if (theApp.Startup (argc, argv))
+		{
+			theApp.Run ();
+
+			QTimer idleTimer;
+			QObject::connect (&idleTimer, &QTimer::timeout, [&]() {
+				try
+				{
+					if (theApp.GetTimeToQuit ())
+					{
+						QCoreApplication::quit ();
+						return;
+					}
+					theApp.HandleIdle ();
+				}
+				catch (const std::exception& e)
+				{
+					fprintf (stderr, "POSE64: Exception in idle handler: %s\n", e.what());
+					QCoreApplication::quit ();
+				}
+				catch (...)
+				{
+					fprintf (stderr, "POSE64: Unknown exception in idle handler\n");
+					QCoreApplication::quit ();
+				}
+			});
+			idleTimer.start (100);
+
+			qtApp.exec ();
+		}
+	}
+	catch (const std::exception& e)
+	{
+		fprintf (stderr, "POSE64: Fatal Internal Error: %s\n", e.what());
+	}
+	catch (...)
+	{
+		fprintf (stderr, "POSE64: Fatal Internal Error (unknown exception)\n");
+	}
+
+	theApp.Shutdown ();
+
+	return
+		gErrorHappened ? 2 :
+		gWarningHappened ? 1 : 0;
+}
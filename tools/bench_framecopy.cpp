@@ -0,0 +1,266 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* Frame copy benchmark for the bulk memory transfers.
+ *
+ * Times full LCD frames moving in and out of emulated RAM the way
+ * EmRegsVZ::GetLCDScanlines (through EmScreenUpdateInfo::FetchDirtyLines)
+ * and the screen clear and scroll code do, two ways:
+ *
+ *   per byte	one EmMemGet8/EmMemPut8 per byte, which is what
+ *				EmMem_memcpy, EmMem_memmove, and EmMem_memset used to do
+ *   spans		EmMem_memcpy, EmMem_memmove, and EmMem_memset as they are
+ *
+ * Both results are compared, so this doubles as a check that the span
+ * code moves the same bytes (including on WORDSWAP_MEMORY hosts).
+ *
+ * The "RAM" is a 1MB host buffer installed as plain pages, like
+ * EmBankSRAM's.  The frame buffer starts 4K before a page boundary so
+ * that every frame straddles two pages.  Build with -DPOSE_TOOLS=ON:
+ *
+ *   pose64-bench-framecopy [seconds per measurement]
+ */
+
+#include "EmCommon.h"
+#include "EmMemory.h"
+
+#include <chrono>				// steady_clock
+#include <cstdio>				// printf
+#include <cstdlib>				// atof
+#include <cstring>				// memcmp, memset
+#include <vector>				// vector
+
+using namespace std;
+
+static const uint32	kRAMSize		= 0x100000;
+static const emuptr	kFrameBase		= 0x0002F000;
+
+static uint8*		gRAM;
+static double		gSeconds		= 0.25;
+
+
+// ---------------------------------------------------------------------------
+//		� Bank handlers
+// ---------------------------------------------------------------------------
+// Only reached for accesses that the page table doesn't handle, which in
+// this benchmark means none; they're here because a bank must have them.
+
+static uint32 PrvGetLong (emuptr a)			{ return EmMemDoGet32 (gRAM + a); }
+static uint32 PrvGetWord (emuptr a)			{ return EmMemDoGet16 (gRAM + a); }
+static uint32 PrvGetByte (emuptr a)			{ return EmMemDoGet8 (gRAM + a); }
+static void PrvSetLong (emuptr a, uint32 v)	{ EmMemDoPut32 (gRAM + a, v); }
+static void PrvSetWord (emuptr a, uint32 v)	{ EmMemDoPut16 (gRAM + a, (uint16) v); }
+static void PrvSetByte (emuptr a, uint32 v)	{ EmMemDoPut8 (gRAM + a, (uint8) v); }
+static uint8* PrvTranslate (emuptr a)		{ return gRAM + a; }
+
+static int PrvCheck (emuptr a, uint32 size)
+{
+	return a < kRAMSize && size <= kRAMSize - a;
+}
+
+static EmAddressBank	gRAMBank =
+{
+	PrvGetLong, PrvGetWord, PrvGetByte,
+	PrvSetLong, PrvSetWord, PrvSetByte,
+	PrvTranslate, PrvCheck,
+	NULL, NULL
+};
+
+
+// ---------------------------------------------------------------------------
+//		� The old byte-at-a-time transfers
+// ---------------------------------------------------------------------------
+
+static void PrvByteCopyIn (uint8* dst, emuptr src, size_t len)
+{
+	while (len--)
+		*dst++ = (uint8) EmMemGet8 (src++);
+}
+
+static void PrvByteMove (emuptr dst, emuptr src, size_t len)
+{
+	if (dst < src)
+	{
+		while (len--)
+			EmMemPut8 (dst++, EmMemGet8 (src++));
+	}
+	else
+	{
+		while (len--)
+			EmMemPut8 (dst + len, EmMemGet8 (src + len));
+	}
+}
+
+static void PrvByteSet (emuptr dst, int val, size_t len)
+{
+	while (len--)
+		EmMemPut8 (dst++, (uint8) val);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvTime
+// ---------------------------------------------------------------------------
+// Run "op" repeatedly for gSeconds and return the number of frames per
+// second.
+
+template <class Op>
+static double PrvTime (Op op)
+{
+	typedef chrono::steady_clock	clock;
+
+	long			frames	= 0;
+	clock::time_point	start	= clock::now ();
+	double			elapsed	= 0;
+
+	do
+	{
+		op ();
+		++frames;
+		elapsed = chrono::duration<double> (clock::now () - start).count ();
+	}
+	while (elapsed < gSeconds);
+
+	return frames / elapsed;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvFillFrame
+// ---------------------------------------------------------------------------
+
+static void PrvFillFrame (emuptr base, size_t len)
+{
+	for (size_t ii = 0; ii < len; ++ii)
+		EmMemPut8 (base + ii, (uint8) (ii * 7 + (ii >> 8)));
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvReport
+// ---------------------------------------------------------------------------
+
+static void PrvReport (const char* what, size_t len,
+					   double before, double after, Bool same)
+{
+	printf ("  %-8s %9.0f frames/s %8.1f MB/s   %9.0f frames/s %8.1f MB/s   %5.1fx  %s\n",
+		what,
+		before, before * len / 1e6,
+		after, after * len / 1e6,
+		after / before,
+		same ? "same" : "DIFFERENT");
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvBenchFrame
+// ---------------------------------------------------------------------------
+// Returns false if the two versions of any transfer disagree.
+
+static Bool PrvBenchFrame (int32 width, int32 height, int32 depth)
+{
+	int32	rowBytes	= width * depth / 8;
+	size_t	len			= rowBytes * height;
+	emuptr	base		= kFrameBase;
+	emuptr	other		= kFrameBase + 0x40000 + 1;	// odd, for the swapped case
+	Bool	ok			= true;
+
+	vector<uint8>	before (len), after (len);
+
+	printf ("%ldx%ld, %ld bpp (%lu bytes per frame)\n",
+		(long) width, (long) height, (long) depth, (unsigned long) len);
+	printf ("  %-8s %-35s %s\n", "", "per byte", "spans");
+
+	// Frame buffer -> host image, as in FetchDirtyLines.
+
+	PrvFillFrame (base, len);
+
+	double	t0	= PrvTime ([&] { PrvByteCopyIn (&before[0], base, len); });
+	double	t1	= PrvTime ([&] { EmMem_memcpy ((void*) &after[0], base, len); });
+	Bool	same	= memcmp (&before[0], &after[0], len) == 0;
+
+	PrvReport ("fetch", len, t0, t1, same);
+	ok = ok && same;
+
+	// Scroll the frame up one line, emulated -> emulated, overlapping.
+
+	t0 = PrvTime ([&] { PrvByteMove (base, base + rowBytes, len - rowBytes); });
+	t1 = PrvTime ([&] { EmMem_memmove (base, base + rowBytes, len - rowBytes); });
+
+	PrvFillFrame (base, len);
+	PrvByteMove (base, base + rowBytes, len - rowBytes);
+	PrvByteCopyIn (&before[0], base, len);
+
+	PrvFillFrame (base, len);
+	EmMem_memmove (base, base + rowBytes, len - rowBytes);
+	PrvByteCopyIn (&after[0], base, len);
+
+	same = memcmp (&before[0], &after[0], len) == 0;
+	PrvReport ("scroll", len - rowBytes, t0, t1, same);
+	ok = ok && same;
+
+	// Copy the frame to an odd address, which word-swapped memory can't
+	// move wholesale.
+
+	PrvFillFrame (base, len);
+
+	t0 = PrvTime ([&] { PrvByteMove (other, base, len); });
+	PrvByteCopyIn (&before[0], other, len);
+
+	PrvByteSet (other, 0, len);
+	t1 = PrvTime ([&] { EmMem_memcpy (other, base, len); });
+	PrvByteCopyIn (&after[0], other, len);
+
+	same = memcmp (&before[0], &after[0], len) == 0;
+	PrvReport ("odd copy", len, t0, t1, same);
+	ok = ok && same;
+
+	// Clear the frame, starting at an odd byte.
+
+	t0 = PrvTime ([&] { PrvByteSet (base + 1, 0xA5, len - 1); });
+	PrvFillFrame (base, len);
+	PrvByteSet (base + 1, 0xA5, len - 1);
+	PrvByteCopyIn (&before[0], base, len);
+
+	t1 = PrvTime ([&] { EmMem_memset (base + 1, 0xA5, len - 1); });
+	PrvFillFrame (base, len);
+	EmMem_memset (base + 1, 0xA5, len - 1);
+	PrvByteCopyIn (&after[0], base, len);
+
+	same = memcmp (&before[0], &after[0], len) == 0;
+	PrvReport ("clear", len - 1, t0, t1, same);
+	ok = ok && same;
+
+	printf ("\n");
+
+	return ok;
+}
+
+
+int main (int argc, char** argv)
+{
+	if (argc > 1)
+		gSeconds = atof (argv[1]);
+
+	vector<uint8>	ram (kRAMSize);
+
+	gRAM = &ram[0];
+
+	Memory::InitializeBanks (gRAMBank, 0, kRAMSize >> 16, kEmMemRegionRAM);
+	Memory::InitializePages (0, kRAMSize >> 16, kEmMemPagePlainGet | kEmMemPagePlainSet);
+	Memory::UpdateAccessMasks ();
+
+#if !EMMEM_PAGE_TABLE
+	printf ("Note: this build has no direct page table (profiling?), so both\n"
+			"versions go through the bank functions.\n\n");
+#endif
+
+	Bool	ok = true;
+
+	ok = PrvBenchFrame (160, 160, 16) && ok;	// m515, m130
+	ok = PrvBenchFrame (160, 160, 4) && ok;		// m500, m505 grayscale
+	ok = PrvBenchFrame (320, 320, 16) && ok;	// high-density
+
+	if (!ok)
+		printf ("FAILED: the span transfers don't match the byte-at-a-time ones.\n");
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,320 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* Benchmark and check for the EmPixMap scanline converters.
+ *
+ * First checks that every SIMD level the host CPU supports produces the
+ * same bytes as the scalar converters, for every pair of formats that
+ * CopyRect converts between, at widths from 1 to 40 pixels (to reach the
+ * scalar tails) as well as at the LCD widths.  Then times full 160x160
+ * and 320x320 frames for every pair, at each SIMD level.
+ *
+ * Build with -DPOSE_TOOLS=ON:
+ *
+ *   pose64-bench-pixmap [seconds per measurement]
+ *
+ * A time of 0 skips the benchmark and runs only the check.
+ */
+
+#include "EmCommon.h"
+#include "EmPixMap.h"
+
+#include <chrono>				// steady_clock
+#include <cstdio>				// printf
+#include <cstdlib>				// atof
+#include <cstring>				// memcmp, memset
+#include <vector>				// vector
+
+using namespace std;
+
+static double		gSeconds	= 0.05;
+
+static const EmPixMapFormat	kFormats[] =
+{
+	kPixMapFormat1,
+	kPixMapFormat2,
+	kPixMapFormat4,
+	kPixMapFormat8,
+	kPixMapFormat24RGB,
+	kPixMapFormat24BGR,
+	kPixMapFormat32ARGB,
+	kPixMapFormat32ABGR,
+	kPixMapFormat32RGBA,
+	kPixMapFormat32BGRA
+};
+
+static const char*	kFormatNames[] =
+{
+	"1", "2", "4", "8",
+	"16RGB555", "16BGR555", "16RGB565", "16BGR565",
+	"24RGB", "24BGR",
+	"32ARGB", "32ABGR", "32RGBA", "32BGRA"
+};
+
+static const char*	kLevelNames[] =
+{
+	"scalar", "SSE2", "AVX2"
+};
+
+static const int	kNumFormats = sizeof (kFormats) / sizeof (kFormats[0]);
+
+
+// ---------------------------------------------------------------------------
+//		� PrvMakeColors
+// ---------------------------------------------------------------------------
+// A color table for an indexed depth: a gray ramp from white to black, as
+// on the grayscale devices, or for 8 bits, the 6x6x6 color cube followed
+// by grays, as in the Palm OS system palette.
+
+static RGBList PrvMakeColors (int depth)
+{
+	RGBList	colors;
+	int		numColors = 1 << depth;
+
+	if (depth < 8)
+	{
+		for (int ii = 0; ii < numColors; ++ii)
+		{
+			uint8	level = (uint8) (255 - ii * 255 / (numColors - 1));
+			colors.push_back (RGBType (level, level, level));
+		}
+	}
+	else
+	{
+		for (int ii = 0; ii < numColors; ++ii)
+		{
+			if (ii < 216)
+				colors.push_back (RGBType ((uint8) ((ii / 36) * 51),
+					(uint8) (((ii / 6) % 6) * 51), (uint8) ((ii % 6) * 51)));
+			else
+			{
+				uint8	level = (uint8) ((ii - 216) * 255 / 39);
+				colors.push_back (RGBType (level, level, level));
+			}
+		}
+	}
+
+	return colors;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvMakePixMap
+// ---------------------------------------------------------------------------
+
+static void PrvMakePixMap (EmPixMap& pixMap, EmPixMapFormat format,
+						   EmCoord width, EmCoord height)
+{
+	pixMap.SetFormat (format);
+	pixMap.SetSize (EmPoint (width, height));
+
+	if (pixMap.GetDepth () <= 8)
+		pixMap.SetColorTable (::PrvMakeColors (pixMap.GetDepth ()));
+
+	memset (pixMap.GetBits (), 0, pixMap.GetRowBytes () * height);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvFillPixMap
+// ---------------------------------------------------------------------------
+// Fill with pseudo-random bytes, the same ones every time.
+
+static void PrvFillPixMap (EmPixMap& pixMap)
+{
+	uint8*	bits	= (uint8*) pixMap.GetBits ();
+	long	size	= pixMap.GetRowBytes () * pixMap.GetSize ().fY;
+	uint32	seed	= 12345;
+
+	for (long ii = 0; ii < size; ++ii)
+	{
+		seed = seed * 1103515245 + 12345;
+		bits[ii] = (uint8) (seed >> 16);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvConvert
+// ---------------------------------------------------------------------------
+// Convert all of src into dest, which is cleared first so that any
+// padding at the end of the scanlines compares equal.
+
+static void PrvConvert (EmPixMap& dest, const EmPixMap& src)
+{
+	EmRect	rect (EmPoint (0, 0), src.GetSize ());
+
+	memset (dest.GetBits (), 0, dest.GetRowBytes () * dest.GetSize ().fY);
+	EmPixMap::CopyRect (dest, src, rect, rect);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvCheckPair
+// ---------------------------------------------------------------------------
+// Compare each SIMD level with the scalar converter for one format pair
+// and size.  Returns the number of mismatches.
+
+static int PrvCheckPair (EmPixMapFormat srcFormat, EmPixMapFormat destFormat,
+						 EmCoord width, EmCoord height, int hostLevel)
+{
+	EmPixMap	src, scalar, simd;
+
+	::PrvMakePixMap (src, srcFormat, width, height);
+	::PrvMakePixMap (scalar, destFormat, width, height);
+	::PrvMakePixMap (simd, destFormat, width, height);
+	::PrvFillPixMap (src);
+
+	EmPixMap::SetSIMDLevel (kPixMapSIMDNone);
+	::PrvConvert (scalar, src);
+
+	int		failures	= 0;
+	long	size		= scalar.GetRowBytes () * height;
+
+	for (int level = kPixMapSIMDSSE2; level <= hostLevel; ++level)
+	{
+		EmPixMap::SetSIMDLevel ((EmPixMapSIMDLevel) level);
+		::PrvConvert (simd, src);
+
+		if (memcmp (scalar.GetBits (), simd.GetBits (), size) != 0)
+		{
+			printf ("MISMATCH: %s -> %s, %ldx%ld, %s\n",
+				kFormatNames[srcFormat], kFormatNames[destFormat],
+				(long) width, (long) height, kLevelNames[level]);
+			++failures;
+		}
+	}
+
+	return failures;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvTimePair
+// ---------------------------------------------------------------------------
+// Microseconds per full-frame conversion at the given SIMD level.
+
+static double PrvTimePair (EmPixMap& dest, const EmPixMap& src, int level)
+{
+	typedef chrono::steady_clock	clock;
+
+	EmRect	rect (EmPoint (0, 0), src.GetSize ());
+	long	frames	= 0;
+	double	elapsed	= 0;
+
+	EmPixMap::SetSIMDLevel ((EmPixMapSIMDLevel) level);
+
+	clock::time_point	start = clock::now ();
+
+	do
+	{
+		EmPixMap::CopyRect (dest, src, rect, rect);
+		++frames;
+		elapsed = chrono::duration<double> (clock::now () - start).count ();
+	}
+	while (elapsed < gSeconds);
+
+	return elapsed * 1e6 / frames;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvBenchSize
+// ---------------------------------------------------------------------------
+
+static void PrvBenchSize (EmCoord width, EmCoord height, int hostLevel)
+{
+	printf ("\n%ldx%ld, microseconds per frame\n", (long) width, (long) height);
+	printf ("  %-18s", "src -> dest");
+
+	for (int level = kPixMapSIMDNone; level <= hostLevel; ++level)
+		printf (" %9s", kLevelNames[level]);
+
+	printf ("\n");
+
+	for (int ss = 0; ss < kNumFormats; ++ss)
+	{
+		EmPixMap	src;
+
+		::PrvMakePixMap (src, kFormats[ss], width, height);
+		::PrvFillPixMap (src);
+
+		for (int dd = 0; dd < kNumFormats; ++dd)
+		{
+			EmPixMap	dest;
+			char		name[32];
+
+			::PrvMakePixMap (dest, kFormats[dd], width, height);
+
+			sprintf (name, "%s -> %s",
+				kFormatNames[kFormats[ss]], kFormatNames[kFormats[dd]]);
+			printf ("  %-18s", name);
+
+			double	scalar = 0;
+
+			for (int level = kPixMapSIMDNone; level <= hostLevel; ++level)
+			{
+				double	us = ::PrvTimePair (dest, src, level);
+
+				if (level == kPixMapSIMDNone)
+					scalar = us;
+
+				printf (" %9.1f", us);
+			}
+
+			// Speedup of the converter CopyRect normally picks.
+
+			printf ("   %4.1fx\n", scalar / ::PrvTimePair (dest, src, hostLevel));
+		}
+	}
+}
+
+
+int main (int argc, char** argv)
+{
+	if (argc > 1)
+		gSeconds = atof (argv[1]);
+
+	int		hostLevel	= EmPixMap::GetSIMDLevel ();
+	int		failures	= 0;
+	int		checks		= 0;
+
+	printf ("Host SIMD level: %s\n", kLevelNames[hostLevel]);
+
+	// Check.
+
+	static const EmCoord	kCheckWidths[] = { 160, 320 };
+
+	for (int ss = 0; ss < kNumFormats; ++ss)
+	{
+		for (int dd = 0; dd < kNumFormats; ++dd)
+		{
+			for (EmCoord width = 1; width <= 40; ++width)
+			{
+				failures += ::PrvCheckPair (kFormats[ss], kFormats[dd], width, 3, hostLevel);
+				++checks;
+			}
+
+			for (size_t ww = 0; ww < sizeof (kCheckWidths) / sizeof (kCheckWidths[0]); ++ww)
+			{
+				EmCoord	width = kCheckWidths[ww];
+
+				failures += ::PrvCheckPair (kFormats[ss], kFormats[dd], width, width, hostLevel);
+				++checks;
+			}
+		}
+	}
+
+	printf ("Checked %d format pairs and sizes against the scalar converters: %d mismatches.\n",
+		checks, failures);
+
+	// Benchmark.
+
+	if (gSeconds > 0)
+	{
+		PrvBenchSize (160, 160, hostLevel);
+		PrvBenchSize (320, 320, hostLevel);
+	}
+
+	EmPixMap::SetSIMDLevel (kPixMapSIMDAVX2);
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,451 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* Check of the lazy 68K condition codes against the eager ones.
+ *
+ * Runs every opcode in the handler table on the same pseudo-random
+ * registers, memory, extension words, and initial condition codes, and
+ * records for each run the resulting X, N, Z, V, and C bits and a checksum
+ * of the registers, PC, SR, and every byte written to memory.  Each opcode
+ * is run eight times; most runs are preceded by an ADD, SUB, CMP, AND, or
+ * NEG so that the opcode starts with that instruction's condition codes
+ * still pending, which is how it usually finds them.
+ *
+ * -DPOSE_TOOLS=ON builds this twice:
+ *
+ *   pose64-check-lazyflags		with src/core/UAE/cpuemu.c, whose handlers
+ *								record their operands (PALM_LAZY_FLAGS in
+ *								gencpu.c) for m68k_flush_flags
+ *   pose64-check-eagerflags	with a cpuemu.c that gencpu generates at
+ *								build time with PALM_LAZY_FLAGS=0, whose
+ *								handlers compute the condition codes as they
+ *								go, as they used to
+ *
+ * The "eagerflags" test writes the eager results to a file and the
+ * "lazyflags" test compares the lazy ones with it:
+ *
+ *   pose64-check-eagerflags -o eagerflags.txt
+ *   pose64-check-lazyflags -c eagerflags.txt
+ *
+ * With no arguments, the results are written to stdout.
+ *
+ * Memory is simulated: every address reads as a byte derived from the
+ * address and the run, unless the run has written it.  Opcodes whose
+ * handler is op_illg (line A, line F, and the unassigned ones) are not
+ * run, nor is RESET; both need an emulator session.
+ */
+
+#include "EmCommon.h"
+#include "EmCPU68K.h"
+#include "EmMemory.h"
+#include "UAE.h"
+
+#include <cstdio>				// printf, sprintf, fopen, fgets
+#include <cstring>				// strcmp, strncmp
+#include <utility>				// pair
+#include <vector>				// vector
+
+using namespace std;
+
+static const int		kNumRuns		= 8;
+static const emuptr		kCodeAddress	= 0x00010000;
+static const int		kMaxReported	= 50;
+
+struct PreludeType
+{
+	uint16		opcode;
+	const char*	name;
+};
+
+static const PreludeType	kPreludes[] =
+{
+	{ 0x0000, "nothing" },
+	{ 0xDE86, "ADD.L D6,D7" },
+	{ 0x9E46, "SUB.W D6,D7" },
+	{ 0xBE06, "CMP.B D6,D7" },
+	{ 0xCE86, "AND.L D6,D7" },
+	{ 0x4487, "NEG.L D7" }
+};
+
+static const int	kNumPreludes	= sizeof (kPreludes) / sizeof (kPreludes[0]);
+
+// Initial XNZVC for each run, so that every bit starts both clear and set
+// with and without a prelude.
+
+static const uint16	kInitialCCR[kNumRuns] =
+{
+	0x00, 0x1F, 0x10, 0x0F, 0x15, 0x0A, 0x11, 0x04
+};
+
+// Register values that put the carries and overflows at the edges.
+
+static const uint32	kEdgeValues[] =
+{
+	0x00000000, 0x00000001, 0x0000007F, 0x00000080, 0x000000FF,
+	0x00007FFF, 0x00008000, 0x0000FFFF, 0x7FFFFFFF, 0x80000000,
+	0xFFFFFF80, 0xFFFF8000, 0xFFFFFFFF
+};
+
+static const int	kNumEdgeValues	= sizeof (kEdgeValues) / sizeof (kEdgeValues[0]);
+
+static uint32		gRandom;
+static uint32		gMemorySeed;
+static uint16		gCode[16];
+static uint8		gScratch[256];
+
+static vector<pair<emuptr, uint8> >	gWrites;
+
+
+// ---------------------------------------------------------------------------
+//		� PrvRandom
+// ---------------------------------------------------------------------------
+
+static uint32 PrvRandom (void)
+{
+	gRandom ^= gRandom << 13;
+	gRandom ^= gRandom >> 17;
+	gRandom ^= gRandom << 5;
+
+	return gRandom;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvOperand
+// ---------------------------------------------------------------------------
+// A register value: one time in four, one of the edge values.
+
+static uint32 PrvOperand (void)
+{
+	uint32	rr = PrvRandom ();
+
+	if ((rr & 3) == 0)
+		return kEdgeValues[(rr >> 2) % kNumEdgeValues];
+
+	return PrvRandom ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		� Bank handlers
+// ---------------------------------------------------------------------------
+// One bank covers the whole address space.  Reads see the last byte this run
+// wrote there, or else a byte that depends only on the address and the run
+// (zero one time in sixteen).  Writes are kept in gWrites, in order, which
+// is also how they get into the checksum.
+
+static uint8 PrvGetMemory (emuptr a)
+{
+	for (size_t ii = gWrites.size (); ii > 0; --ii)
+	{
+		if (gWrites[ii - 1].first == a)
+			return gWrites[ii - 1].second;
+	}
+
+	uint32	xx = (a ^ gMemorySeed) * 0x9E3779B1;
+
+	xx ^= xx >> 15;
+
+	return (xx & 0x0F) == 0 ? 0 : (uint8) (xx >> 24);
+}
+
+static void PrvPutMemory (emuptr a, uint8 v)
+{
+	gWrites.push_back (make_pair (a, v));
+}
+
+static uint32 PrvGetLong (emuptr a)
+{
+	return	((uint32) PrvGetMemory (a + 0) << 24) | ((uint32) PrvGetMemory (a + 1) << 16) |
+			((uint32) PrvGetMemory (a + 2) << 8) | PrvGetMemory (a + 3);
+}
+
+static uint32 PrvGetWord (emuptr a)
+{
+	return ((uint32) PrvGetMemory (a + 0) << 8) | PrvGetMemory (a + 1);
+}
+
+static uint32 PrvGetByte (emuptr a)
+{
+	return PrvGetMemory (a);
+}
+
+static void PrvSetLong (emuptr a, uint32 v)
+{
+	PrvPutMemory (a + 0, (uint8) (v >> 24));
+	PrvPutMemory (a + 1, (uint8) (v >> 16));
+	PrvPutMemory (a + 2, (uint8) (v >> 8));
+	PrvPutMemory (a + 3, (uint8) v);
+}
+
+static void PrvSetWord (emuptr a, uint32 v)
+{
+	PrvPutMemory (a + 0, (uint8) (v >> 8));
+	PrvPutMemory (a + 1, (uint8) v);
+}
+
+static void PrvSetByte (emuptr a, uint32 v)
+{
+	PrvPutMemory (a, (uint8) v);
+}
+
+// Branches, jumps, and exceptions leave the PC pointing here; nothing
+// executes from it.
+
+static uint8* PrvTranslate (emuptr)
+{
+	return gScratch;
+}
+
+static int PrvCheck (emuptr, uint32)
+{
+	return false;
+}
+
+static EmAddressBank	gBank =
+{
+	PrvGetLong, PrvGetWord, PrvGetByte,
+	PrvSetLong, PrvSetWord, PrvSetByte,
+	PrvTranslate, PrvCheck,
+	PrvTranslate, NULL
+};
+
+
+// ---------------------------------------------------------------------------
+//		� PrvChecksum
+// ---------------------------------------------------------------------------
+// FNV-1a, a word at a time.
+
+static void PrvChecksum (uint32& sum, uint32 value)
+{
+	sum = (sum ^ value) * 0x01000193;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvRun
+// ---------------------------------------------------------------------------
+// Run one opcode once.  Returns XNZVC in the low five bits of "ccr" and a
+// checksum of everything else the opcode could have changed in "sum".
+
+static void PrvRun (uint16 opcode, int run, uint16& ccr, uint32& sum)
+{
+	const PreludeType&	prelude = kPreludes[run % kNumPreludes];
+
+	gRandom		= 0x12345678 ^ (opcode << 8) ^ run;
+	gMemorySeed	= PrvRandom ();
+	gWrites.clear ();
+
+	// The prelude, the opcode, and its extension words.
+
+	int		start	= 1;
+
+	gCode[1] = opcode;
+
+	if (prelude.opcode != 0)
+	{
+		gCode[0] = prelude.opcode;
+		start = 0;
+	}
+
+	for (int ii = 2; ii < (int) (sizeof (gCode) / sizeof (gCode[0])); ++ii)
+	{
+		gCode[ii] = (uint16) PrvRandom ();
+	}
+
+	// Registers, in supervisor mode so that the privileged instructions
+	// run rather than trap.
+
+	for (int ii = 0; ii < 16; ++ii)
+	{
+		regs.regs[ii] = PrvOperand ();
+	}
+
+	regs.usp		= PrvOperand ();
+	regs.isp		= m68k_areg (regs, 7);
+	regs.vbr		= 0;
+	regs.s			= 1;
+	regs.sr			= 0x2700 | kInitialCCR[run];
+	regs.stopped	= 0;
+	regs.spcflags	= 0;
+
+	MakeFromSR ();
+
+	regs.spcflags	= 0;
+	regs.pc			= kCodeAddress + start * 2;
+	regs.pc_p		= (uint8*) &gCode[start];
+	regs.pc_oldp	= regs.pc_p;
+	regs.pc_meta_oldp = gScratch;
+
+	if (prelude.opcode != 0)
+	{
+		(*cpufunctbl[prelude.opcode]) (prelude.opcode);
+	}
+
+	(*cpufunctbl[opcode]) (opcode);
+
+	MakeSR ();
+
+	ccr = regs.sr & 0x1F;
+	sum = 0x811C9DC5;
+
+	for (int ii = 0; ii < 16; ++ii)
+	{
+		::PrvChecksum (sum, regs.regs[ii]);
+	}
+
+	::PrvChecksum (sum, regs.usp);
+	::PrvChecksum (sum, regs.isp);
+	::PrvChecksum (sum, regs.sr);
+	::PrvChecksum (sum, m68k_getpc ());
+	::PrvChecksum (sum, regs.stopped);
+
+	for (size_t ii = 0; ii < gWrites.size (); ++ii)
+	{
+		::PrvChecksum (sum, gWrites[ii].first);
+		::PrvChecksum (sum, gWrites[ii].second);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvFormatLine
+// ---------------------------------------------------------------------------
+// One line per opcode: the opcode, then XNZVC:checksum for each run.
+
+static void PrvFormatLine (uint16 opcode, char* line)
+{
+	line += sprintf (line, "%04X", opcode);
+
+	for (int run = 0; run < kNumRuns; ++run)
+	{
+		uint16	ccr;
+		uint32	sum;
+
+		::PrvRun (opcode, run, ccr, sum);
+
+		line += sprintf (line, " %d%d%d%d%d:%08lX",
+			(ccr >> 4) & 1, (ccr >> 3) & 1, (ccr >> 2) & 1, (ccr >> 1) & 1, ccr & 1,
+			(unsigned long) sum);
+	}
+
+	strcpy (line, "\n");
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvReportMismatch
+// ---------------------------------------------------------------------------
+// Describe each run in which "line" and "refLine" differ.
+
+static void PrvReportMismatch (const char* line, const char* refLine,
+							   const char* refName)
+{
+	static const int	kOpcodeLength	= 4;
+	static const int	kRunLength		= 15;	// " XNZVC:checksum"
+
+	for (int run = 0; run < kNumRuns; ++run)
+	{
+		const char*	mine	= line + kOpcodeLength + run * kRunLength + 1;
+		const char*	theirs	= refLine + kOpcodeLength + run * kRunLength + 1;
+
+		if (strlen (theirs) < (size_t) kRunLength - 1 || strncmp (mine, theirs, kRunLength - 1) != 0)
+		{
+			printf ("MISMATCH: opcode %.4s run %d (after %s, XNZVC in %d%d%d%d%d): "
+				"XNZVC:checksum %.14s here, %.14s in %s\n",
+				line, run, kPreludes[run % kNumPreludes].name,
+				(kInitialCCR[run] >> 4) & 1, (kInitialCCR[run] >> 3) & 1,
+				(kInitialCCR[run] >> 2) & 1, (kInitialCCR[run] >> 1) & 1,
+				kInitialCCR[run] & 1,
+				mine, theirs, refName);
+		}
+	}
+}
+
+
+int main (int argc, char** argv)
+{
+	const char*	outName	= NULL;
+	const char*	refName	= NULL;
+
+	if (argc == 3 && strcmp (argv[1], "-o") == 0)
+		outName = argv[2];
+	else if (argc == 3 && strcmp (argv[1], "-c") == 0)
+		refName = argv[2];
+	else if (argc != 1)
+	{
+		printf ("usage: %s [-o output | -c reference]\n", argv[0]);
+		return 2;
+	}
+
+	FILE*	out	= stdout;
+	FILE*	ref	= NULL;
+
+	if (outName && (out = fopen (outName, "w")) == NULL)
+	{
+		printf ("Can't create %s.\n", outName);
+		return 2;
+	}
+
+	if (refName && (ref = fopen (refName, "r")) == NULL)
+	{
+		printf ("Can't open %s.\n", refName);
+		return 2;
+	}
+
+	Memory::InitializeBanks (gBank, 0, 65536, kEmMemRegionRAM);
+	Memory::UpdateAccessMasks ();
+
+	EmCPU68K	cpu (NULL);
+
+	long	opcodes		= 0;
+	long	mismatches	= 0;
+	char	line[512];
+	char	refLine[512];
+
+	for (uint32 opcode = 0; opcode < 65536; ++opcode)
+	{
+		if (cpufunctbl[opcode] == op_illg || opcode == 0x4E70)	// RESET
+			continue;
+
+		::PrvFormatLine ((uint16) opcode, line);
+		++opcodes;
+
+		if (!ref)
+		{
+			fputs (line, out);
+			continue;
+		}
+
+		if (fgets (refLine, sizeof (refLine), ref) == NULL)
+			strcpy (refLine, "");
+
+		if (strcmp (line, refLine) != 0)
+		{
+			if (++mismatches > kMaxReported)
+				continue;
+
+			if (strncmp (line, refLine, 4) != 0)
+				printf ("MISMATCH: opcode %.4s is not the next opcode in %s.\n", line, refName);
+			else
+				::PrvReportMismatch (line, refLine, refName);
+		}
+	}
+
+	if (ref)
+	{
+		if (fgets (refLine, sizeof (refLine), ref) != NULL)
+		{
+			printf ("MISMATCH: %s has results for more opcodes than this build runs.\n", refName);
+			++mismatches;
+		}
+
+		printf ("Compared %ld opcodes, %d runs each, with %s: %ld mismatched.\n",
+			opcodes, kNumRuns, refName, mismatches);
+
+		fclose (ref);
+	}
+
+	if (outName)
+		fclose (out);
+
+	return mismatches == 0 ? 0 : 1;
+}
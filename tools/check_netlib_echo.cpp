@@ -0,0 +1,418 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* Loopback echo check for the redirected NetLib's retry path.
+ *
+ * Starts a TCP echo server on 127.0.0.1 in a host thread, then talks to it
+ * through Platform_NetLib the way the NetLib head patches do: before each
+ * Send, Receive, or Select, Platform_NetLib::MustWait (or MustWaitForSelect)
+ * is asked if the call would block.  Where the head patch would return
+ * kRetryCall and the CPU would park until the next tick, this program
+ * advances hwrCurTicks by one and sleeps for a tick instead, then makes the
+ * call again from the start, with the original timeout.
+ *
+ * The server holds each echo back for a few ticks, so every Receive has to
+ * be retried at least once.  The bytes that come back must be the ones
+ * that were sent.  Last, a Receive with nothing to receive must time out
+ * after its timeout in (emulated) ticks, with netErrTimeout.
+ *
+ * Low memory is a 64K host buffer, so that there is an hwrCurTicks, and
+ * the CPU is only there for its stack pointer and interrupt mask.  Build
+ * with -DPOSE_TOOLS=ON:
+ *
+ *   pose64-check-netlib-echo
+ */
+
+#include "EmCommon.h"
+#include "EmCPU68K.h"
+#include "EmLowMem.h"
+#include "EmMemory.h"
+#include "Platform_NetLib.h"
+
+#include <arpa/inet.h>			// htonl
+#include <netinet/in.h>			// sockaddr_in
+#include <sys/socket.h>			// socket, bind, listen, accept
+#include <unistd.h>				// close
+
+#include <chrono>				// milliseconds
+#include <cstdio>				// printf
+#include <cstring>				// memcmp, memset
+#include <thread>				// thread, sleep_for
+#include <vector>				// vector
+
+using namespace std;
+
+static const uint32		kRAMSize		= 0x10000;
+static const emuptr		kStackTop		= 0x00008000;
+static const UInt16		kLibRefNum		= 0;
+static const int		kTickMs			= 10;		// a device tick
+static const Int32		kCallTimeout	= 500;		// ticks
+static const Int32		kShortTimeout	= 3;		// ticks
+static const int		kEchoDelay		= 3;		// ticks
+static const int		kNumChunks		= 16;
+static const UInt16		kChunkSize		= 1500;
+static const long		kMaxRetries		= 1000;
+
+static uint8*			gRAM;
+static long				gRetries;
+
+
+// ---------------------------------------------------------------------------
+//		� Bank handlers
+// ---------------------------------------------------------------------------
+// Low memory, for the hwrCurTicks that PrvWaitPending reads.
+
+static uint32 PrvGetLong (emuptr a)			{ return EmMemDoGet32 (gRAM + a); }
+static uint32 PrvGetWord (emuptr a)			{ return EmMemDoGet16 (gRAM + a); }
+static uint32 PrvGetByte (emuptr a)			{ return EmMemDoGet8 (gRAM + a); }
+static void PrvSetLong (emuptr a, uint32 v)	{ EmMemDoPut32 (gRAM + a, v); }
+static void PrvSetWord (emuptr a, uint32 v)	{ EmMemDoPut16 (gRAM + a, (uint16) v); }
+static void PrvSetByte (emuptr a, uint32 v)	{ EmMemDoPut8 (gRAM + a, (uint8) v); }
+static uint8* PrvTranslate (emuptr a)		{ return gRAM + a; }
+
+static int PrvCheck (emuptr a, uint32 size)
+{
+	return a < kRAMSize && size <= kRAMSize - a;
+}
+
+static EmAddressBank	gRAMBank =
+{
+	PrvGetLong, PrvGetWord, PrvGetByte,
+	PrvSetLong, PrvSetWord, PrvSetByte,
+	PrvTranslate, PrvCheck,
+	NULL, NULL
+};
+
+
+// ---------------------------------------------------------------------------
+//		� PrvSleepTicks
+// ---------------------------------------------------------------------------
+
+static void PrvSleepTicks (int ticks)
+{
+	this_thread::sleep_for (chrono::milliseconds (ticks * kTickMs));
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvEchoServer
+// ---------------------------------------------------------------------------
+// Accept one connection and send back everything received on it, each
+// piece kEchoDelay ticks late, until the other end shuts down.
+
+static void PrvEchoServer (int listener)
+{
+	int		s = accept (listener, NULL, NULL);
+
+	if (s < 0)
+		return;
+
+	char	buffer[4096];
+	ssize_t	len;
+
+	while ((len = recv (s, buffer, sizeof (buffer), 0)) > 0)
+	{
+		PrvSleepTicks (kEchoDelay);
+
+		ssize_t	offset = 0;
+
+		while (offset < len)
+		{
+			ssize_t	sent = send (s, buffer + offset, len - offset, 0);
+
+			if (sent <= 0)
+				break;
+
+			offset += sent;
+		}
+	}
+
+	close (s);
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvPark
+// ---------------------------------------------------------------------------
+// Stand-in for returning kRetryCall: the CPU would stop until the next
+// tick, and the system call would then be made again.
+
+static Bool PrvPark (void)
+{
+	if (++gRetries > kMaxRetries)
+	{
+		printf ("FAILED: still waiting after %ld retries.\n", gRetries);
+		return false;
+	}
+
+	EmLowMem_SetGlobal (hwrCurTicks, EmLowMem_GetGlobal (hwrCurTicks) + 1);
+	PrvSleepTicks (1);
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvSend
+// ---------------------------------------------------------------------------
+
+static Int16 PrvSend (NetSocketRef sRef, const uint8* buffer, UInt16 len,
+					  Int32 timeout, Err& err)
+{
+	for (;;)
+	{
+		Int32	hostTimeout = timeout;
+
+		if (!Platform_NetLib::MustWait (kLibRefNum, sRef, true, hostTimeout))
+			return Platform_NetLib::Send (kLibRefNum, sRef, (MemPtr) buffer, len,
+				0, NULL, 0, hostTimeout, &err);
+
+		if (!::PrvPark ())
+			return -1;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvReceive
+// ---------------------------------------------------------------------------
+
+static Int16 PrvReceive (NetSocketRef sRef, uint8* buffer, UInt16 len,
+						 Int32 timeout, Err& err)
+{
+	for (;;)
+	{
+		Int32	hostTimeout = timeout;
+
+		if (!Platform_NetLib::MustWait (kLibRefNum, sRef, false, hostTimeout))
+			return Platform_NetLib::Receive (kLibRefNum, sRef, buffer, len,
+				0, NULL, NULL, hostTimeout, &err);
+
+		if (!::PrvPark ())
+			return -1;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvSelectRead
+// ---------------------------------------------------------------------------
+
+static Int16 PrvSelectRead (NetSocketRef sRef, Int32 timeout, Err& err)
+{
+	for (;;)
+	{
+		Int32			hostTimeout = timeout;
+		NetFDSetType	readFDs;
+
+		netFDZero (&readFDs);
+		netFDSet (sRef, &readFDs);
+
+		if (!Platform_NetLib::MustWaitForSelect (kLibRefNum, sRef + 1,
+				&readFDs, NULL, NULL, hostTimeout))
+			return Platform_NetLib::Select (kLibRefNum, sRef + 1,
+				&readFDs, NULL, NULL, hostTimeout, &err);
+
+		if (!::PrvPark ())
+			return -1;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvEcho
+// ---------------------------------------------------------------------------
+// Send kNumChunks pieces of pseudo-random data and check that each comes
+// back whole.  Every other piece waits in Select before it's received.
+
+static Bool PrvEcho (NetSocketRef sRef)
+{
+	uint32	seed = 12345;
+
+	for (int chunk = 0; chunk < kNumChunks; ++chunk)
+	{
+		vector<uint8>	sent (kChunkSize), received (kChunkSize);
+
+		for (UInt16 ii = 0; ii < kChunkSize; ++ii)
+		{
+			seed = seed * 1103515245 + 12345;
+			sent[ii] = (uint8) (seed >> 16);
+		}
+
+		Err		err;
+		Int16	result = ::PrvSend (sRef, &sent[0], kChunkSize, kCallTimeout, err);
+
+		if (result != kChunkSize)
+		{
+			printf ("FAILED: chunk %d: Send returned %d, error 0x%04X.\n",
+				chunk, (int) result, (int) err);
+			return false;
+		}
+
+		long	retriesBefore = gRetries;
+
+		if ((chunk & 1) != 0)
+		{
+			result = ::PrvSelectRead (sRef, kCallTimeout, err);
+
+			if (result != 1)
+			{
+				printf ("FAILED: chunk %d: Select returned %d, error 0x%04X.\n",
+					chunk, (int) result, (int) err);
+				return false;
+			}
+		}
+
+		UInt16	offset = 0;
+
+		while (offset < kChunkSize)
+		{
+			result = ::PrvReceive (sRef, &received[offset], kChunkSize - offset,
+				kCallTimeout, err);
+
+			if (result <= 0)
+			{
+				printf ("FAILED: chunk %d: Receive returned %d, error 0x%04X.\n",
+					chunk, (int) result, (int) err);
+				return false;
+			}
+
+			offset += result;
+		}
+
+		if (gRetries == retriesBefore)
+		{
+			printf ("FAILED: chunk %d was received without being retried.\n", chunk);
+			return false;
+		}
+
+		if (memcmp (&sent[0], &received[0], kChunkSize) != 0)
+		{
+			printf ("FAILED: chunk %d came back different.\n", chunk);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		� PrvTimeOut
+// ---------------------------------------------------------------------------
+// With nothing coming back, a Receive must give up after its timeout.
+
+static Bool PrvTimeOut (NetSocketRef sRef)
+{
+	uint8	buffer[16];
+	Err		err;
+	uint32	start		= EmLowMem_GetGlobal (hwrCurTicks);
+	Int16	result		= ::PrvReceive (sRef, buffer, sizeof (buffer), kShortTimeout, err);
+	uint32	elapsed		= EmLowMem_GetGlobal (hwrCurTicks) - start;
+
+	if (result != -1 || err != netErrTimeout)
+	{
+		printf ("FAILED: idle Receive returned %d, error 0x%04X, not netErrTimeout.\n",
+			(int) result, (int) err);
+		return false;
+	}
+
+	if (elapsed != (uint32) kShortTimeout)
+	{
+		printf ("FAILED: idle Receive timed out after %lu ticks, not %ld.\n",
+			(unsigned long) elapsed, (long) kShortTimeout);
+		return false;
+	}
+
+	return true;
+}
+
+
+int main (int, char**)
+{
+	vector<uint8>	ram (kRAMSize);
+
+	gRAM = &ram[0];
+
+	Memory::InitializeBanks (gRAMBank, 0, kRAMSize >> 16, kEmMemRegionRAM);
+	Memory::UpdateAccessMasks ();
+
+	EmLowMem_SetGlobal (hwrCurTicks, 1000);
+
+	// Supervisor mode, interrupts enabled, as in a system call.
+
+	EmCPU68K	cpu (NULL);
+
+	cpu.SetRegister (e68KRegID_SR, 0x2000);
+	cpu.SetRegister (e68KRegID_SSP, kStackTop);
+
+	// The echo server.
+
+	int		listener = socket (AF_INET, SOCK_STREAM, 0);
+	sockaddr_in	addr;
+	socklen_t	addrLen = sizeof (addr);
+
+	memset (&addr, 0, sizeof (addr));
+	addr.sin_family			= AF_INET;
+	addr.sin_addr.s_addr	= htonl (INADDR_LOOPBACK);
+	addr.sin_port			= 0;
+
+	if (listener < 0 ||
+		bind (listener, (sockaddr*) &addr, sizeof (addr)) != 0 ||
+		listen (listener, 1) != 0 ||
+		getsockname (listener, (sockaddr*) &addr, &addrLen) != 0)
+	{
+		printf ("Can't start the echo server.\n");
+		return 2;
+	}
+
+	thread	server (PrvEchoServer, listener);
+
+	// The client, through NetLib.
+
+	Bool				ok		= false;
+	UInt16				ifErrs;
+	Err					err;
+	NetSocketAddrINType	netAddr;
+
+	netAddr.family	= netSocketAddrINET;
+	netAddr.port	= addr.sin_port;
+	netAddr.addr	= addr.sin_addr.s_addr;
+
+	Platform_NetLib::Open (kLibRefNum, &ifErrs);
+
+	NetSocketRef	sRef = Platform_NetLib::SocketOpen (kLibRefNum,
+		netSocketAddrINET, netSocketTypeStream, 0, kCallTimeout, &err);
+
+	if (sRef < 0)
+	{
+		printf ("FAILED: SocketOpen: error 0x%04X.\n", (int) err);
+	}
+	else if (Platform_NetLib::SocketConnect (kLibRefNum, sRef,
+		(NetSocketAddrType*) &netAddr, sizeof (netAddr), kCallTimeout, &err) != 0)
+	{
+		printf ("FAILED: SocketConnect: error 0x%04X.\n", (int) err);
+	}
+	else
+	{
+		ok = ::PrvEcho (sRef) && ::PrvTimeOut (sRef);
+
+		printf ("Echoed %d chunks of %d bytes over loopback with %ld retries: %s.\n",
+			kNumChunks, (int) kChunkSize, gRetries, ok ? "OK" : "FAILED");
+
+		Platform_NetLib::SocketShutdown (kLibRefNum, sRef, netSocketDirBoth,
+			kCallTimeout, &err);
+	}
+
+	if (sRef >= 0)
+		Platform_NetLib::SocketClose (kLibRefNum, sRef, kCallTimeout, &err);
+
+	Platform_NetLib::Close (kLibRefNum, false);
+	Platform_NetLib::Dispose ();
+
+	// Unblock the server if the connection never happened.
+
+	shutdown (listener, SHUT_RDWR);
+	server.join ();
+	close (listener);
+
+	return ok ? 0 : 1;
+}